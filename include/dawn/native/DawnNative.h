@@ -253,6 +253,20 @@ namespace dawn::native {
     DAWN_NATIVE_EXPORT bool BindGroupLayoutBindingsEqualForTesting(WGPUBindGroupLayout a,
                                                                    WGPUBindGroupLayout b);
 
+    // Returns the peak size in bytes of the intermediate operands of the graph as planned at
+    // build time, with the memory of the operands whose lifetimes don't overlap reused.
+    DAWN_NATIVE_EXPORT uint64_t GetIntermediateMemorySize(WGPUGraph graph);
+
+    // Optimizes the graph computing |namedOperands| and serializes it with its constants to the
+    // file at |path|. Returns false if the graph can't be serialized.
+    DAWN_NATIVE_EXPORT bool SerializeGraph(WGPUGraphBuilder builder,
+                                           WGPUNamedOperands namedOperands,
+                                           const char* path);
+
+    // Builds a graph from the file written by SerializeGraph. The constants are mapped from the
+    // file instead of being read into memory.
+    DAWN_NATIVE_EXPORT WGPUGraph LoadGraph(WGPUDevice device, const char* path);
+
 }  // namespace dawn::native
 
 // TODO(dawn:824): Remove once the deprecation period is passed.
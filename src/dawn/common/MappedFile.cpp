@@ -0,0 +1,120 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/common/MappedFile.h"
+
+#include "dawn/common/Platform.h"
+
+#if DAWN_PLATFORM_WINDOWS
+#    include "dawn/common/windows_with_undefs.h"
+#    if DAWN_PLATFORM_WINUWP
+#        include "dawn/common/WindowsUtils.h"
+#    endif
+#elif DAWN_PLATFORM_POSIX
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#else
+#    error "Unsupported platform for MappedFile"
+#endif
+
+// static
+Ref<MappedFile> MappedFile::Open(const std::string& filename, std::string* error) {
+    Ref<MappedFile> file = AcquireRef(new MappedFile());
+#if DAWN_PLATFORM_WINDOWS
+#    if DAWN_PLATFORM_WINUWP
+    HANDLE handle = CreateFile2(UTF8ToWStr(filename.c_str()).c_str(), GENERIC_READ,
+                                FILE_SHARE_READ, OPEN_EXISTING, nullptr);
+#    else
+    HANDLE handle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#    endif
+    if (handle == INVALID_HANDLE_VALUE) {
+        if (error != nullptr) {
+            *error = "Windows Error: " + std::to_string(GetLastError());
+        }
+        return nullptr;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) {
+        if (error != nullptr) {
+            *error = "Failed to get the size of " + filename;
+        }
+        CloseHandle(handle);
+        return nullptr;
+    }
+    file->mMapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // The mapping keeps the file open.
+    CloseHandle(handle);
+    if (file->mMapping == nullptr) {
+        if (error != nullptr) {
+            *error = "Windows Error: " + std::to_string(GetLastError());
+        }
+        return nullptr;
+    }
+    file->mData =
+        static_cast<const uint8_t*>(MapViewOfFile(file->mMapping, FILE_MAP_READ, 0, 0, 0));
+    if (file->mData == nullptr) {
+        if (error != nullptr) {
+            *error = "Windows Error: " + std::to_string(GetLastError());
+        }
+        return nullptr;
+    }
+    file->mSize = static_cast<size_t>(size.QuadPart);
+#elif DAWN_PLATFORM_POSIX
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (error != nullptr) {
+            *error = "Failed to open " + filename;
+        }
+        return nullptr;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+        if (error != nullptr) {
+            *error = "Failed to get the size of " + filename;
+        }
+        close(fd);
+        return nullptr;
+    }
+    void* data = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps the file open.
+    close(fd);
+    if (data == MAP_FAILED) {
+        if (error != nullptr) {
+            *error = "Failed to map " + filename;
+        }
+        return nullptr;
+    }
+    file->mData = static_cast<const uint8_t*>(data);
+    file->mSize = static_cast<size_t>(fileStat.st_size);
+#endif
+    return file;
+}
+
+MappedFile::~MappedFile() {
+#if DAWN_PLATFORM_WINDOWS
+    if (mData != nullptr) {
+        UnmapViewOfFile(mData);
+    }
+    if (mMapping != nullptr) {
+        CloseHandle(mMapping);
+    }
+#elif DAWN_PLATFORM_POSIX
+    if (mData != nullptr) {
+        munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+#endif
+}
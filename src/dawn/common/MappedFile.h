@@ -0,0 +1,51 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef COMMON_MAPPEDFILE_H_
+#define COMMON_MAPPEDFILE_H_
+
+#include "dawn/common/Platform.h"
+#include "dawn/common/RefCounted.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// A file mapped read-only in memory. The pages are shared with the other processes mapping the
+// same file and are only read from the disk when they are first accessed.
+class MappedFile : public RefCounted {
+  public:
+    // Returns nullptr with |error| set when the file can't be opened or mapped.
+    static Ref<MappedFile> Open(const std::string& filename, std::string* error = nullptr);
+
+    const uint8_t* GetData() const {
+        return mData;
+    }
+    size_t GetSize() const {
+        return mSize;
+    }
+
+  private:
+    MappedFile() = default;
+    ~MappedFile() override;
+
+    const uint8_t* mData = nullptr;
+    size_t mSize = 0;
+#if DAWN_PLATFORM_WINDOWS
+    // The handle of the file mapping object.
+    void* mMapping = nullptr;
+#endif
+};
+
+#endif  // COMMON_MAPPEDFILE_H_
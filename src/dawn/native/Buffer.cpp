@@ -409,6 +409,18 @@ namespace dawn::native {
         UnmapInternal(WGPUBufferMapAsyncStatus_UnmappedBeforeCallback);
     }
 
+    void* BufferBase::GetHostVisiblePointer() {
+        // The memory belongs to the mapping while the buffer is mapped or pending a mapping.
+        if (IsError() || mState != BufferState::Unmapped) {
+            return nullptr;
+        }
+        return GetHostVisiblePointerImpl();
+    }
+
+    void* BufferBase::GetHostVisiblePointerImpl() {
+        return nullptr;
+    }
+
     void BufferBase::UnmapInternal(WGPUBufferMapAsyncStatus callbackStatus) {
         if (mState == BufferState::Mapped) {
             // A map request can only be called once, so this will fire only if the request wasn't
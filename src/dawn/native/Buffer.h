@@ -71,6 +71,11 @@ namespace dawn::native {
         void* GetMappedRange(size_t offset, size_t size, bool writable = true);
         void Unmap();
 
+        // Returns a CPU pointer to the backing memory of an unmapped buffer if it is host
+        // visible, nullptr otherwise. The backend waits for the queue to be done with the buffer,
+        // so the pointer can be read and written until the next submission that uses it.
+        void* GetHostVisiblePointer();
+
         // Dawn API
         void APIMapAsync(wgpu::MapMode mode,
                          size_t offset,
@@ -102,6 +107,7 @@ namespace dawn::native {
         virtual MaybeError MapAsyncImpl(wgpu::MapMode mode, size_t offset, size_t size) = 0;
         virtual void UnmapImpl() = 0;
         virtual void* GetMappedPointerImpl() = 0;
+        virtual void* GetHostVisiblePointerImpl();
 
         virtual bool IsCPUWritableAtCreation() const = 0;
         MaybeError CopyFromStagingBuffer();
@@ -18,7 +18,10 @@
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/Device.h"
+#include "dawn/native/Graph.h"
+#include "dawn/native/GraphBuilder.h"
 #include "dawn/native/Instance.h"
+#include "dawn/native/NamedOperands.h"
 #include "dawn/native/Texture.h"
 #include "dawn/platform/DawnPlatform.h"
 
@@ -309,4 +312,21 @@ namespace dawn::native {
         return FromAPI(a)->IsLayoutEqual(FromAPI(b), excludePipelineCompatibiltyToken);
     }
 
+    uint64_t GetIntermediateMemorySize(WGPUGraph graph) {
+        return FromAPI(graph)->GetIntermediateMemorySize();
+    }
+
+    bool SerializeGraph(WGPUGraphBuilder builder,
+                        WGPUNamedOperands namedOperands,
+                        const char* path) {
+        GraphBuilderBase* graphBuilder = FromAPI(builder);
+        return !graphBuilder->GetDevice()->ConsumedError(
+            graphBuilder->Serialize(FromAPI(namedOperands), path));
+    }
+
+    WGPUGraph LoadGraph(WGPUDevice device, const char* path) {
+        Ref<GraphBuilderBase> builder = AcquireRef(FromAPI(device)->APICreateGraphBuilder());
+        return ToAPI(builder->Load(path));
+    }
+
 }  // namespace dawn::native
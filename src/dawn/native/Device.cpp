@@ -31,6 +31,7 @@
 #include "dawn/native/ErrorInjector.h"
 #include "dawn/native/ErrorScope.h"
 #include "dawn/native/ExternalTexture.h"
+#include "dawn/native/GraphBuilder.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/InternalPipelineStore.h"
 #include "dawn/native/ObjectType_autogen.h"
@@ -48,8 +49,6 @@
 #include "dawn/platform/DawnPlatform.h"
 #include "dawn/platform/tracing/TraceEvent.h"
 
-#include "dawn/native/dml/GraphBuilderDML.h"
-
 #include <array>
 #include <mutex>
 #include <unordered_set>
@@ -961,8 +960,10 @@ namespace dawn::native {
 
     // Object creation API methods
     GraphBuilderBase* DeviceBase::APICreateGraphBuilder() {
-        Ref<GraphBuilderBase> builder = dml::GraphBuilder::Create(this);
-        if (!builder->Initialize()) {
+        Ref<GraphBuilderBase> builder;
+        if (ConsumedError(CreateGraphBuilderImpl(), &builder, "calling %s.CreateGraphBuilder().",
+                          this) ||
+            !builder->Initialize()) {
             return GraphBuilderBase::MakeError(this);
         }
         return builder.Detach();
@@ -1465,6 +1466,10 @@ namespace dawn::native {
         return GetOrCreatePipelineLayout(descriptor);
     }
 
+    ResultOrError<Ref<GraphBuilderBase>> DeviceBase::CreateGraphBuilderImpl() {
+        return DAWN_VALIDATION_ERROR("WebNN graphs are not supported by this backend.");
+    }
+
     ResultOrError<Ref<ExternalTextureBase>> DeviceBase::CreateExternalTextureImpl(
         const ExternalTextureDescriptor* descriptor) {
         if (IsValidationEnabled()) {
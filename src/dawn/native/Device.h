@@ -401,6 +401,8 @@ namespace dawn::native {
             const BufferDescriptor* descriptor) = 0;
         virtual ResultOrError<Ref<ExternalTextureBase>> CreateExternalTextureImpl(
             const ExternalTextureDescriptor* descriptor);
+        // Backends that compute WebNN graphs override it, the others reject the graph builders.
+        virtual ResultOrError<Ref<GraphBuilderBase>> CreateGraphBuilderImpl();
         virtual ResultOrError<Ref<PipelineLayoutBase>> CreatePipelineLayoutImpl(
             const PipelineLayoutDescriptor* descriptor) = 0;
         virtual ResultOrError<Ref<QuerySetBase>> CreateQuerySetImpl(
@@ -0,0 +1,388 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/DynamicGraph.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "dawn/native/Buffer.h"
+#include "dawn/native/Device.h"
+#include "dawn/native/GraphBuilder.h"
+#include "dawn/native/NamedResources.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        // The host pointer to the |byteSize| bytes of the resource |name|, nullptr when it isn't
+        // set, is too small or isn't in host visible memory.
+        uint8_t* GetHostPointer(const NamedResourcesBase* resources,
+                                const std::string& name,
+                                uint64_t byteSize) {
+            auto host = resources->GetHostResources().find(name);
+            if (host != resources->GetHostResources().end()) {
+                if (host->second.size < byteSize) {
+                    return nullptr;
+                }
+                return static_cast<uint8_t*>(host->second.buffer);
+            }
+            auto resource = resources->GetResources().find(name);
+            if (resource == resources->GetResources().end()) {
+                return nullptr;
+            }
+            const BufferResourceView& view = resource->second;
+            uint64_t bufferSize = view.resource->GetSize();
+            if (view.offset > bufferSize) {
+                return nullptr;
+            }
+            uint64_t size = view.size != 0 ? view.size : bufferSize - view.offset;
+            if (size > bufferSize - view.offset || size < byteSize) {
+                return nullptr;
+            }
+            uint8_t* pointer = static_cast<uint8_t*>(view.resource->GetHostVisiblePointer());
+            return pointer != nullptr ? pointer + view.offset : nullptr;
+        }
+
+        size_t GetResourceCount(const NamedResourcesBase* resources) {
+            return resources->GetResources().size() + resources->GetHostResources().size();
+        }
+
+    }  // anonymous namespace
+
+    DynamicGraph::DynamicGraph(DeviceBase* device,
+                               Ref<SerializedGraph> graph,
+                               std::map<std::string, DynamicInput> dynamicInputs)
+        : GraphBase(device), mGraph(std::move(graph)), mDynamicInputs(std::move(dynamicInputs)) {
+    }
+
+    MaybeError DynamicGraph::ComputeImpl(NamedResourcesBase* inputs,
+                                         NamedResourcesBase* outputs) {
+        InputShapes inputShapes;
+        DAWN_TRY_ASSIGN(inputShapes, GetInputShapes(inputs));
+        Ref<GraphBase> variant;
+        DAWN_TRY_ASSIGN(variant, GetVariant(inputShapes));
+        return variant->Compute(inputs, outputs);
+    }
+
+    void DynamicGraph::ComputePendingImpl(std::vector<ComputeRequest>& requests) {
+        auto compute = [this](ComputeRequest* request) {
+            MaybeError maybeError = ComputeImpl(request->inputs.Get(), request->outputs.Get());
+            if (maybeError.IsError()) {
+                request->errorMessage = maybeError.AcquireError()->GetMessage();
+            }
+        };
+
+        // The requests that can be merged, by the shapes of their inputs without the batch
+        // dimension. The others are computed on their own.
+        std::map<InputShapes, std::vector<BatchedRequest>> batches;
+        for (ComputeRequest& request : requests) {
+            ResultOrError<InputShapes> inputShapes = GetInputShapes(request.inputs.Get());
+            if (inputShapes.IsError()) {
+                // Computing the request reports the error.
+                inputShapes.AcquireError();
+                compute(&request);
+                continue;
+            }
+            BatchedRequest batched = {&request, inputShapes.AcquireSuccess(), 0};
+            batched.batchSize = GetBatchSize(request, batched.inputShapes);
+            if (batched.batchSize == 0) {
+                compute(&request);
+                continue;
+            }
+            InputShapes key = batched.inputShapes;
+            for (auto& [name, shape] : key) {
+                shape.erase(shape.begin());
+            }
+            batches[std::move(key)].push_back(std::move(batched));
+        }
+
+        // A batch that can't be merged, or whose merged computation fails, is computed again one
+        // request at a time so that each request reports its own error.
+        for (auto& [key, batch] : batches) {
+            if (batch.size() > 1) {
+                const std::map<std::string, size_t>& outputRowSizes = GetOutputRowSizes(key);
+                if (!outputRowSizes.empty() && ComputeBatch(batch, outputRowSizes)) {
+                    continue;
+                }
+            }
+            for (BatchedRequest& batched : batch) {
+                compute(batched.request);
+            }
+        }
+    }
+
+    int32_t DynamicGraph::GetBatchSize(const ComputeRequest& request,
+                                       const InputShapes& inputShapes) const {
+        // The inputs with static dimensions can't be concatenated.
+        if (GetResourceCount(request.inputs.Get()) != mDynamicInputs.size()) {
+            return 0;
+        }
+        int32_t batchSize = 0;
+        for (auto& [name, input] : mDynamicInputs) {
+            const std::vector<int32_t>& shape = inputShapes.at(name);
+            if (input.dimensions.empty() || input.dimensions[0] != kDynamicDimension ||
+                shape.empty() || shape[0] <= 0 || (batchSize != 0 && shape[0] != batchSize)) {
+                return 0;
+            }
+            batchSize = shape[0];
+        }
+        return batchSize;
+    }
+
+    const std::map<std::string, size_t>& DynamicGraph::GetOutputRowSizes(
+        const InputShapes& key) {
+        auto cached = mOutputRowSizes.find(key);
+        if (cached != mOutputRowSizes.end()) {
+            return cached->second;
+        }
+        if (mOutputRowSizes.size() >= kMaxVariantCount) {
+            mOutputRowSizes.clear();
+        }
+        std::map<std::string, size_t>& rowSizes = mOutputRowSizes[key];
+        ResultOrError<std::map<std::string, size_t>> inferred = InferOutputRowSizes(key);
+        if (inferred.IsError()) {
+            // The requests are computed on their own, which reports the error.
+            inferred.AcquireError();
+        } else {
+            rowSizes = inferred.AcquireSuccess();
+        }
+        return rowSizes;
+    }
+
+    ResultOrError<std::map<std::string, size_t>> DynamicGraph::InferOutputRowSizes(
+        const InputShapes& key) {
+        // The outputs are batched as the inputs when their first dimension follows the batch
+        // size of the inputs and their other dimensions don't depend on it, checked with the
+        // shapes inferred for a batch of one and of two.
+        std::map<std::string, OperandShape> rowShapes[2];
+        std::map<std::string, size_t> rowSizes;
+        for (int32_t batchSize : {1, 2}) {
+            InputShapes inputShapes = key;
+            for (auto& [name, shape] : inputShapes) {
+                shape.insert(shape.begin(), batchSize);
+            }
+            Ref<GraphBuilderBase> builder = AcquireRef(GetDevice()->APICreateGraphBuilder());
+            std::vector<OperatorBase*> operators;
+            std::map<std::string, const OperandBase*> outputs;
+            DAWN_TRY(DeserializeGraph(builder.Get(), mGraph.Get(), inputShapes, &operators,
+                                      &outputs));
+            for (auto& [name, output] : outputs) {
+                const OperandShape& shape = output->Shape();
+                if (shape.empty() || shape[0] != batchSize) {
+                    return std::map<std::string, size_t>();
+                }
+                rowShapes[batchSize - 1][name] = OperandShape(shape.begin() + 1, shape.size() - 1);
+                rowSizes[name] =
+                    GetElementCount(shape) / batchSize * GetOperandTypeSize(output->Type());
+            }
+        }
+        if (rowShapes[0] != rowShapes[1]) {
+            return std::map<std::string, size_t>();
+        }
+        return rowSizes;
+    }
+
+    bool DynamicGraph::ComputeBatch(const std::vector<BatchedRequest>& batch,
+                                    const std::map<std::string, size_t>& outputRowSizes) {
+        // The outputs are split after the computation, they must all be set.
+        int64_t batchSum = 0;
+        for (const BatchedRequest& batched : batch) {
+            if (GetResourceCount(batched.request->outputs.Get()) != outputRowSizes.size()) {
+                return false;
+            }
+            batchSum += batched.batchSize;
+        }
+        if (batchSum > std::numeric_limits<int32_t>::max()) {
+            return false;
+        }
+        int32_t batchSize = static_cast<int32_t>(batchSum);
+        InputShapes inputShapes = batch[0].inputShapes;
+        for (auto& [name, shape] : inputShapes) {
+            shape[0] = batchSize;
+        }
+        ResultOrError<Ref<GraphBase>> variantOrError = GetVariant(inputShapes);
+        if (variantOrError.IsError()) {
+            variantOrError.AcquireError();
+            return false;
+        }
+        Ref<GraphBase> variant = variantOrError.AcquireSuccess();
+
+        // The merged inputs and outputs are staged in host memory, the rows of the requests one
+        // after the other along the batch dimension.
+        std::vector<std::vector<uint8_t>> memory;
+        memory.reserve(inputShapes.size() + outputRowSizes.size());
+        Ref<NamedResourcesBase> inputs = AcquireRef(new NamedResourcesBase());
+        for (auto& [name, shape] : inputShapes) {
+            size_t rowSize = GetElementCount(shape) / batchSize *
+                             GetOperandTypeSize(mDynamicInputs.at(name).type);
+            std::vector<uint8_t>& data = memory.emplace_back(rowSize * batchSize);
+            size_t offset = 0;
+            for (const BatchedRequest& batched : batch) {
+                size_t size = rowSize * batched.batchSize;
+                const uint8_t* source = GetHostPointer(batched.request->inputs.Get(), name, size);
+                if (source == nullptr) {
+                    return false;
+                }
+                memcpy(data.data() + offset, source, size);
+                offset += size;
+            }
+            HostResourceView view = {};
+            view.buffer = data.data();
+            view.size = data.size();
+            inputs->APISetHost(name.c_str(), &view);
+        }
+
+        struct OutputCopy {
+            const uint8_t* source;
+            uint8_t* destination;
+            size_t size;
+        };
+        std::vector<OutputCopy> outputCopies;
+        Ref<NamedResourcesBase> outputs = AcquireRef(new NamedResourcesBase());
+        for (auto& [name, rowSize] : outputRowSizes) {
+            std::vector<uint8_t>& data = memory.emplace_back(rowSize * batchSize);
+            size_t offset = 0;
+            for (const BatchedRequest& batched : batch) {
+                size_t size = rowSize * batched.batchSize;
+                uint8_t* destination = GetHostPointer(batched.request->outputs.Get(), name, size);
+                if (destination == nullptr) {
+                    return false;
+                }
+                outputCopies.push_back({data.data() + offset, destination, size});
+                offset += size;
+            }
+            HostResourceView view = {};
+            view.buffer = data.data();
+            view.size = data.size();
+            outputs->APISetHost(name.c_str(), &view);
+        }
+        MaybeError maybeError = variant->Compute(inputs.Get(), outputs.Get());
+        if (maybeError.IsError()) {
+            maybeError.AcquireError();
+            return false;
+        }
+        for (const OutputCopy& copy : outputCopies) {
+            memcpy(copy.destination, copy.source, copy.size);
+        }
+        return true;
+    }
+
+    ResultOrError<DynamicGraph::InputShapes> DynamicGraph::GetInputShapes(
+        NamedResourcesBase* inputs) const {
+        InputShapes inputShapes;
+        const auto& namedDimensions = inputs->GetDimensions();
+        const auto& namedResources = inputs->GetResources();
+        const auto& namedHostResources = inputs->GetHostResources();
+        for (auto& [name, input] : mDynamicInputs) {
+            auto dimensions = namedDimensions.find(name);
+            if (dimensions != namedDimensions.end()) {
+                inputShapes[name] = dimensions->second;
+                continue;
+            }
+
+            size_t dynamicCount = 0;
+            uint64_t staticSize = GetOperandTypeSize(input.type);
+            for (int32_t dimension : input.dimensions) {
+                if (dimension == kDynamicDimension) {
+                    ++dynamicCount;
+                } else {
+                    staticSize *= dimension;
+                }
+            }
+            DAWN_INVALID_IF(dynamicCount != 1, "The dimensions of the input %s must be set.",
+                            name);
+            uint64_t size;
+            auto host = namedHostResources.find(name);
+            if (host != namedHostResources.end()) {
+                size = host->second.size;
+            } else {
+                auto resource = namedResources.find(name);
+                DAWN_INVALID_IF(resource == namedResources.end(), "The input %s must be set.",
+                                name);
+                const BufferResourceView& view = resource->second;
+                size = view.size != 0 ? view.size : view.resource->GetSize() - view.offset;
+            }
+            DAWN_INVALID_IF(size == 0 || size % staticSize != 0,
+                            "The buffer of the input %s doesn't fit its dimensions.", name);
+            std::vector<int32_t> shape = input.dimensions;
+            for (int32_t& dimension : shape) {
+                if (dimension == kDynamicDimension) {
+                    dimension = static_cast<int32_t>(size / staticSize);
+                }
+            }
+            inputShapes[name] = std::move(shape);
+        }
+        return inputShapes;
+    }
+
+    ResultOrError<Ref<GraphBase>> DynamicGraph::GetVariant(const InputShapes& inputShapes) {
+        std::unique_lock<std::mutex> lock(mVariantMutex);
+        for (;;) {
+            auto variant = std::find_if(
+                mVariants.begin(), mVariants.end(),
+                [&](const Variant& cached) { return cached.inputShapes == inputShapes; });
+            if (variant == mVariants.end()) {
+                break;
+            }
+            if (variant->graph != nullptr) {
+                mVariants.splice(mVariants.begin(), mVariants, variant);
+                return Ref<GraphBase>(variant->graph);
+            }
+            // Another computation is compiling the variant, it is removed if that fails and
+            // compiled again here to report the error.
+            mVariantCompiled.wait(lock);
+        }
+
+        // The variant is compiled without the lock so that the computations with the shapes
+        // already compiled aren't held up, the concurrent computations with the same shapes wait
+        // for it. The variants being compiled are never released.
+        auto variant = mVariants.insert(mVariants.begin(), {inputShapes, nullptr});
+        lock.unlock();
+        ResultOrError<Ref<GraphBase>> compiled = CompileVariant(inputShapes);
+        lock.lock();
+
+        Ref<GraphBase> graph;
+        if (compiled.IsSuccess()) {
+            graph = compiled.AcquireSuccess();
+            variant->graph = graph;
+            for (auto cached = mVariants.end();
+                 mVariants.size() > kMaxVariantCount && cached != mVariants.begin();) {
+                --cached;
+                if (cached->graph != nullptr) {
+                    cached = mVariants.erase(cached);
+                }
+            }
+        } else {
+            mVariants.erase(variant);
+        }
+        lock.unlock();
+        mVariantCompiled.notify_all();
+
+        if (graph == nullptr) {
+            return compiled.AcquireError();
+        }
+        return graph;
+    }
+
+    ResultOrError<Ref<GraphBase>> DynamicGraph::CompileVariant(const InputShapes& inputShapes) {
+        Ref<GraphBuilderBase> builder = AcquireRef(GetDevice()->APICreateGraphBuilder());
+        Ref<GraphBase> variant;
+        DAWN_TRY_ASSIGN(variant, builder->Specialize(mGraph.Get(), inputShapes));
+        variant->ShareProfileWith(this);
+        return variant;
+    }
+
+}  // namespace dawn::native
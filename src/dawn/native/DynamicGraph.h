@@ -0,0 +1,108 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_DYNAMIC_GRAPH_H_
+#define WEBNN_NATIVE_DYNAMIC_GRAPH_H_
+
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dawn/native/Graph.h"
+#include "dawn/native/GraphSerializer.h"
+
+namespace dawn::native {
+
+    // A graph whose inputs have dynamic dimensions, kDynamicDimension in their descriptors. The
+    // graph is kept serialized as it was built, and compiled for the input shapes of a
+    // computation the first time they are seen, with the operand shapes inferred again and the
+    // graph rewrites of GraphOptimizer applied to them. The compiled variants are cached by input
+    // shape, the least recently used is released beyond kMaxVariantCount.
+    //
+    // The asynchronous computations pending together whose inputs differ only in their first
+    // dimension are merged into one computation of the variant for the sum of their batches, when
+    // the outputs have that dimension first too. The graph must compute the rows along it
+    // independently, which the shapes alone can't tell.
+    class DynamicGraph final : public GraphBase {
+      public:
+        static constexpr size_t kMaxVariantCount = 8;
+
+        // The type and the declared dimensions of an input with dynamic dimensions.
+        struct DynamicInput {
+            wgpu::OperandType type;
+            std::vector<int32_t> dimensions;
+        };
+
+        DynamicGraph(DeviceBase* device,
+                     Ref<SerializedGraph> graph,
+                     std::map<std::string, DynamicInput> dynamicInputs);
+        ~DynamicGraph() override = default;
+
+      private:
+        using InputShapes = std::map<std::string, std::vector<int32_t>>;
+
+        MaybeError ComputeImpl(NamedResourcesBase* inputs, NamedResourcesBase* outputs) override;
+        void ComputePendingImpl(std::vector<ComputeRequest>& requests) override;
+
+        // A pending request whose inputs are all batched along their first dimension.
+        struct BatchedRequest {
+            ComputeRequest* request;
+            InputShapes inputShapes;
+            int32_t batchSize;
+        };
+        // The batch size of |request| whose inputs have |inputShapes|, 0 when its inputs can't be
+        // merged with those of other requests.
+        int32_t GetBatchSize(const ComputeRequest& request, const InputShapes& inputShapes) const;
+        // The bytes of a row of each output for the inputs of shapes |key| without their first
+        // dimension, empty when the outputs don't have the batch dimension first.
+        const std::map<std::string, size_t>& GetOutputRowSizes(const InputShapes& key);
+        ResultOrError<std::map<std::string, size_t>> InferOutputRowSizes(const InputShapes& key);
+        // Concatenates the inputs of |batch| in host memory, computes them at once and splits the
+        // outputs. Returns false, with none of the outputs written, when the inputs or the outputs
+        // aren't in host memory or the computation fails.
+        bool ComputeBatch(const std::vector<BatchedRequest>& batch,
+                          const std::map<std::string, size_t>& outputRowSizes);
+
+        // The dimensions of the dynamic inputs of a computation, those set in |inputs|, or
+        // inferred from the size of the buffer when one dimension of the input is dynamic.
+        ResultOrError<InputShapes> GetInputShapes(NamedResourcesBase* inputs) const;
+        // The variant compiled for |inputShapes|, compiled now if it isn't cached.
+        ResultOrError<Ref<GraphBase>> GetVariant(const InputShapes& inputShapes);
+        ResultOrError<Ref<GraphBase>> CompileVariant(const InputShapes& inputShapes);
+
+        Ref<SerializedGraph> mGraph;
+        std::map<std::string, DynamicInput> mDynamicInputs;
+
+        struct Variant {
+            InputShapes inputShapes;
+            // nullptr while the variant is being compiled.
+            Ref<GraphBase> graph;
+        };
+        std::mutex mVariantMutex;
+        std::condition_variable mVariantCompiled;
+        // The variants, the most recently used first.
+        std::list<Variant> mVariants;
+
+        // The results of GetOutputRowSizes(), only used by ComputePendingImpl() which runs on one
+        // worker at a time.
+        std::map<InputShapes, std::map<std::string, size_t>> mOutputRowSizes;
+    };
+
+}  // namespace dawn::native
+
+#endif  // WEBNN_NATIVE_DYNAMIC_GRAPH_H_
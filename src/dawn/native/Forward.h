@@ -55,11 +55,13 @@ namespace dawn::native {
     class DeviceBase;
 
     class ContextBase;
+    class GraphArena;
     class GraphBase;
     class GraphBuilderBase;
     class NamedOperandsBase;
     class NamedResourcesBase;
     class OperandBase;
+    class OperandArrayBase;
     class OperatorBase;
     class FusionOperatorBase;
 
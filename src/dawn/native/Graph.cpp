@@ -19,10 +19,49 @@
 #include "dawn/common/Assert.h"
 #include "dawn/common/Log.h"
 #include "dawn/common/RefCounted.h"
+#include "dawn/native/Adapter.h"
+#include "dawn/native/AsyncTask.h"
+#include "dawn/native/CallbackTaskManager.h"
 #include "dawn/native/Device.h"
+#include "dawn/native/ErrorData.h"
 #include "dawn/native/NamedResources.h"
 
 namespace dawn::native {
+
+    namespace {
+        struct ComputeGraphCallbackTask : CallbackTask {
+          public:
+            ComputeGraphCallbackTask(WGPUComputeGraphCallback callback,
+                                     std::string errorMessage,
+                                     void* userdata)
+                : mCallback(callback), mErrorMessage(std::move(errorMessage)), mUserdata(userdata) {
+            }
+
+            void Finish() override {
+                if (mErrorMessage.empty()) {
+                    mCallback(WGPUComputeGraphStatus_Success, "", mUserdata);
+                } else {
+                    mCallback(WGPUComputeGraphStatus_Error, mErrorMessage.c_str(), mUserdata);
+                }
+            }
+
+            void HandleShutDown() override {
+                mCallback(WGPUComputeGraphStatus_DeviceDestroyed,
+                          "Device destroyed before callback", mUserdata);
+            }
+
+            void HandleDeviceLoss() override {
+                mCallback(WGPUComputeGraphStatus_DeviceLost, "Device lost before callback",
+                          mUserdata);
+            }
+
+          private:
+            WGPUComputeGraphCallback mCallback;
+            std::string mErrorMessage;
+            void* mUserdata;
+        };
+    }  // anonymous namespace
+
     // static
     GraphBase* GraphBase::MakeError(DeviceBase* device) {
         return new GraphBase(device, ObjectBase::kError);
@@ -70,6 +109,14 @@ namespace dawn::native {
         return DAWN_UNIMPLEMENTED_ERROR("AddGemm");
     }
 
+    MaybeError GraphBase::AddGru(const op::Gru* gru) {
+        return DAWN_UNIMPLEMENTED_ERROR("AddGru");
+    }
+
+    MaybeError GraphBase::AddInstanceNorm(const op::InstanceNorm* instanceNorm) {
+        return DAWN_UNIMPLEMENTED_ERROR("AddInstanceNorm");
+    }
+
     MaybeError GraphBase::AddPad(const op::Pad* pad) {
         return DAWN_UNIMPLEMENTED_ERROR("AddPad");
     }
@@ -78,6 +125,10 @@ namespace dawn::native {
         return DAWN_UNIMPLEMENTED_ERROR("AddPool2d");
     }
 
+    MaybeError GraphBase::AddQuantize(const op::Quantize* quantize) {
+        return DAWN_UNIMPLEMENTED_ERROR("AddQuantize");
+    }
+
     MaybeError GraphBase::AddReduce(const op::Reduce* reduce) {
         return DAWN_UNIMPLEMENTED_ERROR("AddReduce");
     }
@@ -90,6 +141,18 @@ namespace dawn::native {
         return DAWN_UNIMPLEMENTED_ERROR("AddReshape");
     }
 
+    MaybeError GraphBase::AddSlice(const op::Slice* slice) {
+        return DAWN_UNIMPLEMENTED_ERROR("AddSlice");
+    }
+
+    MaybeError GraphBase::AddSplit(const op::Split* split) {
+        return DAWN_UNIMPLEMENTED_ERROR("AddSplit");
+    }
+
+    MaybeError GraphBase::AddSqueeze(const op::Squeeze* squeeze) {
+        return DAWN_UNIMPLEMENTED_ERROR("AddSqueeze");
+    }
+
     MaybeError GraphBase::AddTranspose(const op::Transpose* transpose) {
         return DAWN_UNIMPLEMENTED_ERROR("AddTranspose");
     }
@@ -110,19 +173,173 @@ namespace dawn::native {
         return DAWN_UNIMPLEMENTED_ERROR("CompileImpl");
     }
 
-    void GraphBase::ComputeImpl(NamedResourcesBase* inputs,
-                                NamedResourcesBase* outputs) {
-        dawn::ErrorLog() << "Unimplemented: GraphBase::ComputeImpl";
+    void GraphBase::SetContentHash(size_t contentHash) {
+        auto append = [this](auto value) {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            mCacheKey.insert(mCacheKey.end(), bytes, bytes + sizeof(value));
+        };
+        mCacheKey.clear();
+        append(static_cast<uint32_t>(PersistentKeyType::Graph));
+        append(static_cast<uint32_t>(GetDevice()->GetAdapter()->GetBackendType()));
+        append(static_cast<uint64_t>(contentHash));
+    }
+
+    const PersistentCacheKey& GraphBase::GetCacheKey() const {
+        return mCacheKey;
+    }
+
+    void GraphBase::PlanMemory(const std::vector<const OperatorBase*>& operators,
+                               const std::vector<const OperandBase*>& outputs) {
+        mMemoryPlan = MemoryPlan(operators, outputs, [this](wgpu::OperandType type) {
+            return GetIntermediateElementSize(type);
+        });
+    }
+
+    size_t GraphBase::GetIntermediateElementSize(wgpu::OperandType type) const {
+        return GetOperandTypeSize(type);
+    }
+
+    const MemoryPlan& GraphBase::GetMemoryPlan() const {
+        return mMemoryPlan;
+    }
+
+    uint64_t GraphBase::GetIntermediateMemorySize() const {
+        return mMemoryPlan.GetSize();
+    }
+
+    MaybeError GraphBase::ComputeImpl(NamedResourcesBase* inputs,
+                                      NamedResourcesBase* outputs) {
+        return DAWN_UNIMPLEMENTED_ERROR("ComputeImpl");
+    }
+
+    void GraphBase::ComputePendingImpl(std::vector<ComputeRequest>& requests) {
+        for (ComputeRequest& request : requests) {
+            MaybeError maybeError = ComputeImpl(request.inputs.Get(), request.outputs.Get());
+            if (maybeError.IsError()) {
+                request.errorMessage = maybeError.AcquireError()->GetMessage();
+            }
+        }
+    }
+
+    MaybeError GraphBase::Compute(NamedResourcesBase* inputs, NamedResourcesBase* outputs) {
+        return ComputeImpl(inputs, outputs);
     }
 
     void GraphBase::APICompute(NamedResourcesBase* inputs, NamedResourcesBase* outputs) {
         DAWN_ASSERT(inputs != nullptr && outputs != nullptr);
-        ComputeImpl(inputs, outputs);
+        if (GetDevice()->ConsumedError(Compute(inputs, outputs))) {
+            dawn::ErrorLog() << "Failed to compute the graph.";
+        }
+    }
+
+    void GraphBase::APIComputeAsync(NamedResourcesBase* inputs,
+                                    NamedResourcesBase* outputs,
+                                    WGPUComputeGraphCallback callback,
+                                    void* userdata) {
+        DAWN_ASSERT(inputs != nullptr && outputs != nullptr && callback != nullptr);
+        if (IsError()) {
+            GetDevice()->GetCallbackTaskManager()->AddCallbackTask(
+                std::make_unique<ComputeGraphCallbackTask>(callback, "The graph is an error.",
+                                                           userdata));
+            return;
+        }
+
+        bool startWorker = false;
+        {
+            std::lock_guard<std::mutex> lock(mComputeMutex);
+            mPendingComputes.push_back({inputs, outputs, callback, userdata, ""});
+            startWorker = !mIsComputing;
+            mIsComputing = true;
+        }
+        if (startWorker) {
+            // The worker keeps the graph alive until the queue is drained.
+            Ref<GraphBase> graph = this;
+            GetDevice()->GetAsyncTaskManager()->PostTask(
+                [graph] { graph->ProcessPendingComputes(); });
+        }
+    }
+
+    void GraphBase::ProcessPendingComputes() {
+        while (true) {
+            // The requests queued while the previous ones were running are taken together.
+            std::vector<ComputeRequest> requests;
+            {
+                std::lock_guard<std::mutex> lock(mComputeMutex);
+                if (mPendingComputes.empty()) {
+                    mIsComputing = false;
+                    return;
+                }
+                requests.swap(mPendingComputes);
+            }
+            ComputePendingImpl(requests);
+            for (ComputeRequest& request : requests) {
+                GetDevice()->GetCallbackTaskManager()->AddCallbackTask(
+                    std::make_unique<ComputeGraphCallbackTask>(
+                        request.callback, std::move(request.errorMessage), request.userdata));
+            }
+        }
     }
 
-    
     NamedResourcesBase* GraphBase::APICreateNamedResources() {
         return new NamedResourcesBase();
     }
 
+    bool GraphBase::IsProfilingEnabled() const {
+        return mProfiledGraph->mProfilingEnabled.load(std::memory_order_relaxed);
+    }
+
+    void GraphBase::ShareProfileWith(GraphBase* graph) {
+        mProfiledGraph = graph;
+    }
+
+    void GraphBase::RecordProfile(const std::vector<ProfiledOperator>& operators) {
+        if (mProfiledGraph != this) {
+            mProfiledGraph->RecordProfile(operators);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mProfileMutex);
+        if (mProfile.size() != operators.size()) {
+            mProfile.clear();
+            mProfiledComputeCount = 0;
+        }
+        if (mProfiledComputeCount == 0) {
+            mProfile = operators;
+        } else {
+            for (size_t i = 0; i < operators.size(); ++i) {
+                mProfile[i].nanoseconds += operators[i].nanoseconds;
+            }
+        }
+        ++mProfiledComputeCount;
+    }
+
+    void GraphBase::APISetProfilingEnabled(bool enabled) {
+        std::lock_guard<std::mutex> lock(mProfileMutex);
+        if (enabled && !IsProfilingEnabled()) {
+            mProfile.clear();
+            mProfiledComputeCount = 0;
+        }
+        mProfilingEnabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    size_t GraphBase::APIGetOperatorProfileCount() {
+        std::lock_guard<std::mutex> lock(mProfileMutex);
+        return mProfile.size();
+    }
+
+    bool GraphBase::APIGetOperatorProfile(size_t index, OperatorProfile* profile) {
+        DAWN_ASSERT(profile != nullptr);
+        std::lock_guard<std::mutex> lock(mProfileMutex);
+        if (index >= mProfile.size()) {
+            return false;
+        }
+        const ProfiledOperator& op = mProfile[index];
+        profile->name = op.name;
+        profile->variant = op.variant;
+        profile->operationCount = op.operationCount;
+        profile->byteCount = op.byteCount;
+        profile->computeCount = mProfiledComputeCount;
+        profile->totalNanoseconds = op.nanoseconds;
+        return true;
+    }
+
 }  // namespace webnn_native
@@ -15,11 +15,19 @@
 #ifndef WEBNN_NATIVE_GRAPH_H_
 #define WEBNN_NATIVE_GRAPH_H_
 
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "dawn/common/RefCounted.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/GraphBuilder.h"
+#include "dawn/native/MemoryPlan.h"
+#include "dawn/native/NamedResources.h"
 #include "dawn/native/ObjectBase.h"
+#include "dawn/native/PersistentCache.h"
 #include "dawn/native/Operand.h"
 #include "dawn/native/dawn_platform.h"
 
@@ -34,6 +42,7 @@ namespace dawn::native {
         class Gru;
         class Pad;
         class Pool2d;
+        class Quantize;
         class Reduce;
         class Resample2d;
         class Reshape;
@@ -65,25 +74,113 @@ namespace dawn::native {
         virtual MaybeError AddConcat(const op::Concat* concat);
         virtual MaybeError AddConv2d(const op::Conv2d* conv2d);
         virtual MaybeError AddGemm(const op::Gemm* gemm);
+        virtual MaybeError AddGru(const op::Gru* gru);
+        virtual MaybeError AddInstanceNorm(const op::InstanceNorm* instanceNorm);
         virtual MaybeError AddPad(const op::Pad* pad);
         virtual MaybeError AddPool2d(const op::Pool2d* pool2d);
+        virtual MaybeError AddQuantize(const op::Quantize* quantize);
         virtual MaybeError AddReduce(const op::Reduce* reduce);
         virtual MaybeError AddResample2d(const op::Resample2d* resample2d);
         virtual MaybeError AddReshape(const op::Reshape* reshape);
+        virtual MaybeError AddSlice(const op::Slice* slice);
+        virtual MaybeError AddSplit(const op::Split* split);
+        virtual MaybeError AddSqueeze(const op::Squeeze* squeeze);
         virtual MaybeError AddTranspose(const op::Transpose* transpose);
         virtual MaybeError AddUnary(const op::Unary* unary);
         virtual MaybeError Finish();
         virtual MaybeError Compile();
 
+        // Plans the memory of the intermediate operands of |operators| before they are added.
+        void PlanMemory(const std::vector<const OperatorBase*>& operators,
+                        const std::vector<const OperandBase*>& outputs);
+        const MemoryPlan& GetMemoryPlan() const;
+        // The bytes of an element of an intermediate operand of |type| as the backend stores
+        // it, GetOperandTypeSize() by default.
+        virtual size_t GetIntermediateElementSize(wgpu::OperandType type) const;
+        // The size of the arena that holds all the intermediate operands.
+        uint64_t GetIntermediateMemorySize() const;
+
+        // Sets the key of the compiled graph in the persistent cache from the hash of the graph
+        // content, see HashGraph().
+        void SetContentHash(size_t contentHash);
+        // Empty when the graph can't be cached, e.g. its constants aren't readable on the host.
+        const PersistentCacheKey& GetCacheKey() const;
+
+        // The cost of an operator in one computation as the backend ran it.
+        struct ProfiledOperator {
+            // The kernel and the variant it selected, e.g. the convolution algorithm. Both are
+            // static strings.
+            const char* name;
+            const char* variant;
+            // The arithmetic operations, 0 when the backend doesn't count them, and the bytes
+            // of the input and output tensors.
+            uint64_t operationCount;
+            uint64_t byteCount;
+            uint64_t nanoseconds;
+        };
+        // Whether the backend must time the operators of the computations, see
+        // APISetProfilingEnabled().
+        bool IsProfilingEnabled() const;
+        // Adds the operators of one computation, in execution order, to the profile.
+        void RecordProfile(const std::vector<ProfiledOperator>& operators);
+        // Makes the computations of this graph profiled as those of |graph|, which outlives it.
+        // The variants that DynamicGraph compiles for the shapes of its inputs report to it.
+        void ShareProfileWith(GraphBase* graph);
+
+        // Computes the graph, the error is returned rather than consumed by the device.
+        MaybeError Compute(NamedResourcesBase* inputs, NamedResourcesBase* outputs);
+
         // Webnn API
         void APICompute(NamedResourcesBase* inputs, NamedResourcesBase* outputs);
+        void APIComputeAsync(NamedResourcesBase* inputs,
+                             NamedResourcesBase* outputs,
+                             WGPUComputeGraphCallback callback,
+                             void* userdata);
         NamedResourcesBase* APICreateNamedResources();
+        // Enabling the profiling clears the profile of the previous computations.
+        void APISetProfilingEnabled(bool enabled);
+        size_t APIGetOperatorProfileCount();
+        bool APIGetOperatorProfile(size_t index, OperatorProfile* profile);
+
+      protected:
+        // A computation queued by APIComputeAsync().
+        struct ComputeRequest {
+            Ref<NamedResourcesBase> inputs;
+            Ref<NamedResourcesBase> outputs;
+            WGPUComputeGraphCallback callback;
+            void* userdata;
+            // Set by ComputePendingImpl() when the computation failed.
+            std::string errorMessage;
+        };
 
       private:
         GraphBase(DeviceBase* device, ObjectBase::ErrorTag tag);
         virtual MaybeError CompileImpl();
-        virtual void ComputeImpl(NamedResourcesBase* inputs,
-                                 NamedResourcesBase* outputs);
+        virtual MaybeError ComputeImpl(NamedResourcesBase* inputs,
+                                       NamedResourcesBase* outputs);
+        // Runs the requests queued by APIComputeAsync() while the previous ones were running. The
+        // default calls ComputeImpl() for every request in order, a backend can override it to
+        // share the setup of the calls, e.g. a lock. DynamicGraph merges the requests along the
+        // batch dimension.
+        virtual void ComputePendingImpl(std::vector<ComputeRequest>& requests);
+        // Runs the pending requests on a worker thread until the queue is empty.
+        void ProcessPendingComputes();
+
+        MemoryPlan mMemoryPlan;
+        PersistentCacheKey mCacheKey;
+
+        std::mutex mComputeMutex;
+        std::vector<ComputeRequest> mPendingComputes;
+        // Whether a worker thread is running ProcessPendingComputes().
+        bool mIsComputing = false;
+
+        // The graph whose profiling state and profile are those of this graph, itself by default.
+        GraphBase* mProfiledGraph = this;
+        std::atomic<bool> mProfilingEnabled{false};
+        std::mutex mProfileMutex;
+        // The operators of the profiled computations with their durations summed.
+        std::vector<ProfiledOperator> mProfile;
+        uint64_t mProfiledComputeCount = 0;
     };
 }  // namespace webnn_native
 
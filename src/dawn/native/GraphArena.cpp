@@ -0,0 +1,62 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/GraphArena.h"
+
+#include "dawn/common/Math.h"
+#include "dawn/native/ObjectBase.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        constexpr size_t kChunkSize = 64 * 1024;
+        constexpr size_t kAlignment = alignof(std::max_align_t);
+
+    }  // anonymous namespace
+
+    GraphArena::GraphArena() = default;
+
+    GraphArena::~GraphArena() {
+        // The nodes don't use the others in their destructor, they are destroyed in the reverse
+        // order of their construction as a stack would be.
+        for (auto node = mNodes.rbegin(); node != mNodes.rend(); ++node) {
+            (*node)->~ObjectBase();
+        }
+    }
+
+    void* GraphArena::Allocate(size_t size) {
+        size_t allocationSize = Align(size, kAlignment);
+        if (allocationSize > kChunkSize / 4) {
+            // Large allocations get a chunk of their own so that they don't waste the rest of
+            // the current one.
+            mChunks.emplace_back(new char[allocationSize]);
+            return mChunks.back().get();
+        }
+        if (allocationSize > mRemaining) {
+            mChunks.emplace_back(new char[kChunkSize]);
+            mCurrent = mChunks.back().get();
+            mRemaining = kChunkSize;
+        }
+        char* allocation = mCurrent;
+        mCurrent += allocationSize;
+        mRemaining -= allocationSize;
+        return allocation;
+    }
+
+    void GraphArena::Adopt(ObjectBase* node) {
+        mNodes.push_back(node);
+    }
+
+}  // namespace dawn::native
@@ -0,0 +1,55 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_GRAPH_ARENA_H_
+#define WEBNN_NATIVE_GRAPH_ARENA_H_
+
+#include "dawn/common/RefCounted.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace dawn::native {
+
+    class ObjectBase;
+
+    // The memory of the operators and operands created by a graph builder, which owns them.
+    // Allocating bumps a pointer in the current chunk instead of going to the heap for every
+    // node, and the nodes are destroyed and their chunks freed together with the arena. The
+    // nodes aren't reference counted individually: the builder holds a reference to the arena,
+    // and so does every API reference to one of its nodes, see OperandBase::Reference().
+    // Allocate() and Adopt() must not be called concurrently, as for the builder.
+    class GraphArena final : public RefCounted {
+      public:
+        GraphArena();
+
+        // Returns |size| bytes aligned as operator new would, they are freed with the arena.
+        void* Allocate(size_t size);
+        // Makes the arena destroy |node|, which was constructed in memory of Allocate(), when
+        // the arena itself is destroyed. The nodes are destroyed in the reverse order.
+        void Adopt(ObjectBase* node);
+
+      private:
+        ~GraphArena() override;
+
+        std::vector<std::unique_ptr<char[]>> mChunks;
+        char* mCurrent = nullptr;
+        size_t mRemaining = 0;
+        std::vector<ObjectBase*> mNodes;
+    };
+
+}  // namespace dawn::native
+
+#endif  // WEBNN_NATIVE_GRAPH_ARENA_H_
@@ -14,18 +14,22 @@
 
 #include "dawn/native/GraphBuilder.h"
 
-#include <stack>
 #include <string>
-#include <unordered_set>
 #include <vector>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Log.h"
 #include "dawn/common/RefCounted.h"
+#include "dawn/native/DynamicGraph.h"
 #include "dawn/native/Graph.h"
+#include "dawn/native/GraphIndex.h"
+#include "dawn/native/GraphOptimizer.h"
+#include "dawn/native/GraphSerializer.h"
 #include "dawn/native/NamedOperands.h"
 #include "dawn/native/Operand.h"
+#include "dawn/native/OperandArray.h"
 #include "dawn/native/Operator.h"
+#include "dawn/native/PersistentCache.h"
 #include "dawn/native/ops/BatchNorm.h"
 #include "dawn/native/ops/Binary.h"
 #include "dawn/native/ops/Clamp.h"
@@ -33,26 +37,34 @@
 #include "dawn/native/ops/Conv2d.h"
 #include "dawn/native/ops/Constant.h"
 #include "dawn/native/ops/Gemm.h"
+#include "dawn/native/ops/Gru.h"
 #include "dawn/native/ops/LeakyRelu.h"
 #include "dawn/native/ops/Input.h"
+#include "dawn/native/ops/InstanceNorm.h"
 #include "dawn/native/ops/Pad.h"
 #include "dawn/native/ops/Pool2d.h"
+#include "dawn/native/ops/Quantize.h"
 #include "dawn/native/ops/Reduce.h"
 #include "dawn/native/ops/Resample2d.h"
 #include "dawn/native/ops/Reshape.h"
+#include "dawn/native/ops/Slice.h"
+#include "dawn/native/ops/Split.h"
+#include "dawn/native/ops/Squeeze.h"
 #include "dawn/native/ops/Transpose.h"
 #include "dawn/native/ops/Unary.h"
 
 #define WEBNN_VALIDATE(ptr, objectBase)                                  \
-    Ref<OperatorBase> op = AcquireRef(ptr);                              \
-    if (GetDevice()->ConsumedError(op->ValidateAndInferOutputInfo())) { \
+    OperatorBase* op = ptr;                                              \
+    if (GetDevice()->ConsumedError(op->InferOutputInfo())) {            \
         return objectBase::MakeError(this);                              \
     }                                                                    \
     for (;;)                                                             \
     break
 
+// The operand is returned with a reference for the caller, which keeps its arena alive.
 #define VALIDATE_FOR_OPERAND(ptr)     \
     WEBNN_VALIDATE(ptr, OperandBase); \
+    op->PrimaryOutput()->Reference(); \
     return op->PrimaryOutput()
 #define VALIDATE_ARRAY_OPERAND(ptr)        \
     WEBNN_VALIDATE(ptr, OperandArrayBase); \
@@ -73,59 +85,60 @@ namespace dawn::native {
         return InitializeImpl();
     }
 
-    GraphBuilderBase::GraphBuilderBase(DeviceBase* device) : ObjectBase(device) {
+    GraphBuilderBase::GraphBuilderBase(DeviceBase* device)
+        : ObjectBase(device), mArena(AcquireRef(new GraphArena())) {
     }
 
     GraphBuilderBase::GraphBuilderBase(DeviceBase* device, ObjectBase::ErrorTag tag)
-        : ObjectBase(device, tag) {
+        : ObjectBase(device, tag), mArena(AcquireRef(new GraphArena())) {
     }
 
     OperandBase* GraphBuilderBase::APIConstant(OperandDescriptor const* desc,
                                                BufferResourceView const* view) {
-        VALIDATE_FOR_OPERAND(new op::Constant(this, desc, view));
+        VALIDATE_FOR_OPERAND(new (this) op::Constant(this, desc, view));
     }
 
     OperandBase* GraphBuilderBase::APIInput(char const* name, OperandDescriptor const* desc) {
-        VALIDATE_FOR_OPERAND(new op::Input(this, std::string(name), desc));
+        VALIDATE_FOR_OPERAND(new (this) op::Input(this, std::string(name), desc));
     }
 
     OperandBase* GraphBuilderBase::APIAdd(OperandBase* a, OperandBase* b) {
-        VALIDATE_FOR_OPERAND(new op::Binary(this, op::BinaryOpType::kAdd, a, b));
+        VALIDATE_FOR_OPERAND(new (this) op::Binary(this, op::BinaryOpType::kAdd, a, b));
     }
 
     OperandBase* GraphBuilderBase::APIDiv(OperandBase* a, OperandBase* b) {
-        VALIDATE_FOR_OPERAND(new op::Binary(this, op::BinaryOpType::kDiv, a, b));
+        VALIDATE_FOR_OPERAND(new (this) op::Binary(this, op::BinaryOpType::kDiv, a, b));
     }
 
     OperandBase* GraphBuilderBase::APIMul(OperandBase* a, OperandBase* b) {
-        VALIDATE_FOR_OPERAND(new op::Binary(this, op::BinaryOpType::kMul, a, b));
+        VALIDATE_FOR_OPERAND(new (this) op::Binary(this, op::BinaryOpType::kMul, a, b));
     }
 
     OperandBase* GraphBuilderBase::APISub(OperandBase* a, OperandBase* b) {
-        VALIDATE_FOR_OPERAND(new op::Binary(this, op::BinaryOpType::kSub, a, b));
+        VALIDATE_FOR_OPERAND(new (this) op::Binary(this, op::BinaryOpType::kSub, a, b));
     }
 
     OperandBase* GraphBuilderBase::APIMax(OperandBase* a, OperandBase* b) {
-        VALIDATE_FOR_OPERAND(new op::Binary(this, op::BinaryOpType::kMax, a, b));
+        VALIDATE_FOR_OPERAND(new (this) op::Binary(this, op::BinaryOpType::kMax, a, b));
     }
 
     OperandBase* GraphBuilderBase::APIMin(OperandBase* a, OperandBase* b) {
-        VALIDATE_FOR_OPERAND(new op::Binary(this, op::BinaryOpType::kMin, a, b));
+        VALIDATE_FOR_OPERAND(new (this) op::Binary(this, op::BinaryOpType::kMin, a, b));
     }
 
     OperandBase* GraphBuilderBase::APIPow(OperandBase* a, OperandBase* b) {
-        VALIDATE_FOR_OPERAND(new op::Binary(this, op::BinaryOpType::kPower, a, b));
+        VALIDATE_FOR_OPERAND(new (this) op::Binary(this, op::BinaryOpType::kPower, a, b));
     }
 
     OperandBase* GraphBuilderBase::APIBatchNorm(OperandBase* input,
                                                 OperandBase* mean,
                                                 OperandBase* variance,
                                                 BatchNormOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::BatchNorm(this, input, mean, variance, options));
+        VALIDATE_FOR_OPERAND(new (this) op::BatchNorm(this, input, mean, variance, options));
     }
 
     OperandBase* GraphBuilderBase::APIClamp(OperandBase* input, ClampOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Clamp(this, input, options));
+        VALIDATE_FOR_OPERAND(new (this) op::Clamp(this, input, options));
     }
 
     FusionOperatorBase* GraphBuilderBase::APIClampOperator(ClampOptions const* options) {
@@ -135,28 +148,51 @@ namespace dawn::native {
     OperandBase* GraphBuilderBase::APIConcat(uint32_t inputsCount,
                                              OperandBase* const* inputs,
                                              uint32_t axis) {
-        std::vector<Ref<OperandBase>> operandInputs;
+        std::vector<OperandBase*> operandInputs;
         operandInputs.reserve(inputsCount);
         for (uint32_t i = 0; i < inputsCount; ++i) {
             operandInputs.push_back(inputs[i]);
         }
-        VALIDATE_FOR_OPERAND(new op::Concat(this, std::move(operandInputs), axis));
+        VALIDATE_FOR_OPERAND(new (this) op::Concat(this, std::move(operandInputs), axis));
     }
 
     OperandBase* GraphBuilderBase::APIConv2d(OperandBase* input,
                                              OperandBase* filter,
                                              Conv2dOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Conv2d(this, input, filter, options));
+        VALIDATE_FOR_OPERAND(new (this) op::Conv2d(this, input, filter, options));
+    }
+
+    OperandBase* GraphBuilderBase::APIDequantizeLinear(OperandBase* input,
+                                                       OperandBase* scale,
+                                                       OperandBase* zeroPoint) {
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Quantize(this, op::QuantizeOpType::kDequantizeLinear, input, scale,
+                                    zeroPoint));
     }
 
     OperandBase* GraphBuilderBase::APIGemm(OperandBase* a,
                                            OperandBase* b,
                                            GemmOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Gemm(this, a, b, options));
+        VALIDATE_FOR_OPERAND(new (this) op::Gemm(this, a, b, options));
+    }
+
+    OperandArrayBase* GraphBuilderBase::APIGru(OperandBase* input,
+                                               OperandBase* weight,
+                                               OperandBase* recurrentWeight,
+                                               int32_t steps,
+                                               int32_t hiddenSize,
+                                               GruOptions const* options) {
+        VALIDATE_ARRAY_OPERAND(
+            new (this) op::Gru(this, input, weight, recurrentWeight, steps, hiddenSize, options));
+    }
+
+    OperandBase* GraphBuilderBase::APIInstanceNorm(OperandBase* input,
+                                                   InstanceNormOptions const* options) {
+        VALIDATE_FOR_OPERAND(new (this) op::InstanceNorm(this, input, options));
     }
 
     OperandBase* GraphBuilderBase::APILeakyRelu(OperandBase* input, LeakyReluOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::LeakyRelu(this, input, options));
+        VALIDATE_FOR_OPERAND(new (this) op::LeakyRelu(this, input, options));
     }
 
     FusionOperatorBase* GraphBuilderBase::APILeakyReluOperator(LeakyReluOptions const* options) {
@@ -164,26 +200,36 @@ namespace dawn::native {
     }
 
     OperandBase* GraphBuilderBase::APIMatmul(OperandBase* a, OperandBase* b) {
-        VALIDATE_FOR_OPERAND(new op::Binary(this, op::BinaryOpType::kMatMul, a, b));
+        VALIDATE_FOR_OPERAND(new (this) op::Binary(this, op::BinaryOpType::kMatMul, a, b));
     }
 
     OperandBase* GraphBuilderBase::APIAveragePool2d(OperandBase* input, Pool2dOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Pool2d(this, op::Pool2dType::kAveragePool2d, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Pool2d(this, op::Pool2dType::kAveragePool2d, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIMaxPool2d(OperandBase* input, Pool2dOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Pool2d(this, op::Pool2dType::kMaxPool2d, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Pool2d(this, op::Pool2dType::kMaxPool2d, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIPad(OperandBase* input,
                                           uint32_t const* padding,
                                           size_t padding_count,
                                           PadOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Pad(this, input, padding, padding_count, options));
+        VALIDATE_FOR_OPERAND(new (this) op::Pad(this, input, padding, padding_count, options));
+    }
+
+    OperandBase* GraphBuilderBase::APIQuantizeLinear(OperandBase* input,
+                                                     OperandBase* scale,
+                                                     OperandBase* zeroPoint) {
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Quantize(this, op::QuantizeOpType::kQuantizeLinear, input, scale,
+                                    zeroPoint));
     }
 
     OperandBase* GraphBuilderBase::APIRelu(OperandBase* x) {
-        VALIDATE_FOR_OPERAND(new op::Unary(this, op::UnaryOpType::kRelu, x));
+        VALIDATE_FOR_OPERAND(new (this) op::Unary(this, op::UnaryOpType::kRelu, x));
     }
 
     FusionOperatorBase* GraphBuilderBase::APIReluOperator() {
@@ -191,66 +237,96 @@ namespace dawn::native {
     }
 
     OperandBase* GraphBuilderBase::APIReduceArgMax(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceArgMax, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceArgMax, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReduceArgMin(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceArgMin, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceArgMin, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReduceL2(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceL2, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceL2, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReduceL1(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceL1, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceL1, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReduceMax(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceMax, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceMax, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReduceMean(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceMean, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceMean, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReduceMin(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceMin, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceMin, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReduceProduct(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceProduct, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceProduct, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReduceSum(OperandBase* input, ReduceOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Reduce(this, op::ReduceType::kReduceSum, input, options));
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Reduce(this, op::ReduceType::kReduceSum, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIResample2d(OperandBase* input,
                                                  Resample2dOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Resample2d(this, input, options));
+        VALIDATE_FOR_OPERAND(new (this) op::Resample2d(this, input, options));
     }
 
     OperandBase* GraphBuilderBase::APIReshape(OperandBase* input,
                                               int32_t const* new_shape,
                                               size_t new_shape_count) {
-        VALIDATE_FOR_OPERAND(new op::Reshape(this, input, new_shape, new_shape_count));
+        VALIDATE_FOR_OPERAND(new (this) op::Reshape(this, input, new_shape, new_shape_count));
     }
 
     OperandBase* GraphBuilderBase::APISigmoid(OperandBase* input) {
-        VALIDATE_FOR_OPERAND(new op::Unary(this, op::UnaryOpType::kSigmoid, input));
+        VALIDATE_FOR_OPERAND(new (this) op::Unary(this, op::UnaryOpType::kSigmoid, input));
     }
 
     FusionOperatorBase* GraphBuilderBase::APISigmoidOperator() {
         return new op::FusionUnary(this, FusionType::Sigmoid);
     }
 
+    OperandBase* GraphBuilderBase::APISlice(OperandBase* input,
+                                            int32_t const* starts,
+                                            uint32_t startsCount,
+                                            int32_t const* sizes,
+                                            uint32_t sizesCount,
+                                            SliceOptions const* options) {
+        VALIDATE_FOR_OPERAND(
+            new (this) op::Slice(this, input, starts, startsCount, sizes, sizesCount, options));
+    }
+
     OperandBase* GraphBuilderBase::APISoftmax(OperandBase* input) {
-        VALIDATE_FOR_OPERAND(new op::Unary(this, op::UnaryOpType::kSoftmax, input));
+        VALIDATE_FOR_OPERAND(new (this) op::Unary(this, op::UnaryOpType::kSoftmax, input));
+    }
+
+    OperandArrayBase* GraphBuilderBase::APISplit(OperandBase* input,
+                                                 uint32_t const* splits,
+                                                 uint32_t splitsCount,
+                                                 SplitOptions const* options) {
+        VALIDATE_ARRAY_OPERAND(new (this) op::Split(this, input, splits, splitsCount, options));
+    }
+
+    OperandBase* GraphBuilderBase::APISqueeze(OperandBase* input, SqueezeOptions const* options) {
+        VALIDATE_FOR_OPERAND(new (this) op::Squeeze(this, input, options));
     }
 
     OperandBase* GraphBuilderBase::APITranspose(OperandBase* input, TransposeOptions const* options) {
-        VALIDATE_FOR_OPERAND(new op::Transpose(this, input, options));
+        VALIDATE_FOR_OPERAND(new (this) op::Transpose(this, input, options));
     }
 
     NamedOperandsBase* GraphBuilderBase::APICreateNamedOperands() {
@@ -276,86 +352,156 @@ namespace dawn::native {
             dawn::ErrorLog() << "Failed to sort graph.";
             return GraphBase::MakeError(GetDevice());
         }
-        Ref<GraphBase> graph = AcquireRef(CreateGraphImpl());
-        for (auto& op : sorted_operands) {
-            if (op->IsError() || GetDevice()->ConsumedError(op->AddToGraph(graph.Get()))) {
-                dawn::ErrorLog() << "Failed to add the operand when building graph.";
-                return GraphBase::MakeError(GetDevice());
-            }
+        if (HasDynamicInputs(sorted_operands)) {
+            return BuildDynamicGraph(sorted_operands, namedOperands->GetRecords());
+        }
+        GraphOptimizer optimizer(this, std::move(sorted_operands), outputs);
+        if (GetDevice()->ConsumedError(optimizer.Optimize())) {
+            dawn::ErrorLog() << "Failed to optimize the graph.";
+            return GraphBase::MakeError(GetDevice());
         }
+        return BuildGraph(optimizer.GetOperators(), namedOperands->GetRecords());
+    }
+
+    MaybeError GraphBuilderBase::Serialize(NamedOperandsBase const* namedOperands,
+                                           const std::string& path) {
+        DAWN_INVALID_IF(IsError(), "This GraphBuilder object is an error.");
+        DAWN_INVALID_IF(namedOperands->GetRecords().empty(),
+                        "The output named operands are empty.");
+        std::vector<const OperandBase*> outputs;
         for (auto& namedOutput : namedOperands->GetRecords()) {
-            if (GetDevice()->ConsumedError(
-                    graph->AddOutput(namedOutput.first, namedOutput.second))) {
-                dawn::ErrorLog() << "Failed to add output when building graph.";
-                return GraphBase::MakeError(GetDevice());
-            }
+            outputs.push_back(namedOutput.second);
         }
-        if (GetDevice()->ConsumedError(graph->Finish())) {
-            dawn::ErrorLog() << "Failed to finish building graph.";
+        std::vector<const OperatorBase*> sorted_operands = TopologicalSort(outputs);
+        DAWN_INVALID_IF(sorted_operands.empty(), "Failed to sort graph.");
+        DAWN_INVALID_IF(HasDynamicInputs(sorted_operands),
+                        "The graphs with dynamic input dimensions can't be serialized.");
+        GraphOptimizer optimizer(this, std::move(sorted_operands), outputs);
+        DAWN_TRY(optimizer.Optimize());
+        return SerializeGraph(optimizer.GetOperators(), namedOperands->GetRecords(), path);
+    }
+
+    GraphBase* GraphBuilderBase::Load(const std::string& path) {
+        if (DAWN_UNLIKELY(this->IsError())) {
+            dawn::ErrorLog() << "This GraphBuilder object is an error";
             return GraphBase::MakeError(GetDevice());
         }
 
-        if (GetDevice()->ConsumedError(graph->Compile())) {
-            dawn::ErrorLog() << "Failed to compile the graph.";
+        std::vector<OperatorBase*> operators;
+        std::map<std::string, const OperandBase*> outputs;
+        if (GetDevice()->ConsumedError(DeserializeGraph(this, path, &operators, &outputs))) {
+            dawn::ErrorLog() << "Failed to load the graph from " << path;
             return GraphBase::MakeError(GetDevice());
         }
-
-        return graph.Detach();
+        // The serialized operators were sorted and optimized when the graph was serialized.
+        std::vector<const OperatorBase*> sorted_operators(operators.begin(), operators.end());
+        return BuildGraph(sorted_operators, outputs);
+    }
+
+    ResultOrError<Ref<GraphBase>> GraphBuilderBase::Specialize(
+        SerializedGraph* graph,
+        const std::map<std::string, std::vector<int32_t>>& inputShapes) {
+        DAWN_INVALID_IF(IsError(), "This GraphBuilder object is an error.");
+
+        std::vector<OperatorBase*> operators;
+        std::map<std::string, const OperandBase*> namedOutputs;
+        DAWN_TRY_CONTEXT(DeserializeGraph(this, graph, inputShapes, &operators, &namedOutputs),
+                         "inferring the shapes for the dimensions of the inputs");
+        // The operators were serialized in topological order as they were built.
+        std::vector<const OperatorBase*> sorted_operators(operators.begin(), operators.end());
+        std::vector<const OperandBase*> outputs;
+        for (auto& namedOutput : namedOutputs) {
+            outputs.push_back(namedOutput.second);
+        }
+        GraphOptimizer optimizer(this, std::move(sorted_operators), outputs);
+        DAWN_TRY_CONTEXT(optimizer.Optimize(), "optimizing the graph");
+        return CompileGraph(optimizer.GetOperators(), namedOutputs);
     }
 
-    // The implementation derives from nGraph topological_sort in
-    // https://github.com/openvinotoolkit/openvino/blob/master/ngraph/core/include/ngraph/graph_util.hpp
-    //
-    //*****************************************************************************
-    // Copyright 2017-2020 Intel Corporation
-    //
-    // Licensed under the Apache License, Version 2.0 (the "License");
-    // you may not use this file except in compliance with the License.
-    // You may obtain a copy of the License at
-    //
-    //     http://www.apache.org/licenses/LICENSE-2.0
-    //
-    // Unless required by applicable law or agreed to in writing, software
-    // distributed under the License is distributed on an "AS IS" BASIS,
-    // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-    // See the License for the specific language governing permissions and
-    // limitations under the License.
-    //*****************************************************************************
-    std::vector<const OperatorBase*> GraphBuilderBase::TopologicalSort(
-        std::vector<const OperandBase*>& rootNodes) {
-        std::stack<const OperatorBase*> nodesToDo;
-        std::unordered_set<const OperatorBase*> nodesDone;
-        std::vector<const OperatorBase*> result;
-
-        for (auto node : rootNodes) {
-            if (node->IsError()) {
-                return {};
+    bool GraphBuilderBase::HasDynamicInputs(const std::vector<const OperatorBase*>& operators) {
+        for (auto& op : operators) {
+            if (op->GetOperatorType() == OperatorType::Input &&
+                HasDynamicDimensions(op->PrimaryOutput()->Shape())) {
+                return true;
             }
-            nodesToDo.push(const_cast<OperandBase*>(node)->Operator());
         }
-        while (nodesToDo.size() > 0) {
-            const OperatorBase* node = nodesToDo.top();
-            if (node->IsError()) {
-                return {};
+        return false;
+    }
+
+    GraphBase* GraphBuilderBase::BuildDynamicGraph(
+        const std::vector<const OperatorBase*>& operators,
+        const std::map<std::string, const OperandBase*>& namedOutputs) {
+        std::map<std::string, DynamicGraph::DynamicInput> dynamicInputs;
+        for (auto& op : operators) {
+            const OperandBase* output = op->PrimaryOutput();
+            if (op->GetOperatorType() == OperatorType::Input &&
+                HasDynamicDimensions(output->Shape())) {
+                dynamicInputs[static_cast<const op::Input*>(op)->GetName()] = {output->Type(),
+                                                                              output->Shape()};
             }
-            if (nodesDone.count(node) == 0) {
-                bool can_add = true;
-                for (auto& dep : node->Inputs()) {
-                    if (nodesDone.count(dep->Operator()) == 0) {
-                        can_add = false;
-                        nodesToDo.push(dep->Operator());
-                    }
-                }
-                if (can_add) {
-                    result.push_back(node);
-                    nodesToDo.pop();
-                    nodesDone.insert(node);
-                }
+        }
+        // The graph is kept as it was built, it is optimized for every shape of the inputs.
+        Ref<SerializedGraph> graph;
+        if (GetDevice()->ConsumedError(SerializeGraph(operators, namedOutputs), &graph)) {
+            dawn::ErrorLog() << "Failed to build the graph with dynamic input dimensions.";
+            return GraphBase::MakeError(GetDevice());
+        }
+        return new DynamicGraph(GetDevice(), std::move(graph), std::move(dynamicInputs));
+    }
+
+    GraphBase* GraphBuilderBase::BuildGraph(
+        const std::vector<const OperatorBase*>& operators,
+        const std::map<std::string, const OperandBase*>& namedOutputs) {
+        Ref<GraphBase> graph;
+        if (GetDevice()->ConsumedError(CompileGraph(operators, namedOutputs), &graph)) {
+            dawn::ErrorLog() << "Failed to build the graph.";
+            return GraphBase::MakeError(GetDevice());
+        }
+        return graph.Detach();
+    }
+
+    ResultOrError<Ref<GraphBase>> GraphBuilderBase::CompileGraph(
+        const std::vector<const OperatorBase*>& operators,
+        const std::map<std::string, const OperandBase*>& namedOutputs) {
+        std::vector<const OperandBase*> outputs;
+        for (auto& namedOutput : namedOutputs) {
+            outputs.push_back(namedOutput.second);
+        }
+        Ref<GraphBase> graph = AcquireRef(CreateGraphImpl());
+        graph->PlanMemory(operators, outputs);
+        if (GetDevice()->GetPersistentCache()->IsEnabled()) {
+            // The graphs that can't be hashed are compiled without the cache.
+            ResultOrError<size_t> contentHash = HashGraph(operators, namedOutputs);
+            if (contentHash.IsSuccess()) {
+                graph->SetContentHash(contentHash.AcquireSuccess());
             } else {
-                nodesToDo.pop();
+                contentHash.AcquireError();
             }
         }
-        return result;
+        for (auto& op : operators) {
+            DAWN_INVALID_IF(op->IsError(), "An operator of the graph is an error.");
+            DAWN_TRY_CONTEXT(op->AddToGraph(graph.Get()), "adding an operator to the graph");
+        }
+        for (auto& namedOutput : namedOutputs) {
+            DAWN_TRY_CONTEXT(graph->AddOutput(namedOutput.first, namedOutput.second),
+                             "adding the output %s to the graph", namedOutput.first);
+        }
+        DAWN_TRY_CONTEXT(graph->Finish(), "finishing the graph");
+        DAWN_TRY_CONTEXT(graph->Compile(), "compiling the graph");
+        return graph;
+    }
+
+    std::vector<const OperatorBase*> GraphBuilderBase::TopologicalSort(
+        std::vector<const OperandBase*>& rootNodes) {
+        GraphIndex index;
+        if (!index.Initialize(rootNodes)) {
+            return {};
+        }
+        return index.TopologicalSort();
+    }
+
+    bool GraphBuilderBase::SupportsQuantizedOperators() const {
+        return false;
     }
 
     bool GraphBuilderBase::InitializeImpl() {
@@ -18,6 +18,7 @@
 #include "dawn/common/RefCounted.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/Device.h"
+#include "dawn/native/GraphArena.h"
 #include "dawn/native/NamedOperands.h"
 #include "dawn/native/ObjectBase.h"
 #include "dawn/native/Operand.h"
@@ -25,10 +26,14 @@
 #include "dawn/native/dawn_platform.h"
 
 #include <functional>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace dawn::native {
 
+    class SerializedGraph;
+
     class GraphBuilderBase : public ObjectBase {
       public:
         static GraphBuilderBase* Create(DeviceBase* context);
@@ -55,13 +60,22 @@ namespace dawn::native {
         FusionOperatorBase* APIClampOperator(ClampOptions const* options);
         OperandBase* APIConcat(uint32_t inputsCount, OperandBase* const* inputs, uint32_t axis);
         OperandBase* APIConv2d(OperandBase*, OperandBase*, Conv2dOptions const* options);
+        OperandBase* APIDequantizeLinear(OperandBase*, OperandBase*, OperandBase*);
         OperandBase* APIGemm(OperandBase*, OperandBase*, GemmOptions const* options);
+        OperandArrayBase* APIGru(OperandBase*,
+                                 OperandBase*,
+                                 OperandBase*,
+                                 int32_t steps,
+                                 int32_t hiddenSize,
+                                 GruOptions const* options);
+        OperandBase* APIInstanceNorm(OperandBase*, InstanceNormOptions const* options);
         OperandBase* APILeakyRelu(OperandBase*, LeakyReluOptions const* options);
         FusionOperatorBase* APILeakyReluOperator(LeakyReluOptions const* options);
         OperandBase* APIMatmul(OperandBase* a, OperandBase* b);
         OperandBase* APIAveragePool2d(OperandBase*, Pool2dOptions const* options);
         OperandBase* APIMaxPool2d(OperandBase*, Pool2dOptions const* options);
         OperandBase* APIPad(OperandBase*, uint32_t const*, size_t, PadOptions const* options);
+        OperandBase* APIQuantizeLinear(OperandBase*, OperandBase*, OperandBase*);
         OperandBase* APIReshape(OperandBase*, int32_t const*, size_t);
         OperandBase* APISigmoid(OperandBase*);
         FusionOperatorBase* APISigmoidOperator();
@@ -77,11 +91,42 @@ namespace dawn::native {
         OperandBase* APIReduceProduct(OperandBase*, ReduceOptions const* options);
         OperandBase* APIReduceSum(OperandBase*, ReduceOptions const* options);
         OperandBase* APIResample2d(OperandBase*, Resample2dOptions const* options);
+        OperandBase* APISlice(OperandBase*,
+                              int32_t const* starts,
+                              uint32_t startsCount,
+                              int32_t const* sizes,
+                              uint32_t sizesCount,
+                              SliceOptions const* options);
         OperandBase* APISoftmax(OperandBase*);
+        OperandArrayBase* APISplit(OperandBase*,
+                                   uint32_t const* splits,
+                                   uint32_t splitsCount,
+                                   SplitOptions const* options);
+        OperandBase* APISqueeze(OperandBase*, SqueezeOptions const* options);
         OperandBase* APITranspose(OperandBase*, TransposeOptions const* options);
         NamedOperandsBase* APICreateNamedOperands();
         GraphBase* APIBuild(NamedOperandsBase const* namedOperands);
 
+        // Optimizes the graph computing |namedOperands| and serializes it to the file at |path|.
+        MaybeError Serialize(NamedOperandsBase const* namedOperands, const std::string& path);
+        // Builds the graph serialized to the file at |path|, its constants are read from the
+        // file mapped in memory.
+        GraphBase* Load(const std::string& path);
+        // Builds the graph with dynamic input dimensions serialized in |graph| for the concrete
+        // dimensions of its inputs given in |inputShapes|, see DynamicGraph.
+        ResultOrError<Ref<GraphBase>> Specialize(
+            SerializedGraph* graph,
+            const std::map<std::string, std::vector<int32_t>>& inputShapes);
+
+        // Whether the graphs of the backend compute Conv2d and Gemm on quantized operands, in
+        // which case GraphOptimizer folds the dequantizeLinear and quantizeLinear around them.
+        virtual bool SupportsQuantizedOperators() const;
+
+        // The memory of the operators and operands created by this builder.
+        GraphArena* GetArena() const {
+            return mArena.Get();
+        }
+
       protected:
         GraphBuilderBase(DeviceBase* context);
         GraphBuilderBase(DeviceBase* device, ObjectBase::ErrorTag tag);
@@ -91,8 +136,25 @@ namespace dawn::native {
         std::vector<const OperatorBase*> TopologicalSort(
             std::vector<const OperandBase*>& rootNodes);
 
+        // Whether some of the inputs among |operators| have dynamic dimensions.
+        static bool HasDynamicInputs(const std::vector<const OperatorBase*>& operators);
+        // Builds a DynamicGraph from the sorted |operators| and the |namedOutputs|, it is
+        // compiled for the shapes of its inputs when it is computed.
+        GraphBase* BuildDynamicGraph(const std::vector<const OperatorBase*>& operators,
+                                     const std::map<std::string, const OperandBase*>& namedOutputs);
+        // Adds the sorted |operators| and the |namedOutputs| to a new graph and compiles it, an
+        // error graph is returned when it fails.
+        GraphBase* BuildGraph(const std::vector<const OperatorBase*>& operators,
+                              const std::map<std::string, const OperandBase*>& namedOutputs);
+        ResultOrError<Ref<GraphBase>> CompileGraph(
+            const std::vector<const OperatorBase*>& operators,
+            const std::map<std::string, const OperandBase*>& namedOutputs);
+
         virtual bool InitializeImpl();
         virtual GraphBase* CreateGraphImpl();
+
+      private:
+        Ref<GraphArena> mArena;
     };
 
 }  // namespace dawn::native
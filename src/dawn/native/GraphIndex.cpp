@@ -0,0 +1,169 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/GraphIndex.h"
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native {
+
+    GraphIndex::GraphIndex(std::vector<const OperatorBase*> operators)
+        : mOperators(std::move(operators)) {
+        mOperatorIds.reserve(mOperators.size());
+        for (uint32_t id = 0; id < mOperators.size(); ++id) {
+            mOperatorIds.emplace(mOperators[id], id);
+        }
+        IndexEdges();
+    }
+
+    bool GraphIndex::Initialize(const std::vector<const OperandBase*>& outputs) {
+        mOperators.clear();
+        mOperatorIds.clear();
+        // Each operator is pushed once, when it is first found, so the walk is linear in the
+        // number of edges however wide and deep the graph is.
+        std::vector<const OperatorBase*> operatorsToVisit;
+        auto visit = [&](const OperandBase* operand) {
+            if (operand->IsError() || operand->Operator()->IsError()) {
+                return false;
+            }
+            const OperatorBase* op = operand->Operator();
+            if (mOperatorIds.emplace(op, static_cast<uint32_t>(mOperators.size())).second) {
+                mOperators.push_back(op);
+                operatorsToVisit.push_back(op);
+            }
+            return true;
+        };
+        for (const OperandBase* output : outputs) {
+            if (!visit(output)) {
+                return false;
+            }
+        }
+        while (!operatorsToVisit.empty()) {
+            const OperatorBase* op = operatorsToVisit.back();
+            operatorsToVisit.pop_back();
+            for (auto& input : op->Inputs()) {
+                if (!visit(input)) {
+                    return false;
+                }
+            }
+        }
+        IndexEdges();
+        return true;
+    }
+
+    void GraphIndex::IndexEdges() {
+        size_t operatorCount = mOperators.size();
+        mOutputOffsets.assign(operatorCount + 1, 0);
+        mInputOffsets.assign(operatorCount + 1, 0);
+        for (size_t id = 0; id < operatorCount; ++id) {
+            mOutputOffsets[id + 1] = mOutputOffsets[id] + mOperators[id]->Outputs().size();
+            mInputOffsets[id + 1] = mInputOffsets[id] + mOperators[id]->Inputs().size();
+        }
+
+        mProducers.resize(mOutputOffsets[operatorCount]);
+        for (uint32_t id = 0; id < operatorCount; ++id) {
+            for (uint32_t operand = mOutputOffsets[id]; operand < mOutputOffsets[id + 1];
+                 ++operand) {
+                mProducers[operand] = id;
+            }
+        }
+
+        // The consumers are bucketed by operand in two passes, counting then placing, and
+        // come out in increasing order since the operators are visited in order.
+        mInputs.resize(mInputOffsets[operatorCount]);
+        mConsumerOffsets.assign(mProducers.size() + 1, 0);
+        for (uint32_t id = 0; id < operatorCount; ++id) {
+            uint32_t* inputs = mInputs.data() + mInputOffsets[id];
+            for (auto& input : mOperators[id]->Inputs()) {
+                *inputs = GetOperandId(input);
+                if (*inputs != kInvalidId) {
+                    mConsumerOffsets[*inputs + 1]++;
+                }
+                ++inputs;
+            }
+        }
+        for (size_t operand = 0; operand < mProducers.size(); ++operand) {
+            mConsumerOffsets[operand + 1] += mConsumerOffsets[operand];
+        }
+        mConsumers.resize(mConsumerOffsets.back());
+        std::vector<uint32_t> consumerCounts(mProducers.size(), 0);
+        for (uint32_t id = 0; id < operatorCount; ++id) {
+            for (uint32_t input : GetInputs(id)) {
+                if (input != kInvalidId) {
+                    mConsumers[mConsumerOffsets[input] + consumerCounts[input]++] = id;
+                }
+            }
+        }
+    }
+
+    uint32_t GraphIndex::GetOperatorId(const OperatorBase* op) const {
+        auto id = mOperatorIds.find(op);
+        return id == mOperatorIds.end() ? kInvalidId : id->second;
+    }
+
+    uint32_t GraphIndex::GetOperandId(const OperandBase* operand) const {
+        uint32_t id = GetOperatorId(operand->Operator());
+        if (id == kInvalidId) {
+            return kInvalidId;
+        }
+        const std::vector<OperandBase*>& outputs = mOperators[id]->Outputs();
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            if (outputs[i] == operand) {
+                return mOutputOffsets[id] + i;
+            }
+        }
+        return kInvalidId;
+    }
+
+    std::vector<const OperatorBase*> GraphIndex::TopologicalSort() const {
+        // Kahn's algorithm: an operator is ready once all the operators it reads from are
+        // placed. The ready operators are taken last in first out, and the sources are taken
+        // in the order of their ids.
+        size_t operatorCount = mOperators.size();
+        std::vector<uint32_t> pendingInputs(operatorCount, 0);
+        std::vector<uint32_t> readyOperators;
+        for (uint32_t id = operatorCount; id-- > 0;) {
+            for (uint32_t input : GetInputs(id)) {
+                if (input != kInvalidId) {
+                    pendingInputs[id]++;
+                }
+            }
+            if (pendingInputs[id] == 0) {
+                readyOperators.push_back(id);
+            }
+        }
+
+        std::vector<const OperatorBase*> sorted;
+        sorted.reserve(operatorCount);
+        while (!readyOperators.empty()) {
+            uint32_t id = readyOperators.back();
+            readyOperators.pop_back();
+            sorted.push_back(mOperators[id]);
+            for (uint32_t operand = mOutputOffsets[id + 1]; operand-- > mOutputOffsets[id];) {
+                IdRange consumers = GetConsumers(operand);
+                for (auto consumer = consumers.end(); consumer != consumers.begin();) {
+                    --consumer;
+                    if (--pendingInputs[*consumer] == 0) {
+                        readyOperators.push_back(*consumer);
+                    }
+                }
+            }
+        }
+        if (sorted.size() != operatorCount) {
+            return {};
+        }
+        return sorted;
+    }
+
+}  // namespace dawn::native
@@ -0,0 +1,124 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_GRAPH_INDEX_H_
+#define WEBNN_NATIVE_GRAPH_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native {
+
+    // The operators of a graph and the edges between them in flat arrays. The operators and
+    // their outputs get dense ids, the input operands of each operator and the operators
+    // consuming each operand are stored contiguously, so that the passes over large graphs
+    // index arrays instead of looking pointers up in hash sets.
+    class GraphIndex {
+      public:
+        static constexpr uint32_t kInvalidId = std::numeric_limits<uint32_t>::max();
+
+        // The ids stored contiguously for an operator or an operand.
+        class IdRange {
+          public:
+            IdRange(const uint32_t* begin, const uint32_t* end) : mBegin(begin), mEnd(end) {
+            }
+            const uint32_t* begin() const {
+                return mBegin;
+            }
+            const uint32_t* end() const {
+                return mEnd;
+            }
+            size_t size() const {
+                return mEnd - mBegin;
+            }
+
+          private:
+            const uint32_t* mBegin;
+            const uint32_t* mEnd;
+        };
+
+        GraphIndex() = default;
+        // Indexes |operators|, the id of an operator is its position.
+        explicit GraphIndex(std::vector<const OperatorBase*> operators);
+
+        // Indexes the operators that |outputs| depend on, in no particular order. Returns false
+        // if one of them or of their operands is an error.
+        bool Initialize(const std::vector<const OperandBase*>& outputs);
+
+        size_t GetOperatorCount() const {
+            return mOperators.size();
+        }
+        size_t GetOperandCount() const {
+            return mProducers.size();
+        }
+        const OperatorBase* GetOperator(uint32_t id) const {
+            return mOperators[id];
+        }
+        // Returns kInvalidId if |op| is not indexed.
+        uint32_t GetOperatorId(const OperatorBase* op) const;
+        uint32_t GetOperandId(const OperandBase* operand) const;
+        // The operator producing the operand |id|.
+        uint32_t GetProducer(uint32_t id) const {
+            return mProducers[id];
+        }
+
+        // The operands read by the operator |id|, in the order of its inputs. The operands
+        // produced by an operator that is not indexed are kInvalidId.
+        IdRange GetInputs(uint32_t id) const {
+            return {mInputs.data() + mInputOffsets[id], mInputs.data() + mInputOffsets[id + 1]};
+        }
+        // The operands written by the operator |id|, which have consecutive ids.
+        uint32_t GetFirstOutput(uint32_t id) const {
+            return mOutputOffsets[id];
+        }
+        uint32_t GetOutputCount(uint32_t id) const {
+            return mOutputOffsets[id + 1] - mOutputOffsets[id];
+        }
+        // The operators reading the operand |id| in increasing order, an operator reading it
+        // several times appears as many times.
+        IdRange GetConsumers(uint32_t id) const {
+            return {mConsumers.data() + mConsumerOffsets[id],
+                    mConsumers.data() + mConsumerOffsets[id + 1]};
+        }
+
+        // Returns the operators ordered so that each comes after the producers of its inputs,
+        // or an empty vector if there is a cycle. The operators are taken depth first, each
+        // followed as soon as possible by its consumers, which keeps the intermediate operands
+        // alive for a short time.
+        std::vector<const OperatorBase*> TopologicalSort() const;
+
+      private:
+        // Fills the arrays of the edges from mOperators and mOperatorIds.
+        void IndexEdges();
+
+        std::vector<const OperatorBase*> mOperators;
+        std::unordered_map<const OperatorBase*, uint32_t> mOperatorIds;
+        // The first operand id of each operator, followed by the operand count.
+        std::vector<uint32_t> mOutputOffsets;
+        std::vector<uint32_t> mProducers;
+        std::vector<uint32_t> mInputOffsets;
+        std::vector<uint32_t> mInputs;
+        std::vector<uint32_t> mConsumerOffsets;
+        std::vector<uint32_t> mConsumers;
+    };
+
+}  // namespace dawn::native
+
+#endif  // WEBNN_NATIVE_GRAPH_INDEX_H_
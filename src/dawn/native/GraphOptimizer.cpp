@@ -0,0 +1,1188 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "dawn/native/GraphOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/native/Buffer.h"
+#include "dawn/native/Device.h"
+#include "dawn/native/GraphBuilder.h"
+#include "dawn/native/GraphIndex.h"
+#include "dawn/native/ops/BatchNorm.h"
+#include "dawn/native/ops/Binary.h"
+#include "dawn/native/ops/Clamp.h"
+#include "dawn/native/ops/Concat.h"
+#include "dawn/native/ops/Constant.h"
+#include "dawn/native/ops/Conv2d.h"
+#include "dawn/native/ops/Gemm.h"
+#include "dawn/native/ops/LeakyRelu.h"
+#include "dawn/native/ops/Pool2d.h"
+#include "dawn/native/ops/Quantize.h"
+#include "dawn/native/ops/Reshape.h"
+#include "dawn/native/ops/Transpose.h"
+#include "dawn/native/ops/Unary.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        std::vector<size_t> GetStrides(const std::vector<int32_t>& shape) {
+            std::vector<size_t> strides(shape.size());
+            size_t stride = 1;
+            for (size_t i = shape.size(); i-- > 0;) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            return strides;
+        }
+
+        // The strides of |shape| aligned to the right of |rank| dimensions, 0 for the broadcast
+        // dimensions.
+        std::vector<size_t> GetBroadcastStrides(const std::vector<int32_t>& shape, size_t rank) {
+            std::vector<size_t> strides = GetStrides(shape);
+            std::vector<size_t> broadcastStrides(rank, 0);
+            for (size_t i = 0; i < shape.size(); ++i) {
+                broadcastStrides[rank - shape.size() + i] = shape[i] == 1 ? 0 : strides[i];
+            }
+            return broadcastStrides;
+        }
+
+        // The offset of the element |index| of |shape| in a tensor traversed with |strides|.
+        size_t GetOffset(size_t index,
+                         const std::vector<int32_t>& shape,
+                         const std::vector<size_t>& strides) {
+            size_t offset = 0;
+            for (size_t i = shape.size(); i-- > 0;) {
+                offset += index % shape[i] * strides[i];
+                index /= shape[i];
+            }
+            return offset;
+        }
+
+        bool ComputeUnary(op::UnaryOpType type, float alpha, float x, float* y) {
+            switch (type) {
+                case op::UnaryOpType::kAbs:
+                    *y = std::fabs(x);
+                    return true;
+                case op::UnaryOpType::kCeil:
+                    *y = std::ceil(x);
+                    return true;
+                case op::UnaryOpType::kCos:
+                    *y = std::cos(x);
+                    return true;
+                case op::UnaryOpType::kExp:
+                    *y = std::exp(x);
+                    return true;
+                case op::UnaryOpType::kFloor:
+                    *y = std::floor(x);
+                    return true;
+                case op::UnaryOpType::kHardSwish:
+                    *y = x * std::min(std::max(x + 3.0f, 0.0f), 6.0f) / 6.0f;
+                    return true;
+                case op::UnaryOpType::kLog:
+                    *y = std::log(x);
+                    return true;
+                case op::UnaryOpType::kLeakyRelu:
+                    *y = x < 0 ? alpha * x : x;
+                    return true;
+                case op::UnaryOpType::kNeg:
+                    *y = -x;
+                    return true;
+                case op::UnaryOpType::kRelu:
+                    *y = std::max(x, 0.0f);
+                    return true;
+                case op::UnaryOpType::kSigmoid:
+                    *y = 1.0f / (1.0f + std::exp(-x));
+                    return true;
+                case op::UnaryOpType::kSin:
+                    *y = std::sin(x);
+                    return true;
+                case op::UnaryOpType::kTan:
+                    *y = std::tan(x);
+                    return true;
+                case op::UnaryOpType::kTanh:
+                    *y = std::tanh(x);
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        float ComputeBinary(op::BinaryOpType type, float a, float b) {
+            switch (type) {
+                case op::BinaryOpType::kAdd:
+                    return a + b;
+                case op::BinaryOpType::kSub:
+                    return a - b;
+                case op::BinaryOpType::kMul:
+                    return a * b;
+                case op::BinaryOpType::kDiv:
+                    return a / b;
+                case op::BinaryOpType::kMax:
+                    return std::max(a, b);
+                case op::BinaryOpType::kMin:
+                    return std::min(a, b);
+                case op::BinaryOpType::kPower:
+                    return std::pow(a, b);
+                default:
+                    DAWN_UNREACHABLE();
+            }
+        }
+
+        // The permutations of op::Transpose between the two layouts of Conv2d and Pool2d.
+        const std::vector<int32_t> kNchwToNhwc = {0, 2, 3, 1};
+        const std::vector<int32_t> kNhwcToNchw = {0, 3, 1, 2};
+
+        bool IsIdentityPermutation(const std::vector<int32_t>& permutation) {
+            for (size_t i = 0; i < permutation.size(); ++i) {
+                if (permutation[i] != static_cast<int32_t>(i)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::vector<int32_t> InvertPermutation(const std::vector<int32_t>& permutation) {
+            std::vector<int32_t> inverse(permutation.size());
+            for (size_t i = 0; i < permutation.size(); ++i) {
+                inverse[permutation[i]] = static_cast<int32_t>(i);
+            }
+            return inverse;
+        }
+
+        // Returns true if transposing |shape| keeps the order of the dimensions larger than 1,
+        // the data is then not moved.
+        bool KeepsDataOrder(const std::vector<int32_t>& shape,
+                            const std::vector<int32_t>& permutation) {
+            int32_t previous = -1;
+            for (int32_t axis : permutation) {
+                if (shape[axis] == 1) {
+                    continue;
+                }
+                if (axis < previous) {
+                    return false;
+                }
+                previous = axis;
+            }
+            return true;
+        }
+
+        OperatorBase* CreateTranspose(GraphBuilderBase* builder,
+                                      OperandBase* input,
+                                      const std::vector<int32_t>& permutation) {
+            TransposeOptions options;
+            options.permutation = permutation.data();
+            options.permutationCount = permutation.size();
+            return new (builder) op::Transpose(builder, input, &options);
+        }
+
+        OperatorBase* CreateReshape(GraphBuilderBase* builder,
+                                    OperandBase* input,
+                                    const std::vector<int32_t>& shape) {
+            return new (builder) op::Reshape(builder, input, shape.data(), shape.size());
+        }
+
+        // Relu is the clamp to [0, +inf).
+        bool GetClampRange(const FusionOperatorBase* activation,
+                           float* minValue,
+                           float* maxValue) {
+            switch (activation->GetFusionType()) {
+                case FusionType::Clamp: {
+                    auto clamp = static_cast<const op::FusionClamp*>(activation);
+                    *minValue = clamp->GetMinValue();
+                    *maxValue = clamp->GetMaxValue();
+                    return true;
+                }
+                case FusionType::Relu:
+                    *minValue = 0;
+                    *maxValue = std::numeric_limits<float>::infinity();
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+    }  // anonymous namespace
+
+    GraphOptimizer::GraphOptimizer(GraphBuilderBase* builder,
+                                   std::vector<const OperatorBase*> operators,
+                                   const std::vector<const OperandBase*>& outputs)
+        : mBuilder(builder),
+          mOperators(std::move(operators)),
+          mOutputs(outputs.begin(), outputs.end()) {
+    }
+
+    MaybeError GraphOptimizer::Optimize() {
+        DAWN_TRY(PropagateLayouts());
+        DAWN_TRY(FoldConstants());
+        DAWN_TRY(FuseOperators());
+        EliminateDeadOperators();
+        return {};
+    }
+
+    void GraphOptimizer::UpdateUseCounts() {
+        mUseCounts.clear();
+        for (const OperatorBase* op : mOperators) {
+            for (auto& input : op->Inputs()) {
+                mUseCounts[input]++;
+            }
+        }
+    }
+
+    MaybeError GraphOptimizer::PropagateLayouts() {
+        UpdateUseCounts();
+        std::vector<const OperatorBase*> operators = std::move(mOperators);
+        mOperators.clear();
+        mOperators.reserve(operators.size());
+        for (const OperatorBase* op : operators) {
+            ForwardInputs(op);
+            bool rewritten = false;
+            switch (op->GetOperatorType()) {
+                case OperatorType::Transpose:
+                    DAWN_TRY(MergeTranspose(op, &rewritten));
+                    break;
+                case OperatorType::Reshape:
+                    DAWN_TRY(MergeReshape(op, &rewritten));
+                    break;
+                case OperatorType::Binary:
+                case OperatorType::Clamp:
+                case OperatorType::Conv2d:
+                case OperatorType::Pool2d:
+                case OperatorType::Unary:
+                    DAWN_TRY(SinkTranspose(op, &rewritten));
+                    break;
+                default:
+                    break;
+            }
+            if (!rewritten) {
+                mOperators.push_back(op);
+            }
+        }
+        mForwardedOperands.clear();
+        // The Transpose moved after their consumers are no longer used.
+        EliminateDeadOperators();
+        return {};
+    }
+
+    MaybeError GraphOptimizer::FoldConstants() {
+        std::vector<const OperatorBase*> operators = std::move(mOperators);
+        mOperators.clear();
+        mOperators.reserve(operators.size());
+        for (const OperatorBase* op : operators) {
+            // |op| may be released once it is folded.
+            bool folded = false;
+            DAWN_TRY(FoldConstant(op, &folded));
+            if (!folded) {
+                mOperators.push_back(op);
+            }
+        }
+        return {};
+    }
+
+    MaybeError GraphOptimizer::FuseOperators() {
+        UpdateUseCounts();
+        std::vector<const OperatorBase*> operators = std::move(mOperators);
+        mOperators.clear();
+        mOperators.reserve(operators.size());
+        for (const OperatorBase* op : operators) {
+            // |op| may be released once it is fused.
+            bool fused = false;
+            switch (op->GetOperatorType()) {
+                case OperatorType::Binary:
+                    DAWN_TRY(FuseConv2dAdd(op, &fused));
+                    break;
+                case OperatorType::BatchNorm:
+                    DAWN_TRY(FuseConv2dBatchNorm(op, &fused));
+                    break;
+                case OperatorType::Clamp:
+                case OperatorType::Unary:
+                    DAWN_TRY(FuseActivation(op, &fused));
+                    break;
+                case OperatorType::Quantize:
+                    if (mBuilder->SupportsQuantizedOperators()) {
+                        DAWN_TRY(FuseQuantizedOperator(op, &fused));
+                    }
+                    break;
+                default:
+                    break;
+            }
+            if (!fused) {
+                mOperators.push_back(op);
+            }
+        }
+        mOperators.erase(std::remove(mOperators.begin(), mOperators.end(), nullptr),
+                         mOperators.end());
+        return {};
+    }
+
+    void GraphOptimizer::EliminateDeadOperators() {
+        GraphIndex index(std::move(mOperators));
+        std::vector<bool> liveOperators(index.GetOperatorCount(), false);
+        for (const OperandBase* output : mOutputs) {
+            uint32_t id = index.GetOperatorId(output->Operator());
+            if (id != GraphIndex::kInvalidId) {
+                liveOperators[id] = true;
+            }
+        }
+        // The consumers come after their producers, so a backward sweep finds all the live
+        // operators. The inputs are kept so that the graph accepts the same named inputs.
+        mOperators.clear();
+        for (uint32_t id = index.GetOperatorCount(); id-- > 0;) {
+            if (!liveOperators[id] &&
+                index.GetOperator(id)->GetOperatorType() != OperatorType::Input) {
+                continue;
+            }
+            for (uint32_t input : index.GetInputs(id)) {
+                if (input != GraphIndex::kInvalidId) {
+                    liveOperators[index.GetProducer(input)] = true;
+                }
+            }
+            mOperators.push_back(index.GetOperator(id));
+        }
+        std::reverse(mOperators.begin(), mOperators.end());
+    }
+
+    const OperatorBase* GraphOptimizer::GetFusibleProducer(const OperandBase* operand) const {
+        if (mOutputs.find(operand) != mOutputs.end()) {
+            return nullptr;
+        }
+        auto useCount = mUseCounts.find(operand);
+        if (useCount == mUseCounts.end() || useCount->second != 1) {
+            return nullptr;
+        }
+        return operand->Operator();
+    }
+
+    Ref<FusionOperatorBase> GraphOptimizer::CreateActivation(const OperatorBase* op) {
+        // Tanh and HardSwish are not fused because not all the backends support them as fused
+        // activations.
+        if (op->GetOperatorType() == OperatorType::Clamp) {
+            auto clamp = static_cast<const op::Clamp*>(op);
+            ClampOptions options;
+            options.minValue = clamp->GetMinValue();
+            options.maxValue = clamp->GetMaxValue();
+            return AcquireRef(new op::FusionClamp(mBuilder, &options));
+        }
+        if (op->GetOperatorType() != OperatorType::Unary) {
+            return nullptr;
+        }
+        switch (static_cast<const op::Unary*>(op)->GetType()) {
+            case op::UnaryOpType::kRelu:
+                return AcquireRef(new op::FusionUnary(mBuilder, FusionType::Relu));
+            case op::UnaryOpType::kSigmoid:
+                return AcquireRef(new op::FusionUnary(mBuilder, FusionType::Sigmoid));
+            case op::UnaryOpType::kLeakyRelu: {
+                LeakyReluOptions options;
+                options.alpha = static_cast<const op::LeakyRelu*>(op)->GetAlpha();
+                return AcquireRef(new op::FusionLeakyRelu(mBuilder, &options));
+            }
+            default:
+                return nullptr;
+        }
+    }
+
+    Ref<FusionOperatorBase> GraphOptimizer::MergeActivations(FusionOperatorBase* first,
+                                                             FusionOperatorBase* second) {
+        if (first == nullptr) {
+            return second;
+        }
+        // Only the clamps can be merged, into the intersection of their ranges.
+        float firstMin, firstMax, secondMin, secondMax;
+        if (!GetClampRange(first, &firstMin, &firstMax) ||
+            !GetClampRange(second, &secondMin, &secondMax)) {
+            return nullptr;
+        }
+        ClampOptions options;
+        options.minValue = std::max(firstMin, secondMin);
+        options.maxValue = std::min(firstMax, secondMax);
+        if (options.minValue > options.maxValue) {
+            return nullptr;
+        }
+        return AcquireRef(new op::FusionClamp(mBuilder, &options));
+    }
+
+    const uint8_t* GraphOptimizer::GetConstantBytes(const OperandBase* operand) const {
+        const OperatorBase* op = operand->Operator();
+        if (op->GetOperatorType() != OperatorType::Constant) {
+            return nullptr;
+        }
+        auto constant = static_cast<const op::Constant*>(op);
+        const uint8_t* data = constant->GetHostData();
+        size_t elementSize = GetOperandTypeSize(operand->Type());
+        if (data == nullptr || reinterpret_cast<uintptr_t>(data) % elementSize != 0 ||
+            constant->GetSize() < GetElementCount(operand->Shape()) * elementSize) {
+            return nullptr;
+        }
+        return data;
+    }
+
+    const float* GraphOptimizer::GetConstantData(const OperandBase* operand) const {
+        if (operand->Type() != wgpu::OperandType::Float32) {
+            return nullptr;
+        }
+        return reinterpret_cast<const float*>(GetConstantBytes(operand));
+    }
+
+    bool GraphOptimizer::GetQuantizationParameters(const OperatorBase* quantize,
+                                                   size_t channelAxis,
+                                                   size_t channels,
+                                                   std::vector<float>* scales,
+                                                   std::vector<int32_t>* zeroPoints) const {
+        const OperandBase* scale = quantize->Inputs()[1];
+        const OperandBase* zeroPoint = quantize->Inputs()[2];
+        const float* scaleData = GetConstantData(scale);
+        const uint8_t* zeroPointData = GetConstantBytes(zeroPoint);
+        if (scaleData == nullptr || zeroPointData == nullptr) {
+            return false;
+        }
+        size_t count = GetElementCount(scale->Shape());
+        if (count != 1) {
+            // The shape is right aligned with the input.
+            const std::vector<int32_t>& shape = scale->Shape();
+            size_t rank = quantize->Inputs()[0]->Shape().size();
+            if (channels == 1 || count != channels) {
+                return false;
+            }
+            for (size_t i = 0; i < shape.size(); ++i) {
+                size_t axis = rank - shape.size() + i;
+                if (axis != channelAxis && shape[i] != 1) {
+                    return false;
+                }
+            }
+        }
+        scales->assign(scaleData, scaleData + count);
+        zeroPoints->resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            switch (zeroPoint->Type()) {
+                case wgpu::OperandType::Int8:
+                    (*zeroPoints)[i] = reinterpret_cast<const int8_t*>(zeroPointData)[i];
+                    break;
+                case wgpu::OperandType::Uint8:
+                    (*zeroPoints)[i] = zeroPointData[i];
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    ResultOrError<OperatorBase*> GraphOptimizer::CreateConstant(std::vector<int32_t> shape,
+                                                                wgpu::OperandType type,
+                                                                const void* data,
+                                                                size_t byteSize) {
+        // The size of a buffer mapped at creation must be a multiple of 4.
+        BufferDescriptor bufferDesc;
+        bufferDesc.usage = wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc;
+        bufferDesc.size = Align(byteSize, 4);
+        bufferDesc.mappedAtCreation = true;
+        Ref<BufferBase> buffer;
+        DAWN_TRY_ASSIGN(buffer, mBuilder->GetDevice()->CreateBuffer(&bufferDesc));
+        void* mappedData = buffer->GetMappedRange(0, bufferDesc.size);
+        if (mappedData == nullptr) {
+            return DAWN_INTERNAL_ERROR("Failed to map the buffer of the folded constant.");
+        }
+        memcpy(mappedData, data, byteSize);
+        buffer->Unmap();
+
+        OperandDescriptor desc;
+        desc.type = type;
+        desc.dimensions = shape.data();
+        desc.dimensionsCount = shape.size();
+        BufferResourceView view;
+        view.resource = buffer.Get();
+        view.offset = 0;
+        view.size = byteSize;
+        OperatorBase* constant = new (mBuilder) op::Constant(mBuilder, &desc, &view);
+        DAWN_TRY(constant->ValidateAndInferOutputInfo());
+        return constant;
+    }
+
+    ResultOrError<OperandBase*> GraphOptimizer::AddConstant(std::vector<int32_t> shape,
+                                                            const std::vector<float>& data) {
+        OperatorBase* constant = nullptr;
+        DAWN_TRY_ASSIGN(constant, CreateConstant(std::move(shape), wgpu::OperandType::Float32,
+                                                 data.data(), data.size() * sizeof(float)));
+        mOperators.push_back(constant);
+        return constant->PrimaryOutput();
+    }
+
+    MaybeError GraphOptimizer::MergeTranspose(const OperatorBase* transpose, bool* merged) {
+        OperandBase* input = transpose->Inputs()[0];
+        std::vector<int32_t> permutation =
+            static_cast<const op::Transpose*>(transpose)->GetPermutation();
+        const OperatorBase* producer = input->Operator();
+        if (producer->GetOperatorType() == OperatorType::Transpose) {
+            // The element i of the output is the element first[second[i]] of the input.
+            std::vector<int32_t> first =
+                static_cast<const op::Transpose*>(producer)->GetPermutation();
+            for (int32_t& axis : permutation) {
+                axis = first[axis];
+            }
+            input = producer->Inputs()[0];
+        }
+        if (IsIdentityPermutation(permutation)) {
+            return ForwardOperand(transpose, input, merged);
+        }
+        if (KeepsDataOrder(input->Shape(), permutation)) {
+            *merged = true;
+            return ReplaceOperator(
+                CreateReshape(mBuilder, input, transpose->PrimaryOutput()->Shape()), transpose);
+        }
+        if (input == transpose->Inputs()[0]) {
+            return {};
+        }
+        *merged = true;
+        return ReplaceOperator(CreateTranspose(mBuilder, input, permutation), transpose);
+    }
+
+    MaybeError GraphOptimizer::MergeReshape(const OperatorBase* reshape, bool* merged) {
+        OperandBase* input = reshape->Inputs()[0];
+        if (input->Operator()->GetOperatorType() == OperatorType::Reshape) {
+            input = input->Operator()->Inputs()[0];
+        }
+        std::vector<int32_t> shape = reshape->PrimaryOutput()->Shape();
+        if (input->Shape() == shape) {
+            return ForwardOperand(reshape, input, merged);
+        }
+        if (input == reshape->Inputs()[0]) {
+            return {};
+        }
+        *merged = true;
+        return ReplaceOperator(CreateReshape(mBuilder, input, shape), reshape);
+    }
+
+    MaybeError GraphOptimizer::SinkTranspose(const OperatorBase* op, bool* sunk) {
+        // Only the Transpose that nothing else reads are moved, so that they are not copied.
+        auto getTranspose = [&](const OperandBase* operand) -> const op::Transpose* {
+            const OperatorBase* producer = GetFusibleProducer(operand);
+            if (producer == nullptr || producer->GetOperatorType() != OperatorType::Transpose) {
+                return nullptr;
+            }
+            return static_cast<const op::Transpose*>(producer);
+        };
+        auto& inputs = op->Inputs();
+        const op::Transpose* transpose = getTranspose(inputs[0]);
+        if (transpose == nullptr && op->GetOperatorType() == OperatorType::Binary) {
+            transpose = getTranspose(inputs[1]);
+        }
+        if (transpose == nullptr) {
+            return {};
+        }
+        std::vector<int32_t> permutation = transpose->GetPermutation();
+        OperandBase* input = transpose->Inputs()[0];
+
+        // The operator is recreated on the input of the Transpose, which is then applied to
+        // its output.
+        OperatorBase* sunkOperator = nullptr;
+        switch (op->GetOperatorType()) {
+            case OperatorType::Binary: {
+                auto binary = static_cast<const op::Binary*>(op);
+                size_t rank = permutation.size();
+                if (binary->GetType() == op::BinaryOpType::kMatMul ||
+                    op->PrimaryOutput()->Shape().size() != rank) {
+                    return {};
+                }
+                // The other operand must be transposed the same way, or be transposed back
+                // which is folded for the constants, or broadcast as one element.
+                std::vector<int32_t> inverse = InvertPermutation(permutation);
+                OperandBase* operands[2];
+                bool transposeBack[2] = {false, false};
+                for (size_t i = 0; i < 2; ++i) {
+                    OperandBase* operand = inputs[i];
+                    const op::Transpose* operandTranspose = getTranspose(operand);
+                    if (operandTranspose != nullptr &&
+                        operandTranspose->GetPermutation() == permutation) {
+                        operands[i] = operandTranspose->Inputs()[0];
+                    } else if (GetElementCount(operand->Shape()) == 1 &&
+                               operand->Shape().size() <= rank) {
+                        operands[i] = operand;
+                    } else if (operand->Operator()->GetOperatorType() ==
+                                   OperatorType::Constant &&
+                               operand->Shape().size() <= rank) {
+                        operands[i] = operand;
+                        transposeBack[i] = true;
+                    } else {
+                        return {};
+                    }
+                }
+                for (size_t i = 0; i < 2; ++i) {
+                    if (!transposeBack[i]) {
+                        continue;
+                    }
+                    // The broadcast dimensions are aligned to the right.
+                    std::vector<int32_t> shape = operands[i]->Shape();
+                    if (shape.size() < rank) {
+                        shape.insert(shape.begin(), rank - shape.size(), 1);
+                        DAWN_TRY_ASSIGN(operands[i], AppendOperator(CreateReshape(
+                                                         mBuilder, operands[i], shape)));
+                    }
+                    DAWN_TRY_ASSIGN(operands[i], AppendOperator(CreateTranspose(
+                                                     mBuilder, operands[i], inverse)));
+                }
+                sunkOperator = new (mBuilder) op::Binary(mBuilder, binary->GetType(), operands[0],
+                                                         operands[1], binary->GetActivation());
+                break;
+            }
+            case OperatorType::Clamp: {
+                auto clamp = static_cast<const op::Clamp*>(op);
+                ClampOptions options;
+                options.minValue = clamp->GetMinValue();
+                options.maxValue = clamp->GetMaxValue();
+                sunkOperator = new (mBuilder) op::Clamp(mBuilder, input, &options);
+                break;
+            }
+            case OperatorType::Conv2d: {
+                Conv2dOptions options = *static_cast<const op::Conv2d*>(op)->GetOptions();
+                if (options.inputLayout == wgpu::InputOperandLayout::Nchw &&
+                    permutation == kNhwcToNchw) {
+                    options.inputLayout = wgpu::InputOperandLayout::Nhwc;
+                } else if (options.inputLayout == wgpu::InputOperandLayout::Nhwc &&
+                           permutation == kNchwToNhwc) {
+                    options.inputLayout = wgpu::InputOperandLayout::Nchw;
+                } else {
+                    return {};
+                }
+                options.bias = inputs.size() > 2 ? inputs[2] : nullptr;
+                sunkOperator = new (mBuilder) op::Conv2d(mBuilder, input, inputs[1], &options);
+                break;
+            }
+            case OperatorType::Pool2d: {
+                auto pool2d = static_cast<const op::Pool2d*>(op);
+                Pool2dOptions options = *pool2d->GetOptions();
+                if (options.layout == wgpu::InputOperandLayout::Nchw &&
+                    permutation == kNhwcToNchw) {
+                    options.layout = wgpu::InputOperandLayout::Nhwc;
+                } else if (options.layout == wgpu::InputOperandLayout::Nhwc &&
+                           permutation == kNchwToNhwc) {
+                    options.layout = wgpu::InputOperandLayout::Nchw;
+                } else {
+                    return {};
+                }
+                sunkOperator =
+                    new (mBuilder) op::Pool2d(mBuilder, pool2d->GetType(), input, &options);
+                break;
+            }
+            case OperatorType::Unary: {
+                op::UnaryOpType type = static_cast<const op::Unary*>(op)->GetType();
+                if (type == op::UnaryOpType::kSoftmax) {
+                    return {};
+                }
+                if (type == op::UnaryOpType::kLeakyRelu) {
+                    LeakyReluOptions options;
+                    options.alpha = static_cast<const op::LeakyRelu*>(op)->GetAlpha();
+                    sunkOperator = new (mBuilder) op::LeakyRelu(mBuilder, input, &options);
+                } else {
+                    sunkOperator = new (mBuilder) op::Unary(mBuilder, type, input);
+                }
+                break;
+            }
+            default:
+                return {};
+        }
+        OperandBase* output;
+        DAWN_TRY_ASSIGN(output, AppendOperator(sunkOperator));
+        *sunk = true;
+        return ReplaceOperator(CreateTranspose(mBuilder, output, permutation), op);
+    }
+
+    MaybeError GraphOptimizer::FoldConstant(const OperatorBase* op, bool* folded) {
+        OperatorType type = op->GetOperatorType();
+        if (type != OperatorType::Binary && type != OperatorType::Clamp &&
+            type != OperatorType::Concat && type != OperatorType::Reshape &&
+            type != OperatorType::Transpose && type != OperatorType::Unary) {
+            return {};
+        }
+        const OperandBase* output = op->PrimaryOutput();
+        if (mOutputs.find(output) != mOutputs.end()) {
+            return {};
+        }
+        for (auto& input : op->Inputs()) {
+            if (input->Operator()->GetOperatorType() != OperatorType::Constant) {
+                return {};
+            }
+        }
+        std::vector<int32_t> outputShape = output->Shape();
+        size_t count = GetElementCount(outputShape);
+        if (count == 0) {
+            return {};
+        }
+
+        OperatorBase* constant = nullptr;
+        if (type == OperatorType::Reshape) {
+            // The reshaped constant is a view of the same buffer, which doesn't need to be
+            // readable on the host.
+            auto input = static_cast<const op::Constant*>(op->Inputs()[0]->Operator());
+            OperandDescriptor desc;
+            desc.type = output->Type();
+            desc.dimensions = outputShape.data();
+            desc.dimensionsCount = outputShape.size();
+            BufferResourceView view;
+            view.resource = input->GetBuffer();
+            view.offset = input->GetOffset();
+            view.size = input->GetSize();
+            constant = new (mBuilder) op::Constant(mBuilder, &desc, &view);
+            DAWN_TRY(constant->ValidateAndInferOutputInfo());
+        } else {
+            std::vector<const uint8_t*> inputs;
+            for (auto& input : op->Inputs()) {
+                const uint8_t* data = GetConstantBytes(input);
+                if (data == nullptr) {
+                    return {};
+                }
+                inputs.push_back(data);
+            }
+            size_t elementSize = GetOperandTypeSize(output->Type());
+            std::vector<uint8_t> result(count * elementSize);
+            if (type == OperatorType::Transpose) {
+                std::vector<int32_t> permutation =
+                    static_cast<const op::Transpose*>(op)->GetPermutation();
+                std::vector<size_t> inputStrides = GetStrides(op->Inputs()[0]->Shape());
+                std::vector<size_t> strides(permutation.size());
+                for (size_t i = 0; i < permutation.size(); ++i) {
+                    strides[i] = inputStrides[permutation[i]];
+                }
+                for (size_t i = 0; i < count; ++i) {
+                    memcpy(&result[i * elementSize],
+                           inputs[0] + GetOffset(i, outputShape, strides) * elementSize,
+                           elementSize);
+                }
+            } else if (type == OperatorType::Concat) {
+                uint32_t axis = static_cast<const op::Concat*>(op)->GetAxis();
+                size_t outerSize = GetElementCount(
+                    std::vector<int32_t>(outputShape.begin(), outputShape.begin() + axis));
+                uint8_t* destination = result.data();
+                for (size_t i = 0; i < outerSize; ++i) {
+                    for (size_t j = 0; j < inputs.size(); ++j) {
+                        std::vector<int32_t> shape = op->Inputs()[j]->Shape();
+                        size_t blockSize =
+                            GetElementCount(std::vector<int32_t>(shape.begin() + axis,
+                                                                 shape.end())) *
+                            elementSize;
+                        memcpy(destination, inputs[j] + i * blockSize, blockSize);
+                        destination += blockSize;
+                    }
+                }
+            } else {
+                // The arithmetic is only folded for float32.
+                for (auto& input : op->Inputs()) {
+                    if (input->Type() != wgpu::OperandType::Float32) {
+                        return {};
+                    }
+                }
+                auto a = reinterpret_cast<const float*>(inputs[0]);
+                auto y = reinterpret_cast<float*>(result.data());
+                if (type == OperatorType::Clamp) {
+                    auto clamp = static_cast<const op::Clamp*>(op);
+                    for (size_t i = 0; i < count; ++i) {
+                        y[i] = std::min(std::max(a[i], clamp->GetMinValue()),
+                                        clamp->GetMaxValue());
+                    }
+                } else if (type == OperatorType::Unary) {
+                    op::UnaryOpType unaryType = static_cast<const op::Unary*>(op)->GetType();
+                    float alpha = unaryType == op::UnaryOpType::kLeakyRelu
+                                      ? static_cast<const op::LeakyRelu*>(op)->GetAlpha()
+                                      : 0.0f;
+                    for (size_t i = 0; i < count; ++i) {
+                        if (!ComputeUnary(unaryType, alpha, a[i], &y[i])) {
+                            return {};
+                        }
+                    }
+                } else {
+                    auto binary = static_cast<const op::Binary*>(op);
+                    if (binary->GetType() == op::BinaryOpType::kMatMul) {
+                        return {};
+                    }
+                    auto b = reinterpret_cast<const float*>(inputs[1]);
+                    std::vector<size_t> aStrides =
+                        GetBroadcastStrides(op->Inputs()[0]->Shape(), outputShape.size());
+                    std::vector<size_t> bStrides =
+                        GetBroadcastStrides(op->Inputs()[1]->Shape(), outputShape.size());
+                    for (size_t i = 0; i < count; ++i) {
+                        y[i] = ComputeBinary(binary->GetType(),
+                                             a[GetOffset(i, outputShape, aStrides)],
+                                             b[GetOffset(i, outputShape, bStrides)]);
+                    }
+                }
+            }
+            DAWN_TRY_ASSIGN(constant, CreateConstant(outputShape, output->Type(),
+                                                     result.data(), result.size()));
+        }
+        constant->TakeOutputs(op);
+        mOperators.push_back(constant);
+        *folded = true;
+        return {};
+    }
+
+    ResultOrError<OperandBase*> GraphOptimizer::AppendOperator(OperatorBase* op) {
+        DAWN_TRY(op->ValidateAndInferOutputInfo());
+        for (auto& input : op->Inputs()) {
+            mUseCounts[input]++;
+        }
+        mOperators.push_back(op);
+        return op->PrimaryOutput();
+    }
+
+    MaybeError GraphOptimizer::ReplaceOperator(OperatorBase* op, const OperatorBase* replaced) {
+        DAWN_TRY(op->ValidateAndInferOutputInfo());
+        DAWN_ASSERT(op->PrimaryOutput()->Shape() == replaced->PrimaryOutput()->Shape());
+        for (auto& input : replaced->Inputs()) {
+            mUseCounts[input]--;
+        }
+        for (auto& input : op->Inputs()) {
+            mUseCounts[input]++;
+        }
+        op->TakeOutputs(replaced);
+        mOperators.push_back(op);
+        return {};
+    }
+
+    MaybeError GraphOptimizer::ForwardOperand(const OperatorBase* op,
+                                              OperandBase* operand,
+                                              bool* removed) {
+        OperandBase* output = op->PrimaryOutput();
+        if (mOutputs.find(output) != mOutputs.end()) {
+            // The outputs of the graph keep their operands, a Reshape copies them.
+            if (op->GetOperatorType() == OperatorType::Reshape &&
+                op->Inputs()[0] == operand) {
+                return {};
+            }
+            *removed = true;
+            return ReplaceOperator(CreateReshape(mBuilder, operand, output->Shape()), op);
+        }
+        for (auto& input : op->Inputs()) {
+            mUseCounts[input]--;
+        }
+        size_t useCount = mUseCounts[output];
+        mUseCounts.erase(output);
+        mUseCounts[operand] += useCount;
+        mForwardedOperands[output] = operand;
+        *removed = true;
+        return {};
+    }
+
+    void GraphOptimizer::ForwardInputs(const OperatorBase* op) {
+        if (mForwardedOperands.empty()) {
+            return;
+        }
+        for (size_t i = 0; i < op->Inputs().size(); ++i) {
+            auto forwarded = mForwardedOperands.find(op->Inputs()[i]);
+            if (forwarded != mForwardedOperands.end()) {
+                // The operators are only const for the backends, the rewrites may change their
+                // inputs before they are added to the graph.
+                const_cast<OperatorBase*>(op)->ReplaceInput(i, forwarded->second);
+            }
+        }
+    }
+
+    MaybeError GraphOptimizer::AddFusedOperator(OperatorBase* fused,
+                                                const OperatorBase* replaced,
+                                                const OperatorBase* producer) {
+        DAWN_TRY(fused->ValidateAndInferOutputInfo());
+        DAWN_ASSERT(fused->PrimaryOutput()->Shape() == replaced->PrimaryOutput()->Shape());
+        auto position = std::find(mOperators.rbegin(), mOperators.rend(), producer);
+        DAWN_ASSERT(position != mOperators.rend());
+        *position = nullptr;
+        fused->TakeOutputs(replaced);
+        mOperators.push_back(fused);
+        return {};
+    }
+
+    MaybeError GraphOptimizer::FuseConv2dAdd(const OperatorBase* add, bool* fused) {
+        auto binary = static_cast<const op::Binary*>(add);
+        if (binary->GetType() != op::BinaryOpType::kAdd || binary->GetActivation() != nullptr) {
+            return {};
+        }
+        for (size_t i = 0; i < 2; ++i) {
+            const OperatorBase* producer = GetFusibleProducer(add->Inputs()[i]);
+            if (producer == nullptr || producer->GetOperatorType() != OperatorType::Conv2d) {
+                continue;
+            }
+            Conv2dOptions options = *static_cast<const op::Conv2d*>(producer)->GetOptions();
+            OperandBase* bias = add->Inputs()[1 - i];
+            std::vector<int32_t> outputShape = producer->PrimaryOutput()->Shape();
+            if (options.bias != nullptr || options.activation != nullptr ||
+                bias->Type() != producer->PrimaryOutput()->Type() ||
+                add->PrimaryOutput()->Shape() != outputShape) {
+                continue;
+            }
+            // The added operand must only vary along the channel axis.
+            size_t channelAxis = options.inputLayout == wgpu::InputOperandLayout::Nchw ? 1 : 3;
+            int32_t channels = outputShape[channelAxis];
+            std::vector<int32_t> biasShape = bias->Shape();
+            bool isPerChannel = GetElementCount(biasShape) == static_cast<size_t>(channels) &&
+                                biasShape.size() <= outputShape.size();
+            for (size_t j = 0; isPerChannel && j < biasShape.size(); ++j) {
+                size_t axis = outputShape.size() - biasShape.size() + j;
+                isPerChannel = biasShape[j] == (axis == channelAxis ? channels : 1);
+            }
+            if (!isPerChannel) {
+                continue;
+            }
+            auto& inputs = producer->Inputs();
+            if (biasShape.size() != 1) {
+                OperatorBase* reshape = new (mBuilder) op::Reshape(mBuilder, bias, &channels, 1);
+                DAWN_TRY(reshape->ValidateAndInferOutputInfo());
+                mOperators.push_back(reshape);
+                bias = reshape->PrimaryOutput();
+            }
+            options.bias = bias;
+            *fused = true;
+            return AddFusedOperator(
+                new (mBuilder) op::Conv2d(mBuilder, inputs[0], inputs[1], &options), add,
+                producer);
+        }
+        return {};
+    }
+
+    MaybeError GraphOptimizer::FuseConv2dBatchNorm(const OperatorBase* batchNorm, bool* fused) {
+        const OperatorBase* producer = GetFusibleProducer(batchNorm->Inputs()[0]);
+        if (producer == nullptr || producer->GetOperatorType() != OperatorType::Conv2d) {
+            return {};
+        }
+        const BatchNormOptions* batchNormOptions =
+            static_cast<const op::BatchNorm*>(batchNorm)->GetOptions();
+        Conv2dOptions options = *static_cast<const op::Conv2d*>(producer)->GetOptions();
+        uint32_t channelAxis = options.inputLayout == wgpu::InputOperandLayout::Nchw ? 1 : 3;
+        if (options.activation != nullptr || batchNormOptions->axis != channelAxis) {
+            return {};
+        }
+
+        // The filter, the bias and the batch normalization parameters must all be constants
+        // that can be read on the host.
+        auto& convInputs = producer->Inputs();
+        std::vector<int32_t> filterShape = convInputs[1]->Shape();
+        size_t outputAxis = options.filterLayout == wgpu::FilterOperandLayout::Oihw ||
+                                    options.filterLayout == wgpu::FilterOperandLayout::Ohwi
+                                ? 0
+                                : 3;
+        int32_t channels = filterShape[outputAxis];
+        auto getChannelData = [&](const OperandBase* operand) -> const float* {
+            if (operand->Shape() != std::vector<int32_t>{channels}) {
+                return nullptr;
+            }
+            return GetConstantData(operand);
+        };
+        auto& inputs = batchNorm->Inputs();
+        size_t index = 3;
+        const float* filter = GetConstantData(convInputs[1]);
+        const float* convBias =
+            options.bias != nullptr ? getChannelData(convInputs[2]) : nullptr;
+        const float* mean = getChannelData(inputs[1]);
+        const float* variance = getChannelData(inputs[2]);
+        const float* scale =
+            batchNormOptions->scale != nullptr ? getChannelData(inputs[index++]) : nullptr;
+        const float* bias =
+            batchNormOptions->bias != nullptr ? getChannelData(inputs[index++]) : nullptr;
+        if (filter == nullptr || mean == nullptr || variance == nullptr ||
+            (options.bias != nullptr && convBias == nullptr) ||
+            (batchNormOptions->scale != nullptr && scale == nullptr) ||
+            (batchNormOptions->bias != nullptr && bias == nullptr)) {
+            return {};
+        }
+
+        // scale * (conv(x, filter) + convBias - mean) / sqrt(variance + epsilon) + bias is
+        // conv(x, filter * multiplier) + (convBias - mean) * multiplier + bias.
+        std::vector<float> multipliers(channels), newBias(channels);
+        for (int32_t c = 0; c < channels; ++c) {
+            multipliers[c] = (scale != nullptr ? scale[c] : 1.0f) /
+                             std::sqrt(variance[c] + batchNormOptions->epsilon);
+            newBias[c] = ((convBias != nullptr ? convBias[c] : 0.0f) - mean[c]) * multipliers[c] +
+                         (bias != nullptr ? bias[c] : 0.0f);
+        }
+        size_t innerSize = GetElementCount(
+            std::vector<int32_t>(filterShape.begin() + outputAxis + 1, filterShape.end()));
+        std::vector<float> newFilter(GetElementCount(filterShape));
+        for (size_t i = 0; i < newFilter.size(); ++i) {
+            newFilter[i] = filter[i] * multipliers[(i / innerSize) % channels];
+        }
+        OperandBase* filterOperand;
+        DAWN_TRY_ASSIGN(filterOperand, AddConstant(filterShape, newFilter));
+        OperandBase* biasOperand;
+        DAWN_TRY_ASSIGN(biasOperand, AddConstant({channels}, newBias));
+
+        options.bias = biasOperand;
+        options.activation = batchNormOptions->activation;
+        *fused = true;
+        return AddFusedOperator(
+            new (mBuilder) op::Conv2d(mBuilder, convInputs[0], filterOperand, &options),
+            batchNorm, producer);
+    }
+
+    MaybeError GraphOptimizer::FuseActivation(const OperatorBase* activation, bool* fused) {
+        Ref<FusionOperatorBase> fusionOperator = CreateActivation(activation);
+        if (fusionOperator == nullptr) {
+            return {};
+        }
+        const OperatorBase* producer = GetFusibleProducer(activation->Inputs()[0]);
+        if (producer == nullptr) {
+            return {};
+        }
+        auto& inputs = producer->Inputs();
+        Ref<FusionOperatorBase> merged;
+        OperatorBase* fusedOperator = nullptr;
+        switch (producer->GetOperatorType()) {
+            case OperatorType::BatchNorm: {
+                BatchNormOptions options =
+                    *static_cast<const op::BatchNorm*>(producer)->GetOptions();
+                merged = MergeActivations(options.activation, fusionOperator.Get());
+                if (merged == nullptr) {
+                    return {};
+                }
+                options.activation = merged.Get();
+                fusedOperator = new (mBuilder)
+                    op::BatchNorm(mBuilder, inputs[0], inputs[1], inputs[2], &options);
+                break;
+            }
+            case OperatorType::Binary: {
+                auto binary = static_cast<const op::Binary*>(producer);
+                if (binary->GetType() == op::BinaryOpType::kMatMul) {
+                    return {};
+                }
+                merged = MergeActivations(binary->GetActivation(), fusionOperator.Get());
+                if (merged == nullptr) {
+                    return {};
+                }
+                fusedOperator = new (mBuilder) op::Binary(mBuilder, binary->GetType(), inputs[0],
+                                                          inputs[1], merged.Get());
+                break;
+            }
+            case OperatorType::Clamp:
+            case OperatorType::Unary: {
+                // Consecutive clamps become one clamp.
+                Ref<FusionOperatorBase> first = CreateActivation(producer);
+                if (first == nullptr) {
+                    return {};
+                }
+                merged = MergeActivations(first.Get(), fusionOperator.Get());
+                if (merged == nullptr) {
+                    return {};
+                }
+                auto clamp = static_cast<const op::FusionClamp*>(merged.Get());
+                ClampOptions options;
+                options.minValue = clamp->GetMinValue();
+                options.maxValue = clamp->GetMaxValue();
+                fusedOperator = new (mBuilder) op::Clamp(mBuilder, inputs[0], &options);
+                break;
+            }
+            case OperatorType::Conv2d: {
+                Conv2dOptions options = *static_cast<const op::Conv2d*>(producer)->GetOptions();
+                merged = MergeActivations(options.activation, fusionOperator.Get());
+                if (merged == nullptr) {
+                    return {};
+                }
+                options.activation = merged.Get();
+                fusedOperator = new (mBuilder) op::Conv2d(mBuilder, inputs[0], inputs[1], &options);
+                break;
+            }
+            case OperatorType::Gemm: {
+                GemmOptions options = *static_cast<const op::Gemm*>(producer)->GetOptions();
+                merged = MergeActivations(options.activation, fusionOperator.Get());
+                if (merged == nullptr) {
+                    return {};
+                }
+                options.activation = merged.Get();
+                fusedOperator = new (mBuilder) op::Gemm(mBuilder, inputs[0], inputs[1], &options);
+                break;
+            }
+            default:
+                return {};
+        }
+        *fused = true;
+        return AddFusedOperator(fusedOperator, activation, producer);
+    }
+
+    MaybeError GraphOptimizer::FuseQuantizedOperator(const OperatorBase* quantize, bool* fused) {
+        if (static_cast<const op::Quantize*>(quantize)->GetType() !=
+            op::QuantizeOpType::kQuantizeLinear) {
+            return {};
+        }
+        const OperatorBase* producer = GetFusibleProducer(quantize->Inputs()[0]);
+        if (producer == nullptr || (producer->GetOperatorType() != OperatorType::Conv2d &&
+                                    producer->GetOperatorType() != OperatorType::Gemm)) {
+            return {};
+        }
+        // The quantized input and filter or b are read directly, their dequantizeLinear are
+        // removed if nothing else uses them.
+        const OperatorBase* dequantized[2];
+        for (size_t i = 0; i < 2; ++i) {
+            dequantized[i] = producer->Inputs()[i]->Operator();
+            if (dequantized[i]->GetOperatorType() != OperatorType::Quantize ||
+                static_cast<const op::Quantize*>(dequantized[i])->GetType() !=
+                    op::QuantizeOpType::kDequantizeLinear ||
+                dequantized[i]->Inputs()[0]->Type() == wgpu::OperandType::Int32) {
+                return {};
+            }
+        }
+        OperandBase* input = dequantized[0]->Inputs()[0];
+        OperandBase* filter = dequantized[1]->Inputs()[0];
+
+        // The filter may be quantized per output channel.
+        size_t channelAxis;
+        if (producer->GetOperatorType() == OperatorType::Conv2d) {
+            wgpu::FilterOperandLayout layout =
+                static_cast<const op::Conv2d*>(producer)->GetOptions()->filterLayout;
+            channelAxis = layout == wgpu::FilterOperandLayout::Oihw ||
+                                  layout == wgpu::FilterOperandLayout::Ohwi
+                              ? 0
+                              : 3;
+        } else {
+            channelAxis = static_cast<const op::Gemm*>(producer)->GetOptions()->bTranspose ? 0 : 1;
+        }
+        size_t channels = filter->Shape()[channelAxis];
+
+        op::Quantization quantization;
+        std::vector<float> scales;
+        std::vector<int32_t> zeroPoints;
+        if (!GetQuantizationParameters(dequantized[0], 0, 1, &scales, &zeroPoints)) {
+            return {};
+        }
+        quantization.inputScale = scales[0];
+        quantization.inputZeroPoint = zeroPoints[0];
+        if (!GetQuantizationParameters(quantize, 0, 1, &scales, &zeroPoints)) {
+            return {};
+        }
+        quantization.outputScale = scales[0];
+        quantization.outputZeroPoint = zeroPoints[0];
+        if (!GetQuantizationParameters(dequantized[1], channelAxis, channels,
+                                       &quantization.filterScales,
+                                       &quantization.filterZeroPoints)) {
+            return {};
+        }
+
+        OperatorBase* fusedOperator = nullptr;
+        if (producer->GetOperatorType() == OperatorType::Conv2d) {
+            Conv2dOptions options = *static_cast<const op::Conv2d*>(producer)->GetOptions();
+            op::Conv2d* conv2d = new (mBuilder) op::Conv2d(mBuilder, input, filter, &options);
+            conv2d->SetQuantization(std::move(quantization));
+            fusedOperator = conv2d;
+        } else {
+            GemmOptions options = *static_cast<const op::Gemm*>(producer)->GetOptions();
+            op::Gemm* gemm = new (mBuilder) op::Gemm(mBuilder, input, filter, &options);
+            gemm->SetQuantization(std::move(quantization));
+            fusedOperator = gemm;
+        }
+        DAWN_TRY(AddFusedOperator(fusedOperator, quantize, producer));
+        *fused = true;
+        return {};
+    }
+
+}  // namespace dawn::native
@@ -0,0 +1,144 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_GRAPH_OPTIMIZER_H_
+#define WEBNN_NATIVE_GRAPH_OPTIMIZER_H_
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "dawn/native/Error.h"
+#include "dawn/native/FusionOperator.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native {
+
+    // Rewrites the topologically sorted operators of a graph before they are added to the
+    // backend graph, so the rewrites apply to all the backends.
+    class GraphOptimizer {
+      public:
+        GraphOptimizer(GraphBuilderBase* builder,
+                       std::vector<const OperatorBase*> operators,
+                       const std::vector<const OperandBase*>& outputs);
+
+        // Runs PropagateLayouts(), FoldConstants(), FuseOperators() and EliminateDeadOperators()
+        // in this order.
+        MaybeError Optimize();
+
+        // Removes the copies of the tensors between the nchw and nhwc layouts, such as the
+        // Transpose that the models converted from another framework put around each Conv2d:
+        //  - Consecutive Transpose are merged into one, and consecutive Reshape as well. They
+        //    are removed when their result is their input. A Transpose that only moves the
+        //    dimensions of size 1 becomes a Reshape.
+        //  - A Transpose is moved after the Conv2d and Pool2d it feeds by switching their input
+        //    layout between nchw and nhwc, and after the element-wise Unary, Clamp and Binary
+        //    whose other operand is transposed the same way, is a constant or has one element.
+        //    It then meets the opposite Transpose that restores the original layout, so each
+        //    chain of operators works in the layout of its input.
+        MaybeError PropagateLayouts();
+
+        // Replaces the operators whose inputs are all constants with the constants of their
+        // results computed on the host. Reshape, Transpose, Concat, Clamp and the element-wise
+        // Unary and Binary operators are folded.
+        MaybeError FoldConstants();
+
+        // Merges the operators whose intermediate results don't need to be stored:
+        //  - Conv2d followed by the Add of a per-channel operand becomes the bias of Conv2d.
+        //  - BatchNorm following Conv2d is folded into the constant filter and bias.
+        //  - Relu, Sigmoid, LeakyRelu and Clamp become the fused activation of the preceding
+        //    Conv2d, Gemm, BatchNorm or element-wise Binary.
+        //  - Consecutive Clamp and Relu are merged into one Clamp.
+        //  - Conv2d and Gemm between the dequantizeLinear of their input and filter or b and
+        //    the quantizeLinear of their output become quantized, see op::Quantization, when
+        //    the backend supports it and the scales and zero points are constants.
+        MaybeError FuseOperators();
+
+        // Removes the operators whose outputs don't reach any output of the graph, such as the
+        // constants replaced by the other passes.
+        void EliminateDeadOperators();
+
+        // The operators in topological order after the rewrites.
+        const std::vector<const OperatorBase*>& GetOperators() const {
+            return mOperators;
+        }
+
+      private:
+        void UpdateUseCounts();
+        // Returns the operator producing |operand| if it can be merged into the operator
+        // consuming it, that is it is the only consumer and |operand| is not a graph output.
+        const OperatorBase* GetFusibleProducer(const OperandBase* operand) const;
+        // Returns the fusion operator computing the same as |op|, or nullptr if |op| is not an
+        // activation that all the backends can fuse.
+        Ref<FusionOperatorBase> CreateActivation(const OperatorBase* op);
+        // Returns the activation applying |second| after |first|, or nullptr if they can't be
+        // merged into one fusion operator.
+        Ref<FusionOperatorBase> MergeActivations(FusionOperatorBase* first,
+                                                 FusionOperatorBase* second);
+        // Returns the data of |operand| if it is a constant readable on the host.
+        const uint8_t* GetConstantBytes(const OperandBase* operand) const;
+        // Returns the data of |operand| if it is a float32 constant readable on the host.
+        const float* GetConstantData(const OperandBase* operand) const;
+        // Reads the constant scales and zero points of |quantize|, one for the whole tensor or
+        // |channels| along |channelAxis| of its input when |channels| is greater than 1.
+        // Returns false when they are not constants readable on the host or not broadcast that
+        // way.
+        bool GetQuantizationParameters(const OperatorBase* quantize,
+                                       size_t channelAxis,
+                                       size_t channels,
+                                       std::vector<float>* scales,
+                                       std::vector<int32_t>* zeroPoints) const;
+        ResultOrError<OperatorBase*> CreateConstant(std::vector<int32_t> shape,
+                                                    wgpu::OperandType type,
+                                                    const void* data,
+                                                    size_t byteSize);
+        // Appends a float32 constant operator and returns its operand.
+        ResultOrError<OperandBase*> AddConstant(std::vector<int32_t> shape,
+                                                const std::vector<float>& data);
+        // Appends |op| and returns its output.
+        ResultOrError<OperandBase*> AppendOperator(OperatorBase* op);
+        // Appends |op|, which computes the outputs of |replaced| in its place.
+        MaybeError ReplaceOperator(OperatorBase* op, const OperatorBase* replaced);
+        // Removes |op| whose output is |operand|, the consumers of its output read |operand|
+        // instead.
+        MaybeError ForwardOperand(const OperatorBase* op, OperandBase* operand, bool* removed);
+        // Makes |op| read the operands that replace its inputs removed by ForwardOperand().
+        void ForwardInputs(const OperatorBase* op);
+        // Appends |fused|, which computes the outputs of |replaced|, and removes |producer|
+        // which has been merged into it.
+        MaybeError AddFusedOperator(OperatorBase* fused,
+                                    const OperatorBase* replaced,
+                                    const OperatorBase* producer);
+
+        MaybeError MergeTranspose(const OperatorBase* transpose, bool* merged);
+        MaybeError MergeReshape(const OperatorBase* reshape, bool* merged);
+        MaybeError SinkTranspose(const OperatorBase* op, bool* sunk);
+        MaybeError FoldConstant(const OperatorBase* op, bool* folded);
+        MaybeError FuseConv2dAdd(const OperatorBase* add, bool* fused);
+        MaybeError FuseConv2dBatchNorm(const OperatorBase* batchNorm, bool* fused);
+        MaybeError FuseActivation(const OperatorBase* activation, bool* fused);
+        MaybeError FuseQuantizedOperator(const OperatorBase* quantize, bool* fused);
+
+        GraphBuilderBase* mBuilder;
+        std::vector<const OperatorBase*> mOperators;
+        std::unordered_map<const OperandBase*, size_t> mUseCounts;
+        std::unordered_set<const OperandBase*> mOutputs;
+        // The operands removed by ForwardOperand() and the operands replacing them.
+        std::unordered_map<const OperandBase*, OperandBase*> mForwardedOperands;
+    };
+
+}  // namespace dawn::native
+
+#endif  // WEBNN_NATIVE_GRAPH_OPTIMIZER_H_
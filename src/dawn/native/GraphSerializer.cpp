@@ -0,0 +1,1047 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/GraphSerializer.h"
+
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+
+#include "dawn/common/MappedFile.h"
+#include "dawn/common/Math.h"
+#include "dawn/native/FusionOperator.h"
+#include "dawn/native/GraphBuilder.h"
+#include "dawn/native/ObjectContentHasher.h"
+#include "dawn/native/ops/BatchNorm.h"
+#include "dawn/native/ops/Binary.h"
+#include "dawn/native/ops/Clamp.h"
+#include "dawn/native/ops/Concat.h"
+#include "dawn/native/ops/Constant.h"
+#include "dawn/native/ops/Conv2d.h"
+#include "dawn/native/ops/Gemm.h"
+#include "dawn/native/ops/Gru.h"
+#include "dawn/native/ops/Input.h"
+#include "dawn/native/ops/InstanceNorm.h"
+#include "dawn/native/ops/LeakyRelu.h"
+#include "dawn/native/ops/Pad.h"
+#include "dawn/native/ops/Pool2d.h"
+#include "dawn/native/ops/Quantize.h"
+#include "dawn/native/ops/Reduce.h"
+#include "dawn/native/ops/Resample2d.h"
+#include "dawn/native/ops/Reshape.h"
+#include "dawn/native/ops/Slice.h"
+#include "dawn/native/ops/Split.h"
+#include "dawn/native/ops/Squeeze.h"
+#include "dawn/native/ops/Transpose.h"
+#include "dawn/native/ops/Unary.h"
+
+namespace dawn::native {
+
+    namespace {
+        // "WNNG" in little-endian, it doesn't match when the file was written in the other byte
+        // order.
+        constexpr uint32_t kMagic = 0x474E4E57;
+
+        // The size of the header: the magic, the version, the operator and output counts, then
+        // the offset and size of the constant data.
+        constexpr size_t kHeaderSize = 4 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+
+        class Writer {
+          public:
+            template <typename T>
+            void Write(T value) {
+                static_assert(std::is_trivially_copyable<T>::value);
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+                mData.insert(mData.end(), bytes, bytes + sizeof(T));
+            }
+
+            template <typename T>
+            void WriteEnum(T value) {
+                Write(static_cast<uint32_t>(value));
+            }
+
+            void WriteBool(bool value) {
+                Write<uint32_t>(value ? 1 : 0);
+            }
+
+            template <typename T>
+            void WriteVector(const std::vector<T>& values) {
+                Write<uint32_t>(values.size());
+                for (const T& value : values) {
+                    Write(value);
+                }
+            }
+
+            template <typename T>
+            void WriteArray(const T* values, size_t count) {
+                WriteVector(std::vector<T>(values, values + (values == nullptr ? 0 : count)));
+            }
+
+            void WriteString(const std::string& value) {
+                Write<uint32_t>(value.size());
+                mData.insert(mData.end(), value.begin(), value.end());
+            }
+
+            void WriteBytes(const uint8_t* data, size_t size) {
+                mData.insert(mData.end(), data, data + size);
+            }
+
+            template <typename T>
+            void Overwrite(size_t offset, T value) {
+                memcpy(mData.data() + offset, &value, sizeof(T));
+            }
+
+            void Pad(size_t alignment) {
+                mData.resize(Align(mData.size(), alignment), 0);
+            }
+
+            const std::vector<uint8_t>& GetData() const {
+                return mData;
+            }
+
+          private:
+            std::vector<uint8_t> mData;
+        };
+
+        class Reader {
+          public:
+            Reader(const uint8_t* data, size_t size) : mData(data), mSize(size) {
+            }
+
+            template <typename T>
+            MaybeError Read(T* value) {
+                static_assert(std::is_trivially_copyable<T>::value);
+                if (mSize - mOffset < sizeof(T)) {
+                    return DAWN_VALIDATION_ERROR("The serialized graph is truncated.");
+                }
+                memcpy(value, mData + mOffset, sizeof(T));
+                mOffset += sizeof(T);
+                return {};
+            }
+
+            template <typename T>
+            MaybeError ReadEnum(T* value) {
+                uint32_t rawValue;
+                DAWN_TRY(Read(&rawValue));
+                *value = static_cast<T>(rawValue);
+                return {};
+            }
+
+            MaybeError ReadBool(bool* value) {
+                uint32_t rawValue;
+                DAWN_TRY(Read(&rawValue));
+                *value = rawValue != 0;
+                return {};
+            }
+
+            template <typename T>
+            MaybeError ReadVector(std::vector<T>* values) {
+                uint32_t count;
+                DAWN_TRY(Read(&count));
+                if (count > (mSize - mOffset) / sizeof(T)) {
+                    return DAWN_VALIDATION_ERROR("The serialized graph is truncated.");
+                }
+                values->resize(count);
+                memcpy(values->data(), mData + mOffset, count * sizeof(T));
+                mOffset += count * sizeof(T);
+                return {};
+            }
+
+            MaybeError ReadString(std::string* value) {
+                uint32_t size;
+                DAWN_TRY(Read(&size));
+                if (size > mSize - mOffset) {
+                    return DAWN_VALIDATION_ERROR("The serialized graph is truncated.");
+                }
+                value->assign(reinterpret_cast<const char*>(mData + mOffset), size);
+                mOffset += size;
+                return {};
+            }
+
+          private:
+            const uint8_t* mData;
+            size_t mSize;
+            size_t mOffset = 0;
+        };
+
+        // The data of a constant and its offset in the constant data of the file.
+        struct ConstantData {
+            const uint8_t* data;
+            size_t offset;
+            size_t size;
+        };
+
+        // How the operators of a graph being read are recreated. The constants read
+        // |constantData| in place, which is kept alive by |owner|.
+        struct ReadContext {
+            Ref<RefCounted> owner;
+            const uint8_t* constantData;
+            uint64_t constantSize;
+            // The dimensions of the inputs when the graph is specialized for them, in which case
+            // the operators are validated again to infer the shapes of the other operands. Null
+            // when the graph was serialized after its rewrites.
+            const std::map<std::string, std::vector<int32_t>>* inputShapes;
+        };
+
+        // The type and shape of an output operand.
+        struct OperandInfo {
+            wgpu::OperandType type;
+            std::vector<int32_t> shape;
+        };
+
+        void WriteActivation(Writer* writer, const FusionOperatorBase* activation) {
+            writer->WriteBool(activation != nullptr);
+            if (activation == nullptr) {
+                return;
+            }
+            writer->WriteEnum(activation->GetFusionType());
+            switch (activation->GetFusionType()) {
+                case FusionType::Clamp: {
+                    auto clamp = static_cast<const op::FusionClamp*>(activation);
+                    writer->Write(clamp->GetMinValue());
+                    writer->Write(clamp->GetMaxValue());
+                    break;
+                }
+                case FusionType::LeakyRelu:
+                    writer->Write(static_cast<const op::FusionLeakyRelu*>(activation)->GetAlpha());
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        MaybeError ReadActivation(Reader* reader,
+                                  GraphBuilderBase* builder,
+                                  Ref<FusionOperatorBase>* activation) {
+            bool hasActivation;
+            DAWN_TRY(reader->ReadBool(&hasActivation));
+            if (!hasActivation) {
+                *activation = nullptr;
+                return {};
+            }
+            FusionType type;
+            DAWN_TRY(reader->ReadEnum(&type));
+            switch (type) {
+                case FusionType::Clamp: {
+                    ClampOptions options;
+                    DAWN_TRY(reader->Read(&options.minValue));
+                    DAWN_TRY(reader->Read(&options.maxValue));
+                    *activation = AcquireRef(new op::FusionClamp(builder, &options));
+                    break;
+                }
+                case FusionType::LeakyRelu: {
+                    LeakyReluOptions options;
+                    DAWN_TRY(reader->Read(&options.alpha));
+                    *activation = AcquireRef(new op::FusionLeakyRelu(builder, &options));
+                    break;
+                }
+                case FusionType::Relu:
+                case FusionType::Sigmoid:
+                case FusionType::HardSwish:
+                case FusionType::Tanh:
+                    *activation = AcquireRef(new op::FusionUnary(builder, type));
+                    break;
+                default:
+                    return DAWN_VALIDATION_ERROR("The fusion type is unknown.");
+            }
+            return {};
+        }
+
+        void WriteQuantization(Writer* writer, const op::Quantization* quantization) {
+            writer->WriteBool(quantization != nullptr);
+            if (quantization == nullptr) {
+                return;
+            }
+            writer->Write(quantization->inputScale);
+            writer->Write(quantization->inputZeroPoint);
+            writer->WriteVector(quantization->filterScales);
+            writer->WriteVector(quantization->filterZeroPoints);
+            writer->Write(quantization->outputScale);
+            writer->Write(quantization->outputZeroPoint);
+        }
+
+        MaybeError ReadQuantization(Reader* reader,
+                                    std::optional<op::Quantization>* quantization) {
+            bool hasQuantization;
+            DAWN_TRY(reader->ReadBool(&hasQuantization));
+            if (!hasQuantization) {
+                return {};
+            }
+            op::Quantization value;
+            DAWN_TRY(reader->Read(&value.inputScale));
+            DAWN_TRY(reader->Read(&value.inputZeroPoint));
+            DAWN_TRY(reader->ReadVector(&value.filterScales));
+            DAWN_TRY(reader->ReadVector(&value.filterZeroPoints));
+            DAWN_TRY(reader->Read(&value.outputScale));
+            DAWN_TRY(reader->Read(&value.outputZeroPoint));
+            if (value.filterScales.empty() ||
+                value.filterScales.size() != value.filterZeroPoints.size()) {
+                return DAWN_VALIDATION_ERROR("The quantization of the filter is invalid.");
+            }
+            *quantization = std::move(value);
+            return {};
+        }
+
+        MaybeError WriteAttributes(Writer* writer,
+                                   const OperatorBase* op,
+                                   size_t* constantSize,
+                                   std::vector<ConstantData>* constants) {
+            switch (op->GetOperatorType()) {
+                case OperatorType::BatchNorm: {
+                    const BatchNormOptions* options =
+                        static_cast<const op::BatchNorm*>(op)->GetOptions();
+                    writer->WriteBool(options->scale != nullptr);
+                    writer->WriteBool(options->bias != nullptr);
+                    writer->Write(options->axis);
+                    writer->Write(options->epsilon);
+                    WriteActivation(writer, options->activation);
+                    break;
+                }
+                case OperatorType::Binary: {
+                    auto binary = static_cast<const op::Binary*>(op);
+                    writer->WriteEnum(binary->GetType());
+                    WriteActivation(writer, binary->GetActivation());
+                    break;
+                }
+                case OperatorType::Clamp: {
+                    auto clamp = static_cast<const op::Clamp*>(op);
+                    writer->Write(clamp->GetMinValue());
+                    writer->Write(clamp->GetMaxValue());
+                    break;
+                }
+                case OperatorType::Concat:
+                    writer->Write(static_cast<const op::Concat*>(op)->GetAxis());
+                    break;
+                case OperatorType::Constant: {
+                    auto constant = static_cast<const op::Constant*>(op);
+                    const uint8_t* data = constant->GetHostData();
+                    if (data == nullptr) {
+                        return DAWN_UNIMPLEMENTED_ERROR(
+                            "Only the constants readable on the host can be serialized.");
+                    }
+                    const OperandBase* output = op->PrimaryOutput();
+                    size_t size =
+                        GetElementCount(output->Shape()) * GetOperandTypeSize(output->Type());
+                    size_t offset = Align(*constantSize, kSerializedConstantAlignment);
+                    *constantSize = offset + size;
+                    writer->Write<uint64_t>(offset);
+                    writer->Write<uint64_t>(size);
+                    constants->push_back({data, offset, size});
+                    break;
+                }
+                case OperatorType::Conv2d: {
+                    const Conv2dOptions* options =
+                        static_cast<const op::Conv2d*>(op)->GetOptions();
+                    writer->WriteArray(options->padding, options->paddingCount);
+                    writer->WriteArray(options->strides, options->stridesCount);
+                    writer->WriteArray(options->dilations, options->dilationsCount);
+                    writer->WriteEnum(options->autoPad);
+                    writer->Write(options->groups);
+                    writer->WriteEnum(options->inputLayout);
+                    writer->WriteEnum(options->filterLayout);
+                    WriteActivation(writer, options->activation);
+                    WriteQuantization(writer,
+                                      static_cast<const op::Conv2d*>(op)->GetQuantization());
+                    break;
+                }
+                case OperatorType::Gemm: {
+                    const GemmOptions* options = static_cast<const op::Gemm*>(op)->GetOptions();
+                    writer->Write(options->alpha);
+                    writer->Write(options->beta);
+                    writer->WriteBool(options->aTranspose);
+                    writer->WriteBool(options->bTranspose);
+                    WriteActivation(writer, options->activation);
+                    WriteQuantization(writer, static_cast<const op::Gemm*>(op)->GetQuantization());
+                    break;
+                }
+                case OperatorType::Gru: {
+                    auto gru = static_cast<const op::Gru*>(op);
+                    const GruOptions* options = gru->GetOptions();
+                    writer->Write(gru->GetSteps());
+                    writer->Write(gru->GetHiddenSize());
+                    writer->WriteBool(options->bias != nullptr);
+                    writer->WriteBool(options->recurrentBias != nullptr);
+                    writer->WriteBool(options->initialHiddenState != nullptr);
+                    writer->WriteBool(options->resetAfter);
+                    writer->WriteBool(options->returnSequence);
+                    writer->WriteEnum(options->direction);
+                    writer->WriteEnum(options->layout);
+                    break;
+                }
+                case OperatorType::Input:
+                    writer->WriteString(static_cast<const op::Input*>(op)->GetName());
+                    break;
+                case OperatorType::InstanceNorm: {
+                    const InstanceNormOptions* options =
+                        static_cast<const op::InstanceNorm*>(op)->GetOptions();
+                    writer->WriteBool(options->scale != nullptr);
+                    writer->WriteBool(options->bias != nullptr);
+                    writer->Write(options->epsilon);
+                    writer->WriteEnum(options->layout);
+                    break;
+                }
+                case OperatorType::Pad: {
+                    auto pad = static_cast<const op::Pad*>(op);
+                    writer->WriteVector(pad->GetPadding());
+                    writer->WriteEnum(pad->GetOptions()->mode);
+                    writer->Write(pad->GetOptions()->value);
+                    break;
+                }
+                case OperatorType::Pool2d: {
+                    auto pool2d = static_cast<const op::Pool2d*>(op);
+                    const Pool2dOptions* options = pool2d->GetOptions();
+                    writer->WriteEnum(pool2d->GetType());
+                    writer->WriteArray(options->windowDimensions,
+                                       options->windowDimensionsCount);
+                    writer->WriteArray(options->padding, options->paddingCount);
+                    writer->WriteArray(options->strides, options->stridesCount);
+                    writer->WriteArray(options->dilations, options->dilationsCount);
+                    writer->WriteEnum(options->autoPad);
+                    writer->WriteEnum(options->layout);
+                    break;
+                }
+                case OperatorType::Quantize:
+                    writer->WriteEnum(static_cast<const op::Quantize*>(op)->GetType());
+                    break;
+                case OperatorType::Reduce: {
+                    auto reduce = static_cast<const op::Reduce*>(op);
+                    const ReduceOptions* options = reduce->GetOptions();
+                    writer->WriteEnum(reduce->GetType());
+                    writer->WriteArray(options->axes, options->axesCount);
+                    writer->WriteBool(options->keepDimensions);
+                    break;
+                }
+                case OperatorType::Resample2d: {
+                    auto resample2d = static_cast<const op::Resample2d*>(op);
+                    writer->WriteEnum(resample2d->GetOptions()->mode);
+                    writer->WriteVector(resample2d->GetScales());
+                    writer->WriteVector(resample2d->GetSizes());
+                    writer->WriteVector(resample2d->GetAxes());
+                    break;
+                }
+                case OperatorType::Reshape:
+                    writer->WriteVector(static_cast<const op::Reshape*>(op)->GetNewShape());
+                    break;
+                case OperatorType::Slice: {
+                    auto slice = static_cast<const op::Slice*>(op);
+                    writer->WriteVector(slice->GetStarts());
+                    writer->WriteVector(slice->GetSizes());
+                    writer->WriteVector(slice->GetAxes());
+                    break;
+                }
+                case OperatorType::Split: {
+                    auto split = static_cast<const op::Split*>(op);
+                    writer->WriteVector(split->GetSplits());
+                    writer->Write(split->GetAxis());
+                    break;
+                }
+                case OperatorType::Squeeze:
+                    writer->WriteVector(static_cast<const op::Squeeze*>(op)->GetAxes());
+                    break;
+                case OperatorType::Transpose:
+                    writer->WriteVector(static_cast<const op::Transpose*>(op)->GetPermutation());
+                    break;
+                case OperatorType::Unary: {
+                    auto unary = static_cast<const op::Unary*>(op);
+                    writer->WriteEnum(unary->GetType());
+                    if (unary->GetType() == op::UnaryOpType::kLeakyRelu) {
+                        writer->Write(static_cast<const op::LeakyRelu*>(unary)->GetAlpha());
+                    }
+                    break;
+                }
+                default:
+                    return DAWN_UNIMPLEMENTED_ERROR("The operator can't be serialized.");
+            }
+            return {};
+        }
+
+        MaybeError ValidateInputCount(const std::vector<OperandBase*>& inputs,
+                                      size_t minCount,
+                                      size_t maxCount) {
+            if (inputs.size() < minCount || inputs.size() > maxCount) {
+                return DAWN_VALIDATION_ERROR("The operator has a wrong number of inputs.");
+            }
+            return {};
+        }
+
+        // Replaces the dynamic dimensions of the input |name| with those given in
+        // |inputShapes|.
+        MaybeError SpecializeInputShape(
+            const std::map<std::string, std::vector<int32_t>>& inputShapes,
+            const std::string& name,
+            std::vector<int32_t>* dimensions) {
+            auto inputShape = inputShapes.find(name);
+            if (inputShape == inputShapes.end()) {
+                DAWN_INVALID_IF(HasDynamicDimensions(*dimensions),
+                                "The dimensions of the input %s are not set.", name);
+                return {};
+            }
+            const std::vector<int32_t>& shape = inputShape->second;
+            DAWN_INVALID_IF(shape.size() != dimensions->size(),
+                            "The rank of the input %s is wrong.", name);
+            for (size_t i = 0; i < shape.size(); ++i) {
+                DAWN_INVALID_IF(shape[i] <= 0 || ((*dimensions)[i] != kDynamicDimension &&
+                                                  (*dimensions)[i] != shape[i]),
+                                "The dimensions of the input %s are wrong.", name);
+            }
+            *dimensions = shape;
+            return {};
+        }
+
+        // Creates the operator of |type| from its serialized attributes.
+        ResultOrError<OperatorBase*> ReadOperator(Reader* reader,
+                                                  GraphBuilderBase* builder,
+                                                  OperatorType type,
+                                                  const std::vector<OperandBase*>& inputs,
+                                                  const std::vector<OperandInfo>& outputs,
+                                                  const ReadContext& context) {
+            if (outputs.empty()) {
+                return DAWN_VALIDATION_ERROR("The operator has a wrong number of outputs.");
+            }
+            OperandDescriptor desc;
+            desc.type = outputs[0].type;
+            desc.dimensions = outputs[0].shape.data();
+            desc.dimensionsCount = outputs[0].shape.size();
+
+            switch (type) {
+                case OperatorType::BatchNorm: {
+                    BatchNormOptions options;
+                    bool hasScale, hasBias;
+                    DAWN_TRY(reader->ReadBool(&hasScale));
+                    DAWN_TRY(reader->ReadBool(&hasBias));
+                    DAWN_TRY(reader->Read(&options.axis));
+                    DAWN_TRY(reader->Read(&options.epsilon));
+                    Ref<FusionOperatorBase> activation;
+                    DAWN_TRY(ReadActivation(reader, builder, &activation));
+                    size_t inputCount = 3 + (hasScale ? 1 : 0) + (hasBias ? 1 : 0);
+                    DAWN_TRY(ValidateInputCount(inputs, inputCount, inputCount));
+                    options.scale = hasScale ? inputs[3] : nullptr;
+                    options.bias = hasBias ? inputs[inputCount - 1] : nullptr;
+                    options.activation = activation.Get();
+                    return new (builder) op::BatchNorm(builder, inputs[0], inputs[1], inputs[2],
+                                                       &options);
+                }
+                case OperatorType::Binary: {
+                    op::BinaryOpType opType;
+                    DAWN_TRY(reader->ReadEnum(&opType));
+                    Ref<FusionOperatorBase> activation;
+                    DAWN_TRY(ReadActivation(reader, builder, &activation));
+                    DAWN_TRY(ValidateInputCount(inputs, 2, 2));
+                    return new (builder) op::Binary(builder, opType, inputs[0], inputs[1],
+                                                    activation.Get());
+                }
+                case OperatorType::Clamp: {
+                    ClampOptions options;
+                    DAWN_TRY(reader->Read(&options.minValue));
+                    DAWN_TRY(reader->Read(&options.maxValue));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    return new (builder) op::Clamp(builder, inputs[0], &options);
+                }
+                case OperatorType::Concat: {
+                    uint32_t axis;
+                    DAWN_TRY(reader->Read(&axis));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, inputs.size()));
+                    std::vector<OperandBase*> concatInputs(inputs.begin(), inputs.end());
+                    return new (builder) op::Concat(builder, std::move(concatInputs), axis);
+                }
+                case OperatorType::Constant: {
+                    uint64_t offset, size;
+                    DAWN_TRY(reader->Read(&offset));
+                    DAWN_TRY(reader->Read(&size));
+                    DAWN_TRY(ValidateInputCount(inputs, 0, 0));
+                    if (offset > context.constantSize || size > context.constantSize - offset ||
+                        size < GetElementCount(outputs[0].shape) *
+                                   GetOperandTypeSize(outputs[0].type)) {
+                        return DAWN_VALIDATION_ERROR("The constant is out of the file.");
+                    }
+                    return new (builder) op::Constant(builder, &desc, context.owner,
+                                                      context.constantData + offset, size);
+                }
+                case OperatorType::Conv2d: {
+                    Conv2dOptions options;
+                    std::vector<int32_t> padding, strides, dilations;
+                    DAWN_TRY(reader->ReadVector(&padding));
+                    DAWN_TRY(reader->ReadVector(&strides));
+                    DAWN_TRY(reader->ReadVector(&dilations));
+                    DAWN_TRY(reader->ReadEnum(&options.autoPad));
+                    DAWN_TRY(reader->Read(&options.groups));
+                    DAWN_TRY(reader->ReadEnum(&options.inputLayout));
+                    DAWN_TRY(reader->ReadEnum(&options.filterLayout));
+                    Ref<FusionOperatorBase> activation;
+                    DAWN_TRY(ReadActivation(reader, builder, &activation));
+                    std::optional<op::Quantization> quantization;
+                    DAWN_TRY(ReadQuantization(reader, &quantization));
+                    DAWN_TRY(ValidateInputCount(inputs, 2, 3));
+                    options.padding = padding.data();
+                    options.paddingCount = padding.size();
+                    options.strides = strides.data();
+                    options.stridesCount = strides.size();
+                    options.dilations = dilations.data();
+                    options.dilationsCount = dilations.size();
+                    options.bias = inputs.size() == 3 ? inputs[2] : nullptr;
+                    options.activation = activation.Get();
+                    op::Conv2d* conv2d =
+                        new (builder) op::Conv2d(builder, inputs[0], inputs[1], &options);
+                    if (quantization) {
+                        conv2d->SetQuantization(std::move(*quantization));
+                    }
+                    return conv2d;
+                }
+                case OperatorType::Gemm: {
+                    GemmOptions options;
+                    DAWN_TRY(reader->Read(&options.alpha));
+                    DAWN_TRY(reader->Read(&options.beta));
+                    DAWN_TRY(reader->ReadBool(&options.aTranspose));
+                    DAWN_TRY(reader->ReadBool(&options.bTranspose));
+                    Ref<FusionOperatorBase> activation;
+                    DAWN_TRY(ReadActivation(reader, builder, &activation));
+                    std::optional<op::Quantization> quantization;
+                    DAWN_TRY(ReadQuantization(reader, &quantization));
+                    DAWN_TRY(ValidateInputCount(inputs, 2, 3));
+                    options.c = inputs.size() == 3 ? inputs[2] : nullptr;
+                    options.activation = activation.Get();
+                    op::Gemm* gemm =
+                        new (builder) op::Gemm(builder, inputs[0], inputs[1], &options);
+                    if (quantization) {
+                        gemm->SetQuantization(std::move(*quantization));
+                    }
+                    return gemm;
+                }
+                case OperatorType::Gru: {
+                    GruOptions options;
+                    int32_t steps, hiddenSize;
+                    bool hasBias, hasRecurrentBias, hasInitialHiddenState;
+                    DAWN_TRY(reader->Read(&steps));
+                    DAWN_TRY(reader->Read(&hiddenSize));
+                    DAWN_TRY(reader->ReadBool(&hasBias));
+                    DAWN_TRY(reader->ReadBool(&hasRecurrentBias));
+                    DAWN_TRY(reader->ReadBool(&hasInitialHiddenState));
+                    DAWN_TRY(reader->ReadBool(&options.resetAfter));
+                    DAWN_TRY(reader->ReadBool(&options.returnSequence));
+                    DAWN_TRY(reader->ReadEnum(&options.direction));
+                    DAWN_TRY(reader->ReadEnum(&options.layout));
+                    size_t inputCount = 3 + (hasBias ? 1 : 0) + (hasRecurrentBias ? 1 : 0) +
+                                        (hasInitialHiddenState ? 1 : 0);
+                    DAWN_TRY(ValidateInputCount(inputs, inputCount, inputCount));
+                    size_t index = 3;
+                    options.bias = hasBias ? inputs[index++] : nullptr;
+                    options.recurrentBias = hasRecurrentBias ? inputs[index++] : nullptr;
+                    options.initialHiddenState = hasInitialHiddenState ? inputs[index++] : nullptr;
+                    return new (builder) op::Gru(builder, inputs[0], inputs[1], inputs[2], steps,
+                                                 hiddenSize, &options);
+                }
+                case OperatorType::Input: {
+                    std::string name;
+                    DAWN_TRY(reader->ReadString(&name));
+                    DAWN_TRY(ValidateInputCount(inputs, 0, 0));
+                    std::vector<int32_t> dimensions = outputs[0].shape;
+                    if (context.inputShapes != nullptr) {
+                        DAWN_TRY(SpecializeInputShape(*context.inputShapes, name, &dimensions));
+                    }
+                    desc.dimensions = dimensions.data();
+                    desc.dimensionsCount = dimensions.size();
+                    return new (builder) op::Input(builder, name, &desc);
+                }
+                case OperatorType::InstanceNorm: {
+                    InstanceNormOptions options;
+                    bool hasScale, hasBias;
+                    DAWN_TRY(reader->ReadBool(&hasScale));
+                    DAWN_TRY(reader->ReadBool(&hasBias));
+                    DAWN_TRY(reader->Read(&options.epsilon));
+                    DAWN_TRY(reader->ReadEnum(&options.layout));
+                    size_t inputCount = 1 + (hasScale ? 1 : 0) + (hasBias ? 1 : 0);
+                    DAWN_TRY(ValidateInputCount(inputs, inputCount, inputCount));
+                    options.scale = hasScale ? inputs[1] : nullptr;
+                    options.bias = hasBias ? inputs[inputCount - 1] : nullptr;
+                    return new (builder) op::InstanceNorm(builder, inputs[0], &options);
+                }
+                case OperatorType::Pad: {
+                    std::vector<uint32_t> padding;
+                    PadOptions options;
+                    DAWN_TRY(reader->ReadVector(&padding));
+                    DAWN_TRY(reader->ReadEnum(&options.mode));
+                    DAWN_TRY(reader->Read(&options.value));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    return new (builder) op::Pad(builder, inputs[0], padding.data(), padding.size(),
+                                                 &options);
+                }
+                case OperatorType::Pool2d: {
+                    op::Pool2dType poolType;
+                    Pool2dOptions options;
+                    std::vector<int32_t> windowDimensions, padding, strides, dilations;
+                    DAWN_TRY(reader->ReadEnum(&poolType));
+                    DAWN_TRY(reader->ReadVector(&windowDimensions));
+                    DAWN_TRY(reader->ReadVector(&padding));
+                    DAWN_TRY(reader->ReadVector(&strides));
+                    DAWN_TRY(reader->ReadVector(&dilations));
+                    DAWN_TRY(reader->ReadEnum(&options.autoPad));
+                    DAWN_TRY(reader->ReadEnum(&options.layout));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    options.windowDimensions = windowDimensions.data();
+                    options.windowDimensionsCount = windowDimensions.size();
+                    options.padding = padding.data();
+                    options.paddingCount = padding.size();
+                    options.strides = strides.data();
+                    options.stridesCount = strides.size();
+                    options.dilations = dilations.data();
+                    options.dilationsCount = dilations.size();
+                    return new (builder) op::Pool2d(builder, poolType, inputs[0], &options);
+                }
+                case OperatorType::Quantize: {
+                    op::QuantizeOpType quantizeType;
+                    DAWN_TRY(reader->ReadEnum(&quantizeType));
+                    DAWN_TRY(ValidateInputCount(inputs, 3, 3));
+                    return new (builder) op::Quantize(builder, quantizeType, inputs[0], inputs[1],
+                                                      inputs[2]);
+                }
+                case OperatorType::Reduce: {
+                    op::ReduceType reduceType;
+                    ReduceOptions options;
+                    std::vector<int32_t> axes;
+                    DAWN_TRY(reader->ReadEnum(&reduceType));
+                    DAWN_TRY(reader->ReadVector(&axes));
+                    DAWN_TRY(reader->ReadBool(&options.keepDimensions));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    options.axes = axes.data();
+                    options.axesCount = axes.size();
+                    return new (builder) op::Reduce(builder, reduceType, inputs[0], &options);
+                }
+                case OperatorType::Resample2d: {
+                    Resample2dOptions options;
+                    std::vector<float> scales;
+                    std::vector<int32_t> sizes, axes;
+                    DAWN_TRY(reader->ReadEnum(&options.mode));
+                    DAWN_TRY(reader->ReadVector(&scales));
+                    DAWN_TRY(reader->ReadVector(&sizes));
+                    DAWN_TRY(reader->ReadVector(&axes));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    options.scales = scales.data();
+                    options.scalesCount = scales.size();
+                    options.sizes = sizes.data();
+                    options.sizesCount = sizes.size();
+                    options.axes = axes.data();
+                    options.axesCount = axes.size();
+                    return new (builder) op::Resample2d(builder, inputs[0], &options);
+                }
+                case OperatorType::Reshape: {
+                    std::vector<int32_t> newShape;
+                    DAWN_TRY(reader->ReadVector(&newShape));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    return new (builder) op::Reshape(builder, inputs[0], newShape.data(),
+                                                     newShape.size());
+                }
+                case OperatorType::Slice: {
+                    std::vector<int32_t> starts, sizes, axes;
+                    DAWN_TRY(reader->ReadVector(&starts));
+                    DAWN_TRY(reader->ReadVector(&sizes));
+                    DAWN_TRY(reader->ReadVector(&axes));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    SliceOptions options;
+                    options.axes = axes.data();
+                    options.axesCount = axes.size();
+                    return new (builder) op::Slice(builder, inputs[0], starts.data(), starts.size(),
+                                                   sizes.data(), sizes.size(), &options);
+                }
+                case OperatorType::Split: {
+                    std::vector<uint32_t> splits;
+                    SplitOptions options;
+                    DAWN_TRY(reader->ReadVector(&splits));
+                    DAWN_TRY(reader->Read(&options.axis));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    return new (builder) op::Split(builder, inputs[0], splits.data(), splits.size(),
+                                                   &options);
+                }
+                case OperatorType::Squeeze: {
+                    std::vector<int32_t> axes;
+                    DAWN_TRY(reader->ReadVector(&axes));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    SqueezeOptions options;
+                    options.axes = axes.data();
+                    options.axesCount = axes.size();
+                    return new (builder) op::Squeeze(builder, inputs[0], &options);
+                }
+                case OperatorType::Transpose: {
+                    std::vector<int32_t> permutation;
+                    DAWN_TRY(reader->ReadVector(&permutation));
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    TransposeOptions options;
+                    options.permutation = permutation.data();
+                    options.permutationCount = permutation.size();
+                    return new (builder) op::Transpose(builder, inputs[0], &options);
+                }
+                case OperatorType::Unary: {
+                    op::UnaryOpType unaryType;
+                    DAWN_TRY(reader->ReadEnum(&unaryType));
+                    if (unaryType == op::UnaryOpType::kLeakyRelu) {
+                        LeakyReluOptions options;
+                        DAWN_TRY(reader->Read(&options.alpha));
+                        DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                        return new (builder) op::LeakyRelu(builder, inputs[0], &options);
+                    }
+                    DAWN_TRY(ValidateInputCount(inputs, 1, 1));
+                    return new (builder) op::Unary(builder, unaryType, inputs[0]);
+                }
+                default:
+                    return DAWN_VALIDATION_ERROR("The operator type is unknown.");
+            }
+        }
+
+        // Writes the header, the operators and the outputs, and gathers the data of the
+        // constants that follows them.
+        MaybeError WriteGraph(Writer* writer,
+                              const std::vector<const OperatorBase*>& operators,
+                              const std::map<std::string, const OperandBase*>& outputs,
+                              size_t* constantSize,
+                              std::vector<ConstantData>* constants) {
+            writer->Write(kMagic);
+            writer->Write(kSerializedGraphVersion);
+            writer->Write<uint32_t>(operators.size());
+            writer->Write<uint32_t>(outputs.size());
+            // The offset and size of the constant data, written at the end.
+            writer->Write<uint64_t>(0);
+            writer->Write<uint64_t>(0);
+
+            std::unordered_map<const OperandBase*, uint32_t> operandIds;
+            for (const OperatorBase* op : operators) {
+                writer->WriteEnum(op->GetOperatorType());
+                writer->Write<uint32_t>(op->Inputs().size());
+                for (auto& input : op->Inputs()) {
+                    auto operandId = operandIds.find(input);
+                    if (operandId == operandIds.end()) {
+                        return DAWN_VALIDATION_ERROR(
+                            "The operators are not in topological order.");
+                    }
+                    writer->Write(operandId->second);
+                }
+                writer->Write<uint32_t>(op->Outputs().size());
+                for (auto& output : op->Outputs()) {
+                    writer->WriteEnum(output->Type());
+                    writer->WriteVector(std::vector<int32_t>(output->Shape()));
+                    uint32_t id = operandIds.size();
+                    operandIds[output] = id;
+                }
+                DAWN_TRY(WriteAttributes(writer, op, constantSize, constants));
+            }
+            for (auto& output : outputs) {
+                auto operandId = operandIds.find(output.second);
+                if (operandId == operandIds.end()) {
+                    return DAWN_VALIDATION_ERROR("The output is not computed by the operators.");
+                }
+                writer->WriteString(output.first);
+                writer->Write(operandId->second);
+            }
+            return {};
+        }
+
+        // Records |data| in words rather than bytes, the constants can take hundreds of
+        // megabytes.
+        void RecordBytes(ObjectContentHasher* hasher, const uint8_t* data, size_t size) {
+            hasher->Record(size);
+            size_t i = 0;
+            for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+                uint64_t word;
+                memcpy(&word, data + i, sizeof(word));
+                hasher->Record(word);
+            }
+            for (; i < size; ++i) {
+                hasher->Record(data[i]);
+            }
+        }
+
+        // Writes the graph, followed by the data of its constants, as laid out in a file.
+        MaybeError WriteSerializedGraph(Writer* writer,
+                                        const std::vector<const OperatorBase*>& operators,
+                                        const std::map<std::string, const OperandBase*>& outputs) {
+            size_t constantSize = 0;
+            std::vector<ConstantData> constants;
+            DAWN_TRY(WriteGraph(writer, operators, outputs, &constantSize, &constants));
+
+            writer->Pad(kSerializedConstantAlignment);
+            uint64_t constantOffset = writer->GetData().size();
+            writer->Overwrite<uint64_t>(4 * sizeof(uint32_t), constantOffset);
+            writer->Overwrite<uint64_t>(4 * sizeof(uint32_t) + sizeof(uint64_t), constantSize);
+            for (const ConstantData& constant : constants) {
+                writer->Pad(kSerializedConstantAlignment);
+                DAWN_ASSERT(writer->GetData().size() == constantOffset + constant.offset);
+                writer->WriteBytes(constant.data, constant.size);
+            }
+            return {};
+        }
+
+        // Recreates in |builder| the operators of the graph serialized in |data|, which is kept
+        // alive by |owner|. See ReadContext for |inputShapes|.
+        MaybeError ReadGraph(GraphBuilderBase* builder,
+                             Ref<RefCounted> owner,
+                             const uint8_t* data,
+                             size_t size,
+                             const std::map<std::string, std::vector<int32_t>>* inputShapes,
+                             std::vector<OperatorBase*>* operators,
+                             std::map<std::string, const OperandBase*>* outputs) {
+            Reader reader(data, size);
+
+            uint32_t magic, version, operatorCount, outputCount;
+            uint64_t constantOffset, constantSize;
+            DAWN_TRY(reader.Read(&magic));
+            DAWN_TRY(reader.Read(&version));
+            if (magic != kMagic) {
+                return DAWN_VALIDATION_ERROR("The data is not a serialized graph.");
+            }
+            if (version != kSerializedGraphVersion) {
+                return DAWN_VALIDATION_ERROR(
+                    "The version of the serialized graph is unsupported.");
+            }
+            DAWN_TRY(reader.Read(&operatorCount));
+            DAWN_TRY(reader.Read(&outputCount));
+            DAWN_TRY(reader.Read(&constantOffset));
+            DAWN_TRY(reader.Read(&constantSize));
+            if (constantOffset < kHeaderSize || constantOffset > size ||
+                constantSize > size - constantOffset) {
+                return DAWN_VALIDATION_ERROR("The constant data is out of the file.");
+            }
+            ReadContext context = {std::move(owner), data + constantOffset, constantSize,
+                                   inputShapes};
+
+            std::vector<OperandBase*> operands;
+            for (uint32_t i = 0; i < operatorCount; ++i) {
+                OperatorType type;
+                uint32_t inputCount;
+                DAWN_TRY(reader.ReadEnum(&type));
+                DAWN_TRY(reader.Read(&inputCount));
+                std::vector<OperandBase*> inputs;
+                for (uint32_t j = 0; j < inputCount; ++j) {
+                    uint32_t operandId;
+                    DAWN_TRY(reader.Read(&operandId));
+                    if (operandId >= operands.size()) {
+                        return DAWN_VALIDATION_ERROR("The operand index is out of range.");
+                    }
+                    inputs.push_back(operands[operandId]);
+                }
+                uint32_t outputOperandCount;
+                DAWN_TRY(reader.Read(&outputOperandCount));
+                std::vector<OperandInfo> outputInfos;
+                for (uint32_t j = 0; j < outputOperandCount; ++j) {
+                    OperandInfo info;
+                    DAWN_TRY(reader.ReadEnum(&info.type));
+                    DAWN_TRY(reader.ReadVector(&info.shape));
+                    outputInfos.push_back(std::move(info));
+                }
+
+                OperatorBase* op;
+                DAWN_TRY_ASSIGN(
+                    op, ReadOperator(&reader, builder, type, inputs, outputInfos, context));
+                if (op->Outputs().size() != outputInfos.size()) {
+                    return DAWN_VALIDATION_ERROR("The operator has a wrong number of outputs.");
+                }
+                if (inputShapes != nullptr) {
+                    DAWN_TRY(op->ValidateAndInferOutputInfo());
+                } else {
+                    // The outputs were inferred when the graph was built, they are set instead
+                    // of validating the operator again.
+                    for (size_t j = 0; j < outputInfos.size(); ++j) {
+                        op->Outputs()[j]->SetType(outputInfos[j].type);
+                        op->Outputs()[j]->SetShape(std::move(outputInfos[j].shape));
+                    }
+                }
+                for (auto& output : op->Outputs()) {
+                    operands.push_back(output);
+                }
+                operators->push_back(op);
+            }
+
+            for (uint32_t i = 0; i < outputCount; ++i) {
+                std::string name;
+                uint32_t operandId;
+                DAWN_TRY(reader.ReadString(&name));
+                DAWN_TRY(reader.Read(&operandId));
+                if (operandId >= operands.size()) {
+                    return DAWN_VALIDATION_ERROR("The operand index is out of range.");
+                }
+                (*outputs)[name] = operands[operandId];
+            }
+            return {};
+        }
+
+    }  // anonymous namespace
+
+    SerializedGraph::SerializedGraph(const std::vector<uint8_t>& data)
+        : mStorage(new uint8_t[data.size() + kSerializedConstantAlignment]),
+          mData(AlignPtr(mStorage.get(), kSerializedConstantAlignment)),
+          mSize(data.size()) {
+        memcpy(mData, data.data(), mSize);
+    }
+
+    MaybeError SerializeGraph(const std::vector<const OperatorBase*>& operators,
+                              const std::map<std::string, const OperandBase*>& outputs,
+                              const std::string& path) {
+        Writer writer;
+        DAWN_TRY(WriteSerializedGraph(&writer, operators, outputs));
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(writer.GetData().data()),
+                   writer.GetData().size());
+        if (!file) {
+            return DAWN_VALIDATION_ERROR("Failed to write the graph to " + path + ".");
+        }
+        return {};
+    }
+
+    ResultOrError<Ref<SerializedGraph>> SerializeGraph(
+        const std::vector<const OperatorBase*>& operators,
+        const std::map<std::string, const OperandBase*>& outputs) {
+        Writer writer;
+        DAWN_TRY(WriteSerializedGraph(&writer, operators, outputs));
+        return AcquireRef(new SerializedGraph(writer.GetData()));
+    }
+
+    ResultOrError<size_t> HashGraph(const std::vector<const OperatorBase*>& operators,
+                                    const std::map<std::string, const OperandBase*>& outputs) {
+        Writer writer;
+        size_t constantSize = 0;
+        std::vector<ConstantData> constants;
+        DAWN_TRY(WriteGraph(&writer, operators, outputs, &constantSize, &constants));
+
+        ObjectContentHasher hasher;
+        RecordBytes(&hasher, writer.GetData().data(), writer.GetData().size());
+        for (const ConstantData& constant : constants) {
+            RecordBytes(&hasher, constant.data, constant.size);
+        }
+        return hasher.GetContentHash();
+    }
+
+    MaybeError DeserializeGraph(GraphBuilderBase* builder,
+                                const std::string& path,
+                                std::vector<OperatorBase*>* operators,
+                                std::map<std::string, const OperandBase*>* outputs) {
+        std::string error;
+        Ref<MappedFile> file = MappedFile::Open(path, &error);
+        if (file == nullptr) {
+            return DAWN_VALIDATION_ERROR("Failed to load the graph: " + error);
+        }
+        const uint8_t* data = file->GetData();
+        size_t size = file->GetSize();
+        return ReadGraph(builder, std::move(file), data, size, nullptr, operators, outputs);
+    }
+
+    MaybeError DeserializeGraph(GraphBuilderBase* builder,
+                                SerializedGraph* graph,
+                                const std::map<std::string, std::vector<int32_t>>& inputShapes,
+                                std::vector<OperatorBase*>* operators,
+                                std::map<std::string, const OperandBase*>* outputs) {
+        return ReadGraph(builder, graph, graph->GetData(), graph->GetSize(), &inputShapes,
+                         operators, outputs);
+    }
+
+}  // namespace dawn::native
@@ -0,0 +1,101 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_GRAPH_SERIALIZER_H_
+#define WEBNN_NATIVE_GRAPH_SERIALIZER_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dawn/common/RefCounted.h"
+#include "dawn/native/Error.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native {
+
+    // A graph stored in a file, in the native byte order:
+    //  - A header with the magic number, the format version, the operator and output counts,
+    //    and the offset and size of the constant data.
+    //  - The operators in topological order, each with the indices of its input operands, the
+    //    type and shape of its outputs, and its attributes. The operands are numbered in the
+    //    order the operators define them.
+    //  - The names and operand indices of the graph outputs.
+    //  - The data of the constants, every constant aligned to kSerializedConstantAlignment.
+    //
+    // The operators are serialized after the graph rewrites of GraphOptimizer, so loading them
+    // neither validates nor rewrites them again. The graphs with dynamic input dimensions are
+    // instead serialized in memory as they were built, see DynamicGraph, and validated again
+    // when they are read for concrete input shapes.
+    constexpr uint32_t kSerializedGraphVersion = 3;
+    constexpr size_t kSerializedConstantAlignment = 64;
+
+    // A graph serialized in memory, laid out as in a file.
+    class SerializedGraph final : public RefCounted {
+      public:
+        explicit SerializedGraph(const std::vector<uint8_t>& data);
+
+        const uint8_t* GetData() const {
+            return mData;
+        }
+        size_t GetSize() const {
+            return mSize;
+        }
+
+      private:
+        ~SerializedGraph() override = default;
+
+        std::unique_ptr<uint8_t[]> mStorage;
+        // mStorage aligned to kSerializedConstantAlignment.
+        uint8_t* mData;
+        size_t mSize;
+    };
+
+    // Writes the |operators|, in topological order, and the named |outputs| to |path|.
+    MaybeError SerializeGraph(const std::vector<const OperatorBase*>& operators,
+                              const std::map<std::string, const OperandBase*>& outputs,
+                              const std::string& path);
+    // Serializes the |operators| and |outputs| in memory. The constants are copied, so the
+    // buffers they were built from can be reused.
+    ResultOrError<Ref<SerializedGraph>> SerializeGraph(
+        const std::vector<const OperatorBase*>& operators,
+        const std::map<std::string, const OperandBase*>& outputs);
+
+    // Hashes the serialized form of the |operators| and |outputs| together with the data of the
+    // constants, as the content of the graph in the key of its compiled form in the persistent
+    // cache.
+    ResultOrError<size_t> HashGraph(const std::vector<const OperatorBase*>& operators,
+                                    const std::map<std::string, const OperandBase*>& outputs);
+
+    // Recreates in |builder| the operators of the graph serialized in |path|. The file is
+    // mapped in memory and the constants read it in place, so they share the pages of the file
+    // with the other processes loading it.
+    MaybeError DeserializeGraph(GraphBuilderBase* builder,
+                                const std::string& path,
+                                std::vector<OperatorBase*>* operators,
+                                std::map<std::string, const OperandBase*>* outputs);
+    // Recreates in |builder| the operators of |graph| with the dimensions of the inputs given by
+    // |inputShapes|, by name, and validates them to infer the shapes of the other operands. The
+    // constants read |graph| in place.
+    MaybeError DeserializeGraph(GraphBuilderBase* builder,
+                                SerializedGraph* graph,
+                                const std::map<std::string, std::vector<int32_t>>& inputShapes,
+                                std::vector<OperatorBase*>* operators,
+                                std::map<std::string, const OperandBase*>* outputs);
+
+}  // namespace dawn::native
+
+#endif  // WEBNN_NATIVE_GRAPH_SERIALIZER_H_
@@ -0,0 +1,232 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/MemoryPlan.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/native/GraphIndex.h"
+#include "dawn/native/ops/Binary.h"
+#include "dawn/native/ops/Concat.h"
+#include "dawn/native/ops/Unary.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        // The memory shared by an operand and the operands computed in place of it, viewing it
+        // or nested in it by Concat.
+        struct Block {
+            size_t size;
+            // The index of the operator writing the first operand.
+            size_t firstStep;
+            // The index of the last operator reading any of the operands.
+            size_t lastStep;
+            size_t offset = 0;
+            // Whether the block was nested in the block of a Concat output.
+            bool nested = false;
+        };
+
+        // Where an operand is stored.
+        struct Location {
+            size_t block;
+            // The offset in the block.
+            size_t offset;
+        };
+
+        // Whether every element of the output only depends on the elements at the same
+        // position in the inputs, so that it can overwrite an input of the same shape.
+        bool IsElementwise(const OperatorBase* op) {
+            switch (op->GetOperatorType()) {
+                case OperatorType::Binary:
+                    return static_cast<const op::Binary*>(op)->GetType() !=
+                           op::BinaryOpType::kMatMul;
+                case OperatorType::Clamp:
+                    return true;
+                case OperatorType::Unary:
+                    return static_cast<const op::Unary*>(op)->GetType() !=
+                           op::UnaryOpType::kSoftmax;
+                default:
+                    return false;
+            }
+        }
+
+        // Whether the output is the input with another shape, which doesn't need to be copied.
+        bool IsView(const OperatorBase* op) {
+            return op->GetOperatorType() == OperatorType::Reshape ||
+                   op->GetOperatorType() == OperatorType::Squeeze;
+        }
+
+    }  // anonymous namespace
+
+    MemoryPlan::MemoryPlan(const std::vector<const OperatorBase*>& operators,
+                           const std::vector<const OperandBase*>& outputs,
+                           const std::function<size_t(wgpu::OperandType)>& elementSize) {
+        // The index of the last operator reading each operand, which is the last of its
+        // consumers since the operators are in topological order, or the end for the outputs.
+        GraphIndex index(operators);
+        std::vector<size_t> lastUses(index.GetOperandCount());
+        for (uint32_t operand = 0; operand < lastUses.size(); ++operand) {
+            GraphIndex::IdRange consumers = index.GetConsumers(operand);
+            lastUses[operand] = consumers.size() == 0 ? index.GetProducer(operand)
+                                                      : *(consumers.end() - 1);
+        }
+        for (const OperandBase* output : outputs) {
+            uint32_t operand = index.GetOperandId(output);
+            if (operand != GraphIndex::kInvalidId) {
+                lastUses[operand] = operators.size();
+            }
+        }
+        auto getLastUse = [&](const OperandBase* operand) {
+            return lastUses[index.GetOperandId(operand)];
+        };
+
+        // Compute the lifetimes of the blocks.
+        std::vector<Block> blocks;
+        std::unordered_map<const OperandBase*, Location> locations;
+        auto getBytes = [&](const OperandBase* operand) {
+            return GetElementCount(operand->Shape()) * elementSize(operand->Type());
+        };
+        for (size_t step = 0; step < operators.size(); ++step) {
+            const OperatorBase* op = operators[step];
+            if (op->GetOperatorType() == OperatorType::Constant ||
+                op->GetOperatorType() == OperatorType::Input) {
+                continue;
+            }
+            if (IsView(op)) {
+                // The views of the constants and the inputs are not planned either.
+                const OperandBase* output = op->PrimaryOutput();
+                auto inputLocation = locations.find(op->Inputs()[0]);
+                if (inputLocation != locations.end()) {
+                    Block& block = blocks[inputLocation->second.block];
+                    block.lastStep = std::max(block.lastStep, getLastUse(output));
+                    locations[output] = inputLocation->second;
+                }
+                continue;
+            }
+            for (auto& output : op->Outputs()) {
+                size_t lastStep = getLastUse(output);
+                // Reuse the block of an input that is read for the last time.
+                bool inPlace = false;
+                if (op->Outputs().size() == 1 && IsElementwise(op)) {
+                    for (auto& input : op->Inputs()) {
+                        auto inputLocation = locations.find(input);
+                        if (inputLocation != locations.end() &&
+                            blocks[inputLocation->second.block].lastStep == step &&
+                            input->Shape() == output->Shape() &&
+                            input->Type() == output->Type()) {
+                            blocks[inputLocation->second.block].lastStep = lastStep;
+                            locations[output] = inputLocation->second;
+                            inPlace = true;
+                            break;
+                        }
+                    }
+                }
+                if (!inPlace) {
+                    locations[output] = {blocks.size(), 0};
+                    blocks.push_back({Align(getBytes(output), kAlignment), step, lastStep});
+                }
+            }
+            if (op->GetOperatorType() != OperatorType::Concat) {
+                continue;
+            }
+            // The inputs of a Concat whose slices are contiguous in the output are computed in
+            // place there, when they fill their own block, which is then moved into the block of
+            // the output.
+            uint32_t axis = static_cast<const op::Concat*>(op)->GetAxis();
+            std::vector<int32_t> outputShape = op->PrimaryOutput()->Shape();
+            if (GetElementCount(std::vector<int32_t>(outputShape.begin(),
+                                                     outputShape.begin() + axis)) != 1) {
+                continue;
+            }
+            size_t outputBlock = locations[op->PrimaryOutput()].block;
+            size_t sliceOffset = 0;
+            for (auto& input : op->Inputs()) {
+                size_t bytes = getBytes(input);
+                auto inputLocation = locations.find(input);
+                if (inputLocation != locations.end() && inputLocation->second.offset == 0 &&
+                    inputLocation->second.block != outputBlock &&
+                    !blocks[inputLocation->second.block].nested &&
+                    blocks[inputLocation->second.block].size == Align(bytes, kAlignment)) {
+                    size_t inputBlock = inputLocation->second.block;
+                    for (auto& location : locations) {
+                        if (location.second.block == inputBlock) {
+                            location.second = {outputBlock, location.second.offset + sliceOffset};
+                        }
+                    }
+                    blocks[inputBlock].nested = true;
+                    blocks[outputBlock].firstStep =
+                        std::min(blocks[outputBlock].firstStep, blocks[inputBlock].firstStep);
+                    blocks[outputBlock].lastStep =
+                        std::max(blocks[outputBlock].lastStep, blocks[inputBlock].lastStep);
+                }
+                sliceOffset += bytes;
+            }
+        }
+
+        // Place the largest blocks first, each in the smallest gap between the blocks alive at
+        // the same time that fits it, or after all of them.
+        std::vector<size_t> order;
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            if (!blocks[i].nested) {
+                order.push_back(i);
+            }
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&](size_t a, size_t b) { return blocks[a].size > blocks[b].size; });
+        std::vector<const Block*> placedBlocks;
+        for (size_t index : order) {
+            Block& block = blocks[index];
+            std::vector<const Block*> overlappingBlocks;
+            for (const Block* other : placedBlocks) {
+                if (other->firstStep <= block.lastStep && block.firstStep <= other->lastStep) {
+                    overlappingBlocks.push_back(other);
+                }
+            }
+            std::sort(overlappingBlocks.begin(), overlappingBlocks.end(),
+                      [](const Block* a, const Block* b) { return a->offset < b->offset; });
+            size_t bestGap = std::numeric_limits<size_t>::max();
+            size_t bestOffset = 0;
+            size_t end = 0;
+            for (const Block* other : overlappingBlocks) {
+                if (other->offset >= end + block.size && other->offset - end < bestGap) {
+                    bestGap = other->offset - end;
+                    bestOffset = end;
+                }
+                end = std::max(end, other->offset + other->size);
+            }
+            block.offset = bestGap == std::numeric_limits<size_t>::max() ? end : bestOffset;
+            mSize = std::max(mSize, block.offset + block.size);
+            placedBlocks.push_back(&block);
+        }
+
+        for (auto& location : locations) {
+            mOffsets[location.first] =
+                blocks[location.second.block].offset + location.second.offset;
+        }
+    }
+
+    bool MemoryPlan::HasOffset(const OperandBase* operand) const {
+        return mOffsets.find(operand) != mOffsets.end();
+    }
+
+    size_t MemoryPlan::GetOffset(const OperandBase* operand) const {
+        DAWN_ASSERT(HasOffset(operand));
+        return mOffsets.at(operand);
+    }
+
+}  // namespace dawn::native
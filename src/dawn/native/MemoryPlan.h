@@ -0,0 +1,60 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_MEMORY_PLAN_H_
+#define WEBNN_NATIVE_MEMORY_PLAN_H_
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native {
+
+    // The offsets of the intermediate operands of a graph in a single arena. Operands whose
+    // lifetimes don't overlap share memory, and the output of an element-wise operator is
+    // computed in place of an input that is no longer used afterwards. The output of Reshape
+    // and Squeeze is a view of its input, and the inputs of a Concat along its outermost
+    // non-trivial axis are placed at their slices of its output, so neither needs to be copied.
+    class MemoryPlan {
+      public:
+        // The alignment of the operands in the arena, except those placed in a Concat output.
+        static constexpr size_t kAlignment = 64;
+
+        MemoryPlan() = default;
+        // Plans the operands produced by |operators|, which are in topological order, except
+        // those of the constants and the inputs and their views. |outputs| are kept alive until
+        // the end.
+        // |elementSize| gives the bytes of an element as the backend stores it.
+        MemoryPlan(const std::vector<const OperatorBase*>& operators,
+                   const std::vector<const OperandBase*>& outputs,
+                   const std::function<size_t(wgpu::OperandType)>& elementSize);
+
+        bool HasOffset(const OperandBase* operand) const;
+        size_t GetOffset(const OperandBase* operand) const;
+        // The peak size in bytes of the memory of the intermediate operands.
+        size_t GetSize() const {
+            return mSize;
+        }
+
+      private:
+        std::unordered_map<const OperandBase*, size_t> mOffsets;
+        size_t mSize = 0;
+    };
+
+}  // namespace dawn::native
+
+#endif  // WEBNN_NATIVE_MEMORY_PLAN_H_
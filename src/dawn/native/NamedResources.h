@@ -17,6 +17,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "dawn/native/NamedRecords.h"
 #include "dawn/native/dawn_platform.h"
@@ -30,16 +31,37 @@ namespace dawn::native {
 
         // WebNN API
         void APISet(char const* name, const BufferResourceView* record) {
+            mHostResources.erase(name);
             mResources[std::string(name)] = *record;
         }
+        // Host memory the backends that can read and write in place, without staging it in a
+        // buffer. It replaces the buffer resource of |name|, and the other way around.
+        void APISetHost(char const* name, const HostResourceView* record) {
+            mResources.erase(name);
+            mHostResources[std::string(name)] = *record;
+        }
+        // The dimensions of the input |name| of a graph built with dynamic dimensions.
+        void APISetDimensions(char const* name,
+                              int32_t const* dimensions,
+                              uint32_t dimensionsCount) {
+            mDimensions[std::string(name)].assign(dimensions, dimensions + dimensionsCount);
+        }
 
         // Other methods
         const std::map<std::string, BufferResourceView>& GetResources() const {
             return mResources;
         }
+        const std::map<std::string, HostResourceView>& GetHostResources() const {
+            return mHostResources;
+        }
+        const std::map<std::string, std::vector<int32_t>>& GetDimensions() const {
+            return mDimensions;
+        }
 
       private:
         std::map<std::string, BufferResourceView> mResources;
+        std::map<std::string, HostResourceView> mHostResources;
+        std::map<std::string, std::vector<int32_t>> mDimensions;
     };
 
 }  // namespace webnn_native
@@ -20,19 +20,92 @@
 
 namespace dawn::native {
 
+    size_t GetOperandTypeSize(wgpu::OperandType type) {
+        switch (type) {
+            case wgpu::OperandType::Float32:
+            case wgpu::OperandType::Int32:
+            case wgpu::OperandType::Uint32:
+                return 4;
+            case wgpu::OperandType::Float16:
+                return 2;
+            case wgpu::OperandType::Int8:
+            case wgpu::OperandType::Uint8:
+                return 1;
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+    size_t GetElementCount(const OperandShape& shape) {
+        size_t count = 1;
+        for (int32_t dimension : shape) {
+            count *= static_cast<size_t>(dimension);
+        }
+        return count;
+    }
+
+    bool HasDynamicDimensions(const OperandShape& shape) {
+        for (int32_t dimension : shape) {
+            if (dimension == kDynamicDimension) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     OperandBase::OperandBase(GraphBuilderBase* graphBuilder, OperatorBase* operatorBase)
         : ObjectBase(graphBuilder->GetDevice()),
+          mArena(graphBuilder->GetArena()),
           mOperator(operatorBase),
           mType(wgpu::OperandType::Float32) {
+        mArena->Adopt(this);
     }
 
     OperandBase::OperandBase(GraphBuilderBase* graphBuilder, ObjectBase::ErrorTag tag)
-        : ObjectBase(graphBuilder->GetDevice(), tag) {
+        : ObjectBase(graphBuilder->GetDevice(), tag),
+          mArena(graphBuilder->GetArena()),
+          mOperator(nullptr) {
+        mArena->Adopt(this);
     }
 
     // static
     OperandBase* OperandBase::MakeError(GraphBuilderBase* GraphBuilder) {
-        return new OperandBase(GraphBuilder, ObjectBase::kError);
+        OperandBase* operand = new (GraphBuilder) OperandBase(GraphBuilder, ObjectBase::kError);
+        operand->Reference();
+        return operand;
+    }
+
+    void OperandBase::Reference() {
+        mArena->Reference();
+    }
+
+    void OperandBase::Release() {
+        mArena->Release();
+    }
+
+    void OperandBase::APIReference() {
+        Reference();
+    }
+
+    void OperandBase::APIRelease() {
+        Release();
+    }
+
+    void OperandBase::DeleteThis() {
+    }
+
+    // static
+    void* OperandBase::operator new(size_t size, GraphBuilderBase* graphBuilder) {
+        return graphBuilder->GetArena()->Allocate(size);
+    }
+
+    // static
+    void OperandBase::operator delete(void* ptr) {
+        // The memory is freed with the arena.
+    }
+
+    // static
+    void OperandBase::operator delete(void* ptr, GraphBuilderBase* graphBuilder) {
     }
 
 }  // namespace webnn_native
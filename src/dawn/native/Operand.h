@@ -21,18 +21,30 @@
 #include "dawn/native/Forward.h"
 #include "dawn/native/GraphBuilder.h"
 #include "dawn/native/ObjectBase.h"
+#include "dawn/native/OperandShape.h"
 #include "dawn/native/Operator.h"
 #include "dawn/native/dawn_platform.h"
 
 namespace dawn::native {
 
+    size_t GetOperandTypeSize(wgpu::OperandType type);
+    size_t GetElementCount(const OperandShape& shape);
+
+    // The size of a dimension of a graph input that is only known when the graph is computed,
+    // and of the dimensions inferred from it, see DynamicGraph.
+    constexpr int32_t kDynamicDimension = -1;
+    bool HasDynamicDimensions(const OperandShape& shape);
+
     class OperandBase : public ObjectBase {
       public:
         OperandBase(GraphBuilderBase*, OperatorBase*);
         virtual ~OperandBase() = default;
 
         const OperatorBase* Operator() const {
-            return mOperator.Get();
+            return mOperator;
+        }
+        void SetOperator(OperatorBase* op) {
+            mOperator = op;
         }
 
         wgpu::OperandType Type() const {
@@ -42,26 +54,45 @@ namespace dawn::native {
             mType = type;
         }
 
-        std::vector<int32_t> Shape() const {
+        const OperandShape& Shape() const {
             return mShape;
         }
 
-        void SetShape(std::vector<int32_t> shape) {
-            mShape = std::move(shape);
+        void SetShape(const OperandShape& shape) {
+            mShape = shape;
+        }
+        void SetShape(const std::vector<int32_t>& shape) {
+            mShape = shape;
         }
 
+        // Returns an error operand with a reference for the caller.
         static OperandBase* MakeError(GraphBuilderBase* modelBuilder);
 
+        // Operands are owned by the arena of their builder, see GraphArena. A reference to an
+        // operand, e.g. one that the builder returns, is a reference to the arena.
+        void Reference();
+        void Release();
+        void APIReference();
+        void APIRelease();
+        static void* operator new(size_t size, GraphBuilderBase* graphBuilder);
+        static void operator delete(void* ptr);
+        static void operator delete(void* ptr, GraphBuilderBase* graphBuilder);
+
       private:
         OperandBase(GraphBuilderBase* GraphBuilder, ObjectBase::ErrorTag tag);
 
+        // The arena destroys the operand.
+        void DeleteThis() override;
+
+        GraphArena* mArena;
+
       protected:
         // The operator of generating the operand.
-        Ref<OperatorBase> mOperator;
+        OperatorBase* mOperator;
         // The operand type.
         wgpu::OperandType mType;
         // The operand dimensions
-        std::vector<int32_t> mShape;
+        OperandShape mShape;
     };
 }  // namespace dawn::native
 
@@ -0,0 +1,65 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_OPERAND_ARRAY_H_
+#define WEBNN_NATIVE_OPERAND_ARRAY_H_
+
+#include <vector>
+
+#include "dawn/native/GraphBuilder.h"
+#include "dawn/native/ObjectBase.h"
+#include "dawn/native/Operand.h"
+
+namespace dawn::native {
+
+    // The outputs of the operators that produce several operands, e.g. split and gru.
+    class OperandArrayBase : public ObjectBase {
+      public:
+        OperandArrayBase(GraphBuilderBase* graphBuilder, std::vector<OperandBase*> operands)
+            : ObjectBase(graphBuilder->GetDevice()),
+              mArena(graphBuilder->GetArena()),
+              mOperands(std::move(operands)) {
+        }
+        virtual ~OperandArrayBase() = default;
+
+        static OperandArrayBase* MakeError(GraphBuilderBase* graphBuilder) {
+            return new OperandArrayBase(graphBuilder, ObjectBase::kError);
+        }
+
+        // WebNN API
+        size_t APISize() const {
+            return mOperands.size();
+        }
+        // Returns a new reference to the operand at |index|, nullptr when out of range.
+        OperandBase* APIGetOperand(uint32_t index) const {
+            if (index >= mOperands.size()) {
+                return nullptr;
+            }
+            mOperands[index]->Reference();
+            return mOperands[index];
+        }
+
+      private:
+        OperandArrayBase(GraphBuilderBase* graphBuilder, ObjectBase::ErrorTag tag)
+            : ObjectBase(graphBuilder->GetDevice(), tag) {
+        }
+
+        // The operands are owned by the arena.
+        Ref<GraphArena> mArena;
+        std::vector<OperandBase*> mOperands;
+    };
+
+}  // namespace dawn::native
+
+#endif  // WEBNN_NATIVE_OPERAND_ARRAY_H_
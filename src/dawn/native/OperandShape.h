@@ -0,0 +1,116 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_OPERAND_SHAPE_H_
+#define WEBNN_NATIVE_OPERAND_SHAPE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dawn::native {
+
+    // The dimensions of an operand. The shapes of up to kInlineRank dimensions, which are
+    // nearly all of them, are stored inline so that the operands don't allocate them on the
+    // heap. It converts to a std::vector for the code that transforms the shape.
+    class OperandShape {
+      public:
+        static constexpr size_t kInlineRank = 6;
+
+        OperandShape() = default;
+        OperandShape(const int32_t* dimensions, size_t rank) {
+            Assign(dimensions, rank);
+        }
+        OperandShape(const std::vector<int32_t>& shape)
+            : OperandShape(shape.data(), shape.size()) {
+        }
+        OperandShape(const OperandShape& other) : OperandShape(other.data(), other.size()) {
+        }
+        OperandShape& operator=(const OperandShape& other) {
+            if (this != &other) {
+                Assign(other.data(), other.size());
+            }
+            return *this;
+        }
+
+        operator std::vector<int32_t>() const {
+            return std::vector<int32_t>(begin(), end());
+        }
+
+        size_t size() const {
+            return mRank;
+        }
+        bool empty() const {
+            return mRank == 0;
+        }
+        const int32_t* data() const {
+            return mRank <= kInlineRank ? mInline : mOutOfLine.get();
+        }
+        const int32_t* begin() const {
+            return data();
+        }
+        const int32_t* end() const {
+            return data() + mRank;
+        }
+        int32_t operator[](size_t i) const {
+            return data()[i];
+        }
+        int32_t back() const {
+            return data()[mRank - 1];
+        }
+
+        friend bool operator==(const OperandShape& a, const OperandShape& b) {
+            return std::equal(a.begin(), a.end(), b.begin(), b.end());
+        }
+        friend bool operator!=(const OperandShape& a, const OperandShape& b) {
+            return !(a == b);
+        }
+        friend bool operator==(const OperandShape& a, const std::vector<int32_t>& b) {
+            return std::equal(a.begin(), a.end(), b.begin(), b.end());
+        }
+        friend bool operator!=(const OperandShape& a, const std::vector<int32_t>& b) {
+            return !(a == b);
+        }
+        friend bool operator==(const std::vector<int32_t>& a, const OperandShape& b) {
+            return b == a;
+        }
+        friend bool operator!=(const std::vector<int32_t>& a, const OperandShape& b) {
+            return !(b == a);
+        }
+
+      private:
+        void Assign(const int32_t* dimensions, size_t rank) {
+            int32_t* storage = mInline;
+            if (rank > kInlineRank) {
+                if (rank > mOutOfLineCapacity) {
+                    mOutOfLine.reset(new int32_t[rank]);
+                    mOutOfLineCapacity = rank;
+                }
+                storage = mOutOfLine.get();
+            }
+            std::copy(dimensions, dimensions + rank, storage);
+            mRank = rank;
+        }
+
+        size_t mRank = 0;
+        int32_t mInline[kInlineRank];
+        std::unique_ptr<int32_t[]> mOutOfLine;
+        size_t mOutOfLineCapacity = 0;
+    };
+
+}  // namespace dawn::native
+
+#endif  // WEBNN_NATIVE_OPERAND_SHAPE_H_
@@ -19,36 +19,67 @@
 #include "dawn/native/GraphBuilder.h"
 
 namespace dawn::native {
+
+    namespace {
+        // The sizes given to the dynamic dimensions of the inputs to infer the outputs of an
+        // operator. They have many divisors so that most operators accept them, and are far
+        // enough apart that the strided dimensions computed from them differ.
+        constexpr int32_t kDynamicDimensionSamples[] = {60, 120};
+    }  // anonymous namespace
+
     OperatorBase::OperatorBase(GraphBuilderBase* graphBuilder,
-                               std::vector<Ref<OperandBase>> inputs,
+                               std::vector<OperandBase*> inputs,
                                size_t outputSize)
-        : ObjectBase(graphBuilder->GetDevice()), mInputs(std::move(inputs)) {
+        : ObjectBase(graphBuilder->GetDevice()),
+          mArena(graphBuilder->GetArena()),
+          mInputs(std::move(inputs)) {
+        mArena->Adopt(this);
         mOutputs.reserve(outputSize);
         for (size_t i = 0; i < outputSize; ++i) {
-            mOutputs.push_back(new OperandBase(graphBuilder, this));
+            mOutputs.push_back(new (graphBuilder) OperandBase(graphBuilder, this));
         }
     }
 
     OperatorBase::OperatorBase(GraphBuilderBase* graphBuilder, ObjectBase::ErrorTag tag)
-        : ObjectBase(graphBuilder->GetDevice(), tag) {
+        : ObjectBase(graphBuilder->GetDevice(), tag), mArena(graphBuilder->GetArena()) {
+        mArena->Adopt(this);
     }
 
-    const std::vector<Ref<OperandBase>>& OperatorBase::Inputs() const {
+    const std::vector<OperandBase*>& OperatorBase::Inputs() const {
         return mInputs;
     }
 
-    const std::vector<Ref<OperandBase>>& OperatorBase::Outputs() const {
+    const std::vector<OperandBase*>& OperatorBase::Outputs() const {
         return mOutputs;
     }
 
     OperandBase* OperatorBase::PrimaryOutput() const {
-        return mOutputs[0].Get();
+        return mOutputs[0];
     }
 
     MaybeError OperatorBase::AddToGraph(GraphBase* graph) const {
         DAWN_UNREACHABLE();
     }
 
+    OperatorType OperatorBase::GetOperatorType() const {
+        DAWN_UNREACHABLE();
+    }
+
+    void OperatorBase::TakeOutputs(const OperatorBase* replaced) {
+        DAWN_ASSERT(mOutputs.size() == replaced->mOutputs.size());
+        mOutputs = replaced->mOutputs;
+        for (auto& output : mOutputs) {
+            output->SetOperator(this);
+        }
+    }
+
+    void OperatorBase::ReplaceInput(size_t index, OperandBase* operand) {
+        DAWN_ASSERT(index < mInputs.size());
+        DAWN_ASSERT(operand->Type() == mInputs[index]->Type());
+        DAWN_ASSERT(operand->Shape() == mInputs[index]->Shape());
+        mInputs[index] = operand;
+    }
+
     MaybeError OperatorBase::ValidateAndInferOutputInfo() {
         for (auto& input : mInputs) {
             if (input->IsError()) {
@@ -63,9 +94,89 @@ namespace dawn::native {
         return {};
     }
 
+    MaybeError OperatorBase::InferOutputInfo() {
+        std::vector<std::pair<OperandBase*, std::vector<int32_t>>> dynamicInputs;
+        for (auto& input : mInputs) {
+            if (!input->IsError() && HasDynamicDimensions(input->Shape())) {
+                dynamicInputs.push_back({input, input->Shape()});
+            }
+        }
+        if (dynamicInputs.empty()) {
+            return ValidateAndInferOutputInfo();
+        }
+        MaybeError maybeError = InferSampledOutputInfo(dynamicInputs);
+        for (auto& dynamicInput : dynamicInputs) {
+            dynamicInput.first->SetShape(std::move(dynamicInput.second));
+        }
+        return maybeError;
+    }
+
+    MaybeError OperatorBase::InferSampledOutputInfo(
+        const std::vector<std::pair<OperandBase*, std::vector<int32_t>>>& dynamicInputs) {
+        std::vector<std::vector<int32_t>> outputShapes;
+        for (int32_t sample : kDynamicDimensionSamples) {
+            for (auto& dynamicInput : dynamicInputs) {
+                std::vector<int32_t> shape = dynamicInput.second;
+                for (int32_t& dimension : shape) {
+                    if (dimension == kDynamicDimension) {
+                        dimension = sample;
+                    }
+                }
+                dynamicInput.first->SetShape(std::move(shape));
+            }
+            DAWN_TRY(ValidateAndInferOutputInfo());
+
+            if (outputShapes.empty()) {
+                for (auto& output : mOutputs) {
+                    outputShapes.push_back(output->Shape());
+                }
+                continue;
+            }
+            for (size_t i = 0; i < mOutputs.size(); ++i) {
+                const std::vector<int32_t>& shape = mOutputs[i]->Shape();
+                DAWN_INVALID_IF(shape.size() != outputShapes[i].size(),
+                                "The rank of the output depends on the dynamic dimensions.");
+                for (size_t j = 0; j < shape.size(); ++j) {
+                    if (shape[j] != outputShapes[i][j]) {
+                        outputShapes[i][j] = kDynamicDimension;
+                    }
+                }
+            }
+        }
+        for (size_t i = 0; i < mOutputs.size(); ++i) {
+            mOutputs[i]->SetShape(std::move(outputShapes[i]));
+        }
+        return {};
+    }
+
+    void OperatorBase::Reference() {
+        mArena->Reference();
+    }
+
+    void OperatorBase::Release() {
+        mArena->Release();
+    }
+
+    void OperatorBase::DeleteThis() {
+    }
+
+    // static
+    void* OperatorBase::operator new(size_t size, GraphBuilderBase* graphBuilder) {
+        return graphBuilder->GetArena()->Allocate(size);
+    }
+
+    // static
+    void OperatorBase::operator delete(void* ptr) {
+        // The memory is freed with the arena.
+    }
+
+    // static
+    void OperatorBase::operator delete(void* ptr, GraphBuilderBase* graphBuilder) {
+    }
+
     // static
     OperatorBase* OperatorBase::MakeError(GraphBuilderBase* graphBuilder) {
-        return new OperatorBase(graphBuilder, ObjectBase::kError);
+        return new (graphBuilder) OperatorBase(graphBuilder, ObjectBase::kError);
     }
 
 }  // namespace webnn_native
@@ -15,6 +15,9 @@
 #ifndef WEBNN_NATIVE_OPERATOR_H_
 #define WEBNN_NATIVE_OPERATOR_H_
 
+#include <utility>
+#include <vector>
+
 #include "dawn/native/Forward.h"
 #include "dawn/native/ObjectBase.h"
 #include "dawn/native/Error.h"
@@ -22,31 +25,88 @@
 
 namespace dawn::native {
 
+    // Identifies the operator classes for the graph rewrites that match operator patterns.
+    enum class OperatorType {
+        BatchNorm,
+        Binary,
+        Clamp,
+        Concat,
+        Constant,
+        Conv2d,
+        Gemm,
+        Gru,
+        Input,
+        InstanceNorm,
+        Pad,
+        Pool2d,
+        Quantize,
+        Reduce,
+        Resample2d,
+        Reshape,
+        Slice,
+        Split,
+        Squeeze,
+        Transpose,
+        Unary,
+    };
+
     class OperatorBase : public ObjectBase {
       public:
         explicit OperatorBase(GraphBuilderBase* GraphBuilder,
-                              std::vector<Ref<OperandBase>> inputs = {},
+                              std::vector<OperandBase*> inputs = {},
                               size_t outputSize = 1);
         virtual ~OperatorBase() = default;
 
-        const std::vector<Ref<OperandBase>>& Inputs() const;
-        const std::vector<Ref<OperandBase>>& Outputs() const;
+        const std::vector<OperandBase*>& Inputs() const;
+        const std::vector<OperandBase*>& Outputs() const;
         OperandBase* PrimaryOutput() const;
 
         // Add the operand to model for specific backend.
         virtual MaybeError AddToGraph(GraphBase* graph) const;
         virtual MaybeError ValidateAndInferOutputInfo();
+        // ValidateAndInferOutputInfo() for inputs that may have dynamic dimensions. The operator
+        // is validated with the dynamic dimensions set to two sample sizes in turn, and the
+        // output dimensions that differ between the two are dynamic.
+        MaybeError InferOutputInfo();
+        virtual OperatorType GetOperatorType() const;
+
+        // Makes this operator the producer of the outputs of |replaced| in its place, so that
+        // the consumers of those operands read the result of this operator instead. The output
+        // shapes of the two operators must be the same.
+        void TakeOutputs(const OperatorBase* replaced);
+        // Makes this operator read |operand| in place of its input |index|. |operand| must have
+        // the same type and shape and hold the same values.
+        void ReplaceInput(size_t index, OperandBase* operand);
 
         static OperatorBase* MakeError(GraphBuilderBase* graphBuilder);
 
+        // Operators are owned by the arena of their builder, see GraphArena. A reference to an
+        // operator is a reference to the arena.
+        void Reference();
+        void Release();
+        GraphArena* GetArena() const {
+            return mArena;
+        }
+        static void* operator new(size_t size, GraphBuilderBase* graphBuilder);
+        static void operator delete(void* ptr);
+        static void operator delete(void* ptr, GraphBuilderBase* graphBuilder);
+
       private:
         OperatorBase(GraphBuilderBase* graphBuilder, ObjectBase::ErrorTag tag);
 
+        // The arena destroys the operator.
+        void DeleteThis() override;
+
+        GraphArena* mArena;
+
+        MaybeError InferSampledOutputInfo(
+            const std::vector<std::pair<OperandBase*, std::vector<int32_t>>>& dynamicInputs);
+
       protected:
         // The input operands of operator.
-        std::vector<Ref<OperandBase>> mInputs;
+        std::vector<OperandBase*> mInputs;
         // The output operands of operator.
-        std::vector<Ref<OperandBase>> mOutputs;
+        std::vector<OperandBase*> mOutputs;
     };
 
 }  // namespace dawn::native
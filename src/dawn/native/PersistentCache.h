@@ -35,7 +35,7 @@ namespace dawn::native {
 
     class DeviceBase;
 
-    enum class PersistentKeyType { Shader };
+    enum class PersistentKeyType { Shader, Graph };
 
     // This class should always be thread-safe as it is used in Create*PipelineAsync() where it is
     // called asynchronously.
@@ -45,6 +45,11 @@ namespace dawn::native {
       public:
         PersistentCache(DeviceBase* device);
 
+        // Whether the platform provides a cache, so that the keys are worth computing.
+        bool IsEnabled() const {
+            return mCache != nullptr;
+        }
+
         // Combines load/store operations into a single call.
         // If the load was successful, a non-empty blob is returned to the caller.
         // Else, the creation callback |createFn| gets invoked with a callback
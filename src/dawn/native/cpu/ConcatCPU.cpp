@@ -0,0 +1,60 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/ConcatCPU.h"
+
+#include <cstring>
+
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    ConcatKernel::ConcatKernel(std::vector<uint32_t> inputs,
+                               uint32_t output,
+                               size_t elementSize,
+                               const std::vector<std::vector<int32_t>>& inputShapes,
+                               uint32_t axis)
+        : Kernel(std::move(inputs), {output}) {
+        const std::vector<int32_t>& shape = inputShapes[0];
+        for (uint32_t i = 0; i < axis; ++i) {
+            mOuterSize *= shape[i];
+        }
+        for (const std::vector<int32_t>& inputShape : inputShapes) {
+            size_t sliceSize = elementSize;
+            for (size_t i = axis; i < inputShape.size(); ++i) {
+                sliceSize *= inputShape[i];
+            }
+            mInputSliceSizes.push_back(sliceSize);
+            mOutputSliceSize += sliceSize;
+        }
+    }
+
+    void ConcatKernel::Compute(const ExecutionContext& context) const {
+        uint8_t* output = context.GetData<uint8_t>(mOutputs[0]);
+        context.GetThreadPool()->ParallelFor(mOuterSize, [&](size_t begin, size_t end) {
+            for (size_t outer = begin; outer < end; ++outer) {
+                uint8_t* y = output + outer * mOutputSliceSize;
+                for (size_t i = 0; i < mInputs.size(); ++i) {
+                    const uint8_t* x =
+                        context.GetData<uint8_t>(mInputs[i]) + outer * mInputSliceSizes[i];
+                    if (x != y) {
+                        memcpy(y, x, mInputSliceSizes[i]);
+                    }
+                    y += mInputSliceSizes[i];
+                }
+            }
+        });
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,46 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_CONCAT_CPU_H_
+#define WEBNN_NATIVE_CPU_CONCAT_CPU_H_
+
+#include "dawn/native/cpu/KernelCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    // Concatenates tensors of any operand type along |axis|. The inputs that MemoryPlan placed
+    // at their slices of the output are not copied.
+    class ConcatKernel final : public Kernel {
+      public:
+        ConcatKernel(std::vector<uint32_t> inputs,
+                     uint32_t output,
+                     size_t elementSize,
+                     const std::vector<std::vector<int32_t>>& inputShapes,
+                     uint32_t axis);
+
+        const char* GetName() const override {
+            return "Concat";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        size_t mOuterSize = 1;
+        // The bytes that every input contributes to one outer slice of the output.
+        std::vector<size_t> mInputSliceSizes;
+        size_t mOutputSliceSize = 0;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_CONCAT_CPU_H_
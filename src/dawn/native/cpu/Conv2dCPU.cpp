@@ -0,0 +1,921 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/Conv2dCPU.h"
+
+#include <algorithm>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+#include "dawn/native/ops/Conv2d.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The number of output channels computed together by the direct algorithm.
+        constexpr int32_t kDirectBlock = 8;
+        // The number of tiles transformed together by the Winograd algorithm, the rows of its
+        // matrix multiplications.
+        constexpr size_t kWinogradTileBlock = 32;
+        // The minimum number of elements handed to a thread by the elementwise passes.
+        constexpr size_t kElementwiseGrainSize = 16384;
+
+        // The 1-D transforms of F(m, 3) from x to y. The input and output tiles have
+        // alpha = m + 2 values and the filter 3.
+        void TransformFilter2x2(const float* x, size_t xStride, float* y, size_t yStride) {
+            float g0 = x[0], g1 = x[xStride], g2 = x[2 * xStride];
+            y[0] = g0;
+            y[yStride] = 0.5f * (g0 + g1 + g2);
+            y[2 * yStride] = 0.5f * (g0 - g1 + g2);
+            y[3 * yStride] = g2;
+        }
+        void TransformInput2x2(const float* x, size_t xStride, float* y, size_t yStride) {
+            float d0 = x[0], d1 = x[xStride], d2 = x[2 * xStride], d3 = x[3 * xStride];
+            y[0] = d0 - d2;
+            y[yStride] = d1 + d2;
+            y[2 * yStride] = d2 - d1;
+            y[3 * yStride] = d1 - d3;
+        }
+        void TransformOutput2x2(const float* x, size_t xStride, float* y, size_t yStride) {
+            float m0 = x[0], m1 = x[xStride], m2 = x[2 * xStride], m3 = x[3 * xStride];
+            y[0] = m0 + m1 + m2;
+            y[yStride] = m1 - m2 - m3;
+        }
+        void TransformFilter4x4(const float* x, size_t xStride, float* y, size_t yStride) {
+            float g0 = x[0], g1 = x[xStride], g2 = x[2 * xStride];
+            y[0] = g0 / 4;
+            y[yStride] = -(g0 + g1 + g2) / 6;
+            y[2 * yStride] = -(g0 - g1 + g2) / 6;
+            y[3 * yStride] = g0 / 24 + g1 / 12 + g2 / 6;
+            y[4 * yStride] = g0 / 24 - g1 / 12 + g2 / 6;
+            y[5 * yStride] = g2;
+        }
+        void TransformInput4x4(const float* x, size_t xStride, float* y, size_t yStride) {
+            float d0 = x[0], d1 = x[xStride], d2 = x[2 * xStride], d3 = x[3 * xStride],
+                  d4 = x[4 * xStride], d5 = x[5 * xStride];
+            y[0] = 4 * d0 - 5 * d2 + d4;
+            y[yStride] = d3 + d4 - 4 * (d1 + d2);
+            y[2 * yStride] = d4 - d3 + 4 * (d1 - d2);
+            y[3 * yStride] = d4 - d2 + 2 * (d3 - d1);
+            y[4 * yStride] = d4 - d2 + 2 * (d1 - d3);
+            y[5 * yStride] = 4 * d1 - 5 * d3 + d5;
+        }
+        void TransformOutput4x4(const float* x, size_t xStride, float* y, size_t yStride) {
+            float m0 = x[0], m1 = x[xStride], m2 = x[2 * xStride], m3 = x[3 * xStride],
+                  m4 = x[4 * xStride], m5 = x[5 * xStride];
+            y[0] = m0 + m1 + m2 + m3 + m4;
+            y[yStride] = m1 - m2 + 2 * (m3 - m4);
+            y[2 * yStride] = m1 + m2 + 4 * (m3 + m4);
+            y[3 * yStride] = m1 - m2 + 8 * (m3 - m4) + m5;
+        }
+
+        using Transform1d = void (*)(const float* x, size_t xStride, float* y, size_t yStride);
+
+        // y[kOut, kOut] = T * x[kIn, kIn] * transpose(T) for the 1-D transform T, applied to the
+        // columns and then to the rows.
+        template <int32_t kIn, int32_t kOut, Transform1d kTransform>
+        void TransformTile(const float* x, float* y) {
+            float temp[kOut * kIn];
+            for (int32_t j = 0; j < kIn; ++j) {
+                kTransform(x + j, kIn, temp + j, kIn);
+            }
+            for (int32_t i = 0; i < kOut; ++i) {
+                kTransform(temp + i * kIn, 1, y + i * kOut, 1);
+            }
+        }
+
+        // The transforms of F(m x m, 3 x 3) for the tiles of alpha x alpha = (m + 2) x (m + 2)
+        // input values: Y = At * [(G * g * Gt) . (Bt * d * B)] * A.
+        struct WinogradTransform {
+            int32_t m;
+            int32_t alpha;
+            // G * g * Gt, Bt * d * B and At * y * A.
+            void (*transformFilter)(const float* g, float* u);
+            void (*transformInput)(const float* d, float* v);
+            void (*transformOutput)(const float* y, float* result);
+        };
+
+        const WinogradTransform& GetWinogradTransform(Conv2dAlgorithm algorithm) {
+            static const WinogradTransform k2x2 = {2, 4, TransformTile<3, 4, TransformFilter2x2>,
+                                                   TransformTile<4, 4, TransformInput2x2>,
+                                                   TransformTile<4, 2, TransformOutput2x2>};
+            static const WinogradTransform k4x4 = {4, 6, TransformTile<3, 6, TransformFilter4x4>,
+                                                   TransformTile<6, 6, TransformInput4x4>,
+                                                   TransformTile<6, 4, TransformOutput4x4>};
+            DAWN_ASSERT(algorithm == Conv2dAlgorithm::Winograd2x2 ||
+                        algorithm == Conv2dAlgorithm::Winograd4x4);
+            return algorithm == Conv2dAlgorithm::Winograd2x2 ? k2x2 : k4x4;
+        }
+
+        // The output positions [*begin, *end) that read the input position
+        // o * stride - padding + offset inside of [0, inputSize).
+        void GetValidRange(int32_t outputSize,
+                           int32_t inputSize,
+                           int32_t stride,
+                           int32_t padding,
+                           int32_t offset,
+                           int32_t* begin,
+                           int32_t* end) {
+            int32_t low = padding - offset;
+            int32_t high = inputSize - 1 + padding - offset;
+            *end = high < 0 ? 0 : std::min(outputSize, high / stride + 1);
+            *begin = std::min(low <= 0 ? 0 : (low + stride - 1) / stride, *end);
+        }
+
+        // A buffer of the calling thread reused across the calls. |slot| tells apart the
+        // buffers used at the same time.
+        float* GetThreadBuffer(size_t slot, size_t size) {
+            thread_local std::vector<float> buffers[2];
+            if (buffers[slot].size() < size) {
+                buffers[slot].resize(size);
+            }
+            return buffers[slot].data();
+        }
+    }  // anonymous namespace
+
+    Conv2dParams GetConv2dParams(const std::vector<int32_t>& inputShape,
+                                 const std::vector<int32_t>& filterShape,
+                                 const std::vector<int32_t>& outputShape,
+                                 const Conv2dOptions* options,
+                                 size_t filterStrides[4]) {
+        Conv2dParams params;
+        bool nchw = options->inputLayout != wgpu::InputOperandLayout::Nhwc;
+        std::vector<size_t> inputStrides = GetStrides(inputShape);
+        std::vector<size_t> outputStrides = GetStrides(outputShape);
+        // Index the N, C, H, W dimensions in the layout order.
+        const size_t layout[4] = {0, nchw ? 1u : 3u, nchw ? 2u : 1u, nchw ? 3u : 2u};
+        for (size_t i = 0; i < 4; ++i) {
+            params.inputStrides[i] = inputStrides[layout[i]];
+            params.outputStrides[i] = outputStrides[layout[i]];
+        }
+        params.batches = inputShape[0];
+        params.inputChannels = inputShape[layout[1]];
+        params.inputHeight = inputShape[layout[2]];
+        params.inputWidth = inputShape[layout[3]];
+        params.outputChannels = outputShape[layout[1]];
+        params.outputHeight = outputShape[layout[2]];
+        params.outputWidth = outputShape[layout[3]];
+
+        std::vector<size_t> filterShapeStrides = GetStrides(filterShape);
+        size_t filterLayout[4];
+        switch (options->filterLayout) {
+            case wgpu::FilterOperandLayout::Oihw:
+                filterLayout[0] = 0, filterLayout[1] = 1, filterLayout[2] = 2, filterLayout[3] = 3;
+                break;
+            case wgpu::FilterOperandLayout::Hwio:
+                filterLayout[0] = 3, filterLayout[1] = 2, filterLayout[2] = 0, filterLayout[3] = 1;
+                break;
+            case wgpu::FilterOperandLayout::Ohwi:
+                filterLayout[0] = 0, filterLayout[1] = 3, filterLayout[2] = 1, filterLayout[3] = 2;
+                break;
+            case wgpu::FilterOperandLayout::Ihwo:
+                filterLayout[0] = 3, filterLayout[1] = 0, filterLayout[2] = 1, filterLayout[3] = 2;
+                break;
+            default:
+                DAWN_UNREACHABLE();
+        }
+        for (size_t i = 0; i < 4; ++i) {
+            filterStrides[i] = filterShapeStrides[filterLayout[i]];
+        }
+        params.filterHeight = filterShape[filterLayout[2]];
+        params.filterWidth = filterShape[filterLayout[3]];
+
+        params.groups = options->groups;
+        params.strideHeight = options->strides[0];
+        params.strideWidth = options->strides[1];
+        params.dilationHeight = options->dilations[0];
+        params.dilationWidth = options->dilations[1];
+        params.paddingTop = options->padding[0];
+        params.paddingLeft = options->padding[2];
+        if (options->autoPad != wgpu::AutoPad::Explicit) {
+            int32_t paddingBottom, paddingRight;
+            op::ComputeImplicitPaddingForAutoPad(options->autoPad, params.dilationHeight,
+                                                 params.inputHeight, params.filterHeight,
+                                                 params.strideHeight, params.paddingTop,
+                                                 paddingBottom);
+            op::ComputeImplicitPaddingForAutoPad(options->autoPad, params.dilationWidth,
+                                                 params.inputWidth, params.filterWidth,
+                                                 params.strideWidth, params.paddingLeft,
+                                                 paddingRight);
+        }
+
+        return params;
+    }
+
+    const char* Conv2dAlgorithmToString(Conv2dAlgorithm algorithm) {
+        switch (algorithm) {
+            case Conv2dAlgorithm::Auto:
+                return "Auto";
+            case Conv2dAlgorithm::Direct:
+                return "Direct";
+            case Conv2dAlgorithm::Depthwise:
+                return "Depthwise";
+            case Conv2dAlgorithm::Im2col:
+                return "Im2col";
+            case Conv2dAlgorithm::Winograd2x2:
+                return "Winograd2x2";
+            case Conv2dAlgorithm::Winograd4x4:
+                return "Winograd4x4";
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+    bool IsConv2dAlgorithmSupported(Conv2dAlgorithm algorithm, const Conv2dParams& params) {
+        switch (algorithm) {
+            case Conv2dAlgorithm::Direct:
+            case Conv2dAlgorithm::Im2col:
+                return true;
+            case Conv2dAlgorithm::Depthwise:
+                return params.groups == params.inputChannels;
+            case Conv2dAlgorithm::Winograd2x2:
+            case Conv2dAlgorithm::Winograd4x4:
+                return params.groups == 1 && params.filterHeight == 3 && params.filterWidth == 3 &&
+                       params.strideHeight == 1 && params.strideWidth == 1 &&
+                       params.dilationHeight == 1 && params.dilationWidth == 1;
+            default:
+                return false;
+        }
+    }
+
+    Conv2dAlgorithm SelectConv2dAlgorithm(const Conv2dParams& params) {
+        if (IsConv2dAlgorithmSupported(Conv2dAlgorithm::Depthwise, params)) {
+            return Conv2dAlgorithm::Depthwise;
+        }
+        // The transforms pay off once there are a few input channels to sum over, and the
+        // larger tiles waste too much on the borders of the small images.
+        if (IsConv2dAlgorithmSupported(Conv2dAlgorithm::Winograd4x4, params) &&
+            params.inputChannels >= 16) {
+            return params.outputHeight >= 8 && params.outputWidth >= 8
+                       ? Conv2dAlgorithm::Winograd4x4
+                       : Conv2dAlgorithm::Winograd2x2;
+        }
+        // The matrix multiplications are dominated by the packing when they only have a few
+        // columns.
+        if (params.outputChannels / params.groups < kDirectBlock) {
+            return Conv2dAlgorithm::Direct;
+        }
+        return Conv2dAlgorithm::Im2col;
+    }
+
+    uint64_t GetConv2dOperationCount(const Conv2dParams& params) {
+        uint64_t outputCount = static_cast<uint64_t>(params.batches) * params.outputChannels *
+                               params.outputHeight * params.outputWidth;
+        return 2 * outputCount * (params.inputChannels / params.groups) * params.filterHeight *
+               params.filterWidth;
+    }
+
+    Conv2dKernel::Conv2dKernel(uint32_t input,
+                               uint32_t filter,
+                               uint32_t bias,
+                               uint32_t output,
+                               bool hasBias,
+                               const std::vector<int32_t>& inputShape,
+                               const std::vector<int32_t>& filterShape,
+                               const std::vector<int32_t>& outputShape,
+                               const Conv2dOptions* options,
+                               Conv2dAlgorithm algorithm,
+                               bool halfPrecisionFilter)
+        : Kernel(hasBias ? std::vector<uint32_t>{input, filter, bias}
+                         : std::vector<uint32_t>{input, filter},
+                 {output}),
+          mHasBias(hasBias),
+          mChannelsLast(options->inputLayout == wgpu::InputOperandLayout::Nhwc),
+          mActivation(options->activation),
+          mHalfPrecisionFilter(halfPrecisionFilter) {
+        mParams = GetConv2dParams(inputShape, filterShape, outputShape, options, mFilterStrides);
+        mAlgorithm =
+            algorithm == Conv2dAlgorithm::Auto ? SelectConv2dAlgorithm(mParams) : algorithm;
+        DAWN_ASSERT(IsConv2dAlgorithmSupported(mAlgorithm, mParams));
+    }
+
+    float Conv2dKernel::GetFilterValue(const float* filter,
+                                       int32_t oc,
+                                       int32_t ic,
+                                       int32_t kh,
+                                       int32_t kw) const {
+        return filter[oc * mFilterStrides[0] + ic * mFilterStrides[1] + kh * mFilterStrides[2] +
+                      kw * mFilterStrides[3]];
+    }
+
+    void Conv2dKernel::PrepareFilter(const float* filter,
+                                     PreparedFilter* prepared,
+                                     bool halfPrecision) const {
+        const Conv2dParams& p = mParams;
+        int32_t inputChannelsPerGroup = p.inputChannels / p.groups;
+        int32_t outputChannelsPerGroup = p.outputChannels / p.groups;
+        std::vector<float>& data = prepared->data;
+        switch (mAlgorithm) {
+            case Conv2dAlgorithm::Direct: {
+                // [groups, blocks, I, H, W, kDirectBlock], zero padded.
+                int32_t blocks = (outputChannelsPerGroup + kDirectBlock - 1) / kDirectBlock;
+                data.assign(static_cast<size_t>(p.groups) * blocks * inputChannelsPerGroup *
+                                p.filterHeight * p.filterWidth * kDirectBlock,
+                            0.0f);
+                float* w = data.data();
+                for (int32_t g = 0; g < p.groups; ++g) {
+                    for (int32_t block = 0; block < blocks; ++block) {
+                        for (int32_t ic = 0; ic < inputChannelsPerGroup; ++ic) {
+                            for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                                for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                                    for (int32_t j = 0; j < kDirectBlock; ++j, ++w) {
+                                        int32_t oc = block * kDirectBlock + j;
+                                        if (oc < outputChannelsPerGroup) {
+                                            *w = GetFilterValue(
+                                                filter, g * outputChannelsPerGroup + oc, ic, kh,
+                                                kw);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+            case Conv2dAlgorithm::Depthwise: {
+                // [H, W, O].
+                data.resize(static_cast<size_t>(p.filterHeight) * p.filterWidth *
+                            p.outputChannels);
+                float* w = data.data();
+                for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                    for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                        for (int32_t oc = 0; oc < p.outputChannels; ++oc) {
+                            *w++ = GetFilterValue(filter, oc, 0, kh, kw);
+                        }
+                    }
+                }
+                break;
+            }
+            case Conv2dAlgorithm::Im2col: {
+                size_t depth = static_cast<size_t>(inputChannelsPerGroup) * p.filterHeight *
+                               p.filterWidth;
+                if (!mChannelsLast) {
+                    // The left operand [O, I * H * W] of every group.
+                    data.resize(p.outputChannels * depth);
+                    float* w = data.data();
+                    for (int32_t oc = 0; oc < p.outputChannels; ++oc) {
+                        for (int32_t ic = 0; ic < inputChannelsPerGroup; ++ic) {
+                            for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                                for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                                    *w++ = GetFilterValue(filter, oc, ic, kh, kw);
+                                }
+                            }
+                        }
+                    }
+                    break;
+                }
+                // The right operand [H * W * I, O] of every group, packed for Sgemm.
+                std::vector<float> matrix(depth * outputChannelsPerGroup);
+                prepared->packed.resize(p.groups);
+                for (int32_t g = 0; g < p.groups; ++g) {
+                    float* w = matrix.data();
+                    for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                        for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                            for (int32_t ic = 0; ic < inputChannelsPerGroup; ++ic) {
+                                for (int32_t oc = 0; oc < outputChannelsPerGroup; ++oc) {
+                                    *w++ = GetFilterValue(filter, g * outputChannelsPerGroup + oc,
+                                                          ic, kh, kw);
+                                }
+                            }
+                        }
+                    }
+                    prepared->packed[g].Pack(matrix.data(), outputChannelsPerGroup, 1, depth,
+                                             outputChannelsPerGroup, 1.0f, halfPrecision);
+                }
+                break;
+            }
+            case Conv2dAlgorithm::Winograd2x2:
+            case Conv2dAlgorithm::Winograd4x4: {
+                // G * g * Gt of every pair of channels, then one packed [I, O] matrix for each of
+                // the alpha x alpha points of the transformed tiles.
+                const WinogradTransform& transform = GetWinogradTransform(mAlgorithm);
+                size_t points = transform.alpha * transform.alpha;
+                size_t matrixSize = static_cast<size_t>(p.inputChannels) * p.outputChannels;
+                std::vector<float> matrices(points * matrixSize);
+                for (int32_t ic = 0; ic < p.inputChannels; ++ic) {
+                    for (int32_t oc = 0; oc < p.outputChannels; ++oc) {
+                        float g[3 * 3], u[6 * 6];
+                        for (int32_t kh = 0; kh < 3; ++kh) {
+                            for (int32_t kw = 0; kw < 3; ++kw) {
+                                g[kh * 3 + kw] = GetFilterValue(filter, oc, ic, kh, kw);
+                            }
+                        }
+                        transform.transformFilter(g, u);
+                        for (size_t point = 0; point < points; ++point) {
+                            matrices[point * matrixSize + ic * p.outputChannels + oc] = u[point];
+                        }
+                    }
+                }
+                prepared->packed.resize(points);
+                for (size_t point = 0; point < points; ++point) {
+                    prepared->packed[point].Pack(matrices.data() + point * matrixSize,
+                                                 p.outputChannels, 1, p.inputChannels,
+                                                 p.outputChannels, 1.0f, halfPrecision);
+                }
+                break;
+            }
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+    void Conv2dKernel::Prepare(const ExecutionContext& constants) {
+        const float* filter = constants.GetData<float>(mInputs[1]);
+        if (filter != nullptr) {
+            PrepareFilter(filter, &mPreparedFilter, mHalfPrecisionFilter);
+            mIsFilterPrepared = true;
+        }
+    }
+
+    void Conv2dKernel::SerializePrepared(PreparedDataWriter* writer) const {
+        writer->Write<uint32_t>(mIsFilterPrepared ? 1 : 0);
+        if (!mIsFilterPrepared) {
+            return;
+        }
+        writer->WriteFloats(mPreparedFilter.data);
+        writer->Write<uint64_t>(mPreparedFilter.packed.size());
+        for (const PackedMatrix& matrix : mPreparedFilter.packed) {
+            writer->WritePackedMatrix(matrix);
+        }
+    }
+
+    bool Conv2dKernel::DeserializePrepared(PreparedDataReader* reader) {
+        uint32_t isFilterPrepared;
+        if (!reader->Read(&isFilterPrepared)) {
+            return false;
+        }
+        if (isFilterPrepared == 0) {
+            return true;
+        }
+        PreparedFilter prepared;
+        uint64_t packedCount;
+        if (!reader->ReadFloats(&prepared.data) || !reader->Read(&packedCount)) {
+            return false;
+        }
+        for (uint64_t i = 0; i < packedCount; ++i) {
+            PackedMatrix matrix;
+            if (!reader->ReadPackedMatrix(&matrix)) {
+                return false;
+            }
+            prepared.packed.push_back(std::move(matrix));
+        }
+        mPreparedFilter = std::move(prepared);
+        mIsFilterPrepared = true;
+        return true;
+    }
+
+    void Conv2dKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        const float* bias = mHasBias ? context.GetData<float>(mInputs[2]) : nullptr;
+        float* output = context.GetData<float>(mOutputs[0]);
+        ThreadPool* threadPool = context.GetThreadPool();
+
+        PreparedFilter preparedFilter;
+        const PreparedFilter* filter = &mPreparedFilter;
+        if (!mIsFilterPrepared) {
+            PrepareFilter(context.GetData<float>(mInputs[1]), &preparedFilter, false);
+            filter = &preparedFilter;
+        }
+
+        switch (mAlgorithm) {
+            case Conv2dAlgorithm::Direct:
+                ComputeDirect(threadPool, input, *filter, bias, output);
+                break;
+            case Conv2dAlgorithm::Depthwise:
+                ComputeDepthwise(threadPool, input, *filter, bias, output);
+                break;
+            case Conv2dAlgorithm::Im2col:
+                ComputeIm2col(threadPool, input, *filter, bias, output);
+                break;
+            case Conv2dAlgorithm::Winograd2x2:
+            case Conv2dAlgorithm::Winograd4x4:
+                ComputeWinograd(threadPool, input, *filter, bias, output);
+                break;
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+    void Conv2dKernel::InitializeOutput(ThreadPool* threadPool,
+                                        const float* bias,
+                                        float* output) const {
+        const Conv2dParams& p = mParams;
+        threadPool->ParallelFor(
+            static_cast<size_t>(p.batches) * p.outputHeight, [&](size_t begin, size_t end) {
+                for (size_t row = begin; row < end; ++row) {
+                    float* y = output + (row / p.outputHeight) * p.outputStrides[0] +
+                               (row % p.outputHeight) * p.outputStrides[2];
+                    for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                        for (int32_t oc = 0; oc < p.outputChannels; ++oc) {
+                            y[ow * p.outputStrides[3] + oc * p.outputStrides[1]] =
+                                bias != nullptr ? bias[oc] : 0.0f;
+                        }
+                    }
+                }
+            });
+    }
+
+    void Conv2dKernel::ApplyActivation(ThreadPool* threadPool, float* output) const {
+        if (!mActivation.IsEnabled()) {
+            return;
+        }
+        threadPool->ParallelFor(
+            mParams.batches * mParams.outputStrides[0],
+            [&](size_t begin, size_t end) { mActivation.Apply(output + begin, end - begin); },
+            kElementwiseGrainSize);
+    }
+
+    void Conv2dKernel::ComputeDirect(ThreadPool* threadPool,
+                                     const float* input,
+                                     const PreparedFilter& filter,
+                                     const float* bias,
+                                     float* output) const {
+        const Conv2dParams& p = mParams;
+        int32_t inputChannelsPerGroup = p.inputChannels / p.groups;
+        int32_t outputChannelsPerGroup = p.outputChannels / p.groups;
+        int32_t blocks = (outputChannelsPerGroup + kDirectBlock - 1) / kDirectBlock;
+        size_t blockSize = static_cast<size_t>(inputChannelsPerGroup) * p.filterHeight *
+                           p.filterWidth * kDirectBlock;
+        // One task computes kDirectBlock channels of an output row.
+        threadPool->ParallelFor(
+            static_cast<size_t>(p.batches) * p.groups * blocks * p.outputHeight,
+            [&](size_t begin, size_t end) {
+                float* sums = GetThreadBuffer(0, p.outputWidth * kDirectBlock);
+                for (size_t task = begin; task < end; ++task) {
+                    int32_t oh = task % p.outputHeight;
+                    int32_t block = (task / p.outputHeight) % blocks;
+                    int32_t g = (task / p.outputHeight / blocks) % p.groups;
+                    int32_t n = task / p.outputHeight / blocks / p.groups;
+                    int32_t ocBegin = g * outputChannelsPerGroup + block * kDirectBlock;
+                    int32_t ocCount =
+                        std::min(kDirectBlock, outputChannelsPerGroup - block * kDirectBlock);
+                    const float* x = input + n * p.inputStrides[0] +
+                                     g * inputChannelsPerGroup * p.inputStrides[1];
+                    const float* w = filter.data.data() + (g * blocks + block) * blockSize;
+                    // The whole filter window is inside of the input for [owBegin, owEnd).
+                    int32_t owBegin, owEnd, unused;
+                    GetValidRange(p.outputWidth, p.inputWidth, p.strideWidth, p.paddingLeft, 0,
+                                  &owBegin, &unused);
+                    GetValidRange(p.outputWidth, p.inputWidth, p.strideWidth, p.paddingLeft,
+                                  (p.filterWidth - 1) * p.dilationWidth, &unused, &owEnd);
+                    for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                        // The block of output channels is accumulated in registers.
+                        float sum[kDirectBlock];
+                        for (int32_t j = 0; j < kDirectBlock; ++j) {
+                            sum[j] = bias != nullptr && j < ocCount ? bias[ocBegin + j] : 0.0f;
+                        }
+                        bool isInside = ow >= owBegin && ow < owEnd;
+                        int32_t iw0 = ow * p.strideWidth - p.paddingLeft;
+                        for (int32_t ic = 0; ic < inputChannelsPerGroup; ++ic) {
+                            for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                                int32_t ih =
+                                    oh * p.strideHeight - p.paddingTop + kh * p.dilationHeight;
+                                if (ih < 0 || ih >= p.inputHeight) {
+                                    continue;
+                                }
+                                const float* xRow =
+                                    x + ic * p.inputStrides[1] + ih * p.inputStrides[2];
+                                const float* wk =
+                                    w + (ic * p.filterHeight + kh) * p.filterWidth * kDirectBlock;
+                                for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                                    int32_t iw = iw0 + kw * p.dilationWidth;
+                                    if (!isInside && (iw < 0 || iw >= p.inputWidth)) {
+                                        continue;
+                                    }
+                                    float value = xRow[iw * p.inputStrides[3]];
+                                    for (int32_t j = 0; j < kDirectBlock; ++j) {
+                                        sum[j] += value * wk[kw * kDirectBlock + j];
+                                    }
+                                }
+                            }
+                        }
+                        std::copy(sum, sum + kDirectBlock, sums + ow * kDirectBlock);
+                    }
+
+                    mActivation.Apply(sums, p.outputWidth * kDirectBlock);
+                    float* y = output + n * p.outputStrides[0] + oh * p.outputStrides[2];
+                    for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                        for (int32_t j = 0; j < ocCount; ++j) {
+                            y[(ocBegin + j) * p.outputStrides[1] + ow * p.outputStrides[3]] =
+                                sums[ow * kDirectBlock + j];
+                        }
+                    }
+                }
+            });
+    }
+
+    void Conv2dKernel::ComputeDepthwise(ThreadPool* threadPool,
+                                        const float* input,
+                                        const PreparedFilter& filter,
+                                        const float* bias,
+                                        float* output) const {
+        const Conv2dParams& p = mParams;
+        int32_t multiplier = p.outputChannels / p.groups;
+        const float* w = filter.data.data();
+        if (mChannelsLast) {
+            // Accumulate the rows of NHWC output in place, vectorized along the channels.
+            threadPool->ParallelFor(
+                static_cast<size_t>(p.batches) * p.outputHeight, [&](size_t begin, size_t end) {
+                    for (size_t row = begin; row < end; ++row) {
+                        int32_t n = row / p.outputHeight;
+                        int32_t oh = row % p.outputHeight;
+                        float* y = output + n * p.outputStrides[0] + oh * p.outputStrides[2];
+                        for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                            for (int32_t oc = 0; oc < p.outputChannels; ++oc) {
+                                y[ow * p.outputChannels + oc] = bias != nullptr ? bias[oc] : 0.0f;
+                            }
+                        }
+                        for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                            int32_t ih =
+                                oh * p.strideHeight - p.paddingTop + kh * p.dilationHeight;
+                            if (ih < 0 || ih >= p.inputHeight) {
+                                continue;
+                            }
+                            const float* xRow =
+                                input + n * p.inputStrides[0] + ih * p.inputStrides[2];
+                            for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                                int32_t owBegin, owEnd;
+                                GetValidRange(p.outputWidth, p.inputWidth, p.strideWidth,
+                                              p.paddingLeft, kw * p.dilationWidth, &owBegin,
+                                              &owEnd);
+                                const float* wk =
+                                    w + (kh * p.filterWidth + kw) * p.outputChannels;
+                                for (int32_t ow = owBegin; ow < owEnd; ++ow) {
+                                    int32_t iw =
+                                        ow * p.strideWidth - p.paddingLeft + kw * p.dilationWidth;
+                                    const float* xPixel = xRow + iw * p.inputStrides[3];
+                                    float* yPixel = y + ow * p.outputChannels;
+                                    if (multiplier == 1) {
+                                        for (int32_t c = 0; c < p.outputChannels; ++c) {
+                                            yPixel[c] += xPixel[c] * wk[c];
+                                        }
+                                    } else {
+                                        for (int32_t oc = 0; oc < p.outputChannels; ++oc) {
+                                            yPixel[oc] += xPixel[oc / multiplier] * wk[oc];
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                        mActivation.Apply(y, p.outputWidth * p.outputChannels);
+                    }
+                });
+            return;
+        }
+
+        // One task computes a plane of NCHW output, vectorized along the rows.
+        threadPool->ParallelFor(
+            static_cast<size_t>(p.batches) * p.outputChannels, [&](size_t begin, size_t end) {
+                float* sums = GetThreadBuffer(0, p.outputWidth);
+                for (size_t plane = begin; plane < end; ++plane) {
+                    int32_t n = plane / p.outputChannels;
+                    int32_t oc = plane % p.outputChannels;
+                    const float* x = input + n * p.inputStrides[0] +
+                                     (oc / multiplier) * p.inputStrides[1];
+                    float* y = output + n * p.outputStrides[0] + oc * p.outputStrides[1];
+                    for (int32_t oh = 0; oh < p.outputHeight; ++oh) {
+                        std::fill(sums, sums + p.outputWidth, bias != nullptr ? bias[oc] : 0.0f);
+                        for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                            int32_t ih =
+                                oh * p.strideHeight - p.paddingTop + kh * p.dilationHeight;
+                            if (ih < 0 || ih >= p.inputHeight) {
+                                continue;
+                            }
+                            const float* xRow = x + ih * p.inputStrides[2];
+                            for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                                int32_t owBegin, owEnd;
+                                GetValidRange(p.outputWidth, p.inputWidth, p.strideWidth,
+                                              p.paddingLeft, kw * p.dilationWidth, &owBegin,
+                                              &owEnd);
+                                float weight = w[(kh * p.filterWidth + kw) * p.outputChannels + oc];
+                                int32_t offset = kw * p.dilationWidth - p.paddingLeft;
+                                if (p.strideWidth == 1) {
+                                    for (int32_t ow = owBegin; ow < owEnd; ++ow) {
+                                        sums[ow] += xRow[ow + offset] * weight;
+                                    }
+                                } else {
+                                    for (int32_t ow = owBegin; ow < owEnd; ++ow) {
+                                        sums[ow] += xRow[ow * p.strideWidth + offset] * weight;
+                                    }
+                                }
+                            }
+                        }
+                        mActivation.Apply(sums, p.outputWidth);
+                        std::copy(sums, sums + p.outputWidth, y + oh * p.outputStrides[2]);
+                    }
+                }
+            });
+    }
+
+    void Conv2dKernel::ComputeIm2col(ThreadPool* threadPool,
+                                     const float* input,
+                                     const PreparedFilter& filter,
+                                     const float* bias,
+                                     float* output) const {
+        const Conv2dParams& p = mParams;
+        int32_t inputChannelsPerGroup = p.inputChannels / p.groups;
+        int32_t outputChannelsPerGroup = p.outputChannels / p.groups;
+        size_t depth =
+            static_cast<size_t>(inputChannelsPerGroup) * p.filterHeight * p.filterWidth;
+        size_t spatialSize = static_cast<size_t>(p.outputHeight) * p.outputWidth;
+        // A 1x1 convolution without strides and padding multiplies the input as it is.
+        bool isPointwise = p.filterHeight == 1 && p.filterWidth == 1 && p.strideHeight == 1 &&
+                           p.strideWidth == 1 && p.paddingTop == 0 && p.paddingLeft == 0 &&
+                           p.outputHeight == p.inputHeight && p.outputWidth == p.inputWidth;
+        std::vector<float> columns(isPointwise ? 0 : depth * spatialSize);
+
+        // The bias is accumulated on by the matrix multiplications.
+        if (bias != nullptr) {
+            InitializeOutput(threadPool, bias, output);
+        }
+        for (int32_t n = 0; n < p.batches; ++n) {
+            for (int32_t g = 0; g < p.groups; ++g) {
+                const float* x = input + n * p.inputStrides[0] +
+                                 g * inputChannelsPerGroup * p.inputStrides[1];
+                float* y = output + n * p.outputStrides[0] +
+                           g * outputChannelsPerGroup * p.outputStrides[1];
+                if (mChannelsLast) {
+                    // y[H * W, O] = columns[H * W, H * W * I] * filter[H * W * I, O].
+                    const float* a = x;
+                    size_t aRowStride = p.inputStrides[3];
+                    if (!isPointwise) {
+                        threadPool->ParallelFor(p.outputHeight, [&](size_t begin, size_t end) {
+                            for (size_t oh = begin; oh < end; ++oh) {
+                                float* column = columns.data() + oh * p.outputWidth * depth;
+                                for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                                    for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                                        int32_t ih = oh * p.strideHeight - p.paddingTop +
+                                                     kh * p.dilationHeight;
+                                        for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                                            int32_t iw = ow * p.strideWidth - p.paddingLeft +
+                                                         kw * p.dilationWidth;
+                                            if (ih < 0 || ih >= p.inputHeight || iw < 0 ||
+                                                iw >= p.inputWidth) {
+                                                std::fill(column, column + inputChannelsPerGroup,
+                                                          0.0f);
+                                            } else {
+                                                const float* pixel = x + ih * p.inputStrides[2] +
+                                                                     iw * p.inputStrides[3];
+                                                std::copy(pixel, pixel + inputChannelsPerGroup,
+                                                          column);
+                                            }
+                                            column += inputChannelsPerGroup;
+                                        }
+                                    }
+                                }
+                            }
+                        });
+                        a = columns.data();
+                        aRowStride = depth;
+                    }
+                    Sgemm(threadPool, spatialSize, a, aRowStride, 1, filter.packed[g], y,
+                          p.outputStrides[3], bias != nullptr);
+                } else {
+                    // y[O, H * W] = filter[O, I * H * W] * columns[I * H * W, H * W].
+                    PackedMatrix packedColumns;
+                    if (isPointwise) {
+                        packedColumns.Pack(x, p.inputStrides[1], 1, depth, spatialSize);
+                    } else {
+                        threadPool->ParallelFor(depth, [&](size_t begin, size_t end) {
+                            for (size_t k = begin; k < end; ++k) {
+                                int32_t kw = k % p.filterWidth;
+                                int32_t kh = (k / p.filterWidth) % p.filterHeight;
+                                int32_t ic = k / p.filterWidth / p.filterHeight;
+                                float* column = columns.data() + k * spatialSize;
+                                int32_t owBegin, owEnd;
+                                GetValidRange(p.outputWidth, p.inputWidth, p.strideWidth,
+                                              p.paddingLeft, kw * p.dilationWidth, &owBegin,
+                                              &owEnd);
+                                for (int32_t oh = 0; oh < p.outputHeight; ++oh) {
+                                    float* row = column + oh * p.outputWidth;
+                                    int32_t ih = oh * p.strideHeight - p.paddingTop +
+                                                 kh * p.dilationHeight;
+                                    if (ih < 0 || ih >= p.inputHeight) {
+                                        std::fill(row, row + p.outputWidth, 0.0f);
+                                        continue;
+                                    }
+                                    const float* xRow =
+                                        x + ic * p.inputStrides[1] + ih * p.inputStrides[2];
+                                    std::fill(row, row + owBegin, 0.0f);
+                                    for (int32_t ow = owBegin; ow < owEnd; ++ow) {
+                                        row[ow] = xRow[ow * p.strideWidth - p.paddingLeft +
+                                                       kw * p.dilationWidth];
+                                    }
+                                    std::fill(row + owEnd, row + p.outputWidth, 0.0f);
+                                }
+                            }
+                        });
+                        packedColumns.Pack(columns.data(), spatialSize, 1, depth, spatialSize);
+                    }
+                    Sgemm(threadPool, outputChannelsPerGroup,
+                          filter.data.data() + g * outputChannelsPerGroup * depth, depth, 1,
+                          packedColumns, y, p.outputStrides[1], bias != nullptr);
+                }
+            }
+        }
+        ApplyActivation(threadPool, output);
+    }
+
+    void Conv2dKernel::ComputeWinograd(ThreadPool* threadPool,
+                                       const float* input,
+                                       const PreparedFilter& filter,
+                                       const float* bias,
+                                       float* output) const {
+        const Conv2dParams& p = mParams;
+        const WinogradTransform& transform = GetWinogradTransform(mAlgorithm);
+        int32_t m = transform.m, alpha = transform.alpha;
+        size_t points = alpha * alpha;
+        int32_t tileRows = (p.outputHeight + m - 1) / m;
+        int32_t tileColumns = (p.outputWidth + m - 1) / m;
+        size_t tileCount = static_cast<size_t>(tileRows) * tileColumns;
+        size_t blocks = (tileCount + kWinogradTileBlock - 1) / kWinogradTileBlock;
+        // The transformed tiles are stored [tiles, points, I] and their products [tiles, points,
+        // O], so that the points of a tile are next to each other and the matrices of a point
+        // are strided by the tile.
+        size_t transformedStride = points * p.inputChannels;
+        size_t productStride = points * p.outputChannels;
+        threadPool->ParallelFor(p.batches * blocks, [&](size_t begin, size_t end) {
+            float* transformed = GetThreadBuffer(0, kWinogradTileBlock * transformedStride);
+            float* products = GetThreadBuffer(1, kWinogradTileBlock * productStride);
+            for (size_t task = begin; task < end; ++task) {
+                int32_t n = task / blocks;
+                size_t tileBegin = (task % blocks) * kWinogradTileBlock;
+                size_t tiles = std::min(kWinogradTileBlock, tileCount - tileBegin);
+                const float* x = input + n * p.inputStrides[0];
+                for (size_t t = 0; t < tiles; ++t) {
+                    int32_t ih0 = ((tileBegin + t) / tileColumns) * m - p.paddingTop;
+                    int32_t iw0 = ((tileBegin + t) % tileColumns) * m - p.paddingLeft;
+                    bool isInside = ih0 >= 0 && ih0 + alpha <= p.inputHeight && iw0 >= 0 &&
+                                    iw0 + alpha <= p.inputWidth;
+                    for (int32_t ic = 0; ic < p.inputChannels; ++ic) {
+                        float d[6 * 6], v[6 * 6];
+                        const float* xc = x + ic * p.inputStrides[1];
+                        for (int32_t i = 0; i < alpha; ++i) {
+                            int32_t ih = ih0 + i;
+                            for (int32_t j = 0; j < alpha; ++j) {
+                                int32_t iw = iw0 + j;
+                                d[i * alpha + j] =
+                                    isInside || (ih >= 0 && ih < p.inputHeight && iw >= 0 &&
+                                                 iw < p.inputWidth)
+                                        ? xc[ih * p.inputStrides[2] + iw * p.inputStrides[3]]
+                                        : 0.0f;
+                            }
+                        }
+                        transform.transformInput(d, v);
+                        float* tile = transformed + t * transformedStride + ic;
+                        for (size_t point = 0; point < points; ++point) {
+                            tile[point * p.inputChannels] = v[point];
+                        }
+                    }
+                }
+
+                GemmTiling tiling(tiles, p.outputChannels, 1);
+                for (size_t point = 0; point < points; ++point) {
+                    for (size_t tile = 0; tile < tiling.GetTileCount(); ++tile) {
+                        tiling.ComputeTile(tile, transformed + point * p.inputChannels,
+                                           transformedStride, 1, filter.packed[point],
+                                           products + point * p.outputChannels, productStride,
+                                           false);
+                    }
+                }
+
+                float* y = output + n * p.outputStrides[0];
+                for (size_t t = 0; t < tiles; ++t) {
+                    int32_t oh0 = ((tileBegin + t) / tileColumns) * m;
+                    int32_t ow0 = ((tileBegin + t) % tileColumns) * m;
+                    int32_t rows = std::min(m, p.outputHeight - oh0);
+                    int32_t columns = std::min(m, p.outputWidth - ow0);
+                    for (int32_t oc = 0; oc < p.outputChannels; ++oc) {
+                        float product[6 * 6], result[4 * 4];
+                        const float* tile = products + t * productStride + oc;
+                        for (size_t point = 0; point < points; ++point) {
+                            product[point] = tile[point * p.outputChannels];
+                        }
+                        transform.transformOutput(product, result);
+                        float b = bias != nullptr ? bias[oc] : 0.0f;
+                        for (int32_t i = 0; i < rows; ++i) {
+                            for (int32_t j = 0; j < columns; ++j) {
+                                y[oc * p.outputStrides[1] + (oh0 + i) * p.outputStrides[2] +
+                                  (ow0 + j) * p.outputStrides[3]] = result[i * m + j] + b;
+                            }
+                        }
+                    }
+                }
+            }
+        });
+        ApplyActivation(threadPool, output);
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,169 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_CONV2D_CPU_H_
+#define WEBNN_NATIVE_CPU_CONV2D_CPU_H_
+
+#include "dawn/native/cpu/KernelCPU.h"
+#include "dawn/native/cpu/SgemmCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    // The dimensions of a 2-D convolution or pooling with the layouts and the implicit padding
+    // resolved.
+    struct Conv2dParams {
+        int32_t batches;
+        int32_t inputChannels;
+        int32_t inputHeight;
+        int32_t inputWidth;
+        int32_t outputChannels;
+        int32_t outputHeight;
+        int32_t outputWidth;
+        int32_t filterHeight;
+        int32_t filterWidth;
+        int32_t groups;
+        int32_t strideHeight;
+        int32_t strideWidth;
+        int32_t dilationHeight;
+        int32_t dilationWidth;
+        int32_t paddingTop;
+        int32_t paddingLeft;
+        // The element strides of the N, C, H and W dimensions of input and output.
+        size_t inputStrides[4];
+        size_t outputStrides[4];
+    };
+
+    // Resolves the layouts and the implicit padding of |options|. |filterStrides| receives the
+    // element strides of the O, I, H and W dimensions of the filter.
+    Conv2dParams GetConv2dParams(const std::vector<int32_t>& inputShape,
+                                 const std::vector<int32_t>& filterShape,
+                                 const std::vector<int32_t>& outputShape,
+                                 const Conv2dOptions* options,
+                                 size_t filterStrides[4]);
+
+    enum class Conv2dAlgorithm {
+        // Chosen by SelectConv2dAlgorithm().
+        Auto,
+        // Blocks of output channels accumulated together over the filter window, with the
+        // filter reordered to [O / block, I, H, W, block] as in the NCHWc layouts.
+        Direct,
+        // One filter per input channel (groups == input channels).
+        Depthwise,
+        // The input patches gathered into a matrix that is multiplied with the filter by Sgemm.
+        Im2col,
+        // Winograd minimal filtering F(2x2, 3x3) and F(4x4, 3x3) for the 3x3 convolutions with
+        // unit strides and dilations, a batch of Sgemm per point of the transformed tiles.
+        Winograd2x2,
+        Winograd4x4,
+    };
+
+    const char* Conv2dAlgorithmToString(Conv2dAlgorithm algorithm);
+    bool IsConv2dAlgorithmSupported(Conv2dAlgorithm algorithm, const Conv2dParams& params);
+    // Picks the fastest supported algorithm for the shape of the convolution.
+    Conv2dAlgorithm SelectConv2dAlgorithm(const Conv2dParams& params);
+    // The multiply-adds of the convolution counted as two operations.
+    uint64_t GetConv2dOperationCount(const Conv2dParams& params);
+
+    class Conv2dKernel final : public Kernel {
+      public:
+        // |bias| is ignored when |hasBias| is false. |algorithm| must be supported for the
+        // convolution unless it is Auto. With |halfPrecisionFilter| a constant filter is stored
+        // as float16 by the algorithms that pack it for Sgemm, see PackedMatrix::Pack().
+        Conv2dKernel(uint32_t input,
+                     uint32_t filter,
+                     uint32_t bias,
+                     uint32_t output,
+                     bool hasBias,
+                     const std::vector<int32_t>& inputShape,
+                     const std::vector<int32_t>& filterShape,
+                     const std::vector<int32_t>& outputShape,
+                     const Conv2dOptions* options,
+                     Conv2dAlgorithm algorithm = Conv2dAlgorithm::Auto,
+                     bool halfPrecisionFilter = false);
+
+        const char* GetName() const override {
+            return "Conv2d";
+        }
+        const char* GetVariant() const override {
+            return Conv2dAlgorithmToString(mAlgorithm);
+        }
+        uint64_t GetOperationCount() const override {
+            return GetConv2dOperationCount(mParams);
+        }
+        Conv2dAlgorithm GetAlgorithm() const {
+            return mAlgorithm;
+        }
+        void Prepare(const ExecutionContext& constants) override;
+        bool IsInputPrepared(size_t index) const override {
+            return index == 1 && mIsFilterPrepared;
+        }
+        void SerializePrepared(PreparedDataWriter* writer) const override;
+        bool DeserializePrepared(PreparedDataReader* reader) override;
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        // The filter reordered for mAlgorithm, by Prepare() when it is a constant.
+        struct PreparedFilter {
+            std::vector<float> data;
+            std::vector<PackedMatrix> packed;
+        };
+
+        float GetFilterValue(const float* filter,
+                             int32_t oc,
+                             int32_t ic,
+                             int32_t kh,
+                             int32_t kw) const;
+        void PrepareFilter(const float* filter,
+                           PreparedFilter* prepared,
+                           bool halfPrecision) const;
+        void InitializeOutput(ThreadPool* threadPool, const float* bias, float* output) const;
+        void ApplyActivation(ThreadPool* threadPool, float* output) const;
+
+        void ComputeDirect(ThreadPool* threadPool,
+                           const float* input,
+                           const PreparedFilter& filter,
+                           const float* bias,
+                           float* output) const;
+        void ComputeDepthwise(ThreadPool* threadPool,
+                              const float* input,
+                              const PreparedFilter& filter,
+                              const float* bias,
+                              float* output) const;
+        void ComputeIm2col(ThreadPool* threadPool,
+                           const float* input,
+                           const PreparedFilter& filter,
+                           const float* bias,
+                           float* output) const;
+        void ComputeWinograd(ThreadPool* threadPool,
+                             const float* input,
+                             const PreparedFilter& filter,
+                             const float* bias,
+                             float* output) const;
+
+        Conv2dParams mParams;
+        bool mHasBias;
+        // Whether the input and the output are NHWC.
+        bool mChannelsLast;
+        // The element strides of the O, I, H and W dimensions of the filter.
+        size_t mFilterStrides[4];
+        FusedActivation mActivation;
+        Conv2dAlgorithm mAlgorithm;
+        bool mHalfPrecisionFilter;
+        PreparedFilter mPreparedFilter;
+        bool mIsFilterPrepared = false;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_CONV2D_CPU_H_
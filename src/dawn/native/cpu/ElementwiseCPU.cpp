@@ -0,0 +1,184 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/ElementwiseCPU.h"
+
+#include <algorithm>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The minimum number of elements handed to a thread.
+        constexpr size_t kElementwiseGrainSize = 16384;
+    }  // anonymous namespace
+
+    UnaryKernel::UnaryKernel(uint32_t input,
+                             uint32_t output,
+                             op::UnaryOpType opType,
+                             std::vector<int32_t> shape,
+                             float alpha)
+        : Kernel({input}, {output}),
+          mOpType(opType),
+          mShape(std::move(shape)),
+          mAlpha(alpha),
+          mFunctions(GetElementwiseFunctions()) {
+    }
+
+    void UnaryKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        float* output = context.GetData<float>(mOutputs[0]);
+        if (mOpType == op::UnaryOpType::kSoftmax) {
+            DAWN_ASSERT(mShape.size() == 2);
+            size_t columns = mShape[1];
+            context.GetThreadPool()->ParallelFor(mShape[0], [&](size_t begin, size_t end) {
+                for (size_t row = begin; row < end; ++row) {
+                    mFunctions.softmax(input + row * columns, output + row * columns, columns);
+                }
+            });
+            return;
+        }
+        context.GetThreadPool()->ParallelFor(
+            GetElementCount(mShape),
+            [&](size_t begin, size_t end) {
+                mFunctions.unary(mOpType, input + begin, output + begin, end - begin, mAlpha);
+            },
+            kElementwiseGrainSize);
+    }
+
+    BinaryKernel::BinaryKernel(uint32_t a,
+                               uint32_t b,
+                               uint32_t output,
+                               op::BinaryOpType opType,
+                               const std::vector<int32_t>& aShape,
+                               const std::vector<int32_t>& bShape,
+                               const std::vector<int32_t>& outputShape,
+                               const FusionOperatorBase* activation)
+        : Kernel({a, b}, {output}),
+          mOpType(opType),
+          mActivation(activation),
+          mFunctions(GetElementwiseFunctions()) {
+        DAWN_ASSERT(opType != op::BinaryOpType::kMatMul);
+        size_t rank = outputShape.size();
+        auto alignStrides = [rank](const std::vector<int32_t>& shape) {
+            std::vector<size_t> strides = GetStrides(shape);
+            std::vector<size_t> aligned(rank, 0);
+            size_t offset = rank - shape.size();
+            for (size_t i = 0; i < shape.size(); ++i) {
+                aligned[offset + i] = shape[i] == 1 ? 0 : strides[i];
+            }
+            return aligned;
+        };
+        std::vector<size_t> aStrides = alignStrides(aShape);
+        std::vector<size_t> bStrides = alignStrides(bShape);
+        // Merge the adjacent dimensions that a and b both traverse contiguously or both
+        // broadcast, so that the rows handed to the vectorized loops are as long as possible.
+        for (size_t i = 0; i < rank; ++i) {
+            if (outputShape[i] == 1) {
+                continue;
+            }
+            if (!mOutputShape.empty() &&
+                mAStrides.back() == aStrides[i] * outputShape[i] &&
+                mBStrides.back() == bStrides[i] * outputShape[i]) {
+                mOutputShape.back() *= outputShape[i];
+                mAStrides.back() = aStrides[i];
+                mBStrides.back() = bStrides[i];
+                continue;
+            }
+            mOutputShape.push_back(outputShape[i]);
+            mAStrides.push_back(aStrides[i]);
+            mBStrides.push_back(bStrides[i]);
+        }
+    }
+
+    void BinaryKernel::Compute(const ExecutionContext& context) const {
+        const float* a = context.GetData<float>(mInputs[0]);
+        const float* b = context.GetData<float>(mInputs[1]);
+        float* output = context.GetData<float>(mOutputs[0]);
+        size_t rank = mOutputShape.size();
+        size_t innerSize = rank == 0 ? 1 : mOutputShape[rank - 1];
+        size_t aInnerStride = rank == 0 ? 0 : mAStrides[rank - 1];
+        size_t bInnerStride = rank == 0 ? 0 : mBStrides[rank - 1];
+        size_t rows = GetElementCount(mOutputShape) / std::max<size_t>(innerSize, 1);
+        context.GetThreadPool()->ParallelFor(
+            rows,
+            [&](size_t begin, size_t end) {
+                for (size_t row = begin; row < end; ++row) {
+                    size_t aOffset = 0, bOffset = 0, index = row;
+                    for (int d = static_cast<int>(rank) - 2; d >= 0; --d) {
+                        size_t i = index % mOutputShape[d];
+                        index /= mOutputShape[d];
+                        aOffset += i * mAStrides[d];
+                        bOffset += i * mBStrides[d];
+                    }
+                    mFunctions.binary(mOpType, a + aOffset, aInnerStride, b + bOffset,
+                                      bInnerStride, output + row * innerSize, innerSize);
+                    // Activate the row while it is still in the cache.
+                    mActivation.Apply(output + row * innerSize, innerSize);
+                }
+            },
+            std::max<size_t>(1, kElementwiseGrainSize / std::max<size_t>(innerSize, 1)));
+    }
+
+    ClampKernel::ClampKernel(uint32_t input,
+                             uint32_t output,
+                             float minValue,
+                             float maxValue,
+                             std::vector<int32_t> shape)
+        : Kernel({input}, {output}),
+          mMinValue(minValue),
+          mMaxValue(maxValue),
+          mShape(std::move(shape)),
+          mFunctions(GetElementwiseFunctions()) {
+    }
+
+    void ClampKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        float* output = context.GetData<float>(mOutputs[0]);
+        context.GetThreadPool()->ParallelFor(
+            GetElementCount(mShape),
+            [&](size_t begin, size_t end) {
+                mFunctions.clamp(input + begin, output + begin, end - begin, mMinValue,
+                                 mMaxValue);
+            },
+            kElementwiseGrainSize);
+    }
+
+    CastKernel::CastKernel(uint32_t input, uint32_t output, bool toFloat32, size_t count)
+        : Kernel({input}, {output}),
+          mToFloat32(toFloat32),
+          mCount(count),
+          mFunctions(GetElementwiseFunctions()) {
+    }
+
+    void CastKernel::Compute(const ExecutionContext& context) const {
+        context.GetThreadPool()->ParallelFor(
+            mCount,
+            [&](size_t begin, size_t end) {
+                if (mToFloat32) {
+                    mFunctions.halfToFloat(context.GetData<uint16_t>(mInputs[0]) + begin,
+                                           context.GetData<float>(mOutputs[0]) + begin,
+                                           end - begin);
+                } else {
+                    mFunctions.floatToHalf(context.GetData<float>(mInputs[0]) + begin,
+                                           context.GetData<uint16_t>(mOutputs[0]) + begin,
+                                           end - begin);
+                }
+            },
+            kElementwiseGrainSize);
+    }
+
+}}  // namespace dawn::native::cpu
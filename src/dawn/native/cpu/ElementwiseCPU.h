@@ -0,0 +1,124 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_ELEMENTWISE_CPU_H_
+#define WEBNN_NATIVE_CPU_ELEMENTWISE_CPU_H_
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+#include "dawn/native/cpu/KernelCPU.h"
+#include "dawn/native/ops/Binary.h"
+#include "dawn/native/ops/Unary.h"
+
+namespace dawn::native { namespace cpu {
+
+    class UnaryKernel final : public Kernel {
+      public:
+        UnaryKernel(uint32_t input,
+                    uint32_t output,
+                    op::UnaryOpType opType,
+                    std::vector<int32_t> shape,
+                    float alpha = 0);
+
+        const char* GetName() const override {
+            return "Unary";
+        }
+        uint64_t GetOperationCount() const override {
+            return GetElementCount(mShape);
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        op::UnaryOpType mOpType;
+        std::vector<int32_t> mShape;
+        float mAlpha;
+        const ElementwiseFunctions& mFunctions;
+    };
+
+    // Element-wise binary operators with bidirectional broadcasting and an optional fused
+    // activation. kMatMul is handled by MatMulKernel.
+    class BinaryKernel final : public Kernel {
+      public:
+        BinaryKernel(uint32_t a,
+                     uint32_t b,
+                     uint32_t output,
+                     op::BinaryOpType opType,
+                     const std::vector<int32_t>& aShape,
+                     const std::vector<int32_t>& bShape,
+                     const std::vector<int32_t>& outputShape,
+                     const FusionOperatorBase* activation = nullptr);
+
+        const char* GetName() const override {
+            return "Binary";
+        }
+        uint64_t GetOperationCount() const override {
+            return GetElementCount(mOutputShape);
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        op::BinaryOpType mOpType;
+        // The output shape with the dimensions of size 1 removed and the adjacent dimensions
+        // that broadcast in the same way merged, and the strides of a and b over it, 0 for the
+        // broadcast dimensions.
+        std::vector<int32_t> mOutputShape;
+        std::vector<size_t> mAStrides;
+        std::vector<size_t> mBStrides;
+        FusedActivation mActivation;
+        const ElementwiseFunctions& mFunctions;
+    };
+
+    class ClampKernel final : public Kernel {
+      public:
+        ClampKernel(uint32_t input,
+                    uint32_t output,
+                    float minValue,
+                    float maxValue,
+                    std::vector<int32_t> shape);
+
+        const char* GetName() const override {
+            return "Clamp";
+        }
+        uint64_t GetOperationCount() const override {
+            return GetElementCount(mShape);
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        float mMinValue;
+        float mMaxValue;
+        std::vector<int32_t> mShape;
+        const ElementwiseFunctions& mFunctions;
+    };
+
+    // Converts a tensor between float16 and float32, at the float16 inputs and outputs of a
+    // graph whose other tensors are all computed as float32.
+    class CastKernel final : public Kernel {
+      public:
+        // From float16 to float32 with |toFloat32|, the other way otherwise.
+        CastKernel(uint32_t input, uint32_t output, bool toFloat32, size_t count);
+
+        const char* GetName() const override {
+            return "Cast";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        bool mToFloat32;
+        size_t mCount;
+        const ElementwiseFunctions& mFunctions;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_ELEMENTWISE_CPU_H_
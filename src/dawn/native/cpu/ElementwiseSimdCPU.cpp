@@ -0,0 +1,44 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native { namespace cpu {
+
+    const ElementwiseFunctions& GetElementwiseFunctions() {
+        static const ElementwiseFunctions& functions = GetElementwiseFunctions(GetSimdLevel());
+        return functions;
+    }
+
+    const ElementwiseFunctions& GetElementwiseFunctions(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::Scalar:
+                return GetElementwiseFunctionsScalar();
+#if defined(WEBNN_CPU_X86)
+            case SimdLevel::AVX2:
+                return GetElementwiseFunctionsAVX2();
+            case SimdLevel::AVX512:
+                return GetElementwiseFunctionsAVX512();
+#elif defined(WEBNN_CPU_ARM64)
+            case SimdLevel::NEON:
+                return GetElementwiseFunctionsNEON();
+#endif
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+}}  // namespace dawn::native::cpu
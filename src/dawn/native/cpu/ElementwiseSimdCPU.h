@@ -0,0 +1,90 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_ELEMENTWISE_SIMD_CPU_H_
+#define WEBNN_NATIVE_CPU_ELEMENTWISE_SIMD_CPU_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "dawn/native/cpu/SimdCPU.h"
+#include "dawn/native/ops/Binary.h"
+#include "dawn/native/ops/Reduce.h"
+#include "dawn/native/ops/Unary.h"
+
+namespace dawn::native { namespace cpu {
+
+    // The elementwise loops over contiguous float32 values compiled for one instruction set.
+    struct ElementwiseFunctions {
+        // Every op::UnaryOpType except kSoftmax. |alpha| is used by kLeakyRelu.
+        void (*unary)(op::UnaryOpType opType, const float* x, float* y, size_t count, float alpha);
+        // Every op::BinaryOpType except kMatMul. A stride of 0 broadcasts the first value of
+        // a or b, a stride of 1 reads contiguous values.
+        void (*binary)(op::BinaryOpType opType,
+                       const float* a,
+                       size_t aStride,
+                       const float* b,
+                       size_t bStride,
+                       float* y,
+                       size_t count);
+        // Softmax of one row.
+        void (*softmax)(const float* x, float* y, size_t count);
+        // Reduces each of the |rows| rows of |count| contiguous values to one value of y. Every
+        // op::ReduceType except kReduceArgMax and kReduceArgMin, with kReduceL2 giving the sum
+        // of the squares and kReduceMean the sum.
+        void (*reduceRows)(op::ReduceType opType,
+                           const float* x,
+                           float* y,
+                           size_t rows,
+                           size_t count);
+        // Reduces |rows| rows of |count| values, |stride| apart, to |count| contiguous values
+        // of y, combined with the values of y when |accumulate|. Same reductions as reduceRows.
+        void (*reduceColumns)(op::ReduceType opType,
+                              const float* x,
+                              size_t stride,
+                              float* y,
+                              size_t rows,
+                              size_t count,
+                              bool accumulate);
+        void (*clamp)(const float* x, float* y, size_t count, float minValue, float maxValue);
+        // y = a + (b - a) * t over |count| contiguous values.
+        void (*lerp)(const float* a, const float* b, float t, float* y, size_t count);
+        // y[c * yStride + r] = x[r * xStride + c] for the |rows| x |cols| matrix x. Only moves
+        // the bits, so it serves any 32-bit type.
+        void (*transpose)(const float* x,
+                          size_t xStride,
+                          float* y,
+                          size_t yStride,
+                          size_t rows,
+                          size_t cols);
+        // The conversions between the float16 bits and float32, rounding to nearest even.
+        void (*halfToFloat)(const uint16_t* x, float* y, size_t count);
+        void (*floatToHalf)(const float* x, uint16_t* y, size_t count);
+    };
+
+    // The functions for GetSimdLevel().
+    const ElementwiseFunctions& GetElementwiseFunctions();
+    const ElementwiseFunctions& GetElementwiseFunctions(SimdLevel level);
+
+    const ElementwiseFunctions& GetElementwiseFunctionsScalar();
+#if defined(WEBNN_CPU_X86)
+    const ElementwiseFunctions& GetElementwiseFunctionsAVX2();
+    const ElementwiseFunctions& GetElementwiseFunctionsAVX512();
+#elif defined(WEBNN_CPU_ARM64)
+    const ElementwiseFunctions& GetElementwiseFunctionsNEON();
+#endif
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_ELEMENTWISE_SIMD_CPU_H_
@@ -0,0 +1,83 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/Float16CPU.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        uint32_t FloatToBits(float value) {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        float BitsToFloat(uint32_t bits) {
+            float value;
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    }  // anonymous namespace
+
+    // Both conversions let the float32 unit do the rounding and the denormals, see
+    // https://github.com/Maratyszcza/FP16.
+    float HalfToFloat(uint16_t value) {
+        uint32_t bits = static_cast<uint32_t>(value) << 16;
+        uint32_t sign = bits & 0x80000000u;
+        uint32_t doubled = bits + bits;
+        // Rebias the exponent, which also turns the float16 infinities and NaNs into float32
+        // ones once scaled.
+        float normalized = BitsToFloat((doubled >> 4) + (0xE0u << 23)) * 0x1.0p-112f;
+        // The mantissa of a denormal is an offset from 0.5 with the right exponent.
+        float denormalized = BitsToFloat((doubled >> 17) | (126u << 23)) - 0.5f;
+        constexpr uint32_t kDenormalCutoff = 1u << 27;
+        return BitsToFloat(sign | (doubled < kDenormalCutoff ? FloatToBits(denormalized)
+                                                             : FloatToBits(normalized)));
+    }
+
+    uint16_t FloatToHalf(float value) {
+        // Scaling up then down saturates to infinity and rounds the values that become
+        // float16 denormals.
+        float base = (std::fabs(value) * 0x1.0p+112f) * 0x1.0p-110f;
+        uint32_t bits = FloatToBits(value);
+        uint32_t doubled = bits + bits;
+        uint32_t sign = bits & 0x80000000u;
+        uint32_t bias = doubled & 0xFF000000u;
+        if (bias < 0x71000000u) {
+            bias = 0x71000000u;
+        }
+        // Adding a power of two drops the mantissa bits below the float16 precision with the
+        // rounding of the float32 addition.
+        base = BitsToFloat((bias >> 1) + 0x07800000u) + base;
+        uint32_t baseBits = FloatToBits(base);
+        uint32_t exponentBits = (baseBits >> 13) & 0x00007C00u;
+        uint32_t mantissaBits = baseBits & 0x00000FFFu;
+        uint32_t nonSign = exponentBits + mantissaBits;
+        return static_cast<uint16_t>((sign >> 16) | (doubled > 0xFF000000u ? 0x7E00u : nonSign));
+    }
+
+    void ConvertHalfToFloat(const uint16_t* x, float* y, size_t count) {
+        GetElementwiseFunctions().halfToFloat(x, y, count);
+    }
+
+    void ConvertFloatToHalf(const float* x, uint16_t* y, size_t count) {
+        GetElementwiseFunctions().floatToHalf(x, y, count);
+    }
+
+}}  // namespace dawn::native::cpu
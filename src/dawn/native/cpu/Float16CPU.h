@@ -0,0 +1,36 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_FLOAT16_CPU_H_
+#define WEBNN_NATIVE_CPU_FLOAT16_CPU_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dawn::native { namespace cpu {
+
+    // The float16 values are stored as their IEEE 754 binary16 bits. The conversions round to
+    // nearest even and, unlike the helpers of dawn/common/Math.h, keep the infinities, the
+    // NaNs and the denormals.
+    float HalfToFloat(uint16_t value);
+    uint16_t FloatToHalf(float value);
+
+    // Converts |count| contiguous values with the instructions of GetSimdLevel(): F16C with
+    // AVX2, AVX512F and NEON.
+    void ConvertHalfToFloat(const uint16_t* x, float* y, size_t count);
+    void ConvertFloatToHalf(const float* x, uint16_t* y, size_t count);
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_FLOAT16_CPU_H_
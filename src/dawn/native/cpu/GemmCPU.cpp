@@ -0,0 +1,226 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/GemmCPU.h"
+
+#include <algorithm>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    GemmKernel::GemmKernel(uint32_t a,
+                           uint32_t b,
+                           uint32_t c,
+                           uint32_t output,
+                           const std::vector<int32_t>& aShape,
+                           const std::vector<int32_t>& bShape,
+                           const std::vector<int32_t>& cShape,
+                           float alpha,
+                           float beta,
+                           bool aTranspose,
+                           bool bTranspose,
+                           const FusionOperatorBase* activation,
+                           bool halfPrecisionB)
+        : Kernel(cShape.empty() ? std::vector<uint32_t>{a, b} : std::vector<uint32_t>{a, b, c},
+                 {output}),
+          mAlpha(alpha),
+          mBeta(beta),
+          mATranspose(aTranspose),
+          mBTranspose(bTranspose),
+          mHasC(!cShape.empty()),
+          mHalfPrecisionB(halfPrecisionB),
+          mActivation(activation) {
+        mM = aTranspose ? aShape[1] : aShape[0];
+        mK = aTranspose ? aShape[0] : aShape[1];
+        mN = bTranspose ? bShape[0] : bShape[1];
+        if (mHasC) {
+            // Align C to [M, N] from the right side.
+            std::vector<int32_t> alignedShape(2, 1);
+            for (size_t i = 0; i < cShape.size(); ++i) {
+                alignedShape[2 - cShape.size() + i] = cShape[i];
+            }
+            mCRowStride = alignedShape[0] == 1 ? 0 : alignedShape[1];
+            mCColumnStride = alignedShape[1] == 1 ? 0 : 1;
+        }
+    }
+
+    void GemmKernel::Prepare(const ExecutionContext& constants) {
+        const float* b = constants.GetData<float>(mInputs[1]);
+        if (b != nullptr) {
+            // Fold alpha into the packed weights.
+            mPackedB.Pack(b, mBTranspose ? 1 : mN, mBTranspose ? mK : 1, mK, mN, mAlpha,
+                          mHalfPrecisionB);
+        }
+    }
+
+    void GemmKernel::SerializePrepared(PreparedDataWriter* writer) const {
+        writer->WritePackedMatrix(mPackedB);
+    }
+
+    bool GemmKernel::DeserializePrepared(PreparedDataReader* reader) {
+        return reader->ReadPackedMatrix(&mPackedB);
+    }
+
+    void GemmKernel::Compute(const ExecutionContext& context) const {
+        const float* a = context.GetData<float>(mInputs[0]);
+        const float* c = mHasC ? context.GetData<float>(mInputs[2]) : nullptr;
+        float* output = context.GetData<float>(mOutputs[0]);
+        ThreadPool* threadPool = context.GetThreadPool();
+
+        PackedMatrix packedB;
+        const PackedMatrix* b = &mPackedB;
+        if (mPackedB.IsEmpty()) {
+            packedB.Pack(context.GetData<float>(mInputs[1]), mBTranspose ? 1 : mN,
+                         mBTranspose ? mK : 1, mK, mN, mAlpha);
+            b = &packedB;
+        }
+
+        // Start from beta * C and let the micro kernels accumulate alpha * A' * B' on it.
+        bool accumulate = c != nullptr && mBeta != 0.0f;
+        if (accumulate) {
+            threadPool->ParallelFor(mM, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    float* row = output + i * mN;
+                    for (size_t j = 0; j < mN; ++j) {
+                        row[j] = mBeta * c[i * mCRowStride + j * mCColumnStride];
+                    }
+                }
+            });
+        }
+        Sgemm(threadPool, mM, a, mATranspose ? 1 : mK, mATranspose ? mM : 1, *b, output, mN,
+              accumulate);
+        if (mActivation.IsEnabled()) {
+            threadPool->ParallelFor(mM, [&](size_t begin, size_t end) {
+                mActivation.Apply(output + begin * mN, (end - begin) * mN);
+            });
+        }
+    }
+
+    MatMulKernel::MatMulKernel(uint32_t a,
+                               uint32_t b,
+                               uint32_t output,
+                               std::vector<int32_t> aShape,
+                               std::vector<int32_t> bShape,
+                               const std::vector<int32_t>& outputShape,
+                               bool halfPrecisionB)
+        : Kernel({a, b}, {output}), mHalfPrecisionB(halfPrecisionB) {
+        // A 1-D a is a row vector and a 1-D b is a column vector.
+        if (aShape.size() == 1) {
+            aShape.insert(aShape.begin(), 1);
+        }
+        if (bShape.size() == 1) {
+            bShape.push_back(1);
+        }
+        size_t rankA = aShape.size(), rankB = bShape.size();
+        mM = aShape[rankA - 2];
+        mK = aShape[rankA - 1];
+        mN = bShape[rankB - 1];
+        DAWN_ASSERT(static_cast<size_t>(bShape[rankB - 2]) == mK);
+
+        size_t batchRank = std::max(rankA, rankB) - 2;
+        mBatchShape.assign(outputShape.begin(),
+                           outputShape.begin() + std::min(batchRank, outputShape.size()));
+        mBatchShape.resize(batchRank, 1);
+        auto batchStrides = [batchRank](const std::vector<int32_t>& shape, size_t matrixSize) {
+            std::vector<size_t> strides(batchRank, 0);
+            size_t rank = shape.size() - 2;
+            size_t stride = matrixSize;
+            for (size_t i = rank; i-- > 0;) {
+                strides[batchRank - rank + i] = shape[i] == 1 ? 0 : stride;
+                stride *= shape[i];
+            }
+            return strides;
+        };
+        mABatchStrides = batchStrides(aShape, mM * mK);
+        mBBatchStrides = batchStrides(bShape, mK * mN);
+        mBMatrixCount = GetElementCount(std::vector<int32_t>(bShape.begin(), bShape.end() - 2));
+    }
+
+    void MatMulKernel::Prepare(const ExecutionContext& constants) {
+        const float* b = constants.GetData<float>(mInputs[1]);
+        if (b == nullptr) {
+            return;
+        }
+        mPackedB.resize(mBMatrixCount);
+        for (size_t i = 0; i < mBMatrixCount; ++i) {
+            mPackedB[i].Pack(b + i * mK * mN, mN, 1, mK, mN, 1.0f, mHalfPrecisionB);
+        }
+    }
+
+    void MatMulKernel::SerializePrepared(PreparedDataWriter* writer) const {
+        writer->Write<uint64_t>(mPackedB.size());
+        for (const PackedMatrix& matrix : mPackedB) {
+            writer->WritePackedMatrix(matrix);
+        }
+    }
+
+    bool MatMulKernel::DeserializePrepared(PreparedDataReader* reader) {
+        uint64_t count;
+        if (!reader->Read(&count) || (count != 0 && count != mBMatrixCount)) {
+            return false;
+        }
+        std::vector<PackedMatrix> packedB(count);
+        for (PackedMatrix& matrix : packedB) {
+            if (!reader->ReadPackedMatrix(&matrix)) {
+                return false;
+            }
+        }
+        mPackedB = std::move(packedB);
+        return true;
+    }
+
+    void MatMulKernel::Compute(const ExecutionContext& context) const {
+        const float* a = context.GetData<float>(mInputs[0]);
+        float* output = context.GetData<float>(mOutputs[0]);
+        ThreadPool* threadPool = context.GetThreadPool();
+
+        std::vector<PackedMatrix> packedB;
+        const std::vector<PackedMatrix>* b = &mPackedB;
+        if (mPackedB.empty()) {
+            const float* data = context.GetData<float>(mInputs[1]);
+            packedB.resize(mBMatrixCount);
+            threadPool->ParallelFor(mBMatrixCount, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    packedB[i].Pack(data + i * mK * mN, mN, 1, mK, mN);
+                }
+            });
+            b = &packedB;
+        }
+
+        // Split every matrix of the batch into enough tiles to keep all the threads busy.
+        size_t batchCount = GetElementCount(mBatchShape);
+        size_t minTileCount = threadPool->GetThreadCount() * 4;
+        GemmTiling tiling(mM, mN,
+                          std::max<size_t>(1, minTileCount / std::max<size_t>(batchCount, 1)));
+        size_t tileCount = tiling.GetTileCount();
+        threadPool->ParallelFor(batchCount * tileCount, [&](size_t begin, size_t end) {
+            for (size_t task = begin; task < end; ++task) {
+                size_t batch = task / tileCount;
+                size_t aOffset = 0, bOffset = 0, index = batch;
+                for (size_t d = mBatchShape.size(); d-- > 0;) {
+                    size_t i = index % mBatchShape[d];
+                    index /= mBatchShape[d];
+                    aOffset += i * mABatchStrides[d];
+                    bOffset += i * mBBatchStrides[d];
+                }
+                tiling.ComputeTile(task % tileCount, a + aOffset, mK, 1,
+                                   (*b)[mK * mN == 0 ? 0 : bOffset / (mK * mN)],
+                                   output + batch * mM * mN, mN, false);
+            }
+        });
+    }
+
+}}  // namespace dawn::native::cpu
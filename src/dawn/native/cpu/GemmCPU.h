@@ -0,0 +1,125 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_GEMM_CPU_H_
+#define WEBNN_NATIVE_CPU_GEMM_CPU_H_
+
+#include "dawn/native/cpu/KernelCPU.h"
+#include "dawn/native/cpu/SgemmCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    // activation(alpha * A' * B' + beta * C), where A' and B' are optionally transposed, C is
+    // unidirectionally broadcast to [M, N] and the activation is optional.
+    class GemmKernel final : public Kernel {
+      public:
+        // |c| is ignored when |cShape| is empty. A constant B is packed as float16 with
+        // |halfPrecisionB|, see PackedMatrix::Pack().
+        GemmKernel(uint32_t a,
+                   uint32_t b,
+                   uint32_t c,
+                   uint32_t output,
+                   const std::vector<int32_t>& aShape,
+                   const std::vector<int32_t>& bShape,
+                   const std::vector<int32_t>& cShape,
+                   float alpha,
+                   float beta,
+                   bool aTranspose,
+                   bool bTranspose,
+                   const FusionOperatorBase* activation = nullptr,
+                   bool halfPrecisionB = false);
+
+        const char* GetName() const override {
+            return "Gemm";
+        }
+        const char* GetVariant() const override {
+            return mPackedB.IsHalfPrecision() ? "Float16B" : "";
+        }
+        uint64_t GetOperationCount() const override {
+            return 2 * static_cast<uint64_t>(mM) * mN * mK;
+        }
+        void Prepare(const ExecutionContext& constants) override;
+        bool IsInputPrepared(size_t index) const override {
+            return index == 1 && !mPackedB.IsEmpty();
+        }
+        void SerializePrepared(PreparedDataWriter* writer) const override;
+        bool DeserializePrepared(PreparedDataReader* reader) override;
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        size_t mM;
+        size_t mN;
+        size_t mK;
+        float mAlpha;
+        float mBeta;
+        bool mATranspose;
+        bool mBTranspose;
+        bool mHasC;
+        bool mHalfPrecisionB;
+        FusedActivation mActivation;
+        // The strides of C over [M, N], 0 for the broadcast dimensions.
+        size_t mCRowStride = 0;
+        size_t mCColumnStride = 0;
+        // alpha * B' packed by Prepare() when B is a constant.
+        PackedMatrix mPackedB;
+    };
+
+    // Batched matrix multiplication where the batch dimensions are broadcast as in
+    // op::Binary::CaculateMatMulShape.
+    class MatMulKernel final : public Kernel {
+      public:
+        // A constant b is packed as float16 with |halfPrecisionB|.
+        MatMulKernel(uint32_t a,
+                     uint32_t b,
+                     uint32_t output,
+                     std::vector<int32_t> aShape,
+                     std::vector<int32_t> bShape,
+                     const std::vector<int32_t>& outputShape,
+                     bool halfPrecisionB = false);
+
+        const char* GetName() const override {
+            return "MatMul";
+        }
+        const char* GetVariant() const override {
+            return !mPackedB.empty() && mPackedB[0].IsHalfPrecision() ? "Float16B" : "";
+        }
+        uint64_t GetOperationCount() const override {
+            return 2 * static_cast<uint64_t>(GetElementCount(mBatchShape)) * mM * mN * mK;
+        }
+        void Prepare(const ExecutionContext& constants) override;
+        bool IsInputPrepared(size_t index) const override {
+            return index == 1 && !mPackedB.empty();
+        }
+        void SerializePrepared(PreparedDataWriter* writer) const override;
+        bool DeserializePrepared(PreparedDataReader* reader) override;
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        size_t mM;
+        size_t mN;
+        size_t mK;
+        std::vector<int32_t> mBatchShape;
+        // The matrix strides of a and b over mBatchShape, 0 for the broadcast dimensions.
+        std::vector<size_t> mABatchStrides;
+        std::vector<size_t> mBBatchStrides;
+        // The number of distinct matrices in b.
+        size_t mBMatrixCount;
+        bool mHalfPrecisionB;
+        // The matrices of b packed by Prepare() when b is a constant.
+        std::vector<PackedMatrix> mPackedB;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_GEMM_CPU_H_
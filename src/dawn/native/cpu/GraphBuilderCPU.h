@@ -0,0 +1,38 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_GRAPH_BUILDER_CPU_H_
+#define WEBNN_NATIVE_CPU_GRAPH_BUILDER_CPU_H_
+
+#include "dawn/native/GraphBuilder.h"
+
+namespace dawn::native { namespace cpu {
+
+    class GraphBuilder : public GraphBuilderBase {
+      public:
+        static GraphBuilder* Create(DeviceBase* device);
+
+        bool SupportsQuantizedOperators() const override;
+
+      private:
+        GraphBuilder(DeviceBase* device);
+        virtual ~GraphBuilder() = default;
+
+        virtual bool InitializeImpl() override;
+        virtual GraphBase* CreateGraphImpl() override;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_GRAPH_BUILDER_CPU_H_
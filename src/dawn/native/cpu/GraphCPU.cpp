@@ -0,0 +1,798 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/GraphCPU.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/native/Buffer.h"
+#include "dawn/native/Device.h"
+#include "dawn/native/NamedResources.h"
+#include "dawn/native/PersistentCache.h"
+#include "dawn/native/cpu/ConcatCPU.h"
+#include "dawn/native/cpu/Conv2dCPU.h"
+#include "dawn/native/cpu/ElementwiseCPU.h"
+#include "dawn/native/cpu/Float16CPU.h"
+#include "dawn/native/cpu/GemmCPU.h"
+#include "dawn/native/cpu/GruCPU.h"
+#include "dawn/native/cpu/NormalizationCPU.h"
+#include "dawn/native/cpu/PadCPU.h"
+#include "dawn/native/cpu/Pool2dCPU.h"
+#include "dawn/native/cpu/QuantizeCPU.h"
+#include "dawn/native/cpu/ReduceCPU.h"
+#include "dawn/native/cpu/Resample2dCPU.h"
+#include "dawn/native/cpu/SimdCPU.h"
+#include "dawn/native/cpu/SliceCPU.h"
+#include "dawn/native/cpu/TransposeCPU.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The alignment of every tensor in the constant memory, the same as in the scratch
+        // memory.
+        constexpr size_t kTensorAlignment = MemoryPlan::kAlignment;
+
+        // The kernels only compute float32 tensors, which the float16 operands are converted
+        // to, see Graph::AddTensor(). The other operand types can only be moved around by
+        // Concat, Reshape, Slice, Split, Squeeze and Transpose, or be quantized, see
+        // QuantizeCPU.h.
+        MaybeError ValidateFloat32(const OperatorBase* op, const char* name) {
+            for (auto& input : op->Inputs()) {
+                if (input->Type() != wgpu::OperandType::Float32 &&
+                    input->Type() != wgpu::OperandType::Float16) {
+                    return DAWN_UNIMPLEMENTED_ERROR(std::string(name) +
+                                                    " only supports float32 operands.");
+                }
+            }
+            return {};
+        }
+
+        // Whether the constant |weight| of Conv2d, Gemm, Gru or MatMul is packed as float16:
+        // when it was float16 in the graph, or for all of them with the
+        // dawn_enable_cpu_float16_weights GN arg.
+        bool IsHalfPrecisionWeight(const OperandBase* weight) {
+#if defined(DAWN_ENABLE_CPU_FLOAT16_WEIGHTS)
+            constexpr bool kFloat16Weights = true;
+#else
+            constexpr bool kFloat16Weights = false;
+#endif
+            return kFloat16Weights || weight->Type() == wgpu::OperandType::Float16;
+        }
+
+        bool IsInt8(wgpu::OperandType type) {
+            return type == wgpu::OperandType::Int8 || type == wgpu::OperandType::Uint8;
+        }
+
+        // The quantized Conv2d and Gemm read int8 or uint8 input and filter, a float32 bias and
+        // write int8 or uint8, with the filter quantized per tensor or per output channel.
+        MaybeError ValidateQuantized(const OperatorBase* op,
+                                     const op::Quantization& quantization,
+                                     size_t channels,
+                                     const char* name) {
+            auto& inputs = op->Inputs();
+            if (!IsInt8(inputs[0]->Type()) || !IsInt8(inputs[1]->Type()) ||
+                (inputs.size() == 3 && inputs[2]->Type() != wgpu::OperandType::Float32) ||
+                !IsInt8(op->PrimaryOutput()->Type())) {
+                return DAWN_UNIMPLEMENTED_ERROR(std::string("The quantized ") + name +
+                                                " only supports int8 and uint8 operands.");
+            }
+            size_t scaleCount = quantization.filterScales.size();
+            if ((scaleCount != 1 && scaleCount != channels) ||
+                quantization.filterZeroPoints.size() != scaleCount) {
+                return DAWN_VALIDATION_ERROR(std::string("The filter quantization of ") + name +
+                                             " doesn't match the output channels.");
+            }
+            return {};
+        }
+
+        // Sets |data| to the host pointer to |byteSize| bytes of the resource |name|, nullptr when
+        // it isn't set. The host resources and the host visible buffers are used in place. The
+        // pointer is an out-parameter because it may be unaligned, which Result can't hold.
+        MaybeError GetResourcePointer(const NamedResourcesBase* resources,
+                                      const std::string& name,
+                                      size_t byteSize,
+                                      uint8_t** data) {
+            *data = nullptr;
+            auto host = resources->GetHostResources().find(name);
+            if (host != resources->GetHostResources().end()) {
+                if (host->second.buffer == nullptr || host->second.size < byteSize) {
+                    return DAWN_VALIDATION_ERROR("The host memory of " + name + " is too small.");
+                }
+                *data = static_cast<uint8_t*>(host->second.buffer);
+                return {};
+            }
+            auto resource = resources->GetResources().find(name);
+            if (resource == resources->GetResources().end()) {
+                return {};
+            }
+            const BufferResourceView& view = resource->second;
+            uint8_t* pointer = static_cast<uint8_t*>(view.resource->GetHostVisiblePointer());
+            if (pointer == nullptr) {
+                return DAWN_VALIDATION_ERROR("The buffer of " + name + " must be host visible.");
+            }
+            uint64_t size = view.size != 0 ? view.size : view.resource->GetSize() - view.offset;
+            if (view.offset + size > view.resource->GetSize() || size < byteSize) {
+                return DAWN_VALIDATION_ERROR("The buffer of " + name + " is too small.");
+            }
+            *data = pointer + view.offset;
+            return {};
+        }
+    }  // anonymous namespace
+
+    Graph::Graph(DeviceBase* device) : GraphBase(device), mThreadPool(ThreadPool::GetDefault()) {
+    }
+
+    size_t Graph::GetIntermediateElementSize(wgpu::OperandType type) const {
+        return type == wgpu::OperandType::Float16 ? sizeof(float) : GetOperandTypeSize(type);
+    }
+
+    uint32_t Graph::AddTensor(const OperandBase* operand, TensorKind kind) {
+        Tensor tensor;
+        tensor.kind = kind;
+        tensor.type = operand->Type();
+        // Only the graph inputs keep float16, CastKernel converts them to float32.
+        if (tensor.type == wgpu::OperandType::Float16 && kind != TensorKind::Input) {
+            tensor.type = wgpu::OperandType::Float32;
+        }
+        tensor.shape = operand->Shape();
+        tensor.byteSize = GetElementCount(tensor.shape) * GetOperandTypeSize(tensor.type);
+        if (kind == TensorKind::Intermediate) {
+            tensor.offset = GetMemoryPlan().GetOffset(operand);
+        }
+        uint32_t id = mTensors.size();
+        mTensors.push_back(std::move(tensor));
+        mTensorIds[operand] = id;
+        return id;
+    }
+
+    uint32_t Graph::AddScratchTensor(wgpu::OperandType type, const std::vector<int32_t>& shape) {
+        Tensor tensor;
+        tensor.kind = TensorKind::Intermediate;
+        tensor.type = type;
+        tensor.shape = shape;
+        tensor.byteSize = GetElementCount(shape) * GetOperandTypeSize(type);
+        tensor.offset = GetMemoryPlan().GetSize() + mExtraScratchSize;
+        mExtraScratchSize += Align(tensor.byteSize, kTensorAlignment);
+        uint32_t id = mTensors.size();
+        mTensors.push_back(std::move(tensor));
+        return id;
+    }
+
+    uint32_t Graph::GetTensorId(const OperandBase* operand) const {
+        DAWN_ASSERT(mTensorIds.find(operand) != mTensorIds.end());
+        return mTensorIds.at(operand);
+    }
+
+    void* Graph::GetConstantData(const Tensor& tensor) {
+        DAWN_ASSERT(tensor.kind == TensorKind::Constant);
+        if (tensor.released) {
+            return nullptr;
+        }
+        if (tensor.hostData != nullptr) {
+            return const_cast<uint8_t*>(tensor.hostData);
+        }
+        return mConstantData.data() + tensor.offset;
+    }
+
+    MaybeError Graph::AddConstant(const op::Constant* constant) {
+        const uint8_t* data = constant->GetHostData();
+        if (data == nullptr) {
+            return DAWN_VALIDATION_ERROR("The buffer of the constant must be host visible.");
+        }
+        const OperandBase* operand = constant->PrimaryOutput();
+        uint32_t id = AddTensor(operand, TensorKind::Constant);
+        Tensor& tensor = mTensors[id];
+        size_t count = GetElementCount(tensor.shape);
+        if (constant->GetSize() < count * GetOperandTypeSize(operand->Type())) {
+            return DAWN_VALIDATION_ERROR("The buffer of the constant is too small.");
+        }
+        if (operand->Type() == wgpu::OperandType::Float16) {
+            tensor.offset = Align(mConstantData.size(), kTensorAlignment);
+            mConstantData.resize(tensor.offset + tensor.byteSize);
+            std::vector<uint16_t> values(count);
+            memcpy(values.data(), data, count * sizeof(uint16_t));
+            ConvertHalfToFloat(values.data(),
+                               reinterpret_cast<float*>(mConstantData.data() + tensor.offset),
+                               count);
+            return {};
+        }
+        if (constant->GetHostDataOwner() != nullptr &&
+            reinterpret_cast<uintptr_t>(data) % kTensorAlignment == 0) {
+            // The constants of a loaded graph are read in place from the mapped file.
+            tensor.hostData = data;
+            mConstantOwners.push_back(constant->GetHostDataOwner());
+            return {};
+        }
+        // The constant is copied so that the buffer can be reused or destroyed after build.
+        tensor.offset = Align(mConstantData.size(), kTensorAlignment);
+        mConstantData.resize(tensor.offset + tensor.byteSize);
+        memcpy(mConstantData.data() + tensor.offset, data, tensor.byteSize);
+        return {};
+    }
+
+    MaybeError Graph::AddInput(const op::Input* input) {
+        const OperandBase* operand = input->PrimaryOutput();
+        uint32_t id = AddTensor(operand, TensorKind::Input);
+        mInputs.insert(std::make_pair(input->GetName(), id));
+        if (operand->Type() == wgpu::OperandType::Float16) {
+            // The kernels read the input converted to float32.
+            uint32_t converted = AddScratchTensor(wgpu::OperandType::Float32, operand->Shape());
+            mKernels.push_back(std::make_unique<CastKernel>(id, converted, true,
+                                                            GetElementCount(operand->Shape())));
+            mTensorIds[operand] = converted;
+        }
+        return {};
+    }
+
+    MaybeError Graph::AddOutput(const std::string& name, const OperandBase* output) {
+        uint32_t id = GetTensorId(output);
+        if (output->Type() == wgpu::OperandType::Float16) {
+            uint32_t converted = AddScratchTensor(wgpu::OperandType::Float16, output->Shape());
+            mKernels.push_back(std::make_unique<CastKernel>(id, converted, false,
+                                                            GetElementCount(output->Shape())));
+            id = converted;
+        }
+        mOutputs.insert(std::make_pair(name, id));
+        return {};
+    }
+
+    MaybeError Graph::AddBatchNorm(const op::BatchNorm* batchNorm) {
+        DAWN_TRY(ValidateFloat32(batchNorm, "BatchNorm"));
+        const BatchNormOptions* options = batchNorm->GetOptions();
+        std::vector<uint32_t> inputs;
+        for (auto& input : batchNorm->Inputs()) {
+            inputs.push_back(GetTensorId(input));
+        }
+        uint32_t output = AddTensor(batchNorm->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<BatchNormKernel>(
+            std::move(inputs), output, options->scale != nullptr, options->bias != nullptr,
+            batchNorm->Inputs()[0]->Shape(), options->axis, options->epsilon,
+            options->activation));
+        return {};
+    }
+
+    MaybeError Graph::AddBinary(const op::Binary* binary) {
+        DAWN_TRY(ValidateFloat32(binary, "Binary"));
+        const OperandBase* a = binary->Inputs()[0];
+        const OperandBase* b = binary->Inputs()[1];
+        uint32_t output = AddTensor(binary->PrimaryOutput(), TensorKind::Intermediate);
+        if (binary->GetType() == op::BinaryOpType::kMatMul) {
+            mKernels.push_back(std::make_unique<MatMulKernel>(
+                GetTensorId(a), GetTensorId(b), output, a->Shape(), b->Shape(),
+                binary->PrimaryOutput()->Shape(), IsHalfPrecisionWeight(b)));
+        } else {
+            mKernels.push_back(std::make_unique<BinaryKernel>(
+                GetTensorId(a), GetTensorId(b), output, binary->GetType(), a->Shape(),
+                b->Shape(), binary->PrimaryOutput()->Shape(), binary->GetActivation()));
+        }
+        return {};
+    }
+
+    MaybeError Graph::AddClamp(const op::Clamp* clamp) {
+        DAWN_TRY(ValidateFloat32(clamp, "Clamp"));
+        const OperandBase* input = clamp->Inputs()[0];
+        uint32_t output = AddTensor(clamp->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<ClampKernel>(GetTensorId(input), output,
+                                                         clamp->GetMinValue(),
+                                                         clamp->GetMaxValue(), input->Shape()));
+        return {};
+    }
+
+    MaybeError Graph::AddConcat(const op::Concat* concat) {
+        std::vector<uint32_t> inputs;
+        std::vector<std::vector<int32_t>> inputShapes;
+        for (auto& input : concat->Inputs()) {
+            inputs.push_back(GetTensorId(input));
+            inputShapes.push_back(input->Shape());
+        }
+        uint32_t output = AddTensor(concat->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<ConcatKernel>(
+            std::move(inputs), output, GetOperandTypeSize(mTensors[output].type), inputShapes,
+            concat->GetAxis()));
+        return {};
+    }
+
+    MaybeError Graph::AddConv2d(const op::Conv2d* conv2d) {
+        auto& inputs = conv2d->Inputs();
+        bool hasBias = inputs.size() == 3;
+        if (const op::Quantization* quantization = conv2d->GetQuantization()) {
+            const OperandBase* outputOperand = conv2d->PrimaryOutput();
+            size_t channels = conv2d->GetOptions()->inputLayout == wgpu::InputOperandLayout::Nchw
+                                  ? outputOperand->Shape()[1]
+                                  : outputOperand->Shape()[3];
+            DAWN_TRY(ValidateQuantized(conv2d, *quantization, channels, "Conv2d"));
+            uint32_t output = AddTensor(outputOperand, TensorKind::Intermediate);
+            mKernels.push_back(std::make_unique<QuantizedConv2dKernel>(
+                GetTensorId(inputs[0]), GetTensorId(inputs[1]),
+                hasBias ? GetTensorId(inputs[2]) : 0, output, hasBias, inputs[0]->Shape(),
+                inputs[1]->Shape(), outputOperand->Shape(), conv2d->GetOptions(),
+                Int8GemmQuantization(*quantization, inputs[0]->Type(), inputs[1]->Type(),
+                                     outputOperand->Type(), channels)));
+            return {};
+        }
+        DAWN_TRY(ValidateFloat32(conv2d, "Conv2d"));
+        uint32_t output = AddTensor(conv2d->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<Conv2dKernel>(
+            GetTensorId(inputs[0]), GetTensorId(inputs[1]),
+            hasBias ? GetTensorId(inputs[2]) : 0, output, hasBias, inputs[0]->Shape(),
+            inputs[1]->Shape(), conv2d->PrimaryOutput()->Shape(), conv2d->GetOptions(),
+            Conv2dAlgorithm::Auto, IsHalfPrecisionWeight(inputs[1])));
+        return {};
+    }
+
+    MaybeError Graph::AddGemm(const op::Gemm* gemm) {
+        auto& inputs = gemm->Inputs();
+        const GemmOptions* options = gemm->GetOptions();
+        bool hasC = inputs.size() == 3;
+        if (const op::Quantization* quantization = gemm->GetQuantization()) {
+            const OperandBase* outputOperand = gemm->PrimaryOutput();
+            size_t channels = outputOperand->Shape()[1];
+            DAWN_TRY(ValidateQuantized(gemm, *quantization, channels, "Gemm"));
+            uint32_t output = AddTensor(outputOperand, TensorKind::Intermediate);
+            mKernels.push_back(std::make_unique<QuantizedGemmKernel>(
+                GetTensorId(inputs[0]), GetTensorId(inputs[1]),
+                hasC ? GetTensorId(inputs[2]) : 0, output, inputs[0]->Shape(),
+                inputs[1]->Shape(), hasC ? inputs[2]->Shape() : OperandShape(), options,
+                Int8GemmQuantization(*quantization, inputs[0]->Type(), inputs[1]->Type(),
+                                     outputOperand->Type(), channels, options->alpha)));
+            return {};
+        }
+        DAWN_TRY(ValidateFloat32(gemm, "Gemm"));
+        uint32_t output = AddTensor(gemm->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<GemmKernel>(
+            GetTensorId(inputs[0]), GetTensorId(inputs[1]),
+            hasC ? GetTensorId(inputs[2]) : 0, output, inputs[0]->Shape(),
+            inputs[1]->Shape(), hasC ? inputs[2]->Shape() : OperandShape(),
+            options->alpha, options->beta, options->aTranspose, options->bTranspose,
+            options->activation, IsHalfPrecisionWeight(inputs[1])));
+        return {};
+    }
+
+    MaybeError Graph::AddGru(const op::Gru* gru) {
+        DAWN_TRY(ValidateFloat32(gru, "Gru"));
+        std::vector<uint32_t> inputs, outputs;
+        for (auto& input : gru->Inputs()) {
+            inputs.push_back(GetTensorId(input));
+        }
+        for (auto& output : gru->Outputs()) {
+            outputs.push_back(AddTensor(output, TensorKind::Intermediate));
+        }
+        mKernels.push_back(std::make_unique<GruKernel>(
+            std::move(inputs), std::move(outputs), gru->Inputs()[0]->Shape(),
+            gru->GetHiddenSize(), gru->GetOptions(),
+            IsHalfPrecisionWeight(gru->Inputs()[1])));
+        return {};
+    }
+
+    MaybeError Graph::AddInstanceNorm(const op::InstanceNorm* instanceNorm) {
+        DAWN_TRY(ValidateFloat32(instanceNorm, "InstanceNorm"));
+        const InstanceNormOptions* options = instanceNorm->GetOptions();
+        std::vector<uint32_t> inputs;
+        for (auto& input : instanceNorm->Inputs()) {
+            inputs.push_back(GetTensorId(input));
+        }
+        uint32_t output = AddTensor(instanceNorm->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<InstanceNormKernel>(
+            std::move(inputs), output, options->scale != nullptr, options->bias != nullptr,
+            instanceNorm->Inputs()[0]->Shape(), options->epsilon, options->layout));
+        return {};
+    }
+
+    MaybeError Graph::AddPad(const op::Pad* pad) {
+        DAWN_TRY(ValidateFloat32(pad, "Pad"));
+        const OperandBase* input = pad->Inputs()[0];
+        uint32_t output = AddTensor(pad->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<PadKernel>(GetTensorId(input), output,
+                                                       input->Shape(),
+                                                       pad->PrimaryOutput()->Shape(),
+                                                       pad->GetPadding(), pad->GetOptions()));
+        return {};
+    }
+
+    MaybeError Graph::AddPool2d(const op::Pool2d* pool2d) {
+        DAWN_TRY(ValidateFloat32(pool2d, "Pool2d"));
+        const OperandBase* input = pool2d->Inputs()[0];
+        uint32_t output = AddTensor(pool2d->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<Pool2dKernel>(
+            GetTensorId(input), output, pool2d->GetType(), input->Shape(),
+            pool2d->PrimaryOutput()->Shape(), pool2d->GetOptions()));
+        return {};
+    }
+
+    MaybeError Graph::AddQuantize(const op::Quantize* quantize) {
+        auto& inputs = quantize->Inputs();
+        const OperandBase* outputOperand = quantize->PrimaryOutput();
+        uint32_t output = AddTensor(outputOperand, TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<QuantizeKernel>(
+            GetTensorId(inputs[0]), GetTensorId(inputs[1]),
+            GetTensorId(inputs[2]), output, quantize->GetType(), inputs[0]->Type(),
+            outputOperand->Type(), inputs[0]->Shape(), inputs[1]->Shape()));
+        return {};
+    }
+
+    MaybeError Graph::AddReduce(const op::Reduce* reduce) {
+        DAWN_TRY(ValidateFloat32(reduce, "Reduce"));
+        const OperandBase* input = reduce->Inputs()[0];
+        const ReduceOptions* options = reduce->GetOptions();
+        std::vector<int32_t> axes(options->axes, options->axes + options->axesCount);
+        uint32_t output = AddTensor(reduce->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<ReduceKernel>(GetTensorId(input), output,
+                                                          reduce->GetType(), input->Shape(),
+                                                          axes));
+        return {};
+    }
+
+    MaybeError Graph::AddResample2d(const op::Resample2d* resample2d) {
+        DAWN_TRY(ValidateFloat32(resample2d, "Resample2d"));
+        const OperandBase* input = resample2d->Inputs()[0];
+        std::vector<int32_t> axes = resample2d->GetAxes();
+        if (axes.size() != 2 || axes[1] != axes[0] + 1) {
+            return DAWN_UNIMPLEMENTED_ERROR("Resample2d only supports two consecutive axes.");
+        }
+        uint32_t output = AddTensor(resample2d->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<Resample2dKernel>(
+            GetTensorId(input), output, resample2d->GetOptions()->mode, input->Shape(),
+            resample2d->PrimaryOutput()->Shape(), axes));
+        return {};
+    }
+
+    MaybeError Graph::AddReshape(const op::Reshape* reshape) {
+        // The tensors are densely packed, the output is the input tensor read with another
+        // shape, see MemoryPlan.
+        mTensorIds[reshape->PrimaryOutput()] = GetTensorId(reshape->Inputs()[0]);
+        return {};
+    }
+
+    MaybeError Graph::AddSlice(const op::Slice* slice) {
+        const OperandBase* input = slice->Inputs()[0];
+        uint32_t output = AddTensor(slice->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<SliceKernel>(
+            GetTensorId(input), output, GetOperandTypeSize(mTensors[output].type),
+            input->Shape(), slice->PrimaryOutput()->Shape(), slice->GetOffsets()));
+        return {};
+    }
+
+    MaybeError Graph::AddSplit(const op::Split* split) {
+        const OperandBase* input = split->Inputs()[0];
+        std::vector<uint32_t> outputs;
+        std::vector<std::vector<int32_t>> outputShapes;
+        for (auto& output : split->Outputs()) {
+            outputs.push_back(AddTensor(output, TensorKind::Intermediate));
+            outputShapes.push_back(output->Shape());
+        }
+        int32_t axis = split->GetAxis();
+        if (axis < 0) {
+            axis += input->Shape().size();
+        }
+        size_t elementSize = GetOperandTypeSize(mTensors[outputs[0]].type);
+        mKernels.push_back(std::make_unique<SplitKernel>(GetTensorId(input), std::move(outputs),
+                                                         elementSize, outputShapes, axis));
+        return {};
+    }
+
+    MaybeError Graph::AddSqueeze(const op::Squeeze* squeeze) {
+        // The output is a view of the input as for Reshape.
+        mTensorIds[squeeze->PrimaryOutput()] = GetTensorId(squeeze->Inputs()[0]);
+        return {};
+    }
+
+    MaybeError Graph::AddTranspose(const op::Transpose* transpose) {
+        const OperandBase* input = transpose->Inputs()[0];
+        uint32_t output = AddTensor(transpose->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<TransposeKernel>(
+            GetTensorId(input), output, GetOperandTypeSize(mTensors[output].type),
+            input->Shape(), transpose->GetPermutation()));
+        return {};
+    }
+
+    MaybeError Graph::AddUnary(const op::Unary* unary) {
+        DAWN_TRY(ValidateFloat32(unary, "Unary"));
+        const OperandBase* input = unary->Inputs()[0];
+        if (unary->GetType() == op::UnaryOpType::kSoftmax && input->Shape().size() != 2) {
+            return DAWN_UNIMPLEMENTED_ERROR("Softmax only supports 2-D input.");
+        }
+        float alpha = 0;
+        if (unary->GetType() == op::UnaryOpType::kLeakyRelu) {
+            alpha = reinterpret_cast<const op::LeakyRelu*>(unary)->GetAlpha();
+        }
+        uint32_t output = AddTensor(unary->PrimaryOutput(), TensorKind::Intermediate);
+        mKernels.push_back(std::make_unique<UnaryKernel>(GetTensorId(input), output,
+                                                         unary->GetType(), input->Shape(),
+                                                         alpha));
+        return {};
+    }
+
+    MaybeError Graph::Finish() {
+        if (mInputs.empty()) {
+            return DAWN_VALIDATION_ERROR("Model inputs must be set.");
+        }
+        return {};
+    }
+
+    MaybeError Graph::CompileImpl() {
+        TRACE_EVENT0(GetDevice()->GetPlatform(), General, "cpu::Graph::CompileImpl");
+        // The intermediate tensors are placed by the memory plan of the graph, so the ones
+        // with disjoint lifetimes share the scratch memory.
+        mScratchSize = GetMemoryPlan().GetSize() + mExtraScratchSize;
+        BuildKernelGraph();
+
+        std::vector<void*> constantData(mTensors.size(), nullptr);
+        for (size_t i = 0; i < mTensors.size(); ++i) {
+            if (mTensors[i].kind == TensorKind::Constant) {
+                constantData[i] = GetConstantData(mTensors[i]);
+            }
+        }
+        ExecutionContext constants(mThreadPool.get(), std::move(constantData));
+        auto prepareKernels = [&]() {
+            for (auto& kernel : mKernels) {
+                kernel->Prepare(constants);
+            }
+        };
+
+        PersistentCacheKey key = GetCacheKey();
+        if (key.empty()) {
+            prepareKernels();
+            ReleasePreparedConstants();
+            return {};
+        }
+        // The weights are packed for the micro kernels of the SIMD level, in float16 or not.
+        key.push_back(static_cast<uint8_t>(GetSimdLevel()));
+#if defined(DAWN_ENABLE_CPU_FLOAT16_WEIGHTS)
+        key.push_back(1);
+#else
+        key.push_back(0);
+#endif
+        ScopedCachedBlob blob;
+        DAWN_TRY_ASSIGN(blob, GetDevice()->GetPersistentCache()->GetOrCreate(
+                                  key, [&](auto doCache) -> MaybeError {
+                                      prepareKernels();
+                                      PreparedDataWriter writer;
+                                      for (auto& kernel : mKernels) {
+                                          kernel->SerializePrepared(&writer);
+                                      }
+                                      if (!writer.GetData().empty()) {
+                                          doCache(writer.GetData().data(),
+                                                  writer.GetData().size());
+                                      }
+                                      return {};
+                                  }));
+        if (blob.bufferSize > 0) {
+            PreparedDataReader reader(blob.buffer.get(), blob.bufferSize);
+            bool restored = true;
+            for (auto& kernel : mKernels) {
+                restored = restored && kernel->DeserializePrepared(&reader);
+            }
+            if (!restored || !reader.IsEnd()) {
+                // The cached entry doesn't match the kernels, prepare them again.
+                prepareKernels();
+            }
+        }
+        ReleasePreparedConstants();
+        return {};
+    }
+
+    void Graph::BuildKernelGraph() {
+        // The intermediate tensors overlapping in the scratch memory: the views of a tensor,
+        // the tensors computed in place of another or in a Concat output, and the tensors whose
+        // memory is reused once they are dead.
+        std::vector<uint32_t> intermediates;
+        for (uint32_t id = 0; id < mTensors.size(); ++id) {
+            if (mTensors[id].kind == TensorKind::Intermediate && mTensors[id].byteSize != 0) {
+                intermediates.push_back(id);
+            }
+        }
+        std::sort(intermediates.begin(), intermediates.end(), [this](uint32_t a, uint32_t b) {
+            return mTensors[a].offset < mTensors[b].offset;
+        });
+        std::vector<std::vector<uint32_t>> aliases(mTensors.size());
+        for (size_t i = 0; i < intermediates.size(); ++i) {
+            const Tensor& tensor = mTensors[intermediates[i]];
+            for (size_t j = i + 1; j < intermediates.size(); ++j) {
+                if (mTensors[intermediates[j]].offset >= tensor.offset + tensor.byteSize) {
+                    break;
+                }
+                aliases[intermediates[i]].push_back(intermediates[j]);
+                aliases[intermediates[j]].push_back(intermediates[i]);
+            }
+        }
+
+        constexpr uint32_t kNoKernel = std::numeric_limits<uint32_t>::max();
+        std::vector<uint32_t> lastWriters(mTensors.size(), kNoKernel);
+        std::vector<std::vector<uint32_t>> readers(mTensors.size());
+        std::vector<std::vector<uint32_t>> dependencies(mKernels.size());
+        for (uint32_t k = 0; k < mKernels.size(); ++k) {
+            std::vector<uint32_t>& kernelDependencies = dependencies[k];
+            auto addWriter = [&](uint32_t tensor) {
+                if (lastWriters[tensor] != kNoKernel) {
+                    kernelDependencies.push_back(lastWriters[tensor]);
+                }
+            };
+            for (uint32_t input : mKernels[k]->Inputs()) {
+                addWriter(input);
+                for (uint32_t alias : aliases[input]) {
+                    addWriter(alias);
+                }
+            }
+            for (uint32_t output : mKernels[k]->Outputs()) {
+                addWriter(output);
+                kernelDependencies.insert(kernelDependencies.end(), readers[output].begin(),
+                                          readers[output].end());
+                for (uint32_t alias : aliases[output]) {
+                    addWriter(alias);
+                    kernelDependencies.insert(kernelDependencies.end(), readers[alias].begin(),
+                                              readers[alias].end());
+                }
+            }
+            std::sort(kernelDependencies.begin(), kernelDependencies.end());
+            kernelDependencies.erase(
+                std::unique(kernelDependencies.begin(), kernelDependencies.end()),
+                kernelDependencies.end());
+            kernelDependencies.erase(
+                std::remove(kernelDependencies.begin(), kernelDependencies.end(), k),
+                kernelDependencies.end());
+
+            for (uint32_t input : mKernels[k]->Inputs()) {
+                readers[input].push_back(k);
+            }
+            for (uint32_t output : mKernels[k]->Outputs()) {
+                lastWriters[output] = k;
+                readers[output].clear();
+            }
+        }
+
+        mKernelGraph.dependencyCounts.assign(mKernels.size(), 0);
+        mKernelGraph.dependentOffsets.assign(mKernels.size() + 1, 0);
+        for (uint32_t k = 0; k < mKernels.size(); ++k) {
+            mKernelGraph.dependencyCounts[k] = dependencies[k].size();
+            for (uint32_t dependency : dependencies[k]) {
+                mKernelGraph.dependentOffsets[dependency + 1]++;
+            }
+        }
+        for (size_t k = 0; k < mKernels.size(); ++k) {
+            mKernelGraph.dependentOffsets[k + 1] += mKernelGraph.dependentOffsets[k];
+        }
+        mKernelGraph.dependents.resize(mKernelGraph.dependentOffsets.back());
+        std::vector<uint32_t> dependentCounts(mKernels.size(), 0);
+        for (uint32_t k = 0; k < mKernels.size(); ++k) {
+            for (uint32_t dependency : dependencies[k]) {
+                mKernelGraph.dependents[mKernelGraph.dependentOffsets[dependency] +
+                                        dependentCounts[dependency]++] = k;
+            }
+        }
+    }
+
+    void Graph::ReleasePreparedConstants() {
+        std::vector<bool> isRead(mTensors.size(), false);
+        for (auto& kernel : mKernels) {
+            const std::vector<uint32_t>& inputs = kernel->Inputs();
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                if (!kernel->IsInputPrepared(i)) {
+                    isRead[inputs[i]] = true;
+                }
+            }
+        }
+        for (auto& output : mOutputs) {
+            isRead[output.second] = true;
+        }
+        std::vector<uint8_t> constantData;
+        for (size_t i = 0; i < mTensors.size(); ++i) {
+            Tensor& tensor = mTensors[i];
+            if (tensor.kind != TensorKind::Constant || tensor.hostData != nullptr) {
+                continue;
+            }
+            if (!isRead[i]) {
+                tensor.released = true;
+                continue;
+            }
+            size_t offset = Align(constantData.size(), kTensorAlignment);
+            constantData.resize(offset + tensor.byteSize);
+            memcpy(constantData.data() + offset, mConstantData.data() + tensor.offset,
+                   tensor.byteSize);
+            tensor.offset = offset;
+        }
+        mConstantData = std::move(constantData);
+    }
+
+    uint64_t Graph::GetByteCount(const Kernel& kernel) const {
+        uint64_t byteCount = 0;
+        for (uint32_t id : kernel.Inputs()) {
+            byteCount += mTensors[id].byteSize;
+        }
+        for (uint32_t id : kernel.Outputs()) {
+            byteCount += mTensors[id].byteSize;
+        }
+        return byteCount;
+    }
+
+    MaybeError Graph::ComputeImpl(NamedResourcesBase* inputs, NamedResourcesBase* outputs) {
+        dawn::platform::Platform* platform = GetDevice()->GetPlatform();
+        TRACE_EVENT0(platform, General, "cpu::Graph::ComputeImpl");
+        std::unique_ptr<uint8_t[]> scratch(new uint8_t[std::max<size_t>(mScratchSize, 1)]);
+        std::vector<void*> tensorData(mTensors.size(), nullptr);
+        for (size_t i = 0; i < mTensors.size(); ++i) {
+            const Tensor& tensor = mTensors[i];
+            if (tensor.kind == TensorKind::Constant) {
+                tensorData[i] = GetConstantData(tensor);
+            } else if (tensor.kind == TensorKind::Intermediate) {
+                tensorData[i] = scratch.get() + tensor.offset;
+            }
+        }
+
+        for (auto& input : mInputs) {
+            uint8_t* data;
+            DAWN_TRY(GetResourcePointer(inputs, input.first, mTensors[input.second].byteSize,
+                                        &data));
+            // All the inputs must be set.
+            if (data == nullptr) {
+                return DAWN_VALIDATION_ERROR("The input must be set.");
+            }
+            tensorData[input.second] = data;
+        }
+
+        // The intermediate tensors that are outputs are computed in place in the output buffers,
+        // the other outputs are copied once all the kernels have run.
+        std::vector<std::pair<uint32_t, uint8_t*>> outputCopies;
+        std::vector<bool> redirected(mTensors.size(), false);
+        for (auto& output : mOutputs) {
+            uint32_t id = output.second;
+            uint8_t* data;
+            DAWN_TRY(GetResourcePointer(outputs, output.first, mTensors[id].byteSize, &data));
+            if (data == nullptr) {
+                continue;
+            }
+            if (mTensors[id].kind == TensorKind::Intermediate && !redirected[id]) {
+                tensorData[id] = data;
+                redirected[id] = true;
+            } else {
+                outputCopies.push_back(std::make_pair(id, data));
+            }
+        }
+
+        ExecutionContext context(mThreadPool.get(), std::move(tensorData));
+        bool profiling = IsProfilingEnabled();
+        std::vector<ProfiledOperator> profile(profiling ? mKernels.size() : 0);
+        mThreadPool->RunGraph(mKernelGraph, [&](uint32_t index) {
+            const Kernel& kernel = *mKernels[index];
+            TRACE_EVENT1(platform, General, kernel.GetName(), "variant", kernel.GetVariant());
+            if (!profiling) {
+                kernel.Compute(context);
+                return;
+            }
+            auto start = std::chrono::steady_clock::now();
+            kernel.Compute(context);
+            auto duration = std::chrono::steady_clock::now() - start;
+            profile[index] = {
+                kernel.GetName(), kernel.GetVariant(), kernel.GetOperationCount(),
+                GetByteCount(kernel),
+                static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())};
+        });
+        if (profiling) {
+            RecordProfile(profile);
+        }
+        for (auto& copy : outputCopies) {
+            memcpy(copy.second, context.GetData<uint8_t>(copy.first),
+                   mTensors[copy.first].byteSize);
+        }
+        return {};
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,139 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_GRAPH_CPU_H_
+#define WEBNN_NATIVE_CPU_GRAPH_CPU_H_
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "dawn/native/Graph.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+#include "dawn/native/cpu/KernelCPU.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+#include "dawn/native/ops/BatchNorm.h"
+#include "dawn/native/ops/Binary.h"
+#include "dawn/native/ops/Clamp.h"
+#include "dawn/native/ops/Concat.h"
+#include "dawn/native/ops/Constant.h"
+#include "dawn/native/ops/Conv2d.h"
+#include "dawn/native/ops/Gemm.h"
+#include "dawn/native/ops/Gru.h"
+#include "dawn/native/ops/Input.h"
+#include "dawn/native/ops/InstanceNorm.h"
+#include "dawn/native/ops/LeakyRelu.h"
+#include "dawn/native/ops/Pad.h"
+#include "dawn/native/ops/Pool2d.h"
+#include "dawn/native/ops/Quantize.h"
+#include "dawn/native/ops/Reduce.h"
+#include "dawn/native/ops/Resample2d.h"
+#include "dawn/native/ops/Reshape.h"
+#include "dawn/native/ops/Slice.h"
+#include "dawn/native/ops/Split.h"
+#include "dawn/native/ops/Squeeze.h"
+#include "dawn/native/ops/Transpose.h"
+#include "dawn/native/ops/Unary.h"
+
+namespace dawn::native { namespace cpu {
+
+    // A graph executed on the host by a list of kernels in topological order, the kernels that
+    // don't depend on each other run concurrently on the thread pool. The tensors are read from
+    // and written to host visible buffers, see BufferBase::GetHostVisiblePointer().
+    class Graph : public GraphBase {
+      public:
+        explicit Graph(DeviceBase* device);
+        ~Graph() override = default;
+
+        virtual MaybeError AddConstant(const op::Constant* constant) override;
+        virtual MaybeError AddInput(const op::Input* input) override;
+        virtual MaybeError AddOutput(const std::string& name, const OperandBase* output) override;
+        virtual MaybeError AddBatchNorm(const op::BatchNorm* batchNorm) override;
+        virtual MaybeError AddBinary(const op::Binary* binary) override;
+        virtual MaybeError AddClamp(const op::Clamp* clamp) override;
+        virtual MaybeError AddConcat(const op::Concat* concat) override;
+        virtual MaybeError AddConv2d(const op::Conv2d* conv2d) override;
+        virtual MaybeError AddGemm(const op::Gemm* gemm) override;
+        virtual MaybeError AddGru(const op::Gru* gru) override;
+        virtual MaybeError AddInstanceNorm(const op::InstanceNorm* instanceNorm) override;
+        virtual MaybeError AddPad(const op::Pad* pad) override;
+        virtual MaybeError AddPool2d(const op::Pool2d* pool2d) override;
+        virtual MaybeError AddQuantize(const op::Quantize* quantize) override;
+        virtual MaybeError AddReduce(const op::Reduce* reduce) override;
+        virtual MaybeError AddResample2d(const op::Resample2d* resample2d) override;
+        virtual MaybeError AddReshape(const op::Reshape* reshape) override;
+        virtual MaybeError AddSlice(const op::Slice* slice) override;
+        virtual MaybeError AddSplit(const op::Split* split) override;
+        virtual MaybeError AddSqueeze(const op::Squeeze* squeeze) override;
+        virtual MaybeError AddTranspose(const op::Transpose* transpose) override;
+        virtual MaybeError AddUnary(const op::Unary* unary) override;
+        virtual MaybeError Finish() override;
+
+        // The float16 intermediate operands are computed as float32.
+        size_t GetIntermediateElementSize(wgpu::OperandType type) const override;
+
+      private:
+        MaybeError CompileImpl() override;
+        MaybeError ComputeImpl(NamedResourcesBase* inputs, NamedResourcesBase* outputs) override;
+
+        enum class TensorKind { Constant, Input, Intermediate };
+        struct Tensor {
+            TensorKind kind;
+            wgpu::OperandType type;
+            std::vector<int32_t> shape;
+            size_t byteSize;
+            // The offset in mConstantData for a constant, in the scratch memory of a
+            // ComputeImpl() call for an intermediate.
+            size_t offset = 0;
+            // The data of a constant read in place instead of being copied to mConstantData.
+            const uint8_t* hostData = nullptr;
+            // Whether the data of the constant was released after the kernels prepared it.
+            bool released = false;
+        };
+
+        uint32_t AddTensor(const OperandBase* operand, TensorKind kind);
+        // Adds an intermediate tensor that has no operand, placed after the memory plan.
+        uint32_t AddScratchTensor(wgpu::OperandType type, const std::vector<int32_t>& shape);
+        uint32_t GetTensorId(const OperandBase* operand) const;
+        void* GetConstantData(const Tensor& tensor);
+        // Drops from mConstantData the constants only read by the kernels that prepared them.
+        void ReleasePreparedConstants();
+        // The bytes of the input and output tensors of |kernel|, reported in the profile.
+        uint64_t GetByteCount(const Kernel& kernel) const;
+        // Fills mKernelGraph with the kernels each kernel must wait for: the last writers of
+        // the tensors it reads, and the kernels that last accessed the scratch memory it
+        // writes, since the memory plan reuses the memory of the tensors no longer needed.
+        void BuildKernelGraph();
+
+        std::shared_ptr<ThreadPool> mThreadPool;
+        std::vector<Tensor> mTensors;
+        std::map<const OperandBase*, uint32_t> mTensorIds;
+        std::vector<uint8_t> mConstantData;
+        // Keep the memory of the constants read in place alive.
+        std::vector<Ref<RefCounted>> mConstantOwners;
+        std::vector<std::unique_ptr<Kernel>> mKernels;
+        // The dependencies between mKernels, the independent kernels run concurrently.
+        TaskGraph mKernelGraph;
+        std::map<std::string, uint32_t> mInputs;
+        std::map<std::string, uint32_t> mOutputs;
+        // The bytes of memory for the intermediate tensors of one ComputeImpl() call.
+        size_t mScratchSize = 0;
+        // The bytes of the tensors of AddScratchTensor().
+        size_t mExtraScratchSize = 0;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_GRAPH_CPU_H_
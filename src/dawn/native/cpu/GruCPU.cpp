@@ -0,0 +1,229 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/GruCPU.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    GruKernel::GruKernel(std::vector<uint32_t> inputs,
+                         std::vector<uint32_t> outputs,
+                         const std::vector<int32_t>& inputShape,
+                         int32_t hiddenSize,
+                         const GruOptions* options,
+                         bool halfPrecisionWeights)
+        : Kernel(std::move(inputs), std::move(outputs)),
+          mSteps(inputShape[0]),
+          mBatchSize(inputShape[1]),
+          mInputSize(inputShape[2]),
+          mHiddenSize(hiddenSize),
+          mDirections(options->direction == wgpu::RecurrentNetworkDirection::Both ? 2 : 1),
+          mBackward(options->direction == wgpu::RecurrentNetworkDirection::Backward),
+          mResetAfter(options->resetAfter),
+          mHasBias(options->bias != nullptr),
+          mHasRecurrentBias(options->recurrentBias != nullptr),
+          mHasInitialHiddenState(options->initialHiddenState != nullptr),
+          mReturnSequence(options->returnSequence),
+          mHalfPrecisionWeights(halfPrecisionWeights) {
+        bool zrn = options->layout == wgpu::RecurrentNetworkWeightLayout::Zrn;
+        mUpdateOffset = zrn ? 0 : mHiddenSize;
+        mResetOffset = zrn ? mHiddenSize : 0;
+    }
+
+    void GruKernel::PackWeights(const float* weight,
+                                const float* recurrentWeight,
+                                bool halfPrecision,
+                                std::vector<PackedWeights>* packed) const {
+        size_t gateSize = 3 * mHiddenSize;
+        packed->resize(mDirections);
+        for (size_t d = 0; d < mDirections; ++d) {
+            // The weights are [3 * hiddenSize, K] and are multiplied transposed.
+            const float* w = weight + d * gateSize * mInputSize;
+            const float* r = recurrentWeight + d * gateSize * mHiddenSize;
+            PackedWeights& weights = (*packed)[d];
+            weights.input.Pack(w, 1, mInputSize, mInputSize, gateSize, 1.0f, halfPrecision);
+            weights.updateReset.Pack(r, 1, mHiddenSize, mHiddenSize, 2 * mHiddenSize, 1.0f,
+                                     halfPrecision);
+            weights.newGate.Pack(r + 2 * mHiddenSize * mHiddenSize, 1, mHiddenSize, mHiddenSize,
+                                 mHiddenSize, 1.0f, halfPrecision);
+        }
+    }
+
+    void GruKernel::Prepare(const ExecutionContext& constants) {
+        const float* weight = constants.GetData<float>(mInputs[1]);
+        const float* recurrentWeight = constants.GetData<float>(mInputs[2]);
+        if (weight != nullptr && recurrentWeight != nullptr) {
+            PackWeights(weight, recurrentWeight, mHalfPrecisionWeights, &mPackedWeights);
+        }
+    }
+
+    void GruKernel::SerializePrepared(PreparedDataWriter* writer) const {
+        writer->Write<uint64_t>(mPackedWeights.size());
+        for (const PackedWeights& weights : mPackedWeights) {
+            writer->WritePackedMatrix(weights.input);
+            writer->WritePackedMatrix(weights.updateReset);
+            writer->WritePackedMatrix(weights.newGate);
+        }
+    }
+
+    bool GruKernel::DeserializePrepared(PreparedDataReader* reader) {
+        uint64_t count;
+        if (!reader->Read(&count) || (count != 0 && count != mDirections)) {
+            return false;
+        }
+        std::vector<PackedWeights> packedWeights(count);
+        for (PackedWeights& weights : packedWeights) {
+            if (!reader->ReadPackedMatrix(&weights.input) ||
+                !reader->ReadPackedMatrix(&weights.updateReset) ||
+                !reader->ReadPackedMatrix(&weights.newGate)) {
+                return false;
+            }
+        }
+        mPackedWeights = std::move(packedWeights);
+        return true;
+    }
+
+    void GruKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        size_t index = 3;
+        const float* bias = mHasBias ? context.GetData<float>(mInputs[index++]) : nullptr;
+        const float* recurrentBias =
+            mHasRecurrentBias ? context.GetData<float>(mInputs[index++]) : nullptr;
+        const float* initialHiddenState =
+            mHasInitialHiddenState ? context.GetData<float>(mInputs[index++]) : nullptr;
+        float* output = context.GetData<float>(mOutputs[0]);
+        float* sequence = mReturnSequence ? context.GetData<float>(mOutputs[1]) : nullptr;
+        ThreadPool* threadPool = context.GetThreadPool();
+        const ElementwiseFunctions& functions = GetElementwiseFunctions();
+
+        std::vector<PackedWeights> packedWeights;
+        const std::vector<PackedWeights>* weights = &mPackedWeights;
+        if (mPackedWeights.empty()) {
+            PackWeights(context.GetData<float>(mInputs[1]), context.GetData<float>(mInputs[2]),
+                        false, &packedWeights);
+            weights = &packedWeights;
+        }
+
+        size_t hiddenSize = mHiddenSize;
+        size_t gateSize = 3 * hiddenSize;
+        size_t stateSize = mBatchSize * hiddenSize;
+        // The gates of all the steps, which start from the input projections with the biases
+        // and accumulate the recurrent projections of their step.
+        std::vector<float> gates(mSteps * mBatchSize * gateSize);
+        std::vector<float> hidden(stateSize);
+        // The recurrent projection of the new gate, of the hidden state with resetAfter and
+        // of the hidden state multiplied by the reset gate otherwise.
+        std::vector<float> newGate(stateSize);
+        std::vector<float> resetHidden(mResetAfter ? 0 : stateSize);
+        std::vector<float> gateBias(gateSize);
+
+        for (size_t d = 0; d < mDirections; ++d) {
+            bool backward = d == 1 || mBackward;
+            const PackedWeights& packed = (*weights)[d];
+            // The recurrent bias of the new gate is multiplied by the reset gate with
+            // resetAfter, the other biases are all added to the input projections.
+            const float* newGateBias = mResetAfter && recurrentBias != nullptr
+                                           ? recurrentBias + d * gateSize + 2 * hiddenSize
+                                           : nullptr;
+            for (size_t i = 0; i < gateSize; ++i) {
+                gateBias[i] = bias != nullptr ? bias[d * gateSize + i] : 0.0f;
+                if (recurrentBias != nullptr && (!mResetAfter || i < 2 * hiddenSize)) {
+                    gateBias[i] += recurrentBias[d * gateSize + i];
+                }
+            }
+            size_t rows = mSteps * mBatchSize;
+            Sgemm(threadPool, rows, input, mInputSize, 1, packed.input, gates.data(), gateSize,
+                  false);
+            threadPool->ParallelFor(rows, [&](size_t begin, size_t end) {
+                for (size_t row = begin; row < end; ++row) {
+                    float* g = gates.data() + row * gateSize;
+                    for (size_t i = 0; i < gateSize; ++i) {
+                        g[i] += gateBias[i];
+                    }
+                }
+            });
+            if (initialHiddenState != nullptr) {
+                memcpy(hidden.data(), initialHiddenState + d * stateSize,
+                       stateSize * sizeof(float));
+            } else {
+                std::fill(hidden.begin(), hidden.end(), 0.0f);
+            }
+
+            for (size_t step = 0; step < mSteps; ++step) {
+                size_t t = backward ? mSteps - step - 1 : step;
+                float* stepGates = gates.data() + t * mBatchSize * gateSize;
+                Sgemm(threadPool, mBatchSize, hidden.data(), hiddenSize, 1, packed.updateReset,
+                      stepGates, gateSize, true);
+                if (mResetAfter) {
+                    Sgemm(threadPool, mBatchSize, hidden.data(), hiddenSize, 1, packed.newGate,
+                          newGate.data(), hiddenSize, false);
+                }
+                // z = sigmoid(...), r = sigmoid(...), and either r * (h * Rn + Rbn) into the
+                // new gate or r * h for its recurrent projection.
+                threadPool->ParallelFor(mBatchSize, [&](size_t begin, size_t end) {
+                    for (size_t b = begin; b < end; ++b) {
+                        float* g = stepGates + b * gateSize;
+                        functions.unary(op::UnaryOpType::kSigmoid, g, g, 2 * hiddenSize, 0);
+                        const float* r = g + mResetOffset;
+                        float* n = g + 2 * hiddenSize;
+                        if (mResetAfter) {
+                            const float* hn = newGate.data() + b * hiddenSize;
+                            for (size_t i = 0; i < hiddenSize; ++i) {
+                                float recurrent =
+                                    newGateBias != nullptr ? hn[i] + newGateBias[i] : hn[i];
+                                n[i] += r[i] * recurrent;
+                            }
+                        } else {
+                            const float* h = hidden.data() + b * hiddenSize;
+                            float* rh = resetHidden.data() + b * hiddenSize;
+                            for (size_t i = 0; i < hiddenSize; ++i) {
+                                rh[i] = r[i] * h[i];
+                            }
+                        }
+                    }
+                });
+                if (!mResetAfter) {
+                    Sgemm(threadPool, mBatchSize, resetHidden.data(), hiddenSize, 1,
+                          packed.newGate, stepGates + 2 * hiddenSize, gateSize, true);
+                }
+                // n = tanh(...), h = (1 - z) * n + z * h
+                threadPool->ParallelFor(mBatchSize, [&](size_t begin, size_t end) {
+                    for (size_t b = begin; b < end; ++b) {
+                        float* g = stepGates + b * gateSize;
+                        float* n = g + 2 * hiddenSize;
+                        functions.unary(op::UnaryOpType::kTanh, n, n, hiddenSize, 0);
+                        const float* z = g + mUpdateOffset;
+                        float* h = hidden.data() + b * hiddenSize;
+                        for (size_t i = 0; i < hiddenSize; ++i) {
+                            h[i] = n[i] + z[i] * (h[i] - n[i]);
+                        }
+                    }
+                });
+                if (sequence != nullptr) {
+                    // The hidden states are in the order they were computed, as in
+                    // https://www.w3.org/TR/webnn/#api-mlgraphbuilder-gru.
+                    memcpy(sequence + (step * mDirections + d) * stateSize, hidden.data(),
+                           stateSize * sizeof(float));
+                }
+            }
+            memcpy(output + d * stateSize, hidden.data(), stateSize * sizeof(float));
+        }
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,93 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_GRU_CPU_H_
+#define WEBNN_NATIVE_CPU_GRU_CPU_H_
+
+#include "dawn/native/cpu/KernelCPU.h"
+#include "dawn/native/cpu/SgemmCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    // The GRU of op::Gru computed as fused cells. The input projections of all the steps are
+    // one matrix multiplication, then every step multiplies the hidden state by the recurrent
+    // weights and updates it in a single pass over the gates, so the small hidden state stays
+    // in the cache across the steps.
+    class GruKernel final : public Kernel {
+      public:
+        // The inputs are ordered as those of op::Gru. Constant weights are packed as float16
+        // with |halfPrecisionWeights|, see PackedMatrix::Pack().
+        GruKernel(std::vector<uint32_t> inputs,
+                  std::vector<uint32_t> outputs,
+                  const std::vector<int32_t>& inputShape,
+                  int32_t hiddenSize,
+                  const GruOptions* options,
+                  bool halfPrecisionWeights = false);
+
+        const char* GetName() const override {
+            return "Gru";
+        }
+        const char* GetVariant() const override {
+            return !mPackedWeights.empty() && mPackedWeights[0].input.IsHalfPrecision()
+                       ? "Float16Weights"
+                       : "";
+        }
+        uint64_t GetOperationCount() const override {
+            return 2 * static_cast<uint64_t>(mSteps) * mDirections * mBatchSize * 3 *
+                   mHiddenSize * (mInputSize + mHiddenSize);
+        }
+        void Prepare(const ExecutionContext& constants) override;
+        bool IsInputPrepared(size_t index) const override {
+            return (index == 1 || index == 2) && !mPackedWeights.empty();
+        }
+        void SerializePrepared(PreparedDataWriter* writer) const override;
+        bool DeserializePrepared(PreparedDataReader* reader) override;
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        // The transposed weights of a direction. The recurrent weights of the update and reset
+        // gates, which are the first 2 * hiddenSize rows in both layouts, are apart from those
+        // of the new gate that is multiplied by the reset gate.
+        struct PackedWeights {
+            PackedMatrix input;
+            PackedMatrix updateReset;
+            PackedMatrix newGate;
+        };
+        void PackWeights(const float* weight,
+                         const float* recurrentWeight,
+                         bool halfPrecision,
+                         std::vector<PackedWeights>* packed) const;
+
+        size_t mSteps;
+        size_t mBatchSize;
+        size_t mInputSize;
+        size_t mHiddenSize;
+        size_t mDirections;
+        bool mBackward;
+        bool mResetAfter;
+        bool mHasBias;
+        bool mHasRecurrentBias;
+        bool mHasInitialHiddenState;
+        bool mReturnSequence;
+        bool mHalfPrecisionWeights;
+        // The offsets of the update and reset gates in the 3 * hiddenSize gates.
+        size_t mUpdateOffset;
+        size_t mResetOffset;
+        // The weights of every direction packed by Prepare() when they are constants.
+        std::vector<PackedWeights> mPackedWeights;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_GRU_CPU_H_
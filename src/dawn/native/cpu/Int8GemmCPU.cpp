@@ -0,0 +1,243 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/Int8GemmCPU.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/KernelCPU.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The default number of micro kernel rows of a tile.
+        constexpr size_t kRowBlockPanels = 16;
+        // The largest mr of the micro kernels.
+        constexpr size_t kMaxMicroRows = 8;
+
+        constexpr size_t kScalarRows = 4;
+
+        void Int8GemmMicroKernelScalar(size_t kc,
+                                       const uint8_t* a,
+                                       size_t aRowStride,
+                                       const int8_t* b,
+                                       int32_t* c) {
+            int32_t sums[kScalarRows][kInt8GemmPanelWidth] = {};
+            for (size_t p = 0; p < kc; p += kInt8GemmDepthGroup) {
+                const int8_t* group = b + p * kInt8GemmPanelWidth;
+                for (size_t i = 0; i < kScalarRows; ++i) {
+                    const uint8_t* values = a + i * aRowStride + p;
+                    for (size_t j = 0; j < kInt8GemmPanelWidth; ++j) {
+                        for (size_t t = 0; t < kInt8GemmDepthGroup; ++t) {
+                            sums[i][j] += static_cast<int32_t>(values[t]) *
+                                          group[j * kInt8GemmDepthGroup + t];
+                        }
+                    }
+                }
+            }
+            memcpy(c, sums, sizeof(sums));
+        }
+
+        const Int8GemmMicroKernel kScalarInt8GemmMicroKernel = {kScalarRows, false,
+                                                                Int8GemmMicroKernelScalar};
+
+        const Int8GemmMicroKernel& SelectInt8GemmMicroKernel() {
+            if (HasInt8DotProduct()) {
+#if defined(WEBNN_CPU_X86)
+                return GetInt8GemmMicroKernelVNNI();
+#elif defined(WEBNN_CPU_ARM64)
+                return GetInt8GemmMicroKernelDotProd();
+#endif
+            }
+            return GetInt8GemmMicroKernelScalar();
+        }
+
+        // The rows of A at the bottom edge copied to a zero padded block of mr rows.
+        uint8_t* GetEdgeRowsBuffer(size_t size) {
+            thread_local std::vector<uint8_t> buffer;
+            if (buffer.size() < size) {
+                buffer.resize(size);
+            }
+            return buffer.data();
+        }
+    }  // anonymous namespace
+
+    const Int8GemmMicroKernel& GetInt8GemmMicroKernel() {
+        static const Int8GemmMicroKernel& kernel = SelectInt8GemmMicroKernel();
+        return kernel;
+    }
+
+    const Int8GemmMicroKernel& GetInt8GemmMicroKernelScalar() {
+        return kScalarInt8GemmMicroKernel;
+    }
+
+    size_t GetInt8GemmDepth(size_t k) {
+        return (k + kInt8GemmDepthGroup - 1) / kInt8GemmDepthGroup * kInt8GemmDepthGroup;
+    }
+
+    void PackedInt8Matrix::Pack(const uint8_t* b,
+                                size_t rowStride,
+                                size_t columnStride,
+                                size_t k,
+                                size_t n,
+                                uint8_t flip) {
+        mRows = k;
+        mColumns = n;
+        size_t depth = GetInt8GemmDepth(k);
+        size_t panelCount = (n + kInt8GemmPanelWidth - 1) / kInt8GemmPanelWidth;
+        mData.assign(std::max<size_t>(panelCount * depth * kInt8GemmPanelWidth, 1), 0);
+        for (size_t panel = 0; panel < panelCount; ++panel) {
+            size_t j0 = panel * kInt8GemmPanelWidth;
+            size_t columns = std::min(kInt8GemmPanelWidth, n - j0);
+            int8_t* packed = mData.data() + panel * depth * kInt8GemmPanelWidth;
+            for (size_t p = 0; p < k; ++p) {
+                const uint8_t* row = b + p * rowStride + j0 * columnStride;
+                int8_t* group = packed + p / kInt8GemmDepthGroup * kInt8GemmDepthGroup *
+                                             kInt8GemmPanelWidth;
+                for (size_t j = 0; j < columns; ++j) {
+                    group[j * kInt8GemmDepthGroup + p % kInt8GemmDepthGroup] =
+                        static_cast<int8_t>(row[j * columnStride] ^ flip);
+                }
+            }
+        }
+        ComputeColumnSums();
+    }
+
+    bool PackedInt8Matrix::SetData(size_t k, size_t n, std::vector<int8_t> data) {
+        size_t panelCount = (n + kInt8GemmPanelWidth - 1) / kInt8GemmPanelWidth;
+        if (data.size() !=
+            std::max<size_t>(panelCount * GetInt8GemmDepth(k) * kInt8GemmPanelWidth, 1)) {
+            return false;
+        }
+        mRows = k;
+        mColumns = n;
+        mData = std::move(data);
+        ComputeColumnSums();
+        return true;
+    }
+
+    void PackedInt8Matrix::ComputeColumnSums() {
+        // The padding is zero and doesn't change the sums.
+        size_t depth = GetInt8GemmDepth(mRows);
+        mColumnSums.assign(mColumns, 0);
+        for (size_t n = 0; n < mColumns; ++n) {
+            const int8_t* column = GetPanel(n / kInt8GemmPanelWidth) +
+                                   n % kInt8GemmPanelWidth * kInt8GemmDepthGroup;
+            int32_t sum = 0;
+            for (size_t p = 0; p < depth; p += kInt8GemmDepthGroup) {
+                for (size_t t = 0; t < kInt8GemmDepthGroup; ++t) {
+                    sum += column[p * kInt8GemmPanelWidth + t];
+                }
+            }
+            mColumnSums[n] = sum;
+        }
+    }
+
+    void Int8Gemm(ThreadPool* threadPool,
+                  size_t m,
+                  const uint8_t* a,
+                  size_t aRowStride,
+                  const int32_t* aRowSums,
+                  int32_t aZeroPoint,
+                  const PackedInt8Matrix& b,
+                  const int32_t* bZeroPoints,
+                  const Int8GemmOutput& output) {
+        const Int8GemmMicroKernel& kernel = GetInt8GemmMicroKernel();
+        size_t mr = kernel.mr;
+        DAWN_ASSERT(mr <= kMaxMicroRows);
+        size_t n = b.GetColumns();
+        size_t k = b.GetRows();
+        size_t depth = GetInt8GemmDepth(k);
+        size_t panelCount = (n + kInt8GemmPanelWidth - 1) / kInt8GemmPanelWidth;
+        if (m == 0 || panelCount == 0) {
+            return;
+        }
+
+        // Tiles of one panel and a block of rows, small enough to give every thread a few.
+        size_t minTileCount = threadPool->GetThreadCount() * 4;
+        size_t rowBlock = std::min((m + mr - 1) / mr, kRowBlockPanels) * mr;
+        while (((m + rowBlock - 1) / rowBlock) * panelCount < minTileCount && rowBlock > mr) {
+            rowBlock = (rowBlock / 2 + mr - 1) / mr * mr;
+        }
+        size_t rowTiles = (m + rowBlock - 1) / rowBlock;
+
+        const int32_t* columnSums = b.GetColumnSums().data();
+        int32_t outputMin = output.outputSigned ? -128 : 0;
+        int32_t outputMax = output.outputSigned ? 127 : 255;
+        threadPool->ParallelFor(rowTiles * panelCount, [&](size_t begin, size_t end) {
+            for (size_t tile = begin; tile < end; ++tile) {
+                size_t panel = tile % panelCount;
+                size_t j0 = panel * kInt8GemmPanelWidth;
+                size_t columns = std::min(kInt8GemmPanelWidth, n - j0);
+                size_t m0 = tile / panelCount * rowBlock;
+                size_t mEnd = std::min(m0 + rowBlock, m);
+                for (size_t i0 = m0; i0 < mEnd; i0 += mr) {
+                    size_t rows = std::min(mr, mEnd - i0);
+                    const uint8_t* aRows = a + i0 * aRowStride;
+                    size_t rowStride = aRowStride;
+                    if (rows < mr) {
+                        uint8_t* buffer = GetEdgeRowsBuffer(mr * depth);
+                        memset(buffer + rows * depth, 0, (mr - rows) * depth);
+                        for (size_t i = 0; i < rows; ++i) {
+                            memcpy(buffer + i * depth, aRows + i * aRowStride, depth);
+                        }
+                        aRows = buffer;
+                        rowStride = depth;
+                    }
+                    int32_t sums[kMaxMicroRows * kInt8GemmPanelWidth];
+                    kernel.function(depth, aRows, rowStride, b.GetPanel(panel), sums);
+
+                    float values[kInt8GemmPanelWidth];
+                    for (size_t i = 0; i < rows; ++i) {
+                        size_t row = i0 + i;
+                        for (size_t j = 0; j < columns; ++j) {
+                            size_t column = j0 + j;
+                            // sum((a - za) * (b - zb)), which may not fit in 32 bits.
+                            int64_t sum = static_cast<int64_t>(sums[i * kInt8GemmPanelWidth + j]) -
+                                          static_cast<int64_t>(bZeroPoints[column]) *
+                                              aRowSums[row] -
+                                          static_cast<int64_t>(aZeroPoint) * columnSums[column] +
+                                          static_cast<int64_t>(k) * aZeroPoint *
+                                              bZeroPoints[column];
+                            float value = output.scales[column] * static_cast<float>(sum);
+                            if (output.bias != nullptr) {
+                                value += output.biasScale *
+                                         output.bias[row * output.biasRowStride +
+                                                     column * output.biasColumnStride];
+                            }
+                            values[j] = value;
+                        }
+                        if (output.activation != nullptr) {
+                            output.activation->Apply(values, columns);
+                        }
+                        uint8_t* c = output.c + row * output.cRowStride;
+                        for (size_t j = 0; j < columns; ++j) {
+                            float q = std::nearbyint(values[j] / output.outputScale) +
+                                      output.outputZeroPoint;
+                            q = std::min(std::max(q, static_cast<float>(outputMin)),
+                                         static_cast<float>(outputMax));
+                            c[(j0 + j) * output.cColumnStride] =
+                                static_cast<uint8_t>(static_cast<int32_t>(q));
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,146 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_INT8_GEMM_CPU_H_
+#define WEBNN_NATIVE_CPU_INT8_GEMM_CPU_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "dawn/native/cpu/SimdCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    class FusedActivation;
+    class ThreadPool;
+
+    // The depth of the int8 GEMM is consumed in groups of this many values, the width of the
+    // dot product instructions.
+    constexpr size_t kInt8GemmDepthGroup = 4;
+    // The number of columns of the panels of B, shared by all the micro kernels so that the
+    // packed matrices don't depend on the CPU.
+    constexpr size_t kInt8GemmPanelWidth = 16;
+
+    // Computes one mr x kInt8GemmPanelWidth tile of C = A * B in int32. A holds mr rows of kc
+    // values with |aRowStride| bytes between them, read as int8 when |signedA| and as uint8
+    // otherwise. B is a panel of PackedInt8Matrix. kc is a multiple of kInt8GemmDepthGroup and
+    // C is written densely.
+    struct Int8GemmMicroKernel {
+        size_t mr;
+        bool signedA;
+        void (*function)(size_t kc,
+                         const uint8_t* a,
+                         size_t aRowStride,
+                         const int8_t* b,
+                         int32_t* c);
+    };
+
+    // The micro kernel using the int8 dot product instructions when the CPU has them.
+    const Int8GemmMicroKernel& GetInt8GemmMicroKernel();
+
+    const Int8GemmMicroKernel& GetInt8GemmMicroKernelScalar();
+#if defined(WEBNN_CPU_X86)
+    const Int8GemmMicroKernel& GetInt8GemmMicroKernelVNNI();
+#elif defined(WEBNN_CPU_ARM64)
+    const Int8GemmMicroKernel& GetInt8GemmMicroKernelDotProd();
+#endif
+
+    // Rounds |k| up to a multiple of kInt8GemmDepthGroup.
+    size_t GetInt8GemmDepth(size_t k);
+
+    // The int8 B operand of a quantized GEMM: panels of kInt8GemmPanelWidth columns, zero
+    // padded, storing the groups of kInt8GemmDepthGroup consecutive rows of every column
+    // together. The sums of the columns are kept for the zero point corrections.
+    class PackedInt8Matrix {
+      public:
+        // Packs B[K, N] read at b[k * rowStride + n * columnStride]. Every byte is XORed with
+        // |flip|, so 0x80 turns uint8 values into int8 values minus 128.
+        void Pack(const uint8_t* b,
+                  size_t rowStride,
+                  size_t columnStride,
+                  size_t k,
+                  size_t n,
+                  uint8_t flip);
+
+        bool IsEmpty() const {
+            return mData.empty();
+        }
+        size_t GetRows() const {
+            return mRows;
+        }
+        size_t GetColumns() const {
+            return mColumns;
+        }
+        const int8_t* GetPanel(size_t panel) const {
+            return mData.data() + panel * GetInt8GemmDepth(mRows) * kInt8GemmPanelWidth;
+        }
+        const std::vector<int32_t>& GetColumnSums() const {
+            return mColumnSums;
+        }
+
+        // The packed data, to store the matrix with the compiled graph in the persistent cache.
+        const std::vector<int8_t>& GetData() const {
+            return mData;
+        }
+        // Restores the |data| of a packed K x N matrix. Returns false when its size doesn't
+        // match.
+        bool SetData(size_t k, size_t n, std::vector<int8_t> data);
+
+      private:
+        void ComputeColumnSums();
+
+        size_t mRows = 0;
+        size_t mColumns = 0;
+        std::vector<int8_t> mData;
+        std::vector<int32_t> mColumnSums;
+    };
+
+    // How the int32 sums of a quantized GEMM become the quantized output C[M, N]:
+    //   C[m, n] = saturate(round(activation(scales[n] * sum[m, n] + bias) / outputScale) +
+    //                      outputZeroPoint)
+    // where sum[m, n] has the zero points of A and B subtracted from their values and bias is
+    // biasScale * bias[m * biasRowStride + n * biasColumnStride] when there is a bias.
+    struct Int8GemmOutput {
+        const float* scales;
+        const float* bias = nullptr;
+        size_t biasRowStride = 0;
+        size_t biasColumnStride = 0;
+        float biasScale = 1.0f;
+        const FusedActivation* activation = nullptr;
+        float outputScale = 1.0f;
+        int32_t outputZeroPoint = 0;
+        bool outputSigned = false;
+        uint8_t* c;
+        size_t cRowStride;
+        size_t cColumnStride = 1;
+    };
+
+    // Computes the quantized C[M, N] = A[M, K] * B on |threadPool|. The rows of A are read at
+    // a[m * aRowStride] as the values of GetInt8GemmMicroKernel().signedA, padded with zeros
+    // to GetInt8GemmDepth(K), and their sums are in |aRowSums|. |aZeroPoint| and the per
+    // column |bZeroPoints| are in the same representations as the values.
+    void Int8Gemm(ThreadPool* threadPool,
+                  size_t m,
+                  const uint8_t* a,
+                  size_t aRowStride,
+                  const int32_t* aRowSums,
+                  int32_t aZeroPoint,
+                  const PackedInt8Matrix& b,
+                  const int32_t* bZeroPoints,
+                  const Int8GemmOutput& output);
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_INT8_GEMM_CPU_H_
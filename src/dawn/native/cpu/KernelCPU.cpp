@@ -0,0 +1,181 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/KernelCPU.h"
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+#include "dawn/native/ops/Clamp.h"
+#include "dawn/native/ops/LeakyRelu.h"
+
+namespace dawn::native { namespace cpu {
+
+    std::vector<size_t> GetStrides(const std::vector<int32_t>& shape) {
+        std::vector<size_t> strides(shape.size());
+        size_t stride = 1;
+        for (size_t i = shape.size(); i-- > 0;) {
+            strides[i] = stride;
+            stride *= static_cast<size_t>(shape[i]);
+        }
+        return strides;
+    }
+
+    void PreparedDataWriter::WriteFloats(const std::vector<float>& values) {
+        Write<uint64_t>(values.size());
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values.data());
+        mData.insert(mData.end(), bytes, bytes + values.size() * sizeof(float));
+    }
+
+    void PreparedDataWriter::WriteHalfs(const std::vector<uint16_t>& values) {
+        Write<uint64_t>(values.size());
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values.data());
+        mData.insert(mData.end(), bytes, bytes + values.size() * sizeof(uint16_t));
+    }
+
+    void PreparedDataWriter::WritePackedMatrix(const PackedMatrix& matrix) {
+        Write<uint64_t>(matrix.GetRows());
+        Write<uint64_t>(matrix.GetColumns());
+        Write<uint8_t>(matrix.IsHalfPrecision());
+        if (matrix.IsHalfPrecision()) {
+            WriteHalfs(matrix.GetHalfData());
+        } else {
+            WriteFloats(matrix.GetData());
+        }
+    }
+
+    void PreparedDataWriter::WritePackedInt8Matrix(const PackedInt8Matrix& matrix) {
+        Write<uint64_t>(matrix.GetRows());
+        Write<uint64_t>(matrix.GetColumns());
+        const std::vector<int8_t>& data = matrix.GetData();
+        Write<uint64_t>(data.size());
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data.data());
+        mData.insert(mData.end(), bytes, bytes + data.size());
+    }
+
+    bool PreparedDataReader::ReadFloats(std::vector<float>* values) {
+        uint64_t count;
+        if (!Read(&count) || count > (mSize - mOffset) / sizeof(float)) {
+            return false;
+        }
+        values->resize(count);
+        memcpy(values->data(), mData + mOffset, count * sizeof(float));
+        mOffset += count * sizeof(float);
+        return true;
+    }
+
+    bool PreparedDataReader::ReadHalfs(std::vector<uint16_t>* values) {
+        uint64_t count;
+        if (!Read(&count) || count > (mSize - mOffset) / sizeof(uint16_t)) {
+            return false;
+        }
+        values->resize(count);
+        memcpy(values->data(), mData + mOffset, count * sizeof(uint16_t));
+        mOffset += count * sizeof(uint16_t);
+        return true;
+    }
+
+    bool PreparedDataReader::ReadPackedMatrix(PackedMatrix* matrix) {
+        uint64_t rows, columns;
+        uint8_t halfPrecision;
+        if (!Read(&rows) || !Read(&columns) || !Read(&halfPrecision)) {
+            return false;
+        }
+        if (halfPrecision) {
+            std::vector<uint16_t> data;
+            if (!ReadHalfs(&data)) {
+                return false;
+            }
+            if (data.empty()) {
+                *matrix = PackedMatrix();
+                return true;
+            }
+            return matrix->SetHalfData(rows, columns, std::move(data));
+        }
+        std::vector<float> data;
+        if (!ReadFloats(&data)) {
+            return false;
+        }
+        if (data.empty()) {
+            *matrix = PackedMatrix();
+            return true;
+        }
+        return matrix->SetData(rows, columns, std::move(data));
+    }
+
+    bool PreparedDataReader::ReadPackedInt8Matrix(PackedInt8Matrix* matrix) {
+        uint64_t rows, columns, size;
+        if (!Read(&rows) || !Read(&columns) || !Read(&size) || size > mSize - mOffset) {
+            return false;
+        }
+        std::vector<int8_t> data(size);
+        memcpy(data.data(), mData + mOffset, size);
+        mOffset += size;
+        if (data.empty()) {
+            *matrix = PackedInt8Matrix();
+            return true;
+        }
+        return matrix->SetData(rows, columns, std::move(data));
+    }
+
+    FusedActivation::FusedActivation(const FusionOperatorBase* activation) {
+        if (activation == nullptr) {
+            return;
+        }
+        mEnabled = true;
+        mType = activation->GetFusionType();
+        switch (mType) {
+            case FusionType::Clamp: {
+                auto clamp = static_cast<const op::FusionClamp*>(activation);
+                mMinValue = clamp->GetMinValue();
+                mMaxValue = clamp->GetMaxValue();
+                break;
+            }
+            case FusionType::LeakyRelu:
+                mAlpha = static_cast<const op::FusionLeakyRelu*>(activation)->GetAlpha();
+                break;
+            default:
+                break;
+        }
+    }
+
+    void FusedActivation::Apply(float* data, size_t count) const {
+        if (!mEnabled) {
+            return;
+        }
+        const ElementwiseFunctions& functions = GetElementwiseFunctions();
+        switch (mType) {
+            case FusionType::Clamp:
+                functions.clamp(data, data, count, mMinValue, mMaxValue);
+                break;
+            case FusionType::Relu:
+                functions.unary(op::UnaryOpType::kRelu, data, data, count, 0);
+                break;
+            case FusionType::Sigmoid:
+                functions.unary(op::UnaryOpType::kSigmoid, data, data, count, 0);
+                break;
+            case FusionType::LeakyRelu:
+                functions.unary(op::UnaryOpType::kLeakyRelu, data, data, count, mAlpha);
+                break;
+            case FusionType::HardSwish:
+                functions.unary(op::UnaryOpType::kHardSwish, data, data, count, 0);
+                break;
+            case FusionType::Tanh:
+                functions.unary(op::UnaryOpType::kTanh, data, data, count, 0);
+                break;
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,184 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_KERNEL_CPU_H_
+#define WEBNN_NATIVE_CPU_KERNEL_CPU_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "dawn/native/FusionOperator.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/cpu/Int8GemmCPU.h"
+#include "dawn/native/cpu/SgemmCPU.h"
+#include "dawn/native/dawn_platform.h"
+
+namespace dawn::native { namespace cpu {
+
+    class ThreadPool;
+
+    // The strides in elements of a densely packed tensor of |shape|.
+    std::vector<size_t> GetStrides(const std::vector<int32_t>& shape);
+
+    // The pointers to the memory of every tensor of the graph for one Compute() call, indexed by
+    // tensor id.
+    class ExecutionContext {
+      public:
+        ExecutionContext(ThreadPool* threadPool, std::vector<void*> tensorData)
+            : mThreadPool(threadPool), mTensorData(std::move(tensorData)) {
+        }
+
+        template <typename T>
+        T* GetData(uint32_t tensor) const {
+            return static_cast<T*>(mTensorData[tensor]);
+        }
+
+        ThreadPool* GetThreadPool() const {
+            return mThreadPool;
+        }
+
+      private:
+        ThreadPool* mThreadPool;
+        std::vector<void*> mTensorData;
+    };
+
+    // Writes the data the kernels compute in Prepare(), which is stored in the persistent cache
+    // with the compiled graph.
+    class PreparedDataWriter {
+      public:
+        template <typename T>
+        void Write(T value) {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            mData.insert(mData.end(), bytes, bytes + sizeof(T));
+        }
+        void WriteFloats(const std::vector<float>& values);
+        void WriteHalfs(const std::vector<uint16_t>& values);
+        void WritePackedMatrix(const PackedMatrix& matrix);
+        void WritePackedInt8Matrix(const PackedInt8Matrix& matrix);
+
+        const std::vector<uint8_t>& GetData() const {
+            return mData;
+        }
+
+      private:
+        std::vector<uint8_t> mData;
+    };
+
+    // Reads back the data of a PreparedDataWriter. Every read returns false when the data is
+    // truncated or doesn't match what the kernel expects.
+    class PreparedDataReader {
+      public:
+        PreparedDataReader(const uint8_t* data, size_t size) : mData(data), mSize(size) {
+        }
+
+        template <typename T>
+        bool Read(T* value) {
+            if (mSize - mOffset < sizeof(T)) {
+                return false;
+            }
+            memcpy(value, mData + mOffset, sizeof(T));
+            mOffset += sizeof(T);
+            return true;
+        }
+        bool ReadFloats(std::vector<float>* values);
+        bool ReadHalfs(std::vector<uint16_t>* values);
+        bool ReadPackedMatrix(PackedMatrix* matrix);
+        bool ReadPackedInt8Matrix(PackedInt8Matrix* matrix);
+
+        bool IsEnd() const {
+            return mOffset == mSize;
+        }
+
+      private:
+        const uint8_t* mData;
+        size_t mSize;
+        size_t mOffset = 0;
+    };
+
+    // The activation fused into Conv2d and BatchNorm through a FusionOperatorBase.
+    class FusedActivation {
+      public:
+        FusedActivation() = default;
+        explicit FusedActivation(const FusionOperatorBase* activation);
+
+        bool IsEnabled() const {
+            return mEnabled;
+        }
+        void Apply(float* data, size_t count) const;
+
+      private:
+        bool mEnabled = false;
+        FusionType mType = FusionType::Relu;
+        float mMinValue = 0;
+        float mMaxValue = 0;
+        float mAlpha = 0;
+    };
+
+    // A kernel computes one operator of the graph. It reads its input tensors and writes its
+    // output tensors through the ExecutionContext, and must not keep any per-call state so that
+    // a compiled graph can be computed from several threads at once.
+    class Kernel {
+      public:
+        Kernel(std::vector<uint32_t> inputs, std::vector<uint32_t> outputs)
+            : mInputs(std::move(inputs)), mOutputs(std::move(outputs)) {
+        }
+        virtual ~Kernel() = default;
+
+        virtual const char* GetName() const = 0;
+        // The variant of the kernel selected for the operator, e.g. the convolution algorithm,
+        // reported in the profile of the graph.
+        virtual const char* GetVariant() const {
+            return "";
+        }
+        // The arithmetic operations of one Compute(), a multiply-add counting as two. 0 for the
+        // kernels that mostly move data.
+        virtual uint64_t GetOperationCount() const {
+            return 0;
+        }
+        // Called once when the graph is compiled with only the data of the constant tensors
+        // in |constants|, the other tensors are nullptr. Kernels pre-process their constant
+        // inputs here, e.g. pack the weights.
+        virtual void Prepare(const ExecutionContext& constants) {
+        }
+        // Whether Compute() reads the input |index| from the data of Prepare() instead of its
+        // tensor, so that the graph can release the memory of a constant nothing else reads.
+        virtual bool IsInputPrepared(size_t index) const {
+            return false;
+        }
+        // Writes the data computed by Prepare() and reads it back in place of Prepare() when
+        // the compiled graph is loaded from the persistent cache.
+        virtual void SerializePrepared(PreparedDataWriter* writer) const {
+        }
+        virtual bool DeserializePrepared(PreparedDataReader* reader) {
+            return true;
+        }
+        virtual void Compute(const ExecutionContext& context) const = 0;
+
+        const std::vector<uint32_t>& Inputs() const {
+            return mInputs;
+        }
+        const std::vector<uint32_t>& Outputs() const {
+            return mOutputs;
+        }
+
+      protected:
+        std::vector<uint32_t> mInputs;
+        std::vector<uint32_t> mOutputs;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_KERNEL_CPU_H_
@@ -0,0 +1,167 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/NormalizationCPU.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    BatchNormKernel::BatchNormKernel(std::vector<uint32_t> inputs,
+                                     uint32_t output,
+                                     bool hasScale,
+                                     bool hasBias,
+                                     const std::vector<int32_t>& inputShape,
+                                     uint32_t axis,
+                                     float epsilon,
+                                     const FusionOperatorBase* activation)
+        : Kernel(std::move(inputs), {output}),
+          mHasScale(hasScale),
+          mHasBias(hasBias),
+          mOuterSize(1),
+          mChannels(inputShape[axis]),
+          mInnerSize(1),
+          mEpsilon(epsilon),
+          mActivation(activation) {
+        for (size_t i = 0; i < axis; ++i) {
+            mOuterSize *= inputShape[i];
+        }
+        for (size_t i = axis + 1; i < inputShape.size(); ++i) {
+            mInnerSize *= inputShape[i];
+        }
+    }
+
+    void BatchNormKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        const float* mean = context.GetData<float>(mInputs[1]);
+        const float* variance = context.GetData<float>(mInputs[2]);
+        const float* scale = mHasScale ? context.GetData<float>(mInputs[3]) : nullptr;
+        const float* bias = mHasBias ? context.GetData<float>(mInputs[mHasScale ? 4 : 3]) : nullptr;
+        float* output = context.GetData<float>(mOutputs[0]);
+
+        // y = (x - mean) * scale / sqrt(variance + epsilon) + bias = x * multiplier + addend
+        std::vector<float> multiplier(mChannels), addend(mChannels);
+        for (size_t c = 0; c < mChannels; ++c) {
+            multiplier[c] =
+                (scale != nullptr ? scale[c] : 1.0f) / std::sqrt(variance[c] + mEpsilon);
+            addend[c] = (bias != nullptr ? bias[c] : 0.0f) - mean[c] * multiplier[c];
+        }
+        context.GetThreadPool()->ParallelFor(mOuterSize * mChannels, [&](size_t begin, size_t end) {
+            for (size_t block = begin; block < end; ++block) {
+                size_t c = block % mChannels;
+                const float* x = input + block * mInnerSize;
+                float* y = output + block * mInnerSize;
+                for (size_t i = 0; i < mInnerSize; ++i) {
+                    y[i] = x[i] * multiplier[c] + addend[c];
+                }
+                mActivation.Apply(y, mInnerSize);
+            }
+        });
+    }
+
+    InstanceNormKernel::InstanceNormKernel(std::vector<uint32_t> inputs,
+                                           uint32_t output,
+                                           bool hasScale,
+                                           bool hasBias,
+                                           const std::vector<int32_t>& inputShape,
+                                           float epsilon,
+                                           wgpu::InputOperandLayout layout)
+        : Kernel(std::move(inputs), {output}),
+          mHasScale(hasScale),
+          mHasBias(hasBias),
+          mBatchSize(inputShape[0]),
+          mEpsilon(epsilon),
+          mChannelsLast(layout == wgpu::InputOperandLayout::Nhwc) {
+        mChannels = mChannelsLast ? inputShape[3] : inputShape[1];
+        mSpatialSize = mChannelsLast ? inputShape[1] * inputShape[2]
+                                     : inputShape[2] * inputShape[3];
+    }
+
+    void InstanceNormKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        const float* scale = mHasScale ? context.GetData<float>(mInputs[1]) : nullptr;
+        const float* bias = mHasBias ? context.GetData<float>(mInputs[mHasScale ? 2 : 1]) : nullptr;
+        float* output = context.GetData<float>(mOutputs[0]);
+        size_t instanceSize = mChannels * mSpatialSize;
+        // The mean and the variance are computed in two passes, which is more accurate than
+        // the sums of the values and their squares.
+        if (!mChannelsLast) {
+            context.GetThreadPool()->ParallelFor(
+                mBatchSize * mChannels, [&](size_t begin, size_t end) {
+                    for (size_t block = begin; block < end; ++block) {
+                        size_t c = block % mChannels;
+                        const float* x = input + block * mSpatialSize;
+                        float* y = output + block * mSpatialSize;
+                        float mean = 0;
+                        for (size_t i = 0; i < mSpatialSize; ++i) {
+                            mean += x[i];
+                        }
+                        mean /= mSpatialSize;
+                        float variance = 0;
+                        for (size_t i = 0; i < mSpatialSize; ++i) {
+                            variance += (x[i] - mean) * (x[i] - mean);
+                        }
+                        variance /= mSpatialSize;
+                        float multiplier = (scale != nullptr ? scale[c] : 1.0f) /
+                                           std::sqrt(variance + mEpsilon);
+                        float addend = (bias != nullptr ? bias[c] : 0.0f) - mean * multiplier;
+                        for (size_t i = 0; i < mSpatialSize; ++i) {
+                            y[i] = x[i] * multiplier + addend;
+                        }
+                    }
+                });
+            return;
+        }
+        // The channels are the contiguous dimension, the statistics of all of them are
+        // accumulated together over the spatial positions.
+        context.GetThreadPool()->ParallelFor(mBatchSize, [&](size_t begin, size_t end) {
+            std::vector<float> mean(mChannels), multiplier(mChannels), addend(mChannels);
+            for (size_t n = begin; n < end; ++n) {
+                const float* x = input + n * instanceSize;
+                float* y = output + n * instanceSize;
+                std::fill(mean.begin(), mean.end(), 0.0f);
+                std::fill(multiplier.begin(), multiplier.end(), 0.0f);
+                for (size_t i = 0; i < mSpatialSize; ++i) {
+                    for (size_t c = 0; c < mChannels; ++c) {
+                        mean[c] += x[i * mChannels + c];
+                    }
+                }
+                for (size_t c = 0; c < mChannels; ++c) {
+                    mean[c] /= mSpatialSize;
+                }
+                // |multiplier| holds the variance first.
+                for (size_t i = 0; i < mSpatialSize; ++i) {
+                    for (size_t c = 0; c < mChannels; ++c) {
+                        float difference = x[i * mChannels + c] - mean[c];
+                        multiplier[c] += difference * difference;
+                    }
+                }
+                for (size_t c = 0; c < mChannels; ++c) {
+                    multiplier[c] = (scale != nullptr ? scale[c] : 1.0f) /
+                                    std::sqrt(multiplier[c] / mSpatialSize + mEpsilon);
+                    addend[c] = (bias != nullptr ? bias[c] : 0.0f) - mean[c] * multiplier[c];
+                }
+                for (size_t i = 0; i < mSpatialSize; ++i) {
+                    for (size_t c = 0; c < mChannels; ++c) {
+                        y[i * mChannels + c] = x[i * mChannels + c] * multiplier[c] + addend[c];
+                    }
+                }
+            }
+        });
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,79 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_NORMALIZATION_CPU_H_
+#define WEBNN_NATIVE_CPU_NORMALIZATION_CPU_H_
+
+#include "dawn/native/cpu/KernelCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    class BatchNormKernel final : public Kernel {
+      public:
+        // The inputs are input, mean, variance and the optional scale and bias.
+        BatchNormKernel(std::vector<uint32_t> inputs,
+                        uint32_t output,
+                        bool hasScale,
+                        bool hasBias,
+                        const std::vector<int32_t>& inputShape,
+                        uint32_t axis,
+                        float epsilon,
+                        const FusionOperatorBase* activation);
+
+        const char* GetName() const override {
+            return "BatchNorm";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        bool mHasScale;
+        bool mHasBias;
+        size_t mOuterSize;
+        size_t mChannels;
+        size_t mInnerSize;
+        float mEpsilon;
+        FusedActivation mActivation;
+    };
+
+    // Normalizes every channel of every batch of a 4-D input by its own mean and variance over
+    // the spatial dimensions.
+    class InstanceNormKernel final : public Kernel {
+      public:
+        // The inputs are input and the optional scale and bias.
+        InstanceNormKernel(std::vector<uint32_t> inputs,
+                           uint32_t output,
+                           bool hasScale,
+                           bool hasBias,
+                           const std::vector<int32_t>& inputShape,
+                           float epsilon,
+                           wgpu::InputOperandLayout layout);
+
+        const char* GetName() const override {
+            return "InstanceNorm";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        bool mHasScale;
+        bool mHasBias;
+        size_t mBatchSize;
+        size_t mChannels;
+        size_t mSpatialSize;
+        float mEpsilon;
+        bool mChannelsLast;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_NORMALIZATION_CPU_H_
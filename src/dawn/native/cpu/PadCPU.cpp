@@ -0,0 +1,137 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/PadCPU.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // Maps the padded coordinate |i| into [0, size), or returns -1 for the constant mode.
+        int32_t MapPaddedIndex(int32_t i, int32_t size, wgpu::PaddingMode mode) {
+            if (i >= 0 && i < size) {
+                return i;
+            }
+            switch (mode) {
+                case wgpu::PaddingMode::Constant:
+                    return -1;
+                case wgpu::PaddingMode::Edge:
+                    return i < 0 ? 0 : size - 1;
+                case wgpu::PaddingMode::Reflection:
+                    return i < 0 ? -i : 2 * (size - 1) - i;
+                case wgpu::PaddingMode::Symmetric:
+                    return i < 0 ? -i - 1 : 2 * size - 1 - i;
+                default:
+                    DAWN_UNREACHABLE();
+            }
+        }
+    }  // anonymous namespace
+
+    PadKernel::PadKernel(uint32_t input,
+                         uint32_t output,
+                         const std::vector<int32_t>& inputShape,
+                         const std::vector<int32_t>& outputShape,
+                         const std::vector<uint32_t>& padding,
+                         const PadOptions* options)
+        : Kernel({input}, {output}), mMode(options->mode), mValue(options->value) {
+        // A dimension without padding merges into the previous one when that one has no
+        // padding either. With the constant mode the padding of the previous one scales
+        // instead, the other modes repeat whole sub-tensors that can't be merged.
+        for (size_t i = 0; i < inputShape.size(); ++i) {
+            int32_t before = padding[2 * i];
+            bool padded = outputShape[i] != inputShape[i];
+            if (!mInputShape.empty() && !padded &&
+                (mMode == wgpu::PaddingMode::Constant ||
+                 mOutputShape.back() == mInputShape.back())) {
+                mInputShape.back() *= inputShape[i];
+                mOutputShape.back() *= outputShape[i];
+                mPaddingBefore.back() *= inputShape[i];
+                continue;
+            }
+            mInputShape.push_back(inputShape[i]);
+            mOutputShape.push_back(outputShape[i]);
+            mPaddingBefore.push_back(before);
+        }
+        if (mInputShape.empty()) {
+            mInputShape = {1};
+            mOutputShape = {1};
+            mPaddingBefore = {0};
+        }
+        mInputStrides = GetStrides(mInputShape);
+    }
+
+    void PadKernel::PadRow(const float* x, float* y) const {
+        int32_t width = mInputShape.back();
+        int32_t before = mPaddingBefore.back();
+        int32_t after = mOutputShape.back() - width - before;
+        switch (mMode) {
+            case wgpu::PaddingMode::Constant:
+                std::fill(y, y + before, mValue);
+                std::fill(y + before + width, y + before + width + after, mValue);
+                break;
+            case wgpu::PaddingMode::Edge:
+                std::fill(y, y + before, x[0]);
+                std::fill(y + before + width, y + before + width + after, x[width - 1]);
+                break;
+            default:
+                for (int32_t i = 0; i < before; ++i) {
+                    y[i] = x[MapPaddedIndex(i - before, width, mMode)];
+                }
+                for (int32_t i = 0; i < after; ++i) {
+                    y[before + width + i] = x[MapPaddedIndex(width + i, width, mMode)];
+                }
+                break;
+        }
+        memcpy(y + before, x, width * sizeof(float));
+    }
+
+    void PadKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        float* output = context.GetData<float>(mOutputs[0]);
+        size_t rank = mOutputShape.size();
+        size_t rowSize = mOutputShape.back();
+        size_t rows = GetElementCount(mOutputShape) / rowSize;
+        context.GetThreadPool()->ParallelFor(
+            rows,
+            [&](size_t begin, size_t end) {
+                for (size_t row = begin; row < end; ++row) {
+                    float* y = output + row * rowSize;
+                    size_t offset = 0, index = row;
+                    bool inside = true;
+                    for (size_t d = rank - 1; d-- > 0;) {
+                        int32_t i = static_cast<int32_t>(index % mOutputShape[d]);
+                        index /= mOutputShape[d];
+                        i = MapPaddedIndex(i - mPaddingBefore[d], mInputShape[d], mMode);
+                        if (i < 0) {
+                            inside = false;
+                            break;
+                        }
+                        offset += i * mInputStrides[d];
+                    }
+                    if (inside) {
+                        PadRow(input + offset, y);
+                    } else {
+                        std::fill(y, y + rowSize, mValue);
+                    }
+                }
+            },
+            std::max<size_t>(1, 4096 / rowSize));
+    }
+
+}}  // namespace dawn::native::cpu
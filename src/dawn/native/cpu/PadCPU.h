@@ -0,0 +1,55 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_PAD_CPU_H_
+#define WEBNN_NATIVE_CPU_PAD_CPU_H_
+
+#include "dawn/native/cpu/KernelCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    // Pads the input row by row: the input values of an output row are copied as one run and
+    // the padding around them is filled, the rows outside of the input with the constant mode
+    // entirely. The adjacent dimensions without padding are merged into longer rows.
+    class PadKernel final : public Kernel {
+      public:
+        // |padding| holds the [beginning, ending] padding of every dimension as in op::Pad.
+        PadKernel(uint32_t input,
+                  uint32_t output,
+                  const std::vector<int32_t>& inputShape,
+                  const std::vector<int32_t>& outputShape,
+                  const std::vector<uint32_t>& padding,
+                  const PadOptions* options);
+
+        const char* GetName() const override {
+            return "Pad";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        // Pads the input row |x| to the output row |y|.
+        void PadRow(const float* x, float* y) const;
+
+        // The merged dimensions, the last one being the rows.
+        std::vector<int32_t> mInputShape;
+        std::vector<int32_t> mOutputShape;
+        std::vector<size_t> mInputStrides;
+        std::vector<int32_t> mPaddingBefore;
+        wgpu::PaddingMode mMode;
+        float mValue;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_PAD_CPU_H_
@@ -0,0 +1,269 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/Pool2dCPU.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+#include "dawn/native/ops/Conv2d.h"
+
+namespace dawn::native { namespace cpu {
+
+    Pool2dKernel::Pool2dKernel(uint32_t input,
+                               uint32_t output,
+                               op::Pool2dType type,
+                               const std::vector<int32_t>& inputShape,
+                               const std::vector<int32_t>& outputShape,
+                               const Pool2dOptions* options)
+        : Kernel({input}, {output}), mType(type), mFunctions(GetElementwiseFunctions()) {
+        switch (type) {
+            case op::Pool2dType::kAveragePool2d:
+                mReduceType = op::ReduceType::kReduceSum;
+                break;
+            case op::Pool2dType::kL2Pool2d:
+                mReduceType = op::ReduceType::kReduceL2;
+                break;
+            case op::Pool2dType::kMaxPool2d:
+                mReduceType = op::ReduceType::kReduceMax;
+                break;
+            default:
+                DAWN_UNREACHABLE();
+        }
+        bool nchw = options->layout == wgpu::InputOperandLayout::Nchw;
+        std::vector<size_t> inputStrides = GetStrides(inputShape);
+        std::vector<size_t> outputStrides = GetStrides(outputShape);
+        const size_t layout[4] = {0, nchw ? 1u : 3u, nchw ? 2u : 1u, nchw ? 3u : 2u};
+        for (size_t i = 0; i < 4; ++i) {
+            mParams.inputStrides[i] = inputStrides[layout[i]];
+            mParams.outputStrides[i] = outputStrides[layout[i]];
+        }
+        mParams.batches = inputShape[0];
+        mParams.inputChannels = inputShape[layout[1]];
+        mParams.inputHeight = inputShape[layout[2]];
+        mParams.inputWidth = inputShape[layout[3]];
+        mParams.outputChannels = outputShape[layout[1]];
+        mParams.outputHeight = outputShape[layout[2]];
+        mParams.outputWidth = outputShape[layout[3]];
+        mParams.groups = mParams.inputChannels;
+        if (options->windowDimensions != nullptr) {
+            mParams.filterHeight = options->windowDimensions[0];
+            mParams.filterWidth = options->windowDimensions[1];
+        } else {
+            mParams.filterHeight = mParams.inputHeight;
+            mParams.filterWidth = mParams.inputWidth;
+        }
+        mParams.strideHeight = options->strides[0];
+        mParams.strideWidth = options->strides[1];
+        mParams.dilationHeight = options->dilations[0];
+        mParams.dilationWidth = options->dilations[1];
+        mParams.paddingTop = options->padding[0];
+        mParams.paddingLeft = options->padding[2];
+        if (options->autoPad != wgpu::AutoPad::Explicit) {
+            int32_t paddingBottom, paddingRight;
+            op::ComputeImplicitPaddingForAutoPad(options->autoPad, mParams.dilationHeight,
+                                                 mParams.inputHeight, mParams.filterHeight,
+                                                 mParams.strideHeight, mParams.paddingTop,
+                                                 paddingBottom);
+            op::ComputeImplicitPaddingForAutoPad(options->autoPad, mParams.dilationWidth,
+                                                 mParams.inputWidth, mParams.filterWidth,
+                                                 mParams.strideWidth, mParams.paddingLeft,
+                                                 paddingRight);
+        }
+
+        mRowRanges.resize(mParams.outputHeight);
+        for (int32_t oh = 0; oh < mParams.outputHeight; ++oh) {
+            mRowRanges[oh] = GetWindowRange(oh * mParams.strideHeight - mParams.paddingTop,
+                                            mParams.dilationHeight, mParams.filterHeight,
+                                            mParams.inputHeight);
+        }
+        mColumnRanges.resize(mParams.outputWidth);
+        for (int32_t ow = 0; ow < mParams.outputWidth; ++ow) {
+            mColumnRanges[ow] = GetWindowRange(ow * mParams.strideWidth - mParams.paddingLeft,
+                                               mParams.dilationWidth, mParams.filterWidth,
+                                               mParams.inputWidth);
+        }
+        // The interior is contiguous since the window moves monotonically.
+        if (mParams.strideWidth == 1) {
+            mInteriorBegin = mParams.outputWidth;
+            for (int32_t ow = 0; ow < mParams.outputWidth; ++ow) {
+                if (mColumnRanges[ow].begin == 0 &&
+                    mColumnRanges[ow].end == mParams.filterWidth) {
+                    mInteriorBegin = std::min(mInteriorBegin, ow);
+                    mInteriorEnd = ow + 1;
+                }
+            }
+        }
+    }
+
+    Pool2dKernel::WindowRange Pool2dKernel::GetWindowRange(int32_t start,
+                                                           int32_t dilation,
+                                                           int32_t window,
+                                                           int32_t size) {
+        int32_t begin = start >= 0 ? 0 : (-start + dilation - 1) / dilation;
+        int32_t end = start >= size ? 0 : std::min(window, (size - 1 - start) / dilation + 1);
+        return {begin, std::max(begin, end)};
+    }
+
+    bool Pool2dKernel::IsChannelsLast() const {
+        return mParams.inputStrides[1] == 1 && mParams.outputStrides[1] == 1;
+    }
+
+    void Pool2dKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        float* output = context.GetData<float>(mOutputs[0]);
+        if (IsChannelsLast()) {
+            ComputeChannelsLast(context.GetThreadPool(), input, output);
+        } else {
+            ComputeRows(context.GetThreadPool(), input, output);
+        }
+    }
+
+    void Pool2dKernel::ComputeChannelsLast(ThreadPool* threadPool,
+                                           const float* input,
+                                           float* output) const {
+        const Conv2dParams& p = mParams;
+        float emptyValue =
+            mType == op::Pool2dType::kMaxPool2d ? std::numeric_limits<float>::lowest() : 0.0f;
+        threadPool->ParallelFor(
+            static_cast<size_t>(p.batches) * p.outputHeight, [&](size_t begin, size_t end) {
+                for (size_t task = begin; task < end; ++task) {
+                    int32_t n = task / p.outputHeight;
+                    int32_t oh = task % p.outputHeight;
+                    const WindowRange& rows = mRowRanges[oh];
+                    const float* x = input + n * p.inputStrides[0];
+                    float* y = output + n * p.outputStrides[0] + oh * p.outputStrides[2];
+                    for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                        const WindowRange& columns = mColumnRanges[ow];
+                        float* yw = y + ow * p.outputStrides[3];
+                        int32_t windowSize =
+                            (rows.end - rows.begin) * (columns.end - columns.begin);
+                        if (windowSize == 0) {
+                            std::fill(yw, yw + p.inputChannels, emptyValue);
+                            continue;
+                        }
+                        int32_t iw = ow * p.strideWidth - p.paddingLeft +
+                                     columns.begin * p.dilationWidth;
+                        for (int32_t kh = rows.begin; kh < rows.end; ++kh) {
+                            int32_t ih =
+                                oh * p.strideHeight - p.paddingTop + kh * p.dilationHeight;
+                            mFunctions.reduceColumns(
+                                mReduceType, x + ih * p.inputStrides[2] + iw * p.inputStrides[3],
+                                p.dilationWidth * p.inputStrides[3], yw,
+                                columns.end - columns.begin, p.inputChannels, kh != rows.begin);
+                        }
+                        Finalize(yw, p.inputChannels, windowSize);
+                    }
+                }
+            });
+    }
+
+    void Pool2dKernel::ComputeRows(ThreadPool* threadPool,
+                                   const float* input,
+                                   float* output) const {
+        const Conv2dParams& p = mParams;
+        DAWN_ASSERT(p.inputStrides[3] == 1 && p.outputStrides[3] == 1);
+        float emptyValue =
+            mType == op::Pool2dType::kMaxPool2d ? std::numeric_limits<float>::lowest() : 0.0f;
+        threadPool->ParallelFor(
+            static_cast<size_t>(p.batches) * p.inputChannels * p.outputHeight,
+            [&](size_t begin, size_t end) {
+                for (size_t task = begin; task < end; ++task) {
+                    int32_t oh = task % p.outputHeight;
+                    int32_t c = (task / p.outputHeight) % p.inputChannels;
+                    int32_t n = task / p.outputHeight / p.inputChannels;
+                    const float* x = input + n * p.inputStrides[0] + c * p.inputStrides[1];
+                    float* y = output + n * p.outputStrides[0] + c * p.outputStrides[1] +
+                               oh * p.outputStrides[2];
+                    for (int32_t ow = 0; ow < mInteriorBegin; ++ow) {
+                        y[ow] = PoolWindow(x, oh, ow);
+                    }
+                    for (int32_t ow = std::max(mInteriorBegin, mInteriorEnd);
+                         ow < p.outputWidth; ++ow) {
+                        y[ow] = PoolWindow(x, oh, ow);
+                    }
+                    if (mInteriorBegin >= mInteriorEnd) {
+                        continue;
+                    }
+                    // The output columns of the interior are contiguous in the input for each
+                    // position of the window, they are reduced as the columns of its rows.
+                    const WindowRange& rows = mRowRanges[oh];
+                    float* yw = y + mInteriorBegin;
+                    size_t count = mInteriorEnd - mInteriorBegin;
+                    if (rows.begin >= rows.end) {
+                        std::fill(yw, yw + count, emptyValue);
+                        continue;
+                    }
+                    int32_t iw = mInteriorBegin - p.paddingLeft;
+                    for (int32_t kh = rows.begin; kh < rows.end; ++kh) {
+                        int32_t ih = oh * p.strideHeight - p.paddingTop + kh * p.dilationHeight;
+                        mFunctions.reduceColumns(mReduceType, x + ih * p.inputStrides[2] + iw,
+                                                 p.dilationWidth, yw, p.filterWidth, count,
+                                                 kh != rows.begin);
+                    }
+                    Finalize(yw, count, (rows.end - rows.begin) * p.filterWidth);
+                }
+            });
+    }
+
+    float Pool2dKernel::PoolWindow(const float* x, int32_t oh, int32_t ow) const {
+        const Conv2dParams& p = mParams;
+        const WindowRange& rows = mRowRanges[oh];
+        const WindowRange& columns = mColumnRanges[ow];
+        float value =
+            mType == op::Pool2dType::kMaxPool2d ? std::numeric_limits<float>::lowest() : 0.0f;
+        int32_t windowSize = (rows.end - rows.begin) * (columns.end - columns.begin);
+        if (windowSize == 0) {
+            return value;
+        }
+        for (int32_t kh = rows.begin; kh < rows.end; ++kh) {
+            int32_t ih = oh * p.strideHeight - p.paddingTop + kh * p.dilationHeight;
+            for (int32_t kw = columns.begin; kw < columns.end; ++kw) {
+                int32_t iw = ow * p.strideWidth - p.paddingLeft + kw * p.dilationWidth;
+                float v = x[ih * p.inputStrides[2] + iw * p.inputStrides[3]];
+                switch (mType) {
+                    case op::Pool2dType::kAveragePool2d:
+                        value += v;
+                        break;
+                    case op::Pool2dType::kL2Pool2d:
+                        value += v * v;
+                        break;
+                    case op::Pool2dType::kMaxPool2d:
+                        value = std::max(value, v);
+                        break;
+                    default:
+                        DAWN_UNREACHABLE();
+                }
+            }
+        }
+        Finalize(&value, 1, windowSize);
+        return value;
+    }
+
+    void Pool2dKernel::Finalize(float* y, size_t count, int32_t windowSize) const {
+        // The padding values are not counted by the average.
+        if (mType == op::Pool2dType::kAveragePool2d) {
+            float scale = 1.0f / windowSize;
+            mFunctions.binary(op::BinaryOpType::kMul, y, 1, &scale, 0, y, count);
+        } else if (mType == op::Pool2dType::kL2Pool2d) {
+            for (size_t i = 0; i < count; ++i) {
+                y[i] = std::sqrt(y[i]);
+            }
+        }
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,85 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_POOL2D_CPU_H_
+#define WEBNN_NATIVE_CPU_POOL2D_CPU_H_
+
+#include "dawn/native/cpu/Conv2dCPU.h"
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+#include "dawn/native/ops/Pool2d.h"
+
+namespace dawn::native { namespace cpu {
+
+    // Pools each channel over the window. The index ranges of the window inside of the input
+    // are computed once per output row and column. With the channels innermost, each window
+    // position reduces a vector of channels. Otherwise the output columns whose window is
+    // inside of the input are reduced as vectors when the horizontal stride is 1.
+    class Pool2dKernel final : public Kernel {
+      public:
+        Pool2dKernel(uint32_t input,
+                     uint32_t output,
+                     op::Pool2dType type,
+                     const std::vector<int32_t>& inputShape,
+                     const std::vector<int32_t>& outputShape,
+                     const Pool2dOptions* options);
+
+        const char* GetName() const override {
+            return "Pool2d";
+        }
+        const char* GetVariant() const override {
+            return IsChannelsLast() ? "Channels" : "Rows";
+        }
+        uint64_t GetOperationCount() const override {
+            return static_cast<uint64_t>(mParams.batches) * mParams.outputChannels *
+                   mParams.outputHeight * mParams.outputWidth * mParams.filterHeight *
+                   mParams.filterWidth;
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        // The window indices [begin, end) that fall inside of the input.
+        struct WindowRange {
+            int32_t begin;
+            int32_t end;
+        };
+
+        // The indices of the window starting at |start| with |window| elements |dilation|
+        // apart that are inside of [0, size).
+        static WindowRange GetWindowRange(int32_t start,
+                                          int32_t dilation,
+                                          int32_t window,
+                                          int32_t size);
+        bool IsChannelsLast() const;
+        void ComputeChannelsLast(ThreadPool* threadPool, const float* input, float* output) const;
+        void ComputeRows(ThreadPool* threadPool, const float* input, float* output) const;
+        // The pooled value of one channel, whose plane starts at |x|.
+        float PoolWindow(const float* x, int32_t oh, int32_t ow) const;
+        // Turns the reduced values of windows of |windowSize| elements into the results.
+        void Finalize(float* y, size_t count, int32_t windowSize) const;
+
+        op::Pool2dType mType;
+        op::ReduceType mReduceType;
+        // The window is described by the filter dimensions, the channels are not mixed.
+        Conv2dParams mParams;
+        std::vector<WindowRange> mRowRanges;
+        std::vector<WindowRange> mColumnRanges;
+        // The output columns whose whole window is inside of the input.
+        int32_t mInteriorBegin = 0;
+        int32_t mInteriorEnd = 0;
+        const ElementwiseFunctions& mFunctions;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_POOL2D_CPU_H_
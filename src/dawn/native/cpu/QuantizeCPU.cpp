@@ -0,0 +1,533 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/QuantizeCPU.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The minimum number of elements handed to a thread by QuantizeKernel.
+        constexpr size_t kElementwiseGrainSize = 16384;
+
+        int32_t LoadInteger(const void* data, wgpu::OperandType type, size_t index) {
+            switch (type) {
+                case wgpu::OperandType::Int8:
+                    return static_cast<const int8_t*>(data)[index];
+                case wgpu::OperandType::Uint8:
+                    return static_cast<const uint8_t*>(data)[index];
+                case wgpu::OperandType::Int32:
+                    return static_cast<const int32_t*>(data)[index];
+                default:
+                    DAWN_UNREACHABLE();
+            }
+        }
+
+        // saturate(round(value / scale) + zeroPoint), rounding half to even.
+        uint8_t QuantizeValue(float value, float scale, int32_t zeroPoint, bool isSigned) {
+            float q = std::nearbyint(value / scale) + zeroPoint;
+            float low = isSigned ? -128.0f : 0.0f;
+            float high = isSigned ? 127.0f : 255.0f;
+            q = q >= low ? std::min(q, high) : low;
+            return static_cast<uint8_t>(static_cast<int32_t>(q));
+        }
+
+        // The value of a byte in the representation of the micro kernel.
+        int32_t DecodeValue(uint8_t value, bool isSigned) {
+            return isSigned ? static_cast<int8_t>(value) : value;
+        }
+
+        int32_t SumValues(const uint8_t* values, size_t count, bool isSigned) {
+            int32_t sum = 0;
+            if (isSigned) {
+                for (size_t i = 0; i < count; ++i) {
+                    sum += static_cast<int8_t>(values[i]);
+                }
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    sum += values[i];
+                }
+            }
+            return sum;
+        }
+
+        // Reads the |count| values of a row at |values| with |stride| between them and
+        // converts them with |flip| to |row|. Returns their sum.
+        int32_t ConvertRow(const uint8_t* values,
+                           size_t stride,
+                           size_t count,
+                           uint8_t flip,
+                           bool isSigned,
+                           uint8_t* row) {
+            for (size_t i = 0; i < count; ++i) {
+                row[i] = values[i * stride] ^ flip;
+            }
+            return SumValues(row, count, isSigned);
+        }
+    }  // anonymous namespace
+
+    QuantizeKernel::QuantizeKernel(uint32_t input,
+                                   uint32_t scale,
+                                   uint32_t zeroPoint,
+                                   uint32_t output,
+                                   op::QuantizeOpType opType,
+                                   wgpu::OperandType inputType,
+                                   wgpu::OperandType outputType,
+                                   const std::vector<int32_t>& inputShape,
+                                   const std::vector<int32_t>& scaleShape)
+        : Kernel({input, scale, zeroPoint}, {output}),
+          mOpType(opType),
+          mInputType(inputType),
+          mOutputType(outputType) {
+        mElementCount = 1;
+        for (int32_t dimension : inputShape) {
+            mElementCount *= dimension;
+        }
+        // Align the scale to the input from the right side.
+        size_t rank = inputShape.size();
+        std::vector<int32_t> alignedShape(rank, 1);
+        for (size_t i = 0; i < scaleShape.size(); ++i) {
+            alignedShape[rank - scaleShape.size() + i] = scaleShape[i];
+        }
+        // The trailing dimensions along which the scale is broadcast make up the blocks.
+        size_t blockRank = rank;
+        mBlockSize = 1;
+        while (blockRank > 0 && alignedShape[blockRank - 1] == 1) {
+            --blockRank;
+            mBlockSize *= inputShape[blockRank];
+        }
+        std::vector<size_t> scaleStrides = GetStrides(alignedShape);
+        for (size_t i = 0; i < blockRank; ++i) {
+            mBlockShape.push_back(inputShape[i]);
+            mBlockStrides.push_back(alignedShape[i] == 1 ? 0 : scaleStrides[i]);
+        }
+    }
+
+    void QuantizeKernel::Compute(const ExecutionContext& context) const {
+        if (mElementCount == 0) {
+            return;
+        }
+        const void* input = context.GetData<void>(mInputs[0]);
+        const float* scale = context.GetData<float>(mInputs[1]);
+        const void* zeroPoint = context.GetData<void>(mInputs[2]);
+        void* output = context.GetData<void>(mOutputs[0]);
+        wgpu::OperandType zeroPointType =
+            mOpType == op::QuantizeOpType::kQuantizeLinear ? mOutputType : mInputType;
+        bool outputSigned = mOutputType == wgpu::OperandType::Int8;
+
+        size_t blockCount = mElementCount / mBlockSize;
+        size_t grainSize = std::max<size_t>(kElementwiseGrainSize / mBlockSize, 1);
+        context.GetThreadPool()->ParallelFor(
+            blockCount,
+            [&](size_t begin, size_t end) {
+                for (size_t block = begin; block < end; ++block) {
+                    size_t offset = 0;
+                    for (size_t i = mBlockShape.size(), index = block; i-- > 0;) {
+                        offset += (index % mBlockShape[i]) * mBlockStrides[i];
+                        index /= mBlockShape[i];
+                    }
+                    float s = scale[offset];
+                    int32_t z = LoadInteger(zeroPoint, zeroPointType, offset);
+                    size_t first = block * mBlockSize;
+                    if (mOpType == op::QuantizeOpType::kQuantizeLinear) {
+                        const float* x = static_cast<const float*>(input) + first;
+                        uint8_t* y = static_cast<uint8_t*>(output) + first;
+                        for (size_t i = 0; i < mBlockSize; ++i) {
+                            y[i] = QuantizeValue(x[i], s, z, outputSigned);
+                        }
+                    } else {
+                        float* y = static_cast<float*>(output) + first;
+                        for (size_t i = 0; i < mBlockSize; ++i) {
+                            y[i] = (LoadInteger(input, mInputType, first + i) - z) * s;
+                        }
+                    }
+                }
+            },
+            grainSize);
+    }
+
+    Int8GemmQuantization::Int8GemmQuantization(const op::Quantization& quantization,
+                                               wgpu::OperandType inputType,
+                                               wgpu::OperandType filterType,
+                                               wgpu::OperandType outputType,
+                                               size_t channels,
+                                               float alpha) {
+        // The micro kernel reads A as uint8 or int8 and B as int8. Flipping the top bit turns
+        // int8 values into uint8 values plus 128 and uint8 values into int8 values minus 128.
+        bool kernelSigned = GetInt8GemmMicroKernel().signedA;
+        bool inputSigned = inputType == wgpu::OperandType::Int8;
+        inputFlip = inputSigned != kernelSigned ? 0x80 : 0;
+        inputZeroPoint = quantization.inputZeroPoint;
+        if (inputSigned && !kernelSigned) {
+            inputZeroPoint += 128;
+        } else if (!inputSigned && kernelSigned) {
+            inputZeroPoint -= 128;
+        }
+        bool filterSigned = filterType == wgpu::OperandType::Int8;
+        filterFlip = filterSigned ? 0 : 0x80;
+
+        DAWN_ASSERT(quantization.filterScales.size() == 1 ||
+                    quantization.filterScales.size() == channels);
+        bool perChannel = quantization.filterScales.size() != 1;
+        filterZeroPoints.resize(channels);
+        scales.resize(channels);
+        for (size_t c = 0; c < channels; ++c) {
+            size_t index = perChannel ? c : 0;
+            filterZeroPoints[c] = quantization.filterZeroPoints[index] - (filterSigned ? 0 : 128);
+            scales[c] = alpha * quantization.inputScale * quantization.filterScales[index];
+        }
+        outputScale = quantization.outputScale;
+        outputZeroPoint = quantization.outputZeroPoint;
+        outputSigned = outputType == wgpu::OperandType::Int8;
+    }
+
+    QuantizedGemmKernel::QuantizedGemmKernel(uint32_t a,
+                                             uint32_t b,
+                                             uint32_t c,
+                                             uint32_t output,
+                                             const std::vector<int32_t>& aShape,
+                                             const std::vector<int32_t>& bShape,
+                                             const std::vector<int32_t>& cShape,
+                                             const GemmOptions* options,
+                                             Int8GemmQuantization quantization)
+        : Kernel(cShape.empty() ? std::vector<uint32_t>{a, b} : std::vector<uint32_t>{a, b, c},
+                 {output}),
+          mBeta(options->beta),
+          mATranspose(options->aTranspose),
+          mBTranspose(options->bTranspose),
+          mHasC(!cShape.empty()),
+          mActivation(options->activation),
+          mQuantization(std::move(quantization)) {
+        mM = mATranspose ? aShape[1] : aShape[0];
+        mK = mATranspose ? aShape[0] : aShape[1];
+        mN = mBTranspose ? bShape[0] : bShape[1];
+        if (mHasC) {
+            // Align C to [M, N] from the right side.
+            std::vector<int32_t> alignedShape(2, 1);
+            for (size_t i = 0; i < cShape.size(); ++i) {
+                alignedShape[2 - cShape.size() + i] = cShape[i];
+            }
+            mCRowStride = alignedShape[0] == 1 ? 0 : alignedShape[1];
+            mCColumnStride = alignedShape[1] == 1 ? 0 : 1;
+        }
+    }
+
+    void QuantizedGemmKernel::PackB(const uint8_t* b, PackedInt8Matrix* packed) const {
+        packed->Pack(b, mBTranspose ? 1 : mN, mBTranspose ? mK : 1, mK, mN,
+                     mQuantization.filterFlip);
+    }
+
+    void QuantizedGemmKernel::Prepare(const ExecutionContext& constants) {
+        const uint8_t* b = constants.GetData<uint8_t>(mInputs[1]);
+        if (b != nullptr) {
+            PackB(b, &mPackedB);
+        }
+    }
+
+    void QuantizedGemmKernel::SerializePrepared(PreparedDataWriter* writer) const {
+        writer->WritePackedInt8Matrix(mPackedB);
+    }
+
+    bool QuantizedGemmKernel::DeserializePrepared(PreparedDataReader* reader) {
+        return reader->ReadPackedInt8Matrix(&mPackedB);
+    }
+
+    void QuantizedGemmKernel::Compute(const ExecutionContext& context) const {
+        const uint8_t* a = context.GetData<uint8_t>(mInputs[0]);
+        const float* c = mHasC ? context.GetData<float>(mInputs[2]) : nullptr;
+        uint8_t* output = context.GetData<uint8_t>(mOutputs[0]);
+        ThreadPool* threadPool = context.GetThreadPool();
+
+        PackedInt8Matrix packedB;
+        const PackedInt8Matrix* b = &mPackedB;
+        if (mPackedB.IsEmpty()) {
+            PackB(context.GetData<uint8_t>(mInputs[1]), &packedB);
+            b = &packedB;
+        }
+
+        // The rows of A' converted for the micro kernel and zero padded.
+        bool kernelSigned = GetInt8GemmMicroKernel().signedA;
+        size_t depth = GetInt8GemmDepth(mK);
+        size_t aRowStride = mATranspose ? 1 : mK;
+        size_t aColumnStride = mATranspose ? mM : 1;
+        std::vector<uint8_t> rows(mM * depth, 0);
+        std::vector<int32_t> rowSums(mM);
+        threadPool->ParallelFor(mM, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                rowSums[i] = ConvertRow(a + i * aRowStride, aColumnStride, mK,
+                                        mQuantization.inputFlip, kernelSigned,
+                                        rows.data() + i * depth);
+            }
+        });
+
+        Int8GemmOutput gemmOutput;
+        gemmOutput.scales = mQuantization.scales.data();
+        if (c != nullptr && mBeta != 0.0f) {
+            gemmOutput.bias = c;
+            gemmOutput.biasRowStride = mCRowStride;
+            gemmOutput.biasColumnStride = mCColumnStride;
+            gemmOutput.biasScale = mBeta;
+        }
+        gemmOutput.activation = mActivation.IsEnabled() ? &mActivation : nullptr;
+        gemmOutput.outputScale = mQuantization.outputScale;
+        gemmOutput.outputZeroPoint = mQuantization.outputZeroPoint;
+        gemmOutput.outputSigned = mQuantization.outputSigned;
+        gemmOutput.c = output;
+        gemmOutput.cRowStride = mN;
+        Int8Gemm(threadPool, mM, rows.data(), depth, rowSums.data(), mQuantization.inputZeroPoint,
+                 *b, mQuantization.filterZeroPoints.data(), gemmOutput);
+    }
+
+    QuantizedConv2dKernel::QuantizedConv2dKernel(uint32_t input,
+                                                 uint32_t filter,
+                                                 uint32_t bias,
+                                                 uint32_t output,
+                                                 bool hasBias,
+                                                 const std::vector<int32_t>& inputShape,
+                                                 const std::vector<int32_t>& filterShape,
+                                                 const std::vector<int32_t>& outputShape,
+                                                 const Conv2dOptions* options,
+                                                 Int8GemmQuantization quantization)
+        : Kernel(hasBias ? std::vector<uint32_t>{input, filter, bias}
+                         : std::vector<uint32_t>{input, filter},
+                 {output}),
+          mHasBias(hasBias),
+          mActivation(options->activation),
+          mQuantization(std::move(quantization)) {
+        mParams = GetConv2dParams(inputShape, filterShape, outputShape, options, mFilterStrides);
+    }
+
+    bool QuantizedConv2dKernel::IsDepthwise() const {
+        return mParams.groups == mParams.inputChannels &&
+               mParams.groups == mParams.outputChannels;
+    }
+
+    void QuantizedConv2dKernel::PackFilter(const uint8_t* filter,
+                                           std::vector<PackedInt8Matrix>* packed) const {
+        const Conv2dParams& p = mParams;
+        int32_t inputChannelsPerGroup = p.inputChannels / p.groups;
+        int32_t outputChannelsPerGroup = p.outputChannels / p.groups;
+        size_t depth =
+            static_cast<size_t>(p.filterHeight) * p.filterWidth * inputChannelsPerGroup;
+        // [H * W * I, O] in the order of the input patches gathered by ComputeIm2col().
+        std::vector<uint8_t> matrix(depth * outputChannelsPerGroup);
+        packed->resize(p.groups);
+        for (int32_t g = 0; g < p.groups; ++g) {
+            for (int32_t oc = 0; oc < outputChannelsPerGroup; ++oc) {
+                const uint8_t* w = filter + (g * outputChannelsPerGroup + oc) * mFilterStrides[0];
+                size_t k = 0;
+                for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                    for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                        for (int32_t ic = 0; ic < inputChannelsPerGroup; ++ic, ++k) {
+                            matrix[k * outputChannelsPerGroup + oc] =
+                                w[ic * mFilterStrides[1] + kh * mFilterStrides[2] +
+                                  kw * mFilterStrides[3]];
+                        }
+                    }
+                }
+            }
+            (*packed)[g].Pack(matrix.data(), outputChannelsPerGroup, 1, depth,
+                              outputChannelsPerGroup, mQuantization.filterFlip);
+        }
+    }
+
+    void QuantizedConv2dKernel::Prepare(const ExecutionContext& constants) {
+        const uint8_t* filter = constants.GetData<uint8_t>(mInputs[1]);
+        if (filter != nullptr && !IsDepthwise()) {
+            PackFilter(filter, &mPackedFilter);
+        }
+    }
+
+    void QuantizedConv2dKernel::SerializePrepared(PreparedDataWriter* writer) const {
+        writer->Write<uint64_t>(mPackedFilter.size());
+        for (const PackedInt8Matrix& matrix : mPackedFilter) {
+            writer->WritePackedInt8Matrix(matrix);
+        }
+    }
+
+    bool QuantizedConv2dKernel::DeserializePrepared(PreparedDataReader* reader) {
+        uint64_t count;
+        if (!reader->Read(&count) ||
+            (count != 0 && count != static_cast<uint64_t>(mParams.groups))) {
+            return false;
+        }
+        mPackedFilter.resize(count);
+        for (PackedInt8Matrix& matrix : mPackedFilter) {
+            if (!reader->ReadPackedInt8Matrix(&matrix)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void QuantizedConv2dKernel::Compute(const ExecutionContext& context) const {
+        const uint8_t* input = context.GetData<uint8_t>(mInputs[0]);
+        const uint8_t* filter = context.GetData<uint8_t>(mInputs[1]);
+        const float* bias = mHasBias ? context.GetData<float>(mInputs[2]) : nullptr;
+        uint8_t* output = context.GetData<uint8_t>(mOutputs[0]);
+        ThreadPool* threadPool = context.GetThreadPool();
+        if (IsDepthwise()) {
+            ComputeDepthwise(threadPool, input, filter, bias, output);
+            return;
+        }
+        if (mPackedFilter.empty()) {
+            std::vector<PackedInt8Matrix> packedFilter;
+            PackFilter(filter, &packedFilter);
+            ComputeIm2col(threadPool, input, packedFilter, bias, output);
+            return;
+        }
+        ComputeIm2col(threadPool, input, mPackedFilter, bias, output);
+    }
+
+    void QuantizedConv2dKernel::ComputeDepthwise(ThreadPool* threadPool,
+                                                 const uint8_t* input,
+                                                 const uint8_t* filter,
+                                                 const float* bias,
+                                                 uint8_t* output) const {
+        const Conv2dParams& p = mParams;
+        const Int8GemmQuantization& q = mQuantization;
+        bool kernelSigned = GetInt8GemmMicroKernel().signedA;
+        size_t rowCount = static_cast<size_t>(p.batches) * p.outputChannels * p.outputHeight;
+        threadPool->ParallelFor(rowCount, [&](size_t begin, size_t end) {
+            std::vector<float> values(p.outputWidth);
+            for (size_t rowIndex = begin; rowIndex < end; ++rowIndex) {
+                int32_t oh = rowIndex % p.outputHeight;
+                int32_t c = (rowIndex / p.outputHeight) % p.outputChannels;
+                int32_t n = rowIndex / p.outputHeight / p.outputChannels;
+                const uint8_t* x = input + n * p.inputStrides[0] + c * p.inputStrides[1];
+                const uint8_t* w = filter + c * mFilterStrides[0];
+                for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                    // The padding holds the zero point and adds nothing.
+                    int32_t sum = 0;
+                    for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                        int32_t ih = oh * p.strideHeight - p.paddingTop + kh * p.dilationHeight;
+                        if (ih < 0 || ih >= p.inputHeight) {
+                            continue;
+                        }
+                        for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                            int32_t iw =
+                                ow * p.strideWidth - p.paddingLeft + kw * p.dilationWidth;
+                            if (iw < 0 || iw >= p.inputWidth) {
+                                continue;
+                            }
+                            int32_t xValue =
+                                DecodeValue(x[ih * p.inputStrides[2] + iw * p.inputStrides[3]] ^
+                                                q.inputFlip,
+                                            kernelSigned) -
+                                q.inputZeroPoint;
+                            int32_t wValue =
+                                static_cast<int8_t>(
+                                    w[kh * mFilterStrides[2] + kw * mFilterStrides[3]] ^
+                                    q.filterFlip) -
+                                q.filterZeroPoints[c];
+                            sum += xValue * wValue;
+                        }
+                    }
+                    values[ow] = q.scales[c] * sum + (bias != nullptr ? bias[c] : 0.0f);
+                }
+                mActivation.Apply(values.data(), p.outputWidth);
+                uint8_t* y = output + n * p.outputStrides[0] + c * p.outputStrides[1] +
+                             oh * p.outputStrides[2];
+                for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                    y[ow * p.outputStrides[3]] =
+                        QuantizeValue(values[ow], q.outputScale, q.outputZeroPoint,
+                                      q.outputSigned);
+                }
+            }
+        });
+    }
+
+    void QuantizedConv2dKernel::ComputeIm2col(ThreadPool* threadPool,
+                                              const uint8_t* input,
+                                              const std::vector<PackedInt8Matrix>& filter,
+                                              const float* bias,
+                                              uint8_t* output) const {
+        const Conv2dParams& p = mParams;
+        const Int8GemmQuantization& q = mQuantization;
+        bool kernelSigned = GetInt8GemmMicroKernel().signedA;
+        int32_t inputChannelsPerGroup = p.inputChannels / p.groups;
+        int32_t outputChannelsPerGroup = p.outputChannels / p.groups;
+        size_t k = static_cast<size_t>(p.filterHeight) * p.filterWidth * inputChannelsPerGroup;
+        size_t depth = GetInt8GemmDepth(k);
+        size_t spatialSize = static_cast<size_t>(p.outputHeight) * p.outputWidth;
+        // The patches are padded with the zero point, which adds nothing to the sums.
+        uint8_t padding = static_cast<uint8_t>(q.inputZeroPoint);
+        std::vector<uint8_t> rows(spatialSize * depth, 0);
+        std::vector<int32_t> rowSums(spatialSize);
+
+        for (int32_t n = 0; n < p.batches; ++n) {
+            for (int32_t g = 0; g < p.groups; ++g) {
+                const uint8_t* x = input + n * p.inputStrides[0] +
+                                   g * inputChannelsPerGroup * p.inputStrides[1];
+                // rows[H * W, H * W * I] as in PackFilter().
+                threadPool->ParallelFor(p.outputHeight, [&](size_t begin, size_t end) {
+                    for (size_t oh = begin; oh < end; ++oh) {
+                        for (int32_t ow = 0; ow < p.outputWidth; ++ow) {
+                            size_t m = oh * p.outputWidth + ow;
+                            uint8_t* row = rows.data() + m * depth;
+                            uint8_t* patch = row;
+                            for (int32_t kh = 0; kh < p.filterHeight; ++kh) {
+                                int32_t ih = oh * p.strideHeight - p.paddingTop +
+                                             kh * p.dilationHeight;
+                                for (int32_t kw = 0; kw < p.filterWidth; ++kw) {
+                                    int32_t iw = ow * p.strideWidth - p.paddingLeft +
+                                                 kw * p.dilationWidth;
+                                    if (ih < 0 || ih >= p.inputHeight || iw < 0 ||
+                                        iw >= p.inputWidth) {
+                                        memset(patch, padding, inputChannelsPerGroup);
+                                    } else {
+                                        const uint8_t* pixel =
+                                            x + ih * p.inputStrides[2] + iw * p.inputStrides[3];
+                                        for (int32_t ic = 0; ic < inputChannelsPerGroup; ++ic) {
+                                            patch[ic] = pixel[ic * p.inputStrides[1]] ^
+                                                        q.inputFlip;
+                                        }
+                                    }
+                                    patch += inputChannelsPerGroup;
+                                }
+                            }
+                            rowSums[m] = SumValues(row, k, kernelSigned);
+                        }
+                    }
+                });
+
+                // The rows of the output are the spatial positions, its columns the channels.
+                Int8GemmOutput gemmOutput;
+                gemmOutput.scales = q.scales.data() + g * outputChannelsPerGroup;
+                if (bias != nullptr) {
+                    gemmOutput.bias = bias + g * outputChannelsPerGroup;
+                    gemmOutput.biasColumnStride = 1;
+                }
+                gemmOutput.activation = mActivation.IsEnabled() ? &mActivation : nullptr;
+                gemmOutput.outputScale = q.outputScale;
+                gemmOutput.outputZeroPoint = q.outputZeroPoint;
+                gemmOutput.outputSigned = q.outputSigned;
+                gemmOutput.c = output + n * p.outputStrides[0] +
+                               g * outputChannelsPerGroup * p.outputStrides[1];
+                gemmOutput.cRowStride = p.outputStrides[3];
+                gemmOutput.cColumnStride = p.outputStrides[1];
+                Int8Gemm(threadPool, spatialSize, rows.data(), depth, rowSums.data(),
+                         q.inputZeroPoint, filter[g],
+                         q.filterZeroPoints.data() + g * outputChannelsPerGroup, gemmOutput);
+            }
+        }
+    }
+
+}}  // namespace dawn::native::cpu
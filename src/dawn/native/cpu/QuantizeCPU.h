@@ -0,0 +1,184 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_QUANTIZE_CPU_H_
+#define WEBNN_NATIVE_CPU_QUANTIZE_CPU_H_
+
+#include "dawn/native/cpu/Conv2dCPU.h"
+#include "dawn/native/cpu/Int8GemmCPU.h"
+#include "dawn/native/cpu/KernelCPU.h"
+#include "dawn/native/ops/Quantize.h"
+
+namespace dawn::native { namespace cpu {
+
+    // quantizeLinear and dequantizeLinear with the scale and the zero point unidirectionally
+    // broadcast to the input.
+    class QuantizeKernel final : public Kernel {
+      public:
+        QuantizeKernel(uint32_t input,
+                       uint32_t scale,
+                       uint32_t zeroPoint,
+                       uint32_t output,
+                       op::QuantizeOpType opType,
+                       wgpu::OperandType inputType,
+                       wgpu::OperandType outputType,
+                       const std::vector<int32_t>& inputShape,
+                       const std::vector<int32_t>& scaleShape);
+
+        const char* GetName() const override {
+            return "Quantize";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        op::QuantizeOpType mOpType;
+        wgpu::OperandType mInputType;
+        wgpu::OperandType mOutputType;
+        size_t mElementCount;
+        // The input is split into blocks of mBlockSize elements sharing one scale. The scale of
+        // a block is at the offset given by mBlockStrides for the block index decomposed over
+        // mBlockShape.
+        size_t mBlockSize;
+        std::vector<int32_t> mBlockShape;
+        std::vector<size_t> mBlockStrides;
+    };
+
+    // The quantization of a Conv2d or Gemm converted for the int8 GEMM: the zero points in
+    // the representations the micro kernel reads the values in, and the scales of the int32
+    // sums per output channel.
+    struct Int8GemmQuantization {
+        Int8GemmQuantization(const op::Quantization& quantization,
+                             wgpu::OperandType inputType,
+                             wgpu::OperandType filterType,
+                             wgpu::OperandType outputType,
+                             size_t channels,
+                             float alpha = 1.0f);
+
+        // XORed to the input and filter values.
+        uint8_t inputFlip;
+        uint8_t filterFlip;
+        int32_t inputZeroPoint;
+        std::vector<int32_t> filterZeroPoints;
+        std::vector<float> scales;
+        float outputScale;
+        int32_t outputZeroPoint;
+        bool outputSigned;
+    };
+
+    // activation(alpha * A' * B' + beta * C) where A', B' and the result are quantized, see
+    // op::Quantization. C is float32.
+    class QuantizedGemmKernel final : public Kernel {
+      public:
+        // |c| is ignored when |cShape| is empty.
+        QuantizedGemmKernel(uint32_t a,
+                            uint32_t b,
+                            uint32_t c,
+                            uint32_t output,
+                            const std::vector<int32_t>& aShape,
+                            const std::vector<int32_t>& bShape,
+                            const std::vector<int32_t>& cShape,
+                            const GemmOptions* options,
+                            Int8GemmQuantization quantization);
+
+        const char* GetName() const override {
+            return "QuantizedGemm";
+        }
+        uint64_t GetOperationCount() const override {
+            return 2 * static_cast<uint64_t>(mM) * mN * mK;
+        }
+        void Prepare(const ExecutionContext& constants) override;
+        bool IsInputPrepared(size_t index) const override {
+            return index == 1 && !mPackedB.IsEmpty();
+        }
+        void SerializePrepared(PreparedDataWriter* writer) const override;
+        bool DeserializePrepared(PreparedDataReader* reader) override;
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        void PackB(const uint8_t* b, PackedInt8Matrix* packed) const;
+
+        size_t mM;
+        size_t mN;
+        size_t mK;
+        float mBeta;
+        bool mATranspose;
+        bool mBTranspose;
+        bool mHasC;
+        FusedActivation mActivation;
+        size_t mCRowStride = 0;
+        size_t mCColumnStride = 0;
+        Int8GemmQuantization mQuantization;
+        PackedInt8Matrix mPackedB;
+    };
+
+    // A Conv2d whose input, filter and output are quantized, see op::Quantization. The bias is
+    // float32. The depthwise convolutions are computed directly, the others as the product of
+    // the input patches gathered in rows and the filter by Int8Gemm().
+    class QuantizedConv2dKernel final : public Kernel {
+      public:
+        // |bias| is ignored when |hasBias| is false.
+        QuantizedConv2dKernel(uint32_t input,
+                              uint32_t filter,
+                              uint32_t bias,
+                              uint32_t output,
+                              bool hasBias,
+                              const std::vector<int32_t>& inputShape,
+                              const std::vector<int32_t>& filterShape,
+                              const std::vector<int32_t>& outputShape,
+                              const Conv2dOptions* options,
+                              Int8GemmQuantization quantization);
+
+        const char* GetName() const override {
+            return "QuantizedConv2d";
+        }
+        const char* GetVariant() const override {
+            return IsDepthwise() ? "Depthwise" : "Im2col";
+        }
+        uint64_t GetOperationCount() const override {
+            return GetConv2dOperationCount(mParams);
+        }
+        void Prepare(const ExecutionContext& constants) override;
+        bool IsInputPrepared(size_t index) const override {
+            return index == 1 && !mPackedFilter.empty();
+        }
+        void SerializePrepared(PreparedDataWriter* writer) const override;
+        bool DeserializePrepared(PreparedDataReader* reader) override;
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        bool IsDepthwise() const;
+        // The filter of every group as the B[H * W * I, O] operand of Int8Gemm().
+        void PackFilter(const uint8_t* filter, std::vector<PackedInt8Matrix>* packed) const;
+        void ComputeDepthwise(ThreadPool* threadPool,
+                              const uint8_t* input,
+                              const uint8_t* filter,
+                              const float* bias,
+                              uint8_t* output) const;
+        void ComputeIm2col(ThreadPool* threadPool,
+                           const uint8_t* input,
+                           const std::vector<PackedInt8Matrix>& filter,
+                           const float* bias,
+                           uint8_t* output) const;
+
+        Conv2dParams mParams;
+        bool mHasBias;
+        size_t mFilterStrides[4];
+        FusedActivation mActivation;
+        Int8GemmQuantization mQuantization;
+        std::vector<PackedInt8Matrix> mPackedFilter;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_QUANTIZE_CPU_H_
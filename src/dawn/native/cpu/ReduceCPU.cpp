@@ -0,0 +1,333 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/ReduceCPU.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The values a task reduces at least, so that small reductions aren't split across
+        // threads.
+        constexpr size_t kMinTaskValues = 16384;
+        // The columns a task of a column stage reduces.
+        constexpr size_t kColumnBlock = 256;
+
+        // The partial results of a reduction combine with kReduceSum for L1, L2 and Mean, whose
+        // first stage gives sums, and with the reduction itself otherwise.
+        op::ReduceType GetCombineType(op::ReduceType opType) {
+            switch (opType) {
+                case op::ReduceType::kReduceL1:
+                case op::ReduceType::kReduceL2:
+                case op::ReduceType::kReduceMean:
+                    return op::ReduceType::kReduceSum;
+                default:
+                    return opType;
+            }
+        }
+
+        bool IsArgReduce(op::ReduceType opType) {
+            return opType == op::ReduceType::kReduceArgMax ||
+                   opType == op::ReduceType::kReduceArgMin;
+        }
+
+        float* GetThreadBuffer(size_t slot, size_t size) {
+            thread_local std::vector<float> buffers[3];
+            if (buffers[slot].size() < size) {
+                buffers[slot].resize(size);
+            }
+            return buffers[slot].data();
+        }
+    }  // anonymous namespace
+
+    ReduceKernel::ReduceKernel(uint32_t input,
+                               uint32_t output,
+                               op::ReduceType opType,
+                               const std::vector<int32_t>& inputShape,
+                               const std::vector<int32_t>& axes)
+        : Kernel({input}, {output}),
+          mOpType(opType),
+          mInputCount(GetElementCount(inputShape)),
+          mReducedCount(1),
+          mFunctions(GetElementwiseFunctions()) {
+        std::vector<bool> reduced(inputShape.size(), false);
+        for (int32_t axis : axes) {
+            reduced[axis == -1 ? inputShape.size() - 1 : axis] = true;
+        }
+        // The dimensions without those of size 1, the adjacent ones both reduced or both kept
+        // merged.
+        std::vector<size_t> dimensions;
+        std::vector<bool> dimensionReduced;
+        size_t reducedGroups = 0;
+        for (size_t i = 0; i < inputShape.size(); ++i) {
+            if (reduced[i]) {
+                mReducedCount *= inputShape[i];
+            }
+            if (inputShape[i] == 1) {
+                continue;
+            }
+            if (!dimensions.empty() && dimensionReduced.back() == reduced[i]) {
+                dimensions.back() *= inputShape[i];
+            } else {
+                dimensions.push_back(inputShape[i]);
+                dimensionReduced.push_back(reduced[i]);
+                reducedGroups += reduced[i] ? 1 : 0;
+            }
+        }
+
+        if (IsArgReduce(opType) && reducedGroups > 1) {
+            std::vector<size_t> strides = GetStrides(inputShape);
+            for (size_t i = 0; i < inputShape.size(); ++i) {
+                if (reduced[i]) {
+                    mReducedShape.push_back(inputShape[i]);
+                    mReducedStrides.push_back(strides[i]);
+                } else {
+                    mKeptShape.push_back(inputShape[i]);
+                    mKeptStrides.push_back(strides[i]);
+                }
+            }
+            return;
+        }
+
+        for (size_t i = dimensions.size(); i-- > 0;) {
+            if (!dimensionReduced[i]) {
+                continue;
+            }
+            Stage stage = {1, dimensions[i], 1};
+            for (size_t d = 0; d < i; ++d) {
+                stage.outer *= dimensions[d];
+            }
+            for (size_t d = i + 1; d < dimensions.size(); ++d) {
+                stage.inner *= dimensions[d];
+            }
+            mStages.push_back(stage);
+            dimensions.erase(dimensions.begin() + i);
+            dimensionReduced.erase(dimensionReduced.begin() + i);
+        }
+        if (mStages.empty()) {
+            // Only dimensions of size 1 are reduced, each output reduces a single value.
+            mStages.push_back({mInputCount, 1, 1});
+        }
+    }
+
+    const char* ReduceKernel::GetVariant() const {
+        if (mStages.empty()) {
+            return "Strided";
+        }
+        if (mStages.size() > 1) {
+            return "MultiStage";
+        }
+        return mStages[0].inner == 1 ? "Rows" : "Columns";
+    }
+
+    void ReduceKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        float* output = context.GetData<float>(mOutputs[0]);
+        ThreadPool* threadPool = context.GetThreadPool();
+        if (mStages.empty()) {
+            ComputeStrided(threadPool, input, output);
+            return;
+        }
+        if (IsArgReduce(mOpType)) {
+            ComputeArg(threadPool, input, output);
+            return;
+        }
+
+        // The stages but the last reduce to the buffers of the calling thread, in turn.
+        const float* x = input;
+        op::ReduceType opType = mOpType;
+        for (size_t i = 0; i < mStages.size(); ++i) {
+            const Stage& stage = mStages[i];
+            float* y = i + 1 == mStages.size()
+                           ? output
+                           : GetThreadBuffer(i % 2, stage.outer * stage.inner);
+            ComputeStage(threadPool, opType, stage, x, y);
+            x = y;
+            opType = GetCombineType(mOpType);
+        }
+
+        size_t outputCount = mStages.back().outer * mStages.back().inner;
+        if (mOpType == op::ReduceType::kReduceL2) {
+            for (size_t i = 0; i < outputCount; ++i) {
+                output[i] = std::sqrt(output[i]);
+            }
+        } else if (mOpType == op::ReduceType::kReduceMean) {
+            float scale = 1.0f / mReducedCount;
+            for (size_t i = 0; i < outputCount; ++i) {
+                output[i] *= scale;
+            }
+        }
+    }
+
+    void ReduceKernel::ComputeStage(ThreadPool* threadPool,
+                                    op::ReduceType opType,
+                                    const Stage& stage,
+                                    const float* x,
+                                    float* y) const {
+        size_t outputCount = stage.outer * stage.inner;
+        size_t threadCount = threadPool->GetThreadCount();
+        // Too few outputs to keep the threads busy: the reduced dimension is split in chunks
+        // reduced in parallel to partial results, which are then combined.
+        size_t chunks = 1;
+        if (outputCount < threadCount && mInputCount >= 2 * kMinTaskValues) {
+            chunks = std::min({threadCount, stage.size, mInputCount / kMinTaskValues});
+        }
+
+        if (stage.inner == 1) {
+            if (chunks == 1) {
+                threadPool->ParallelFor(
+                    stage.outer,
+                    [&](size_t begin, size_t end) {
+                        mFunctions.reduceRows(opType, x + begin * stage.size, y + begin,
+                                              end - begin, stage.size);
+                    },
+                    std::max<size_t>(1, kMinTaskValues / stage.size));
+                return;
+            }
+            float* partials = GetThreadBuffer(2, stage.outer * chunks);
+            threadPool->ParallelFor(stage.outer * chunks, [&](size_t begin, size_t end) {
+                for (size_t task = begin; task < end; ++task) {
+                    size_t o = task / chunks, chunk = task % chunks;
+                    size_t rowBegin = stage.size * chunk / chunks;
+                    size_t rowEnd = stage.size * (chunk + 1) / chunks;
+                    mFunctions.reduceRows(opType, x + o * stage.size + rowBegin,
+                                          partials + task, 1, rowEnd - rowBegin);
+                }
+            });
+            mFunctions.reduceRows(GetCombineType(opType), partials, y, stage.outer, chunks);
+            return;
+        }
+
+        if (chunks == 1) {
+            size_t blocks = (stage.inner + kColumnBlock - 1) / kColumnBlock;
+            size_t taskValues = stage.size * std::min(stage.inner, kColumnBlock);
+            threadPool->ParallelFor(
+                stage.outer * blocks,
+                [&](size_t begin, size_t end) {
+                    for (size_t task = begin; task < end; ++task) {
+                        size_t o = task / blocks;
+                        size_t c = task % blocks * kColumnBlock;
+                        mFunctions.reduceColumns(
+                            opType, x + o * stage.size * stage.inner + c, stage.inner,
+                            y + o * stage.inner + c, stage.size,
+                            std::min(kColumnBlock, stage.inner - c), false);
+                    }
+                },
+                std::max<size_t>(1, kMinTaskValues / taskValues));
+            return;
+        }
+        // The partial results of a chunk are laid out as the output, one chunk after the other.
+        float* partials = GetThreadBuffer(2, outputCount * chunks);
+        threadPool->ParallelFor(stage.outer * chunks, [&](size_t begin, size_t end) {
+            for (size_t task = begin; task < end; ++task) {
+                size_t chunk = task / stage.outer, o = task % stage.outer;
+                size_t rowBegin = stage.size * chunk / chunks;
+                size_t rowEnd = stage.size * (chunk + 1) / chunks;
+                mFunctions.reduceColumns(
+                    opType, x + (o * stage.size + rowBegin) * stage.inner, stage.inner,
+                    partials + chunk * outputCount + o * stage.inner, rowEnd - rowBegin,
+                    stage.inner, false);
+            }
+        });
+        mFunctions.reduceColumns(GetCombineType(opType), partials, outputCount, y, chunks,
+                                 outputCount, false);
+    }
+
+    void ReduceKernel::ComputeArg(ThreadPool* threadPool, const float* x, float* y) const {
+        const Stage& stage = mStages[0];
+        bool isMax = mOpType == op::ReduceType::kReduceArgMax;
+        if (stage.inner == 1) {
+            threadPool->ParallelFor(
+                stage.outer,
+                [&](size_t begin, size_t end) {
+                    for (size_t o = begin; o < end; ++o) {
+                        const float* row = x + o * stage.size;
+                        float best = row[0];
+                        size_t bestIndex = 0;
+                        for (size_t r = 1; r < stage.size; ++r) {
+                            if (isMax ? row[r] > best : row[r] < best) {
+                                best = row[r];
+                                bestIndex = r;
+                            }
+                        }
+                        y[o] = static_cast<float>(bestIndex);
+                    }
+                },
+                std::max<size_t>(1, kMinTaskValues / stage.size));
+            return;
+        }
+
+        // The best values and their indices of a block of columns, updated row by row so that
+        // the input is read contiguously.
+        size_t blocks = (stage.inner + kColumnBlock - 1) / kColumnBlock;
+        threadPool->ParallelFor(stage.outer * blocks, [&](size_t begin, size_t end) {
+            float best[kColumnBlock];
+            for (size_t task = begin; task < end; ++task) {
+                size_t o = task / blocks;
+                size_t c = task % blocks * kColumnBlock;
+                size_t count = std::min(kColumnBlock, stage.inner - c);
+                const float* column = x + o * stage.size * stage.inner + c;
+                float* bestIndex = y + o * stage.inner + c;
+                for (size_t j = 0; j < count; ++j) {
+                    best[j] = column[j];
+                    bestIndex[j] = 0;
+                }
+                for (size_t r = 1; r < stage.size; ++r) {
+                    const float* row = column + r * stage.inner;
+                    for (size_t j = 0; j < count; ++j) {
+                        if (isMax ? row[j] > best[j] : row[j] < best[j]) {
+                            best[j] = row[j];
+                            bestIndex[j] = static_cast<float>(r);
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    void ReduceKernel::ComputeStrided(ThreadPool* threadPool, const float* x, float* y) const {
+        size_t reduceCount = GetElementCount(mReducedShape);
+        bool isMax = mOpType == op::ReduceType::kReduceArgMax;
+        threadPool->ParallelFor(GetElementCount(mKeptShape), [&](size_t begin, size_t end) {
+            for (size_t o = begin; o < end; ++o) {
+                size_t base = 0, index = o;
+                for (size_t d = mKeptShape.size(); d-- > 0;) {
+                    base += (index % mKeptShape[d]) * mKeptStrides[d];
+                    index /= mKeptShape[d];
+                }
+                float best = 0;
+                size_t bestIndex = 0;
+                for (size_t r = 0; r < reduceCount; ++r) {
+                    size_t offset = base;
+                    index = r;
+                    for (size_t d = mReducedShape.size(); d-- > 0;) {
+                        offset += (index % mReducedShape[d]) * mReducedStrides[d];
+                        index /= mReducedShape[d];
+                    }
+                    float value = x[offset];
+                    if (r == 0 || (isMax ? value > best : value < best)) {
+                        best = value;
+                        bestIndex = r;
+                    }
+                }
+                y[o] = static_cast<float>(bestIndex);
+            }
+        });
+    }
+
+}}  // namespace dawn::native::cpu
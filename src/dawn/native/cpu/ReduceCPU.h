@@ -0,0 +1,77 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_REDUCE_CPU_H_
+#define WEBNN_NATIVE_CPU_REDUCE_CPU_H_
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+#include "dawn/native/cpu/KernelCPU.h"
+#include "dawn/native/ops/Reduce.h"
+
+namespace dawn::native { namespace cpu {
+
+    // Reduces the input over |axes|. The indices computed by ArgMax and ArgMin are stored as
+    // float values in the float32 output. The adjacent reduced dimensions are merged, and each
+    // group of them is reduced by a stage, from the innermost, with the SIMD row and column
+    // reductions of ElementwiseFunctions. The stages of ArgMax and ArgMin over several groups
+    // don't compose, so they are reduced element by element.
+    class ReduceKernel final : public Kernel {
+      public:
+        ReduceKernel(uint32_t input,
+                     uint32_t output,
+                     op::ReduceType opType,
+                     const std::vector<int32_t>& inputShape,
+                     const std::vector<int32_t>& axes);
+
+        const char* GetName() const override {
+            return "Reduce";
+        }
+        const char* GetVariant() const override;
+        uint64_t GetOperationCount() const override {
+            return mInputCount;
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        // Reduces [outer, size, inner] to [outer, inner].
+        struct Stage {
+            size_t outer;
+            size_t size;
+            size_t inner;
+        };
+
+        void ComputeStage(ThreadPool* threadPool,
+                          op::ReduceType opType,
+                          const Stage& stage,
+                          const float* x,
+                          float* y) const;
+        void ComputeArg(ThreadPool* threadPool, const float* x, float* y) const;
+        void ComputeStrided(ThreadPool* threadPool, const float* x, float* y) const;
+
+        op::ReduceType mOpType;
+        size_t mInputCount;
+        size_t mReducedCount;
+        std::vector<Stage> mStages;
+        // The kept dimensions, in the order of the output, and the reduced dimensions with their
+        // input strides, for ComputeStrided() when mStages is empty.
+        std::vector<int32_t> mKeptShape;
+        std::vector<size_t> mKeptStrides;
+        std::vector<int32_t> mReducedShape;
+        std::vector<size_t> mReducedStrides;
+        const ElementwiseFunctions& mFunctions;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_REDUCE_CPU_H_
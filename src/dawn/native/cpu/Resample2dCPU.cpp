@@ -0,0 +1,192 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/Resample2dCPU.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The output rows a task computes, so that the interpolated input rows are reused.
+        constexpr int32_t kRowTile = 16;
+
+        // Maps an output coordinate to the input with half pixel centers, as DirectML does by
+        // default.
+        float SourceCoordinate(int32_t outputIndex, int32_t inputSize, int32_t outputSize) {
+            float scale = static_cast<float>(outputSize) / inputSize;
+            return (outputIndex + 0.5f) / scale - 0.5f;
+        }
+
+        float* GetThreadBuffer(size_t slot, size_t size) {
+            thread_local std::vector<float> buffers[2];
+            if (buffers[slot].size() < size) {
+                buffers[slot].resize(size);
+            }
+            return buffers[slot].data();
+        }
+    }  // anonymous namespace
+
+    Resample2dKernel::Resample2dKernel(uint32_t input,
+                                       uint32_t output,
+                                       wgpu::InterpolationMode mode,
+                                       const std::vector<int32_t>& inputShape,
+                                       const std::vector<int32_t>& outputShape,
+                                       const std::vector<int32_t>& axes)
+        : Kernel({input}, {output}),
+          mMode(mode),
+          mOuterSize(1),
+          mInnerSize(1),
+          mFunctions(GetElementwiseFunctions()) {
+        DAWN_ASSERT(axes.size() == 2 && axes[1] == axes[0] + 1);
+        for (int32_t i = 0; i < axes[0]; ++i) {
+            mOuterSize *= inputShape[i];
+        }
+        for (size_t i = axes[1] + 1; i < inputShape.size(); ++i) {
+            mInnerSize *= inputShape[i];
+        }
+        mInputHeight = inputShape[axes[0]];
+        mInputWidth = inputShape[axes[1]];
+        mOutputHeight = outputShape[axes[0]];
+        mOutputWidth = outputShape[axes[1]];
+        mRowIndices = GetSourceIndices(mInputHeight, mOutputHeight);
+        mColumnIndices = GetSourceIndices(mInputWidth, mOutputWidth);
+    }
+
+    std::vector<Resample2dKernel::SourceIndex> Resample2dKernel::GetSourceIndices(
+        int32_t inputSize,
+        int32_t outputSize) const {
+        std::vector<SourceIndex> indices(outputSize);
+        for (int32_t o = 0; o < outputSize; ++o) {
+            float s = SourceCoordinate(o, inputSize, outputSize);
+            SourceIndex& index = indices[o];
+            if (mMode == wgpu::InterpolationMode::NearestNeighbor) {
+                index.first = std::min(static_cast<int32_t>(std::floor(s + 0.5f)), inputSize - 1);
+                index.first = std::max(index.first, 0);
+                index.second = index.first;
+                index.weight = 0.0f;
+                continue;
+            }
+            s = std::min(std::max(s, 0.0f), inputSize - 1.0f);
+            index.first = static_cast<int32_t>(s);
+            index.second = std::min(index.first + 1, inputSize - 1);
+            index.weight = s - index.first;
+        }
+        return indices;
+    }
+
+    void Resample2dKernel::Compute(const ExecutionContext& context) const {
+        const float* input = context.GetData<float>(mInputs[0]);
+        float* output = context.GetData<float>(mOutputs[0]);
+        size_t inputPlane = static_cast<size_t>(mInputHeight) * mInputWidth * mInnerSize;
+        size_t outputPlane = static_cast<size_t>(mOutputHeight) * mOutputWidth * mInnerSize;
+        size_t tiles = (mOutputHeight + kRowTile - 1) / kRowTile;
+        context.GetThreadPool()->ParallelFor(mOuterSize * tiles, [&](size_t begin, size_t end) {
+            for (size_t task = begin; task < end; ++task) {
+                size_t outer = task / tiles;
+                int32_t ohBegin = task % tiles * kRowTile;
+                int32_t ohEnd = std::min(ohBegin + kRowTile, mOutputHeight);
+                const float* x = input + outer * inputPlane;
+                float* y = output + outer * outputPlane;
+                if (mMode == wgpu::InterpolationMode::NearestNeighbor) {
+                    ComputeNearest(x, y, ohBegin, ohEnd);
+                } else {
+                    ComputeLinear(x, y, ohBegin, ohEnd);
+                }
+            }
+        });
+    }
+
+    void Resample2dKernel::ComputeNearest(const float* x,
+                                          float* y,
+                                          int32_t ohBegin,
+                                          int32_t ohEnd) const {
+        size_t inputRowSize = mInputWidth * mInnerSize;
+        size_t outputRowSize = mOutputWidth * mInnerSize;
+        for (int32_t oh = ohBegin; oh < ohEnd; ++oh) {
+            float* yh = y + oh * outputRowSize;
+            // The output rows of an upsampling repeat the previous one.
+            if (oh > ohBegin && mRowIndices[oh].first == mRowIndices[oh - 1].first) {
+                memcpy(yh, yh - outputRowSize, outputRowSize * sizeof(float));
+                continue;
+            }
+            const float* xh = x + mRowIndices[oh].first * inputRowSize;
+            if (mInnerSize == 1) {
+                for (int32_t ow = 0; ow < mOutputWidth; ++ow) {
+                    yh[ow] = xh[mColumnIndices[ow].first];
+                }
+                continue;
+            }
+            for (int32_t ow = 0; ow < mOutputWidth; ++ow) {
+                memcpy(yh + ow * mInnerSize, xh + mColumnIndices[ow].first * mInnerSize,
+                       mInnerSize * sizeof(float));
+            }
+        }
+    }
+
+    void Resample2dKernel::InterpolateRow(const float* x, float* y) const {
+        if (mInnerSize == 1) {
+            for (int32_t ow = 0; ow < mOutputWidth; ++ow) {
+                const SourceIndex& index = mColumnIndices[ow];
+                float a = x[index.first];
+                y[ow] = a + (x[index.second] - a) * index.weight;
+            }
+            return;
+        }
+        for (int32_t ow = 0; ow < mOutputWidth; ++ow) {
+            const SourceIndex& index = mColumnIndices[ow];
+            mFunctions.lerp(x + index.first * mInnerSize, x + index.second * mInnerSize,
+                            index.weight, y + ow * mInnerSize, mInnerSize);
+        }
+    }
+
+    void Resample2dKernel::ComputeLinear(const float* x,
+                                         float* y,
+                                         int32_t ohBegin,
+                                         int32_t ohEnd) const {
+        size_t inputRowSize = mInputWidth * mInnerSize;
+        size_t outputRowSize = mOutputWidth * mInnerSize;
+        // The input rows interpolated along the width, and which rows they are.
+        float* rows[2] = {GetThreadBuffer(0, outputRowSize), GetThreadBuffer(1, outputRowSize)};
+        int32_t cached[2] = {-1, -1};
+        auto interpolatedRow = [&](int32_t ih, int32_t keep) -> const float* {
+            for (size_t slot = 0; slot < 2; ++slot) {
+                if (cached[slot] == ih) {
+                    return rows[slot];
+                }
+            }
+            size_t slot = cached[0] == keep ? 1 : 0;
+            InterpolateRow(x + ih * inputRowSize, rows[slot]);
+            cached[slot] = ih;
+            return rows[slot];
+        };
+        for (int32_t oh = ohBegin; oh < ohEnd; ++oh) {
+            const SourceIndex& index = mRowIndices[oh];
+            float* yh = y + oh * outputRowSize;
+            const float* top = interpolatedRow(index.first, index.second);
+            if (index.weight == 0.0f) {
+                memcpy(yh, top, outputRowSize * sizeof(float));
+                continue;
+            }
+            const float* bottom = interpolatedRow(index.second, index.first);
+            mFunctions.lerp(top, bottom, index.weight, yh, outputRowSize);
+        }
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,73 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_RESAMPLE2D_CPU_H_
+#define WEBNN_NATIVE_CPU_RESAMPLE2D_CPU_H_
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+#include "dawn/native/cpu/KernelCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    // The source indices and weights of every output row and column are computed once for
+    // the shapes of the graph. Linear interpolation is separable: the input rows an output row
+    // needs are interpolated horizontally, and kept for the next output rows that read them,
+    // then blended vertically with SIMD. The values of a pixel, the axes after the resampled
+    // ones, are interpolated as vectors too.
+    class Resample2dKernel final : public Kernel {
+      public:
+        Resample2dKernel(uint32_t input,
+                         uint32_t output,
+                         wgpu::InterpolationMode mode,
+                         const std::vector<int32_t>& inputShape,
+                         const std::vector<int32_t>& outputShape,
+                         const std::vector<int32_t>& axes);
+
+        const char* GetName() const override {
+            return "Resample2d";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        // The output coordinate reads the source indices first and second, the latter with
+        // |weight|. Only first is used by nearest neighbor.
+        struct SourceIndex {
+            int32_t first;
+            int32_t second;
+            float weight;
+        };
+
+        std::vector<SourceIndex> GetSourceIndices(int32_t inputSize, int32_t outputSize) const;
+        // Interpolates the input row |x| along the width to |mOutputWidth| pixels.
+        void InterpolateRow(const float* x, float* y) const;
+        void ComputeNearest(const float* x, float* y, int32_t ohBegin, int32_t ohEnd) const;
+        void ComputeLinear(const float* x, float* y, int32_t ohBegin, int32_t ohEnd) const;
+
+        wgpu::InterpolationMode mMode;
+        // The input is viewed as [outer, height, width, inner] where height and width are the
+        // resampled axes.
+        size_t mOuterSize;
+        size_t mInnerSize;
+        int32_t mInputHeight;
+        int32_t mInputWidth;
+        int32_t mOutputHeight;
+        int32_t mOutputWidth;
+        std::vector<SourceIndex> mRowIndices;
+        std::vector<SourceIndex> mColumnIndices;
+        const ElementwiseFunctions& mFunctions;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_RESAMPLE2D_CPU_H_
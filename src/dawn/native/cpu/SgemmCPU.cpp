@@ -0,0 +1,272 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/SgemmCPU.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/Float16CPU.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The depth of the blocks of A and B that stay in the caches while their product is
+        // accumulated, and the default tile size in micro kernel panels.
+        constexpr size_t kDepthBlock = 256;
+        constexpr size_t kRowBlockPanels = 12;
+        constexpr size_t kColumnBlockPanels = 16;
+        // The largest mr * nr of the micro kernels, for the partial tiles at the edges.
+        constexpr size_t kMaxMicroTileSize = 512;
+
+        size_t RoundUp(size_t value, size_t multiple) {
+            return (value + multiple - 1) / multiple * multiple;
+        }
+
+        // Packs |rows| rows and the columns [k0, k0 + kc) of A into panels of mr rows stored
+        // column by column, zero padded to a multiple of mr rows.
+        void PackA(const float* a,
+                   size_t aRowStride,
+                   size_t aColumnStride,
+                   size_t rows,
+                   size_t k0,
+                   size_t kc,
+                   size_t mr,
+                   float* packed) {
+            for (size_t i0 = 0; i0 < rows; i0 += mr) {
+                size_t panelRows = std::min(mr, rows - i0);
+                for (size_t p = 0; p < kc; ++p) {
+                    const float* column = a + i0 * aRowStride + (k0 + p) * aColumnStride;
+                    for (size_t i = 0; i < panelRows; ++i) {
+                        packed[i] = column[i * aRowStride];
+                    }
+                    std::fill(packed + panelRows, packed + mr, 0.0f);
+                    packed += mr;
+                }
+            }
+        }
+
+        // The buffer of packed A of the calling thread, reused across the calls.
+        float* GetPackedABuffer(size_t size) {
+            thread_local std::vector<float> buffer;
+            if (buffer.size() < size) {
+                buffer.resize(size);
+            }
+            return buffer.data();
+        }
+    }  // anonymous namespace
+
+    const GemmMicroKernel& GetGemmMicroKernel() {
+        static const GemmMicroKernel& kernel = GetGemmMicroKernel(GetSimdLevel());
+        return kernel;
+    }
+
+    const GemmMicroKernel& GetGemmMicroKernel(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::Scalar:
+                return GetGemmMicroKernelScalar();
+#if defined(WEBNN_CPU_X86)
+            case SimdLevel::AVX2:
+                return GetGemmMicroKernelAVX2();
+            case SimdLevel::AVX512:
+                return GetGemmMicroKernelAVX512();
+#elif defined(WEBNN_CPU_ARM64)
+            case SimdLevel::NEON:
+                return GetGemmMicroKernelNEON();
+#endif
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+    void PackedMatrix::Pack(const float* b,
+                            size_t rowStride,
+                            size_t columnStride,
+                            size_t k,
+                            size_t n,
+                            float scale,
+                            bool halfPrecision) {
+        mKernel = &GetGemmMicroKernel();
+        mRows = k;
+        mColumns = n;
+        size_t nr = mKernel->nr;
+        size_t panelCount = (n + nr - 1) / nr;
+        mData.assign(std::max<size_t>(panelCount * k * nr, 1), 0.0f);
+        mHalfData.clear();
+        for (size_t panel = 0; panel < panelCount; ++panel) {
+            size_t j0 = panel * nr;
+            size_t columns = std::min(nr, n - j0);
+            float* packed = mData.data() + panel * k * nr;
+            for (size_t p = 0; p < k; ++p) {
+                const float* row = b + p * rowStride + j0 * columnStride;
+                for (size_t j = 0; j < columns; ++j) {
+                    packed[j] = scale * row[j * columnStride];
+                }
+                packed += nr;
+            }
+        }
+        if (halfPrecision) {
+            mHalfData.resize(mData.size());
+            ConvertFloatToHalf(mData.data(), mHalfData.data(), mData.size());
+            std::vector<float>().swap(mData);
+        }
+    }
+
+    bool PackedMatrix::SetShape(size_t k, size_t n, size_t size) {
+        const GemmMicroKernel* kernel = &GetGemmMicroKernel();
+        size_t panelCount = (n + kernel->nr - 1) / kernel->nr;
+        if (size != std::max<size_t>(panelCount * k * kernel->nr, 1)) {
+            return false;
+        }
+        mKernel = kernel;
+        mRows = k;
+        mColumns = n;
+        return true;
+    }
+
+    bool PackedMatrix::SetData(size_t k, size_t n, std::vector<float> data) {
+        if (!SetShape(k, n, data.size())) {
+            return false;
+        }
+        mData = std::move(data);
+        mHalfData.clear();
+        return true;
+    }
+
+    bool PackedMatrix::SetHalfData(size_t k, size_t n, std::vector<uint16_t> data) {
+        if (!SetShape(k, n, data.size())) {
+            return false;
+        }
+        mHalfData = std::move(data);
+        mData.clear();
+        return true;
+    }
+
+    const float* PackedMatrix::GetPanel(size_t panel, size_t k) const {
+        return mData.data() + (panel * mRows + k) * mKernel->nr;
+    }
+
+    const uint16_t* PackedMatrix::GetHalfPanel(size_t panel, size_t k) const {
+        return mHalfData.data() + (panel * mRows + k) * mKernel->nr;
+    }
+
+    GemmTiling::GemmTiling(size_t m, size_t n, size_t minTileCount) : mM(m), mN(n) {
+        const GemmMicroKernel& kernel = GetGemmMicroKernel();
+        size_t mr = kernel.mr, nr = kernel.nr;
+        mRowBlock = std::min(RoundUp(std::max<size_t>(m, 1), mr), kRowBlockPanels * mr);
+        mColumnBlock = std::min(RoundUp(std::max<size_t>(n, 1), nr), kColumnBlockPanels * nr);
+        auto tileCount = [&]() {
+            return ((m + mRowBlock - 1) / mRowBlock) * ((n + mColumnBlock - 1) / mColumnBlock);
+        };
+        // Prefer narrower tiles, the packed A of a row block is then shared by fewer of them
+        // but the B panels stay in the cache either way.
+        while (tileCount() < minTileCount && mColumnBlock > nr) {
+            mColumnBlock = RoundUp(mColumnBlock / 2, nr);
+        }
+        while (tileCount() < minTileCount && mRowBlock > mr) {
+            mRowBlock = RoundUp(mRowBlock / 2, mr);
+        }
+        mRowTiles = (m + mRowBlock - 1) / mRowBlock;
+        mColumnTiles = (n + mColumnBlock - 1) / mColumnBlock;
+    }
+
+    void GemmTiling::ComputeTile(size_t tile,
+                                 const float* a,
+                                 size_t aRowStride,
+                                 size_t aColumnStride,
+                                 const PackedMatrix& b,
+                                 float* c,
+                                 size_t cRowStride,
+                                 bool accumulate) const {
+        const GemmMicroKernel& kernel = GetGemmMicroKernel();
+        size_t mr = kernel.mr, nr = kernel.nr;
+        DAWN_ASSERT(mr * nr <= kMaxMicroTileSize);
+        DAWN_ASSERT(b.GetColumns() == mN);
+        size_t m0 = (tile / mColumnTiles) * mRowBlock;
+        size_t n0 = (tile % mColumnTiles) * mColumnBlock;
+        size_t mc = std::min(mRowBlock, mM - m0);
+        size_t nc = std::min(mColumnBlock, mN - n0);
+        size_t k = b.GetRows();
+        if (k == 0) {
+            if (!accumulate) {
+                for (size_t i = 0; i < mc; ++i) {
+                    std::fill(c + (m0 + i) * cRowStride + n0,
+                              c + (m0 + i) * cRowStride + n0 + nc, 0.0f);
+                }
+            }
+            return;
+        }
+
+        float* packedA = GetPackedABuffer(RoundUp(mc, mr) * std::min(k, kDepthBlock));
+        for (size_t k0 = 0; k0 < k; k0 += kDepthBlock) {
+            size_t kc = std::min(kDepthBlock, k - k0);
+            PackA(a + m0 * aRowStride, aRowStride, aColumnStride, mc, k0, kc, mr, packedA);
+            bool accumulateBlock = accumulate || k0 > 0;
+            for (size_t j0 = n0; j0 < n0 + nc; j0 += nr) {
+                size_t columns = std::min(nr, n0 + nc - j0);
+                auto computeTile = [&](const float* packedATile, float* cTile,
+                                       size_t tileRowStride) {
+                    if (b.IsHalfPrecision()) {
+                        kernel.halfFunction(kc, packedATile, b.GetHalfPanel(j0 / nr, k0), cTile,
+                                            tileRowStride, accumulateBlock);
+                    } else {
+                        kernel.function(kc, packedATile, b.GetPanel(j0 / nr, k0), cTile,
+                                        tileRowStride, accumulateBlock);
+                    }
+                };
+                for (size_t i0 = 0; i0 < mc; i0 += mr) {
+                    size_t rows = std::min(mr, mc - i0);
+                    float* cTile = c + (m0 + i0) * cRowStride + j0;
+                    if (rows == mr && columns == nr) {
+                        computeTile(packedA + i0 * kc, cTile, cRowStride);
+                        continue;
+                    }
+                    // The edges go through a full size tile.
+                    float buffer[kMaxMicroTileSize];
+                    if (accumulateBlock) {
+                        for (size_t i = 0; i < rows; ++i) {
+                            memcpy(buffer + i * nr, cTile + i * cRowStride,
+                                   columns * sizeof(float));
+                        }
+                    }
+                    computeTile(packedA + i0 * kc, buffer, nr);
+                    for (size_t i = 0; i < rows; ++i) {
+                        memcpy(cTile + i * cRowStride, buffer + i * nr, columns * sizeof(float));
+                    }
+                }
+            }
+        }
+    }
+
+    void Sgemm(ThreadPool* threadPool,
+               size_t m,
+               const float* a,
+               size_t aRowStride,
+               size_t aColumnStride,
+               const PackedMatrix& b,
+               float* c,
+               size_t cRowStride,
+               bool accumulate) {
+        GemmTiling tiling(m, b.GetColumns(), threadPool->GetThreadCount() * 4);
+        threadPool->ParallelFor(tiling.GetTileCount(), [&](size_t begin, size_t end) {
+            for (size_t tile = begin; tile < end; ++tile) {
+                tiling.ComputeTile(tile, a, aRowStride, aColumnStride, b, c, cRowStride,
+                                   accumulate);
+            }
+        });
+    }
+
+}}  // namespace dawn::native::cpu
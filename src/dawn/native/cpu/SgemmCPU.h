@@ -0,0 +1,160 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_SGEMM_CPU_H_
+#define WEBNN_NATIVE_CPU_SGEMM_CPU_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "dawn/native/cpu/SimdCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    class ThreadPool;
+
+    // Computes one mr x nr tile of C = A * B, plus C when |accumulate|. A is packed as kc
+    // columns of mr values and B as kc rows of nr values.
+    struct GemmMicroKernel {
+        size_t mr;
+        size_t nr;
+        void (*function)(size_t kc,
+                         const float* a,
+                         const float* b,
+                         float* c,
+                         size_t cRowStride,
+                         bool accumulate);
+        // The same with B stored as float16, converted to float32 as it is loaded.
+        void (*halfFunction)(size_t kc,
+                             const float* a,
+                             const uint16_t* b,
+                             float* c,
+                             size_t cRowStride,
+                             bool accumulate);
+    };
+
+    // The micro kernel for GetSimdLevel().
+    const GemmMicroKernel& GetGemmMicroKernel();
+    const GemmMicroKernel& GetGemmMicroKernel(SimdLevel level);
+
+    const GemmMicroKernel& GetGemmMicroKernelScalar();
+#if defined(WEBNN_CPU_X86)
+    const GemmMicroKernel& GetGemmMicroKernelAVX2();
+    const GemmMicroKernel& GetGemmMicroKernelAVX512();
+#elif defined(WEBNN_CPU_ARM64)
+    const GemmMicroKernel& GetGemmMicroKernelNEON();
+#endif
+
+    // The B operand of a GEMM packed for the micro kernel: panels of nr columns, zero padded,
+    // each holding the K rows contiguously. Constant weights are packed once when the graph is
+    // compiled.
+    class PackedMatrix {
+      public:
+        // Packs scale * B where B[K, N] is read at b[k * rowStride + n * columnStride]. With
+        // |halfPrecision| the packed values are stored as float16, which halves the memory and
+        // the bandwidth of the weights while the products are still accumulated in float32.
+        void Pack(const float* b,
+                  size_t rowStride,
+                  size_t columnStride,
+                  size_t k,
+                  size_t n,
+                  float scale = 1.0f,
+                  bool halfPrecision = false);
+
+        bool IsEmpty() const {
+            return mData.empty() && mHalfData.empty();
+        }
+        bool IsHalfPrecision() const {
+            return !mHalfData.empty();
+        }
+        size_t GetRows() const {
+            return mRows;
+        }
+        size_t GetColumns() const {
+            return mColumns;
+        }
+        // The kc rows of the panel starting at row |k|, GetHalfPanel() when IsHalfPrecision().
+        const float* GetPanel(size_t panel, size_t k) const;
+        const uint16_t* GetHalfPanel(size_t panel, size_t k) const;
+
+        // The packed data, to store the matrix with the compiled graph in the persistent cache.
+        const std::vector<float>& GetData() const {
+            return mData;
+        }
+        // Restores the |data| of a K x N matrix packed for GetGemmMicroKernel(). Returns false
+        // when its size doesn't match the panels of the micro kernel.
+        bool SetData(size_t k, size_t n, std::vector<float> data);
+        const std::vector<uint16_t>& GetHalfData() const {
+            return mHalfData;
+        }
+        bool SetHalfData(size_t k, size_t n, std::vector<uint16_t> data);
+
+      private:
+        // Sets the kernel and the shape when |size| matches the panels of a K x N matrix.
+        bool SetShape(size_t k, size_t n, size_t size);
+
+        const GemmMicroKernel* mKernel = nullptr;
+        size_t mRows = 0;
+        size_t mColumns = 0;
+        // Only one of them is used.
+        std::vector<float> mData;
+        std::vector<uint16_t> mHalfData;
+    };
+
+    // C[M, N] = A[M, K] * B, plus C when |accumulate|, split into tiles that can be computed
+    // independently.
+    class GemmTiling {
+      public:
+        // Chooses tiles small enough to give at least |minTileCount| tiles when possible.
+        GemmTiling(size_t m, size_t n, size_t minTileCount);
+
+        size_t GetTileCount() const {
+            return mRowTiles * mColumnTiles;
+        }
+
+        // A[M, K] is read at a[m * aRowStride + k * aColumnStride], C is densely packed with
+        // |cRowStride| between its rows.
+        void ComputeTile(size_t tile,
+                         const float* a,
+                         size_t aRowStride,
+                         size_t aColumnStride,
+                         const PackedMatrix& b,
+                         float* c,
+                         size_t cRowStride,
+                         bool accumulate) const;
+
+      private:
+        size_t mM;
+        size_t mN;
+        size_t mRowBlock;
+        size_t mColumnBlock;
+        size_t mRowTiles;
+        size_t mColumnTiles;
+    };
+
+    // Computes all the tiles of C = A * B (+ C) on |threadPool|.
+    void Sgemm(ThreadPool* threadPool,
+               size_t m,
+               const float* a,
+               size_t aRowStride,
+               size_t aColumnStride,
+               const PackedMatrix& b,
+               float* c,
+               size_t cRowStride,
+               bool accumulate);
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_SGEMM_CPU_H_
@@ -0,0 +1,176 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+
+#if defined(WEBNN_CPU_X86)
+
+#    include <immintrin.h>
+
+#    include <cmath>
+#    include <cstddef>
+#    include <cstdint>
+#    include <cstring>
+#    include <limits>
+
+#    include "dawn/native/cpu/SgemmCPU.h"
+#    include "dawn/native/ops/Binary.h"
+#    include "dawn/native/ops/Reduce.h"
+#    include "dawn/native/ops/Unary.h"
+
+// Only the code below is compiled for AVX2, FMA and F16C, it runs after GetSimdLevel() checked
+// them.
+#    if defined(__clang__)
+#        pragma clang attribute push(__attribute__((target("avx2,fma,f16c"))), \
+                                     apply_to = function)
+#    elif defined(__GNUC__)
+#        pragma GCC push_options
+#        pragma GCC target("avx2,fma,f16c")
+#    endif
+
+#    include "dawn/native/cpu/VectorMathCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        struct VecAVX2 {
+            using Reg = __m256;
+            static constexpr size_t kWidth = 8;
+
+            static Reg Load(const float* p) {
+                return _mm256_loadu_ps(p);
+            }
+            static void Store(float* p, Reg x) {
+                _mm256_storeu_ps(p, x);
+            }
+            static Reg LoadHalf(const uint16_t* p) {
+                return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            }
+            static void StoreHalf(uint16_t* p, Reg x) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(p),
+                                 _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT));
+            }
+            static Reg Set1(float x) {
+                return _mm256_set1_ps(x);
+            }
+            static Reg Zero() {
+                return _mm256_setzero_ps();
+            }
+            static Reg Add(Reg a, Reg b) {
+                return _mm256_add_ps(a, b);
+            }
+            static Reg Sub(Reg a, Reg b) {
+                return _mm256_sub_ps(a, b);
+            }
+            static Reg Mul(Reg a, Reg b) {
+                return _mm256_mul_ps(a, b);
+            }
+            static Reg Div(Reg a, Reg b) {
+                return _mm256_div_ps(a, b);
+            }
+            static Reg Max(Reg a, Reg b) {
+                return _mm256_max_ps(a, b);
+            }
+            static Reg Min(Reg a, Reg b) {
+                return _mm256_min_ps(a, b);
+            }
+            static Reg MulAdd(Reg a, Reg b, Reg c) {
+                return _mm256_fmadd_ps(a, b, c);
+            }
+            static Reg Floor(Reg x) {
+                return _mm256_floor_ps(x);
+            }
+            static Reg Ceil(Reg x) {
+                return _mm256_ceil_ps(x);
+            }
+            static Reg Abs(Reg x) {
+                return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+            }
+            static Reg SelectLess(Reg a, Reg b, Reg x, Reg y) {
+                return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+            }
+            static Reg Pow2(Reg n) {
+                __m256i bits = _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127));
+                return _mm256_castsi256_ps(_mm256_slli_epi32(bits, 23));
+            }
+            static Reg Exponent(Reg x) {
+                __m256i bits = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+                bits = _mm256_and_si256(bits, _mm256_set1_epi32(0xFF));
+                return _mm256_cvtepi32_ps(_mm256_sub_epi32(bits, _mm256_set1_epi32(126)));
+            }
+            static Reg Mantissa(Reg x) {
+                __m256i bits = _mm256_and_si256(_mm256_castps_si256(x),
+                                                _mm256_set1_epi32(0x807FFFFF));
+                bits = _mm256_or_si256(bits, _mm256_set1_epi32(0x3F000000));
+                return _mm256_castsi256_ps(bits);
+            }
+            // Transposes the 8 x 8 matrix of |rows| in place.
+            static void Transpose(Reg* rows) {
+                Reg t[8];
+                for (size_t i = 0; i < 4; ++i) {
+                    t[2 * i] = _mm256_unpacklo_ps(rows[2 * i], rows[2 * i + 1]);
+                    t[2 * i + 1] = _mm256_unpackhi_ps(rows[2 * i], rows[2 * i + 1]);
+                }
+                // Each 128-bit lane now holds 4 x 4 blocks, transposed in the lanes.
+                for (size_t i = 0; i < 2; ++i) {
+                    rows[4 * i] = _mm256_shuffle_ps(t[4 * i], t[4 * i + 2], 0x44);
+                    rows[4 * i + 1] = _mm256_shuffle_ps(t[4 * i], t[4 * i + 2], 0xEE);
+                    rows[4 * i + 2] = _mm256_shuffle_ps(t[4 * i + 1], t[4 * i + 3], 0x44);
+                    rows[4 * i + 3] = _mm256_shuffle_ps(t[4 * i + 1], t[4 * i + 3], 0xEE);
+                }
+                for (size_t j = 0; j < 4; ++j) {
+                    t[j] = _mm256_permute2f128_ps(rows[j], rows[4 + j], 0x20);
+                    t[4 + j] = _mm256_permute2f128_ps(rows[j], rows[4 + j], 0x31);
+                }
+                for (size_t i = 0; i < 8; ++i) {
+                    rows[i] = t[i];
+                }
+            }
+        };
+
+        const ElementwiseFunctions kAVX2Functions = {
+            VecUnary<VecAVX2>,
+            VecBinary<VecAVX2>,
+            VecSoftmax<VecAVX2>,
+            VecReduceRows<VecAVX2>,
+            VecReduceColumns<VecAVX2>,
+            VecClampLoop<VecAVX2>,
+            VecLerpLoop<VecAVX2>,
+            VecTranspose<VecAVX2>,
+            VecHalfToFloat<VecAVX2>,
+            VecFloatToHalf<VecAVX2>,
+        };
+
+        const GemmMicroKernel kAVX2GemmMicroKernel = {
+            6, 2 * VecAVX2::kWidth, VecGemmMicroKernel<VecAVX2, 6, 2>,
+            VecGemmMicroKernel<VecAVX2, 6, 2, uint16_t>};
+    }  // anonymous namespace
+
+    const ElementwiseFunctions& GetElementwiseFunctionsAVX2() {
+        return kAVX2Functions;
+    }
+
+    const GemmMicroKernel& GetGemmMicroKernelAVX2() {
+        return kAVX2GemmMicroKernel;
+    }
+
+}}  // namespace dawn::native::cpu
+
+#    if defined(__clang__)
+#        pragma clang attribute pop
+#    elif defined(__GNUC__)
+#        pragma GCC pop_options
+#    endif
+
+#endif  // defined(WEBNN_CPU_X86)
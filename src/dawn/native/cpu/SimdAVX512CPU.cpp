@@ -0,0 +1,182 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+
+#if defined(WEBNN_CPU_X86)
+
+#    include <immintrin.h>
+
+#    include <cmath>
+#    include <cstddef>
+#    include <cstdint>
+#    include <cstring>
+#    include <limits>
+
+#    include "dawn/native/cpu/SgemmCPU.h"
+#    include "dawn/native/ops/Binary.h"
+#    include "dawn/native/ops/Reduce.h"
+#    include "dawn/native/ops/Unary.h"
+
+// Only the code below is compiled for AVX-512, it runs after GetSimdLevel() checked it.
+#    if defined(__clang__)
+#        pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#    elif defined(__GNUC__)
+#        pragma GCC push_options
+#        pragma GCC target("avx512f")
+#    endif
+
+#    include "dawn/native/cpu/VectorMathCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        struct VecAVX512 {
+            using Reg = __m512;
+            static constexpr size_t kWidth = 16;
+
+            static Reg Load(const float* p) {
+                return _mm512_loadu_ps(p);
+            }
+            static void Store(float* p, Reg x) {
+                _mm512_storeu_ps(p, x);
+            }
+            static Reg LoadHalf(const uint16_t* p) {
+                return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+            }
+            static void StoreHalf(uint16_t* p, Reg x) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p),
+                                    _mm512_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT));
+            }
+            static Reg Set1(float x) {
+                return _mm512_set1_ps(x);
+            }
+            static Reg Zero() {
+                return _mm512_setzero_ps();
+            }
+            static Reg Add(Reg a, Reg b) {
+                return _mm512_add_ps(a, b);
+            }
+            static Reg Sub(Reg a, Reg b) {
+                return _mm512_sub_ps(a, b);
+            }
+            static Reg Mul(Reg a, Reg b) {
+                return _mm512_mul_ps(a, b);
+            }
+            static Reg Div(Reg a, Reg b) {
+                return _mm512_div_ps(a, b);
+            }
+            static Reg Max(Reg a, Reg b) {
+                return _mm512_max_ps(a, b);
+            }
+            static Reg Min(Reg a, Reg b) {
+                return _mm512_min_ps(a, b);
+            }
+            static Reg MulAdd(Reg a, Reg b, Reg c) {
+                return _mm512_fmadd_ps(a, b, c);
+            }
+            static Reg Floor(Reg x) {
+                return _mm512_roundscale_ps(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            }
+            static Reg Ceil(Reg x) {
+                return _mm512_roundscale_ps(x, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            }
+            static Reg Abs(Reg x) {
+                return _mm512_castsi512_ps(
+                    _mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(0x7FFFFFFF)));
+            }
+            static Reg SelectLess(Reg a, Reg b, Reg x, Reg y) {
+                return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), y, x);
+            }
+            static Reg Pow2(Reg n) {
+                __m512i bits = _mm512_add_epi32(_mm512_cvtps_epi32(n), _mm512_set1_epi32(127));
+                return _mm512_castsi512_ps(_mm512_slli_epi32(bits, 23));
+            }
+            static Reg Exponent(Reg x) {
+                __m512i bits = _mm512_srli_epi32(_mm512_castps_si512(x), 23);
+                bits = _mm512_and_si512(bits, _mm512_set1_epi32(0xFF));
+                return _mm512_cvtepi32_ps(_mm512_sub_epi32(bits, _mm512_set1_epi32(126)));
+            }
+            static Reg Mantissa(Reg x) {
+                __m512i bits = _mm512_and_si512(_mm512_castps_si512(x),
+                                                _mm512_set1_epi32(0x807FFFFF));
+                bits = _mm512_or_si512(bits, _mm512_set1_epi32(0x3F000000));
+                return _mm512_castsi512_ps(bits);
+            }
+            // Transposes the 16 x 16 matrix of |rows| in place.
+            static void Transpose(Reg* rows) {
+                Reg t[16];
+                for (size_t i = 0; i < 8; ++i) {
+                    t[2 * i] = _mm512_unpacklo_ps(rows[2 * i], rows[2 * i + 1]);
+                    t[2 * i + 1] = _mm512_unpackhi_ps(rows[2 * i], rows[2 * i + 1]);
+                }
+                // Each 128-bit lane now holds 4 x 4 blocks, transposed in the lanes.
+                for (size_t i = 0; i < 4; ++i) {
+                    rows[4 * i] = _mm512_shuffle_ps(t[4 * i], t[4 * i + 2], 0x44);
+                    rows[4 * i + 1] = _mm512_shuffle_ps(t[4 * i], t[4 * i + 2], 0xEE);
+                    rows[4 * i + 2] = _mm512_shuffle_ps(t[4 * i + 1], t[4 * i + 3], 0x44);
+                    rows[4 * i + 3] = _mm512_shuffle_ps(t[4 * i + 1], t[4 * i + 3], 0xEE);
+                }
+                // Gather the lane k of the 4 blocks of rows j, 4 + j, 8 + j and 12 + j.
+                for (size_t j = 0; j < 4; ++j) {
+                    Reg low01 = _mm512_shuffle_f32x4(rows[j], rows[4 + j], 0x44);
+                    Reg high01 = _mm512_shuffle_f32x4(rows[j], rows[4 + j], 0xEE);
+                    Reg low23 = _mm512_shuffle_f32x4(rows[8 + j], rows[12 + j], 0x44);
+                    Reg high23 = _mm512_shuffle_f32x4(rows[8 + j], rows[12 + j], 0xEE);
+                    t[j] = _mm512_shuffle_f32x4(low01, low23, 0x88);
+                    t[4 + j] = _mm512_shuffle_f32x4(low01, low23, 0xDD);
+                    t[8 + j] = _mm512_shuffle_f32x4(high01, high23, 0x88);
+                    t[12 + j] = _mm512_shuffle_f32x4(high01, high23, 0xDD);
+                }
+                for (size_t i = 0; i < 16; ++i) {
+                    rows[i] = t[i];
+                }
+            }
+        };
+
+        const ElementwiseFunctions kAVX512Functions = {
+            VecUnary<VecAVX512>,
+            VecBinary<VecAVX512>,
+            VecSoftmax<VecAVX512>,
+            VecReduceRows<VecAVX512>,
+            VecReduceColumns<VecAVX512>,
+            VecClampLoop<VecAVX512>,
+            VecLerpLoop<VecAVX512>,
+            VecTranspose<VecAVX512>,
+            VecHalfToFloat<VecAVX512>,
+            VecFloatToHalf<VecAVX512>,
+        };
+
+        const GemmMicroKernel kAVX512GemmMicroKernel = {
+            8, 2 * VecAVX512::kWidth, VecGemmMicroKernel<VecAVX512, 8, 2>,
+            VecGemmMicroKernel<VecAVX512, 8, 2, uint16_t>};
+    }  // anonymous namespace
+
+    const ElementwiseFunctions& GetElementwiseFunctionsAVX512() {
+        return kAVX512Functions;
+    }
+
+    const GemmMicroKernel& GetGemmMicroKernelAVX512() {
+        return kAVX512GemmMicroKernel;
+    }
+
+}}  // namespace dawn::native::cpu
+
+#    if defined(__clang__)
+#        pragma clang attribute pop
+#    elif defined(__GNUC__)
+#        pragma GCC pop_options
+#    endif
+
+#endif  // defined(WEBNN_CPU_X86)
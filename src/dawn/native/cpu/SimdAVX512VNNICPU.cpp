@@ -0,0 +1,80 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/Int8GemmCPU.h"
+
+#if defined(WEBNN_CPU_X86)
+
+#    include <immintrin.h>
+
+#    include <cstring>
+
+// Only the code below is compiled for AVX512-VNNI, it runs after HasInt8DotProduct() checked
+// it.
+#    if defined(__clang__)
+#        pragma clang attribute push(__attribute__((target("avx512f,avx512vnni"))), \
+                                     apply_to = function)
+#    elif defined(__GNUC__)
+#        pragma GCC push_options
+#        pragma GCC target("avx512f,avx512vnni")
+#    endif
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        constexpr size_t kRows = 8;
+
+        // Every VPDPBUSD multiplies the 4 uint8 values of a row of A broadcast to all the lanes
+        // with the 4 int8 values of the 16 columns of a group of B, and adds them to the int32
+        // sums of the row.
+        void Int8GemmMicroKernelVNNI(size_t kc,
+                                     const uint8_t* a,
+                                     size_t aRowStride,
+                                     const int8_t* b,
+                                     int32_t* c) {
+            static_assert(kInt8GemmPanelWidth == 16 && kInt8GemmDepthGroup == 4);
+            __m512i sums[kRows];
+            for (size_t i = 0; i < kRows; ++i) {
+                sums[i] = _mm512_setzero_si512();
+            }
+            for (size_t p = 0; p < kc; p += kInt8GemmDepthGroup) {
+                __m512i group = _mm512_loadu_si512(b + p * kInt8GemmPanelWidth);
+                for (size_t i = 0; i < kRows; ++i) {
+                    int32_t values;
+                    memcpy(&values, a + i * aRowStride + p, sizeof(values));
+                    sums[i] = _mm512_dpbusd_epi32(sums[i], _mm512_set1_epi32(values), group);
+                }
+            }
+            for (size_t i = 0; i < kRows; ++i) {
+                _mm512_storeu_si512(c + i * kInt8GemmPanelWidth, sums[i]);
+            }
+        }
+
+        const Int8GemmMicroKernel kVNNIInt8GemmMicroKernel = {kRows, false,
+                                                              Int8GemmMicroKernelVNNI};
+    }  // anonymous namespace
+
+    const Int8GemmMicroKernel& GetInt8GemmMicroKernelVNNI() {
+        return kVNNIInt8GemmMicroKernel;
+    }
+
+}}  // namespace dawn::native::cpu
+
+#    if defined(__clang__)
+#        pragma clang attribute pop
+#    elif defined(__GNUC__)
+#        pragma GCC pop_options
+#    endif
+
+#endif  // defined(WEBNN_CPU_X86)
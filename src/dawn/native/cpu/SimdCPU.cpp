@@ -0,0 +1,184 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/SimdCPU.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Compiler.h"
+#include "dawn/common/Platform.h"
+
+#if defined(WEBNN_CPU_X86)
+#    if defined(DAWN_COMPILER_MSVC)
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#elif defined(WEBNN_CPU_ARM64)
+#    if defined(DAWN_PLATFORM_LINUX)
+#        include <sys/auxv.h>
+#    elif defined(DAWN_PLATFORM_APPLE)
+#        include <sys/sysctl.h>
+#    elif defined(DAWN_PLATFORM_WINDOWS)
+#        include <windows.h>
+#    endif
+#endif
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+#if defined(WEBNN_CPU_X86)
+        void CpuId(uint32_t leaf, uint32_t registers[4]) {
+#    if defined(DAWN_COMPILER_MSVC)
+            int values[4];
+            __cpuidex(values, leaf, 0);
+            memcpy(registers, values, sizeof(values));
+#    else
+            __cpuid_count(leaf, 0, registers[0], registers[1], registers[2], registers[3]);
+#    endif
+        }
+
+        // The register states the OS saves on context switches, from XGETBV.
+        uint64_t GetEnabledRegisterStates() {
+#    if defined(DAWN_COMPILER_MSVC)
+            return _xgetbv(0);
+#    else
+            uint32_t eax, edx;
+            __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<uint64_t>(edx) << 32) | eax;
+#    endif
+        }
+
+        SimdLevel DetectSimdLevel() {
+            uint32_t registers[4];
+            CpuId(0, registers);
+            uint32_t maxLeaf = registers[0];
+            if (maxLeaf < 7) {
+                return SimdLevel::Scalar;
+            }
+            CpuId(1, registers);
+            bool hasOsxsave = registers[2] & (1u << 27);
+            bool hasFma = registers[2] & (1u << 12);
+            bool hasF16c = registers[2] & (1u << 29);
+            if (!hasOsxsave) {
+                return SimdLevel::Scalar;
+            }
+            uint64_t states = GetEnabledRegisterStates();
+            // SSE and AVX states for the ymm registers, plus the opmask and zmm states.
+            constexpr uint64_t kAvxStates = 0x6;
+            constexpr uint64_t kAvx512States = 0xE0;
+            CpuId(7, registers);
+            bool hasAvx2 = registers[1] & (1u << 5);
+            bool hasAvx512f = registers[1] & (1u << 16);
+            if ((states & kAvxStates) != kAvxStates || !hasAvx2 || !hasFma || !hasF16c) {
+                return SimdLevel::Scalar;
+            }
+            if (hasAvx512f && (states & kAvx512States) == kAvx512States) {
+                return SimdLevel::AVX512;
+            }
+            return SimdLevel::AVX2;
+        }
+
+        bool DetectInt8DotProduct() {
+            if (GetSimdLevel() != SimdLevel::AVX512) {
+                return false;
+            }
+            uint32_t registers[4];
+            CpuId(7, registers);
+            return registers[2] & (1u << 11);
+        }
+#elif defined(WEBNN_CPU_ARM64)
+        SimdLevel DetectSimdLevel() {
+            return SimdLevel::NEON;
+        }
+
+        bool DetectInt8DotProduct() {
+            if (GetSimdLevel() != SimdLevel::NEON) {
+                return false;
+            }
+#    if defined(DAWN_PLATFORM_LINUX)
+            // HWCAP_ASIMDDP, which older headers don't define.
+            return getauxval(AT_HWCAP) & (1ul << 20);
+#    elif defined(DAWN_PLATFORM_APPLE)
+            int value = 0;
+            size_t size = sizeof(value);
+            return sysctlbyname("hw.optional.arm.FEAT_DotProd", &value, &size, nullptr, 0) == 0 &&
+                   value != 0;
+#    elif defined(DAWN_PLATFORM_WINDOWS)
+            return IsProcessorFeaturePresent(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE);
+#    else
+            return false;
+#    endif
+        }
+#else
+        SimdLevel DetectSimdLevel() {
+            return SimdLevel::Scalar;
+        }
+
+        bool DetectInt8DotProduct() {
+            return false;
+        }
+#endif
+
+        // WEBNN_CPU_SIMD_LEVEL=scalar|neon|avx2|avx512 caps the detected level, which is useful
+        // to compare the code paths on one machine.
+        SimdLevel ApplySimdLevelOverride(SimdLevel detected) {
+            const char* value = getenv("WEBNN_CPU_SIMD_LEVEL");
+            if (value == nullptr) {
+                return detected;
+            }
+            for (SimdLevel level :
+                 {SimdLevel::Scalar, SimdLevel::NEON, SimdLevel::AVX2, SimdLevel::AVX512}) {
+                if (strcmp(value, SimdLevelToString(level)) != 0) {
+                    continue;
+                }
+                // Only the levels supported by the CPU can be selected.
+                if (level == SimdLevel::Scalar || level == detected ||
+                    (level == SimdLevel::AVX2 && detected == SimdLevel::AVX512)) {
+                    return level;
+                }
+            }
+            return detected;
+        }
+    }  // anonymous namespace
+
+    SimdLevel GetSimdLevel() {
+        static const SimdLevel level = ApplySimdLevelOverride(DetectSimdLevel());
+        return level;
+    }
+
+    bool HasInt8DotProduct() {
+        static const bool hasInt8DotProduct = DetectInt8DotProduct();
+        return hasInt8DotProduct;
+    }
+
+    const char* SimdLevelToString(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::Scalar:
+                return "scalar";
+            case SimdLevel::NEON:
+                return "neon";
+            case SimdLevel::AVX2:
+                return "avx2";
+            case SimdLevel::AVX512:
+                return "avx512";
+        }
+        DAWN_UNREACHABLE();
+    }
+
+}}  // namespace dawn::native::cpu
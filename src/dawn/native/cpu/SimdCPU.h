@@ -0,0 +1,44 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_SIMD_CPU_H_
+#define WEBNN_NATIVE_CPU_SIMD_CPU_H_
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#    define WEBNN_CPU_X86 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define WEBNN_CPU_ARM64 1
+#endif
+
+namespace dawn::native { namespace cpu {
+
+    // The widest instruction set the kernels may use on the running CPU. The x86 levels are
+    // detected at runtime, NEON is always available on arm64.
+    enum class SimdLevel {
+        Scalar,
+        NEON,
+        AVX2,
+        AVX512,
+    };
+
+    SimdLevel GetSimdLevel();
+    const char* SimdLevelToString(SimdLevel level);
+
+    // Whether the quantized kernels may use the int8 dot product instructions: AVX512-VNNI
+    // with the AVX512 level on x86, SDOT on arm64. Detected at runtime on both.
+    bool HasInt8DotProduct();
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_SIMD_CPU_H_
@@ -0,0 +1,138 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+
+#if defined(WEBNN_CPU_ARM64)
+
+#    include <arm_neon.h>
+
+#    include <cstdint>
+
+#    include "dawn/native/cpu/SgemmCPU.h"
+
+// NEON is part of the arm64 baseline, so unlike the x86 files no target needs to be enabled.
+#    include "dawn/native/cpu/VectorMathCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        struct VecNEON {
+            using Reg = float32x4_t;
+            static constexpr size_t kWidth = 4;
+
+            static Reg Load(const float* p) {
+                return vld1q_f32(p);
+            }
+            static void Store(float* p, Reg x) {
+                vst1q_f32(p, x);
+            }
+            static Reg LoadHalf(const uint16_t* p) {
+                return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(p)));
+            }
+            static void StoreHalf(uint16_t* p, Reg x) {
+                vst1_u16(p, vreinterpret_u16_f16(vcvt_f16_f32(x)));
+            }
+            static Reg Set1(float x) {
+                return vdupq_n_f32(x);
+            }
+            static Reg Zero() {
+                return vdupq_n_f32(0.0f);
+            }
+            static Reg Add(Reg a, Reg b) {
+                return vaddq_f32(a, b);
+            }
+            static Reg Sub(Reg a, Reg b) {
+                return vsubq_f32(a, b);
+            }
+            static Reg Mul(Reg a, Reg b) {
+                return vmulq_f32(a, b);
+            }
+            static Reg Div(Reg a, Reg b) {
+                return vdivq_f32(a, b);
+            }
+            static Reg Max(Reg a, Reg b) {
+                return vmaxq_f32(a, b);
+            }
+            static Reg Min(Reg a, Reg b) {
+                return vminq_f32(a, b);
+            }
+            static Reg MulAdd(Reg a, Reg b, Reg c) {
+                return vfmaq_f32(c, a, b);
+            }
+            static Reg Floor(Reg x) {
+                return vrndmq_f32(x);
+            }
+            static Reg Ceil(Reg x) {
+                return vrndpq_f32(x);
+            }
+            static Reg Abs(Reg x) {
+                return vabsq_f32(x);
+            }
+            static Reg SelectLess(Reg a, Reg b, Reg x, Reg y) {
+                return vbslq_f32(vcltq_f32(a, b), x, y);
+            }
+            static Reg Pow2(Reg n) {
+                int32x4_t bits = vaddq_s32(vcvtnq_s32_f32(n), vdupq_n_s32(127));
+                return vreinterpretq_f32_s32(vshlq_n_s32(bits, 23));
+            }
+            static Reg Exponent(Reg x) {
+                uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(x), 23);
+                int32x4_t exponent = vreinterpretq_s32_u32(vandq_u32(bits, vdupq_n_u32(0xFF)));
+                return vcvtq_f32_s32(vsubq_s32(exponent, vdupq_n_s32(126)));
+            }
+            static Reg Mantissa(Reg x) {
+                uint32x4_t bits = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x807FFFFF));
+                return vreinterpretq_f32_u32(vorrq_u32(bits, vdupq_n_u32(0x3F000000)));
+            }
+            // Transposes the 4 x 4 matrix of |rows| in place.
+            static void Transpose(Reg* rows) {
+                float32x4x2_t t01 = vtrnq_f32(rows[0], rows[1]);
+                float32x4x2_t t23 = vtrnq_f32(rows[2], rows[3]);
+                rows[0] = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+                rows[1] = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+                rows[2] = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+                rows[3] = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+            }
+        };
+
+        const ElementwiseFunctions kNEONFunctions = {
+            VecUnary<VecNEON>,
+            VecBinary<VecNEON>,
+            VecSoftmax<VecNEON>,
+            VecReduceRows<VecNEON>,
+            VecReduceColumns<VecNEON>,
+            VecClampLoop<VecNEON>,
+            VecLerpLoop<VecNEON>,
+            VecTranspose<VecNEON>,
+            VecHalfToFloat<VecNEON>,
+            VecFloatToHalf<VecNEON>,
+        };
+
+        const GemmMicroKernel kNEONGemmMicroKernel = {
+            8, 2 * VecNEON::kWidth, VecGemmMicroKernel<VecNEON, 8, 2>,
+            VecGemmMicroKernel<VecNEON, 8, 2, uint16_t>};
+    }  // anonymous namespace
+
+    const ElementwiseFunctions& GetElementwiseFunctionsNEON() {
+        return kNEONFunctions;
+    }
+
+    const GemmMicroKernel& GetGemmMicroKernelNEON() {
+        return kNEONGemmMicroKernel;
+    }
+
+}}  // namespace dawn::native::cpu
+
+#endif  // defined(WEBNN_CPU_ARM64)
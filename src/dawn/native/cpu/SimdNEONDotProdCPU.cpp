@@ -0,0 +1,88 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/Int8GemmCPU.h"
+
+#if defined(WEBNN_CPU_ARM64)
+
+#    include <cstring>
+
+// Only the code below is compiled for the dot product extension of Armv8.2, it runs after
+// HasInt8DotProduct() checked it.
+#    if defined(__clang__)
+#        pragma clang attribute push(__attribute__((target("dotprod"))), apply_to = function)
+#    elif defined(__GNUC__)
+#        pragma GCC push_options
+#        pragma GCC target("arch=armv8.2-a+dotprod")
+#    endif
+
+#    include <arm_neon.h>
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        constexpr size_t kRows = 4;
+
+        // Every SDOT multiplies the 4 values of a row of A, broadcast to the 4 lanes, with the
+        // 4 int8 values of 4 columns of a group of B and adds them to the int32 sums. SDOT is
+        // signed, so A is read as int8.
+        void Int8GemmMicroKernelDotProd(size_t kc,
+                                        const uint8_t* a,
+                                        size_t aRowStride,
+                                        const int8_t* b,
+                                        int32_t* c) {
+            static_assert(kInt8GemmPanelWidth == 16 && kInt8GemmDepthGroup == 4);
+            int32x4_t sums[kRows][4];
+            for (size_t i = 0; i < kRows; ++i) {
+                for (size_t j = 0; j < 4; ++j) {
+                    sums[i][j] = vdupq_n_s32(0);
+                }
+            }
+            for (size_t p = 0; p < kc; p += kInt8GemmDepthGroup) {
+                const int8_t* group = b + p * kInt8GemmPanelWidth;
+                int8x16_t columns[4] = {vld1q_s8(group), vld1q_s8(group + 16),
+                                        vld1q_s8(group + 32), vld1q_s8(group + 48)};
+                for (size_t i = 0; i < kRows; ++i) {
+                    int32_t values;
+                    memcpy(&values, a + i * aRowStride + p, sizeof(values));
+                    int8x16_t row = vreinterpretq_s8_s32(vdupq_n_s32(values));
+                    for (size_t j = 0; j < 4; ++j) {
+                        sums[i][j] = vdotq_s32(sums[i][j], row, columns[j]);
+                    }
+                }
+            }
+            for (size_t i = 0; i < kRows; ++i) {
+                for (size_t j = 0; j < 4; ++j) {
+                    vst1q_s32(c + i * kInt8GemmPanelWidth + j * 4, sums[i][j]);
+                }
+            }
+        }
+
+        const Int8GemmMicroKernel kDotProdInt8GemmMicroKernel = {kRows, true,
+                                                                 Int8GemmMicroKernelDotProd};
+    }  // anonymous namespace
+
+    const Int8GemmMicroKernel& GetInt8GemmMicroKernelDotProd() {
+        return kDotProdInt8GemmMicroKernel;
+    }
+
+}}  // namespace dawn::native::cpu
+
+#    if defined(__clang__)
+#        pragma clang attribute pop
+#    elif defined(__GNUC__)
+#        pragma GCC pop_options
+#    endif
+
+#endif  // defined(WEBNN_CPU_ARM64)
@@ -0,0 +1,132 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+#include "dawn/native/cpu/Float16CPU.h"
+#include "dawn/native/cpu/SgemmCPU.h"
+#include "dawn/native/cpu/VectorMathCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // One lane vectors, the fallback for CPUs without a supported instruction set.
+        struct VecScalar {
+            using Reg = float;
+            static constexpr size_t kWidth = 1;
+
+            static Reg Load(const float* p) {
+                return *p;
+            }
+            static void Store(float* p, Reg x) {
+                *p = x;
+            }
+            static Reg LoadHalf(const uint16_t* p) {
+                return HalfToFloat(*p);
+            }
+            static void StoreHalf(uint16_t* p, Reg x) {
+                *p = FloatToHalf(x);
+            }
+            static Reg Set1(float x) {
+                return x;
+            }
+            static Reg Zero() {
+                return 0.0f;
+            }
+            static Reg Add(Reg a, Reg b) {
+                return a + b;
+            }
+            static Reg Sub(Reg a, Reg b) {
+                return a - b;
+            }
+            static Reg Mul(Reg a, Reg b) {
+                return a * b;
+            }
+            static Reg Div(Reg a, Reg b) {
+                return a / b;
+            }
+            static Reg Max(Reg a, Reg b) {
+                return a > b ? a : b;
+            }
+            static Reg Min(Reg a, Reg b) {
+                return a < b ? a : b;
+            }
+            static Reg MulAdd(Reg a, Reg b, Reg c) {
+                return a * b + c;
+            }
+            static Reg Floor(Reg x) {
+                return std::floor(x);
+            }
+            static Reg Ceil(Reg x) {
+                return std::ceil(x);
+            }
+            static Reg Abs(Reg x) {
+                return std::fabs(x);
+            }
+            static Reg SelectLess(Reg a, Reg b, Reg x, Reg y) {
+                return a < b ? x : y;
+            }
+            static Reg Pow2(Reg n) {
+                uint32_t bits = static_cast<uint32_t>(static_cast<int32_t>(n) + 127) << 23;
+                float result;
+                memcpy(&result, &bits, sizeof(result));
+                return result;
+            }
+            static Reg Exponent(Reg x) {
+                uint32_t bits;
+                memcpy(&bits, &x, sizeof(bits));
+                return static_cast<float>(static_cast<int32_t>((bits >> 23) & 0xFF) - 126);
+            }
+            static Reg Mantissa(Reg x) {
+                uint32_t bits;
+                memcpy(&bits, &x, sizeof(bits));
+                bits = (bits & 0x807FFFFFu) | 0x3F000000u;
+                float result;
+                memcpy(&result, &bits, sizeof(result));
+                return result;
+            }
+            static void Transpose(Reg* rows) {
+            }
+        };
+
+        const ElementwiseFunctions kScalarFunctions = {
+            VecUnary<VecScalar>,
+            VecBinary<VecScalar>,
+            VecSoftmax<VecScalar>,
+            VecReduceRows<VecScalar>,
+            VecReduceColumns<VecScalar>,
+            VecClampLoop<VecScalar>,
+            VecLerpLoop<VecScalar>,
+            VecTranspose<VecScalar>,
+            VecHalfToFloat<VecScalar>,
+            VecFloatToHalf<VecScalar>,
+        };
+
+        const GemmMicroKernel kScalarGemmMicroKernel = {
+            4, 4, VecGemmMicroKernel<VecScalar, 4, 4>,
+            VecGemmMicroKernel<VecScalar, 4, 4, uint16_t>};
+    }  // anonymous namespace
+
+    const ElementwiseFunctions& GetElementwiseFunctionsScalar() {
+        return kScalarFunctions;
+    }
+
+    const GemmMicroKernel& GetGemmMicroKernelScalar() {
+        return kScalarGemmMicroKernel;
+    }
+
+}}  // namespace dawn::native::cpu
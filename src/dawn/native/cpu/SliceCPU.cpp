@@ -0,0 +1,103 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/SliceCPU.h"
+
+#include <cstring>
+
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    SliceKernel::SliceKernel(uint32_t input,
+                             uint32_t output,
+                             size_t elementSize,
+                             const std::vector<int32_t>& inputShape,
+                             const std::vector<int32_t>& outputShape,
+                             const std::vector<int32_t>& offsets)
+        : Kernel({input}, {output}) {
+        std::vector<size_t> strides = GetStrides(inputShape);
+        // The rows start at the last sliced dimension.
+        size_t rowDimension = 0;
+        for (size_t i = 0; i < inputShape.size(); ++i) {
+            if (outputShape[i] != inputShape[i]) {
+                rowDimension = i;
+            }
+        }
+        mRowSize = elementSize;
+        for (size_t i = rowDimension; i < outputShape.size(); ++i) {
+            mRowSize *= outputShape[i];
+        }
+        for (size_t i = 0; i < inputShape.size(); ++i) {
+            mInputOffset += offsets[i] * strides[i] * elementSize;
+            if (i < rowDimension) {
+                mOuterShape.push_back(outputShape[i]);
+                mInputStrides.push_back(strides[i] * elementSize);
+            }
+        }
+    }
+
+    void SliceKernel::Compute(const ExecutionContext& context) const {
+        const uint8_t* input = context.GetData<uint8_t>(mInputs[0]) + mInputOffset;
+        uint8_t* output = context.GetData<uint8_t>(mOutputs[0]);
+        size_t rowCount = GetElementCount(mOuterShape);
+        context.GetThreadPool()->ParallelFor(rowCount, [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; ++row) {
+                const uint8_t* x = input;
+                size_t index = row;
+                for (size_t i = mOuterShape.size(); i-- > 0;) {
+                    x += (index % mOuterShape[i]) * mInputStrides[i];
+                    index /= mOuterShape[i];
+                }
+                memcpy(output + row * mRowSize, x, mRowSize);
+            }
+        });
+    }
+
+    SplitKernel::SplitKernel(uint32_t input,
+                             std::vector<uint32_t> outputs,
+                             size_t elementSize,
+                             const std::vector<std::vector<int32_t>>& outputShapes,
+                             uint32_t axis)
+        : Kernel({input}, std::move(outputs)) {
+        const std::vector<int32_t>& shape = outputShapes[0];
+        for (uint32_t i = 0; i < axis; ++i) {
+            mOuterSize *= shape[i];
+        }
+        for (const std::vector<int32_t>& outputShape : outputShapes) {
+            size_t sliceSize = elementSize;
+            for (size_t i = axis; i < outputShape.size(); ++i) {
+                sliceSize *= outputShape[i];
+            }
+            mOutputSliceSizes.push_back(sliceSize);
+            mInputSliceSize += sliceSize;
+        }
+    }
+
+    void SplitKernel::Compute(const ExecutionContext& context) const {
+        const uint8_t* input = context.GetData<uint8_t>(mInputs[0]);
+        context.GetThreadPool()->ParallelFor(mOuterSize, [&](size_t begin, size_t end) {
+            for (size_t outer = begin; outer < end; ++outer) {
+                const uint8_t* x = input + outer * mInputSliceSize;
+                for (size_t i = 0; i < mOutputs.size(); ++i) {
+                    uint8_t* y =
+                        context.GetData<uint8_t>(mOutputs[i]) + outer * mOutputSliceSizes[i];
+                    memcpy(y, x, mOutputSliceSizes[i]);
+                    x += mOutputSliceSizes[i];
+                }
+            }
+        });
+    }
+
+}}  // namespace dawn::native::cpu
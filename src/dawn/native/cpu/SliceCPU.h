@@ -0,0 +1,71 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_SLICE_CPU_H_
+#define WEBNN_NATIVE_CPU_SLICE_CPU_H_
+
+#include "dawn/native/cpu/KernelCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    // Copies the block of |outputShape| at |offsets| of the input, of any operand type. The
+    // trailing dimensions that are not sliced are copied as contiguous rows.
+    class SliceKernel final : public Kernel {
+      public:
+        SliceKernel(uint32_t input,
+                    uint32_t output,
+                    size_t elementSize,
+                    const std::vector<int32_t>& inputShape,
+                    const std::vector<int32_t>& outputShape,
+                    const std::vector<int32_t>& offsets);
+
+        const char* GetName() const override {
+            return "Slice";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        // The output as rows of mRowSize bytes over mOuterShape.
+        std::vector<int32_t> mOuterShape;
+        // The input strides in bytes of the dimensions of mOuterShape.
+        std::vector<size_t> mInputStrides;
+        // The offset in bytes of the first row in the input.
+        size_t mInputOffset = 0;
+        size_t mRowSize;
+    };
+
+    // Splits a tensor of any operand type along |axis|, the reverse of ConcatKernel.
+    class SplitKernel final : public Kernel {
+      public:
+        SplitKernel(uint32_t input,
+                    std::vector<uint32_t> outputs,
+                    size_t elementSize,
+                    const std::vector<std::vector<int32_t>>& outputShapes,
+                    uint32_t axis);
+
+        const char* GetName() const override {
+            return "Split";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        size_t mOuterSize = 1;
+        // The bytes that every output takes from one outer slice of the input.
+        std::vector<size_t> mOutputSliceSizes;
+        size_t mInputSliceSize = 0;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_SLICE_CPU_H_
@@ -0,0 +1,241 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+#include <algorithm>
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // Each thread gets a few chunks so that uneven chunks still balance out.
+        constexpr size_t kChunksPerThread = 4;
+    }  // anonymous namespace
+
+    // static
+    std::shared_ptr<ThreadPool> ThreadPool::GetDefault() {
+        static std::mutex mutex;
+        static std::weak_ptr<ThreadPool> defaultPool;
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<ThreadPool> pool = defaultPool.lock();
+        if (pool == nullptr) {
+            pool = std::make_shared<ThreadPool>(std::max(1u, std::thread::hardware_concurrency()));
+            defaultPool = pool;
+        }
+        return pool;
+    }
+
+    ThreadPool::ThreadPool(uint32_t threadCount) {
+        DAWN_ASSERT(threadCount >= 1);
+        mThreads.reserve(threadCount - 1);
+        for (uint32_t i = 0; i + 1 < threadCount; ++i) {
+            mThreads.emplace_back(&ThreadPool::WorkerLoop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopping = true;
+        }
+        mJobAvailable.notify_all();
+        for (auto& thread : mThreads) {
+            thread.join();
+        }
+    }
+
+    uint32_t ThreadPool::GetThreadCount() const {
+        return static_cast<uint32_t>(mThreads.size()) + 1;
+    }
+
+    // static
+    void ThreadPool::RunChunks(Job* job) {
+        for (;;) {
+            size_t chunk = job->nextChunk.fetch_add(1);
+            if (chunk >= job->chunkCount) {
+                return;
+            }
+            size_t begin = chunk * job->chunkSize;
+            size_t end = std::min(job->count, begin + job->chunkSize);
+            (*job->task)(begin, end);
+        }
+    }
+
+    void ThreadPool::RunGraphNodes(Job* job) {
+        GraphRun* run = job->graph;
+        const TaskGraph& graph = *run->graph;
+        std::unique_lock<std::mutex> lock(run->mutex);
+        while (!run->readyNodes.empty()) {
+            uint32_t node = run->readyNodes.back();
+            run->readyNodes.pop_back();
+            lock.unlock();
+            (*run->task)(node);
+            lock.lock();
+
+            size_t readyCount = run->readyNodes.size();
+            // The ready nodes are taken last in first out, push the dependents in reverse so
+            // that they run in order.
+            uint32_t begin = graph.dependentOffsets[node];
+            for (uint32_t i = graph.dependentOffsets[node + 1]; i-- > begin;) {
+                uint32_t dependent = graph.dependents[i];
+                if (--run->pendingDependencies[dependent] == 0) {
+                    run->readyNodes.push_back(dependent);
+                }
+            }
+            if (--run->remainingNodes == 0 || run->readyNodes.size() > readyCount) {
+                run->progress.notify_all();
+            }
+            // This thread goes on with one of the new ready nodes, the workers take the others.
+            if (run->readyNodes.size() > readyCount + 1) {
+                lock.unlock();
+                RequeueJob(job);
+                lock.lock();
+            }
+        }
+    }
+
+    // static
+    bool ThreadPool::HasPendingWork(Job* job) {
+        if (job->graph == nullptr) {
+            return job->nextChunk.load() < job->chunkCount;
+        }
+        std::lock_guard<std::mutex> lock(job->graph->mutex);
+        return !job->graph->readyNodes.empty();
+    }
+
+    void ThreadPool::RequeueJob(Job* job) {
+        if (mThreads.empty()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (std::find(mJobs.begin(), mJobs.end(), job) == mJobs.end()) {
+                mJobs.push_back(job);
+            }
+        }
+        mJobAvailable.notify_all();
+    }
+
+    void ThreadPool::FinishJob(Job* job) {
+        // The job lives on the stack frame of the caller, wait for the workers still running
+        // it.
+        std::unique_lock<std::mutex> lock(mMutex);
+        auto it = std::find(mJobs.begin(), mJobs.end(), job);
+        if (it != mJobs.end()) {
+            mJobs.erase(it);
+        }
+        mJobFinished.wait(lock, [job] { return job->activeWorkers == 0; });
+    }
+
+    void ThreadPool::WorkerLoop() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        for (;;) {
+            mJobAvailable.wait(lock, [this] { return mStopping || !mJobs.empty(); });
+            if (mStopping) {
+                return;
+            }
+            Job* job = mJobs.front();
+            job->activeWorkers++;
+            lock.unlock();
+
+            if (job->graph != nullptr) {
+                RunGraphNodes(job);
+            } else {
+                RunChunks(job);
+            }
+
+            lock.lock();
+            // Every chunk has been claimed or no node is ready, make the other workers move on
+            // to the next job. A graph job is queued again when more nodes become ready.
+            if (!HasPendingWork(job)) {
+                auto it = std::find(mJobs.begin(), mJobs.end(), job);
+                if (it != mJobs.end()) {
+                    mJobs.erase(it);
+                }
+            }
+            if (--job->activeWorkers == 0) {
+                mJobFinished.notify_all();
+            }
+        }
+    }
+
+    void ThreadPool::ParallelFor(size_t count, const RangeTask& task, size_t grainSize) {
+        if (count == 0) {
+            return;
+        }
+        grainSize = std::max<size_t>(grainSize, 1);
+        size_t maxChunks = static_cast<size_t>(GetThreadCount()) * kChunksPerThread;
+        size_t chunkSize = std::max(grainSize, (count + maxChunks - 1) / maxChunks);
+        size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        if (mThreads.empty() || chunkCount == 1) {
+            task(0, count);
+            return;
+        }
+
+        Job job;
+        job.task = &task;
+        job.count = count;
+        job.chunkSize = chunkSize;
+        job.chunkCount = chunkCount;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mJobs.push_back(&job);
+        }
+        mJobAvailable.notify_all();
+
+        RunChunks(&job);
+        FinishJob(&job);
+    }
+
+    void ThreadPool::RunGraph(const TaskGraph& graph, const NodeTask& task) {
+        size_t nodeCount = graph.dependencyCounts.size();
+        DAWN_ASSERT(graph.dependentOffsets.size() == nodeCount + 1);
+        if (nodeCount == 0) {
+            return;
+        }
+
+        GraphRun run;
+        run.graph = &graph;
+        run.task = &task;
+        run.pendingDependencies = graph.dependencyCounts;
+        run.remainingNodes = nodeCount;
+        for (uint32_t node = nodeCount; node-- > 0;) {
+            if (graph.dependencyCounts[node] == 0) {
+                run.readyNodes.push_back(node);
+            }
+        }
+        Job job;
+        job.graph = &run;
+        if (run.readyNodes.size() > 1) {
+            RequeueJob(&job);
+        }
+
+        // Run the ready nodes along with the workers, and wait for more while the workers run
+        // the nodes they depend on.
+        for (;;) {
+            RunGraphNodes(&job);
+            std::unique_lock<std::mutex> lock(run.mutex);
+            run.progress.wait(lock, [&run] {
+                return run.remainingNodes == 0 || !run.readyNodes.empty();
+            });
+            if (run.remainingNodes == 0) {
+                break;
+            }
+        }
+        FinishJob(&job);
+    }
+
+}}  // namespace dawn::native::cpu
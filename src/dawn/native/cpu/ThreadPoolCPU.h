@@ -0,0 +1,118 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_THREAD_POOL_CPU_H_
+#define WEBNN_NATIVE_CPU_THREAD_POOL_CPU_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dawn/common/NonCopyable.h"
+
+namespace dawn::native { namespace cpu {
+
+    // The nodes run by ThreadPool::RunGraph() and the dependencies between them.
+    struct TaskGraph {
+        // The number of nodes each node waits for.
+        std::vector<uint32_t> dependencyCounts;
+        // The nodes waiting for node i are dependents[dependentOffsets[i]] to
+        // dependents[dependentOffsets[i + 1]] excluded.
+        std::vector<uint32_t> dependentOffsets;
+        std::vector<uint32_t> dependents;
+    };
+
+    // A fixed size pool of worker threads used to run the kernels of a compiled graph. The
+    // thread calling ParallelFor() or RunGraph() always takes part in the work, so a
+    // ParallelFor() issued from inside another ParallelFor() or a node of RunGraph() makes
+    // progress even when every worker is busy. The independent nodes of a graph and the chunks
+    // of the ParallelFor() inside them share the same workers, so the two levels of
+    // parallelism never run more threads than the pool has.
+    class ThreadPool : public NonCopyable {
+      public:
+        using RangeTask = std::function<void(size_t begin, size_t end)>;
+        using NodeTask = std::function<void(uint32_t node)>;
+
+        // The pool shared by all the graphs of the process, sized to the number of hardware
+        // threads.
+        static std::shared_ptr<ThreadPool> GetDefault();
+
+        // |threadCount| includes the calling thread, so a pool of 1 runs everything inline.
+        explicit ThreadPool(uint32_t threadCount);
+        ~ThreadPool();
+
+        uint32_t GetThreadCount() const;
+
+        // Splits [0, count) into chunks of at least |grainSize| items and runs |task| on each
+        // chunk. Returns when all the chunks are done.
+        void ParallelFor(size_t count, const RangeTask& task, size_t grainSize = 1);
+
+        // Runs |task| on every node of |graph| once the nodes it depends on are done, the
+        // nodes that are ready at the same time in parallel. Returns when all the nodes are
+        // done.
+        void RunGraph(const TaskGraph& graph, const NodeTask& task);
+
+      private:
+        // The state of a RunGraph() call.
+        struct GraphRun {
+            const TaskGraph* graph;
+            const NodeTask* task;
+            std::mutex mutex;
+            // Notified when nodes become ready or the last node is done. The members below are
+            // guarded by |mutex|.
+            std::condition_variable progress;
+            std::vector<uint32_t> pendingDependencies;
+            std::vector<uint32_t> readyNodes;
+            size_t remainingNodes;
+        };
+
+        // The work of a ParallelFor() call, or of a RunGraph() call when |graph| is set.
+        struct Job {
+            const RangeTask* task = nullptr;
+            size_t count = 0;
+            size_t chunkSize = 0;
+            size_t chunkCount = 0;
+            std::atomic<size_t> nextChunk{0};
+            GraphRun* graph = nullptr;
+            // Guarded by mMutex.
+            uint32_t activeWorkers = 0;
+        };
+
+        void WorkerLoop();
+        static void RunChunks(Job* job);
+        // Runs the ready nodes of the graph of |job| until there are none left.
+        void RunGraphNodes(Job* job);
+        // Whether the workers still have something to do for |job|, with mMutex held.
+        static bool HasPendingWork(Job* job);
+        // Queues |job| again if the workers left it and wakes them up.
+        void RequeueJob(Job* job);
+        // Removes |job| from the queue and waits for the workers still running it.
+        void FinishJob(Job* job);
+
+        std::vector<std::thread> mThreads;
+        std::mutex mMutex;
+        std::condition_variable mJobAvailable;
+        std::condition_variable mJobFinished;
+        std::deque<Job*> mJobs;
+        bool mStopping = false;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_THREAD_POOL_CPU_H_
@@ -0,0 +1,193 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/cpu/TransposeCPU.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+        // The rows and columns of a tile, 16 KB of float32.
+        constexpr size_t kTile = 64;
+
+        // y[c * yStride + r] = x[r * xStride + c] for the |rows| x |cols| matrix x.
+        template <typename T>
+        void TransposeBlock(const T* x,
+                            size_t xStride,
+                            T* y,
+                            size_t yStride,
+                            size_t rows,
+                            size_t cols) {
+            for (size_t r = 0; r < rows; ++r) {
+                for (size_t c = 0; c < cols; ++c) {
+                    y[c * yStride + r] = x[r * xStride + c];
+                }
+            }
+        }
+    }  // anonymous namespace
+
+    TransposeKernel::TransposeKernel(uint32_t input,
+                                     uint32_t output,
+                                     size_t elementSize,
+                                     const std::vector<int32_t>& inputShape,
+                                     const std::vector<int32_t>& permutation)
+        : Kernel({input}, {output}),
+          mElementSize(elementSize),
+          mFunctions(GetElementwiseFunctions()) {
+        std::vector<size_t> strides = GetStrides(inputShape);
+        std::vector<size_t> shape;
+        std::vector<size_t> inputStrides;
+        for (int32_t axis : permutation) {
+            size_t size = inputShape[axis];
+            if (size == 1) {
+                continue;
+            }
+            if (!shape.empty() && inputStrides.back() == strides[axis] * size) {
+                shape.back() *= size;
+                inputStrides.back() = strides[axis];
+            } else {
+                shape.push_back(size);
+                inputStrides.push_back(strides[axis]);
+            }
+        }
+        size_t rank = shape.size();
+        std::vector<size_t> outputStrides(rank);
+        for (size_t d = rank, stride = 1; d-- > 0;) {
+            outputStrides[d] = stride;
+            stride *= shape[d];
+        }
+
+        // The output dimension of the innermost input dimension.
+        size_t rowAxis = rank;
+        for (size_t d = 0; d < rank; ++d) {
+            if (inputStrides[d] == 1) {
+                rowAxis = d;
+            }
+        }
+        mTiled = rank > 0 && rowAxis != rank - 1;
+        if (rank > 0) {
+            mColumns = shape[rank - 1];
+        }
+        if (mTiled) {
+            DAWN_ASSERT(rowAxis < rank);
+            mRows = shape[rowAxis];
+            mInputColumnStride = inputStrides[rank - 1];
+            mOutputRowStride = outputStrides[rowAxis];
+        }
+        for (size_t d = 0; d + 1 < rank; ++d) {
+            if (mTiled && d == rowAxis) {
+                continue;
+            }
+            mOuterShape.push_back(shape[d]);
+            mOuterInputStrides.push_back(inputStrides[d]);
+            mOuterOutputStrides.push_back(outputStrides[d]);
+        }
+    }
+
+    void TransposeKernel::GetOuterOffsets(size_t outer,
+                                          size_t* inputOffset,
+                                          size_t* outputOffset) const {
+        *inputOffset = 0;
+        *outputOffset = 0;
+        for (size_t d = mOuterShape.size(); d-- > 0;) {
+            size_t i = outer % mOuterShape[d];
+            outer /= mOuterShape[d];
+            *inputOffset += i * mOuterInputStrides[d];
+            *outputOffset += i * mOuterOutputStrides[d];
+        }
+    }
+
+    template <typename T>
+    void TransposeKernel::ComputeRuns(ThreadPool* threadPool, const T* input, T* output) const {
+        size_t outerCount = 1;
+        for (size_t size : mOuterShape) {
+            outerCount *= size;
+        }
+        threadPool->ParallelFor(
+            outerCount,
+            [&](size_t begin, size_t end) {
+                for (size_t outer = begin; outer < end; ++outer) {
+                    size_t inputOffset, outputOffset;
+                    GetOuterOffsets(outer, &inputOffset, &outputOffset);
+                    memcpy(output + outputOffset, input + inputOffset, mColumns * sizeof(T));
+                }
+            },
+            std::max<size_t>(1, kTile * kTile / mColumns));
+    }
+
+    template <typename T>
+    void TransposeKernel::ComputeTiles(ThreadPool* threadPool, const T* input, T* output) const {
+        size_t outerCount = 1;
+        for (size_t size : mOuterShape) {
+            outerCount *= size;
+        }
+        size_t rowTiles = (mRows + kTile - 1) / kTile;
+        size_t columnTiles = (mColumns + kTile - 1) / kTile;
+        threadPool->ParallelFor(outerCount * rowTiles * columnTiles, [&](size_t begin,
+                                                                         size_t end) {
+            for (size_t task = begin; task < end; ++task) {
+                size_t tile = task % (rowTiles * columnTiles);
+                size_t inputOffset, outputOffset;
+                GetOuterOffsets(task / (rowTiles * columnTiles), &inputOffset, &outputOffset);
+                size_t r = tile / columnTiles * kTile;
+                size_t c = tile % columnTiles * kTile;
+                // The input of the tile is the matrix [columns, rows].
+                const T* x = input + inputOffset + c * mInputColumnStride + r;
+                T* y = output + outputOffset + r * mOutputRowStride + c;
+                size_t rows = std::min(kTile, mRows - r);
+                size_t columns = std::min(kTile, mColumns - c);
+                if constexpr (sizeof(T) == sizeof(float)) {
+                    mFunctions.transpose(reinterpret_cast<const float*>(x), mInputColumnStride,
+                                         reinterpret_cast<float*>(y), mOutputRowStride, columns,
+                                         rows);
+                } else {
+                    TransposeBlock(x, mInputColumnStride, y, mOutputRowStride, columns, rows);
+                }
+            }
+        });
+    }
+
+    template <typename T>
+    void TransposeKernel::ComputeTyped(const ExecutionContext& context) const {
+        const T* input = context.GetData<T>(mInputs[0]);
+        T* output = context.GetData<T>(mOutputs[0]);
+        if (mTiled) {
+            ComputeTiles(context.GetThreadPool(), input, output);
+        } else {
+            ComputeRuns(context.GetThreadPool(), input, output);
+        }
+    }
+
+    void TransposeKernel::Compute(const ExecutionContext& context) const {
+        switch (mElementSize) {
+            case 1:
+                ComputeTyped<uint8_t>(context);
+                break;
+            case 2:
+                ComputeTyped<uint16_t>(context);
+                break;
+            case 4:
+                ComputeTyped<uint32_t>(context);
+                break;
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,72 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_TRANSPOSE_CPU_H_
+#define WEBNN_NATIVE_CPU_TRANSPOSE_CPU_H_
+
+#include "dawn/native/cpu/ElementwiseSimdCPU.h"
+#include "dawn/native/cpu/KernelCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    // Permutes the dimensions of a tensor of any operand type. The output dimensions of size 1
+    // are dropped and the adjacent ones that are adjacent in the input too are merged. When
+    // the innermost input dimension stays innermost, the output is copied in contiguous runs.
+    // Otherwise the plane of the innermost input and output dimensions is transposed in tiles
+    // that fit in the cache, in SIMD registers for the 32-bit types.
+    class TransposeKernel final : public Kernel {
+      public:
+        TransposeKernel(uint32_t input,
+                        uint32_t output,
+                        size_t elementSize,
+                        const std::vector<int32_t>& inputShape,
+                        const std::vector<int32_t>& permutation);
+
+        const char* GetName() const override {
+            return "Transpose";
+        }
+        const char* GetVariant() const override {
+            return mTiled ? "Tiles" : "Runs";
+        }
+        void Compute(const ExecutionContext& context) const override;
+
+      private:
+        template <typename T>
+        void ComputeTyped(const ExecutionContext& context) const;
+        template <typename T>
+        void ComputeRuns(ThreadPool* threadPool, const T* input, T* output) const;
+        template <typename T>
+        void ComputeTiles(ThreadPool* threadPool, const T* input, T* output) const;
+        // The input and output offsets of the index |outer| over mOuterShape.
+        void GetOuterOffsets(size_t outer, size_t* inputOffset, size_t* outputOffset) const;
+
+        size_t mElementSize;
+        bool mTiled;
+        // The output dimensions besides those of the runs or the tiles, with their input and
+        // output strides.
+        std::vector<size_t> mOuterShape;
+        std::vector<size_t> mOuterInputStrides;
+        std::vector<size_t> mOuterOutputStrides;
+        // The runs have mColumns elements. The tiles are taken from the output plane of mRows
+        // rows of mColumns elements, whose input strides are 1 and mInputColumnStride.
+        size_t mRows = 1;
+        size_t mColumns = 1;
+        size_t mInputColumnStride = 0;
+        size_t mOutputRowStride = 0;
+        const ElementwiseFunctions& mFunctions;
+    };
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_TRANSPOSE_CPU_H_
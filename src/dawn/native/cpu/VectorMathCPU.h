@@ -0,0 +1,811 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_VECTOR_MATH_CPU_H_
+#define WEBNN_NATIVE_CPU_VECTOR_MATH_CPU_H_
+
+// The vector loops shared by every instruction set, written against a vector type V
+// that provides:
+//   using Reg; static constexpr size_t kWidth;
+//   Load, Store, Set1, Zero, Add, Sub, Mul, Div, Max, Min, MulAdd(a, b, c) = a * b + c,
+//   LoadHalf and StoreHalf converting kWidth float16 values,
+//   Floor, Ceil, Abs, SelectLess(a, b, x, y) = a < b ? x : y,
+//   Pow2(n) = 2^n for integral n in [-126, 127],
+//   Exponent(x) and Mantissa(x) with x = Mantissa(x) * 2^Exponent(x), Mantissa(x) in [0.5, 1),
+//   Transpose(rows) transposing the kWidth x kWidth matrix of kWidth registers in place.
+//
+// The files specific to an instruction set include this header inside the region where
+// their target is enabled, after all the other headers, so that only these templates are
+// compiled for that target. Everything here must stay a template of V for the same reason:
+// an inline function would be emitted with different targets in different object files.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "dawn/native/ops/Binary.h"
+#include "dawn/native/ops/Reduce.h"
+#include "dawn/native/ops/Unary.h"
+
+namespace dawn::native { namespace cpu {
+
+    // exp(x) with the Cephes polynomial, the inputs are clamped to the range where 2^n is a
+    // normal float.
+    template <typename V>
+    typename V::Reg VecExp(typename V::Reg x) {
+        using Reg = typename V::Reg;
+        x = V::Min(V::Max(x, V::Set1(-87.3365448f)), V::Set1(88.0296936f));
+        Reg n = V::Floor(V::MulAdd(x, V::Set1(1.44269504088896341f), V::Set1(0.5f)));
+        x = V::Sub(x, V::Mul(n, V::Set1(0.693359375f)));
+        x = V::Sub(x, V::Mul(n, V::Set1(-2.12194440e-4f)));
+        Reg y = V::Set1(1.9875691500e-4f);
+        y = V::MulAdd(y, x, V::Set1(1.3981999507e-3f));
+        y = V::MulAdd(y, x, V::Set1(8.3334519073e-3f));
+        y = V::MulAdd(y, x, V::Set1(4.1665795894e-2f));
+        y = V::MulAdd(y, x, V::Set1(1.6666665459e-1f));
+        y = V::MulAdd(y, x, V::Set1(5.0000001201e-1f));
+        y = V::MulAdd(y, V::Mul(x, x), V::Add(x, V::Set1(1.0f)));
+        return V::Mul(y, V::Pow2(n));
+    }
+
+    // log(x) with the Cephes polynomial. Denormal inputs are treated as the smallest normal.
+    template <typename V>
+    typename V::Reg VecLog(typename V::Reg input) {
+        using Reg = typename V::Reg;
+        Reg one = V::Set1(1.0f);
+        Reg x = V::Max(input, V::Set1(std::numeric_limits<float>::min()));
+        Reg e = V::Exponent(x);
+        x = V::Mantissa(x);
+        // Move the mantissa to [sqrt(0.5), sqrt(2)).
+        Reg small = V::SelectLess(x, V::Set1(0.707106781186547524f), one, V::Zero());
+        e = V::Sub(e, small);
+        x = V::Sub(V::MulAdd(x, small, x), one);
+        Reg z = V::Mul(x, x);
+        Reg y = V::Set1(7.0376836292e-2f);
+        y = V::MulAdd(y, x, V::Set1(-1.1514610310e-1f));
+        y = V::MulAdd(y, x, V::Set1(1.1676998740e-1f));
+        y = V::MulAdd(y, x, V::Set1(-1.2420140846e-1f));
+        y = V::MulAdd(y, x, V::Set1(1.4249322787e-1f));
+        y = V::MulAdd(y, x, V::Set1(-1.6668057665e-1f));
+        y = V::MulAdd(y, x, V::Set1(2.0000714765e-1f));
+        y = V::MulAdd(y, x, V::Set1(-2.4999993993e-1f));
+        y = V::MulAdd(y, x, V::Set1(3.3333331174e-1f));
+        y = V::Mul(V::Mul(y, x), z);
+        y = V::MulAdd(e, V::Set1(-2.12194440e-4f), y);
+        y = V::MulAdd(z, V::Set1(-0.5f), y);
+        x = V::Add(x, y);
+        x = V::MulAdd(e, V::Set1(0.693359375f), x);
+        // log(0) is -inf and the log of a negative number is NaN.
+        Reg invalid =
+            V::SelectLess(input, V::Zero(), V::Set1(std::numeric_limits<float>::quiet_NaN()),
+                          V::Set1(-std::numeric_limits<float>::infinity()));
+        return V::SelectLess(V::Zero(), input, x, invalid);
+    }
+
+    template <typename V>
+    typename V::Reg VecSigmoid(typename V::Reg x) {
+        typename V::Reg one = V::Set1(1.0f);
+        return V::Div(one, V::Add(one, VecExp<V>(V::Sub(V::Zero(), x))));
+    }
+
+    // tanh(x) = 1 - 2 / (exp(2x) + 1), with the Cephes polynomial near 0 where that formula
+    // loses precision.
+    template <typename V>
+    typename V::Reg VecTanh(typename V::Reg x) {
+        using Reg = typename V::Reg;
+        Reg one = V::Set1(1.0f);
+        Reg large = V::Sub(one, V::Div(V::Set1(2.0f), V::Add(VecExp<V>(V::Add(x, x)), one)));
+        Reg z = V::Mul(x, x);
+        Reg y = V::Set1(-5.70498872745e-3f);
+        y = V::MulAdd(y, z, V::Set1(2.06390887954e-2f));
+        y = V::MulAdd(y, z, V::Set1(-5.37397155531e-2f));
+        y = V::MulAdd(y, z, V::Set1(1.33314422036e-1f));
+        y = V::MulAdd(y, z, V::Set1(-3.33332819422e-1f));
+        Reg small = V::MulAdd(V::Mul(y, z), x, x);
+        return V::SelectLess(V::Abs(x), V::Set1(0.625f), small, large);
+    }
+
+    template <typename V>
+    struct VecAbs {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return V::Abs(x);
+        }
+    };
+    template <typename V>
+    struct VecCeil {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return V::Ceil(x);
+        }
+    };
+    template <typename V>
+    struct VecExpFunctor {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return VecExp<V>(x);
+        }
+    };
+    template <typename V>
+    struct VecFloor {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return V::Floor(x);
+        }
+    };
+    template <typename V>
+    struct VecHardSwish {
+        typename V::Reg operator()(typename V::Reg x) const {
+            typename V::Reg t =
+                V::Min(V::Max(V::Add(x, V::Set1(3.0f)), V::Zero()), V::Set1(6.0f));
+            return V::Mul(V::Mul(x, t), V::Set1(1.0f / 6.0f));
+        }
+    };
+    template <typename V>
+    struct VecLogFunctor {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return VecLog<V>(x);
+        }
+    };
+    template <typename V>
+    struct VecLeakyRelu {
+        float alpha;
+        typename V::Reg operator()(typename V::Reg x) const {
+            return V::MulAdd(V::Min(x, V::Zero()), V::Set1(alpha), V::Max(x, V::Zero()));
+        }
+    };
+    template <typename V>
+    struct VecNeg {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return V::Sub(V::Zero(), x);
+        }
+    };
+    template <typename V>
+    struct VecRelu {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return V::Max(x, V::Zero());
+        }
+    };
+    template <typename V>
+    struct VecSigmoidFunctor {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return VecSigmoid<V>(x);
+        }
+    };
+    template <typename V>
+    struct VecTanhFunctor {
+        typename V::Reg operator()(typename V::Reg x) const {
+            return VecTanh<V>(x);
+        }
+    };
+    template <typename V>
+    struct VecClamp {
+        float minValue;
+        float maxValue;
+        typename V::Reg operator()(typename V::Reg x) const {
+            return V::Min(V::Max(x, V::Set1(minValue)), V::Set1(maxValue));
+        }
+    };
+    template <typename V>
+    struct VecScale {
+        float scale;
+        typename V::Reg operator()(typename V::Reg x) const {
+            return V::Mul(x, V::Set1(scale));
+        }
+    };
+    // exp(x - shift), the numerator of softmax.
+    template <typename V>
+    struct VecShiftedExp {
+        float shift;
+        typename V::Reg operator()(typename V::Reg x) const {
+            return VecExp<V>(V::Sub(x, V::Set1(shift)));
+        }
+    };
+
+    // a + (b - a) * t, the linear interpolation between a and b.
+    template <typename V>
+    struct VecLerp {
+        float t;
+        typename V::Reg operator()(typename V::Reg a, typename V::Reg b) const {
+            return V::MulAdd(V::Sub(b, a), V::Set1(t), a);
+        }
+    };
+    template <typename V>
+    struct VecAdd {
+        typename V::Reg operator()(typename V::Reg a, typename V::Reg b) const {
+            return V::Add(a, b);
+        }
+    };
+    template <typename V>
+    struct VecSub {
+        typename V::Reg operator()(typename V::Reg a, typename V::Reg b) const {
+            return V::Sub(a, b);
+        }
+    };
+    template <typename V>
+    struct VecMul {
+        typename V::Reg operator()(typename V::Reg a, typename V::Reg b) const {
+            return V::Mul(a, b);
+        }
+    };
+    template <typename V>
+    struct VecDiv {
+        typename V::Reg operator()(typename V::Reg a, typename V::Reg b) const {
+            return V::Div(a, b);
+        }
+    };
+    template <typename V>
+    struct VecMax {
+        typename V::Reg operator()(typename V::Reg a, typename V::Reg b) const {
+            return V::Max(a, b);
+        }
+    };
+    template <typename V>
+    struct VecMin {
+        typename V::Reg operator()(typename V::Reg a, typename V::Reg b) const {
+            return V::Min(a, b);
+        }
+    };
+
+    // Applies |f| to |count| contiguous values. The tail is computed through a padded copy so
+    // that every element gets the same result whatever its position.
+    template <typename V, typename F>
+    void VecUnaryLoop(const float* x, float* y, size_t count, const F& f) {
+        size_t i = 0;
+        for (; i + V::kWidth <= count; i += V::kWidth) {
+            V::Store(y + i, f(V::Load(x + i)));
+        }
+        if (i < count) {
+            float buffer[V::kWidth] = {};
+            memcpy(buffer, x + i, (count - i) * sizeof(float));
+            V::Store(buffer, f(V::Load(buffer)));
+            memcpy(y + i, buffer, (count - i) * sizeof(float));
+        }
+    }
+
+    // Applies |f| to |count| values of a and b, each either contiguous or a single broadcast
+    // value.
+    template <typename V, bool kBroadcastA, bool kBroadcastB, typename F>
+    void VecBinaryLoop(const float* a, const float* b, float* y, size_t count, const F& f) {
+        using Reg = typename V::Reg;
+        Reg broadcastA = V::Set1(a[0]);
+        Reg broadcastB = V::Set1(b[0]);
+        size_t i = 0;
+        for (; i + V::kWidth <= count; i += V::kWidth) {
+            Reg va = kBroadcastA ? broadcastA : V::Load(a + i);
+            Reg vb = kBroadcastB ? broadcastB : V::Load(b + i);
+            V::Store(y + i, f(va, vb));
+        }
+        if (i < count) {
+            float bufferA[V::kWidth] = {};
+            float bufferB[V::kWidth] = {};
+            if (!kBroadcastA) {
+                memcpy(bufferA, a + i, (count - i) * sizeof(float));
+            }
+            if (!kBroadcastB) {
+                memcpy(bufferB, b + i, (count - i) * sizeof(float));
+            }
+            Reg va = kBroadcastA ? broadcastA : V::Load(bufferA);
+            Reg vb = kBroadcastB ? broadcastB : V::Load(bufferB);
+            V::Store(bufferA, f(va, vb));
+            memcpy(y + i, bufferA, (count - i) * sizeof(float));
+        }
+    }
+
+    template <typename V, typename F>
+    void VecBinaryDispatch(const float* a,
+                           size_t aStride,
+                           const float* b,
+                           size_t bStride,
+                           float* y,
+                           size_t count,
+                           const F& f) {
+        if (aStride == 0 && bStride == 0) {
+            VecBinaryLoop<V, true, true>(a, b, y, count, f);
+        } else if (aStride == 0) {
+            VecBinaryLoop<V, true, false>(a, b, y, count, f);
+        } else if (bStride == 0) {
+            VecBinaryLoop<V, false, true>(a, b, y, count, f);
+        } else {
+            VecBinaryLoop<V, false, false>(a, b, y, count, f);
+        }
+    }
+
+    template <typename V>
+    void VecUnary(op::UnaryOpType opType, const float* x, float* y, size_t count, float alpha) {
+        switch (opType) {
+            case op::UnaryOpType::kAbs:
+                return VecUnaryLoop<V>(x, y, count, VecAbs<V>());
+            case op::UnaryOpType::kCeil:
+                return VecUnaryLoop<V>(x, y, count, VecCeil<V>());
+            case op::UnaryOpType::kExp:
+                return VecUnaryLoop<V>(x, y, count, VecExpFunctor<V>());
+            case op::UnaryOpType::kFloor:
+                return VecUnaryLoop<V>(x, y, count, VecFloor<V>());
+            case op::UnaryOpType::kHardSwish:
+                return VecUnaryLoop<V>(x, y, count, VecHardSwish<V>());
+            case op::UnaryOpType::kLog:
+                return VecUnaryLoop<V>(x, y, count, VecLogFunctor<V>());
+            case op::UnaryOpType::kLeakyRelu:
+                return VecUnaryLoop<V>(x, y, count, VecLeakyRelu<V>{alpha});
+            case op::UnaryOpType::kNeg:
+                return VecUnaryLoop<V>(x, y, count, VecNeg<V>());
+            case op::UnaryOpType::kRelu:
+                return VecUnaryLoop<V>(x, y, count, VecRelu<V>());
+            case op::UnaryOpType::kSigmoid:
+                return VecUnaryLoop<V>(x, y, count, VecSigmoidFunctor<V>());
+            case op::UnaryOpType::kTanh:
+                return VecUnaryLoop<V>(x, y, count, VecTanhFunctor<V>());
+            // The trigonometric functions are rare in models and stay scalar.
+            case op::UnaryOpType::kCos:
+                for (size_t i = 0; i < count; ++i) {
+                    y[i] = std::cos(x[i]);
+                }
+                return;
+            case op::UnaryOpType::kSin:
+                for (size_t i = 0; i < count; ++i) {
+                    y[i] = std::sin(x[i]);
+                }
+                return;
+            case op::UnaryOpType::kTan:
+                for (size_t i = 0; i < count; ++i) {
+                    y[i] = std::tan(x[i]);
+                }
+                return;
+            default:
+                // Softmax is not elementwise, see VecSoftmax.
+                return;
+        }
+    }
+
+    template <typename V>
+    void VecBinary(op::BinaryOpType opType,
+                   const float* a,
+                   size_t aStride,
+                   const float* b,
+                   size_t bStride,
+                   float* y,
+                   size_t count) {
+        switch (opType) {
+            case op::BinaryOpType::kAdd:
+                return VecBinaryDispatch<V>(a, aStride, b, bStride, y, count, VecAdd<V>());
+            case op::BinaryOpType::kSub:
+                return VecBinaryDispatch<V>(a, aStride, b, bStride, y, count, VecSub<V>());
+            case op::BinaryOpType::kMul:
+                return VecBinaryDispatch<V>(a, aStride, b, bStride, y, count, VecMul<V>());
+            case op::BinaryOpType::kDiv:
+                return VecBinaryDispatch<V>(a, aStride, b, bStride, y, count, VecDiv<V>());
+            case op::BinaryOpType::kMax:
+                return VecBinaryDispatch<V>(a, aStride, b, bStride, y, count, VecMax<V>());
+            case op::BinaryOpType::kMin:
+                return VecBinaryDispatch<V>(a, aStride, b, bStride, y, count, VecMin<V>());
+            case op::BinaryOpType::kPower:
+                for (size_t i = 0; i < count; ++i) {
+                    y[i] = std::pow(a[i * aStride], b[i * bStride]);
+                }
+                return;
+            default:
+                // MatMul is not elementwise.
+                return;
+        }
+    }
+
+    // The reductions of op::ReduceType: the value every input contributes, how two partial
+    // results combine and the identity of the combination. kReduceL2 gives the sum of the
+    // squares, kReduceMean the sum. The sums are pairwise: the halves of the long sequences are
+    // reduced separately, which bounds the rounding error by the depth of the recursion.
+    template <typename V>
+    struct VecSumReducer {
+        static constexpr bool kPairwise = true;
+        static float Identity() {
+            return 0.0f;
+        }
+        static typename V::Reg Map(typename V::Reg x) {
+            return x;
+        }
+        static float MapScalar(float x) {
+            return x;
+        }
+        static typename V::Reg Combine(typename V::Reg a, typename V::Reg b) {
+            return V::Add(a, b);
+        }
+        static float CombineScalar(float a, float b) {
+            return a + b;
+        }
+    };
+    template <typename V>
+    struct VecL1Reducer : VecSumReducer<V> {
+        static typename V::Reg Map(typename V::Reg x) {
+            return V::Abs(x);
+        }
+        static float MapScalar(float x) {
+            return std::fabs(x);
+        }
+    };
+    template <typename V>
+    struct VecSumSquaresReducer : VecSumReducer<V> {
+        static typename V::Reg Map(typename V::Reg x) {
+            return V::Mul(x, x);
+        }
+        static float MapScalar(float x) {
+            return x * x;
+        }
+    };
+    template <typename V>
+    struct VecProductReducer {
+        static constexpr bool kPairwise = false;
+        static float Identity() {
+            return 1.0f;
+        }
+        static typename V::Reg Map(typename V::Reg x) {
+            return x;
+        }
+        static float MapScalar(float x) {
+            return x;
+        }
+        static typename V::Reg Combine(typename V::Reg a, typename V::Reg b) {
+            return V::Mul(a, b);
+        }
+        static float CombineScalar(float a, float b) {
+            return a * b;
+        }
+    };
+    template <typename V>
+    struct VecMaxReducer {
+        static constexpr bool kPairwise = false;
+        static float Identity() {
+            return -std::numeric_limits<float>::infinity();
+        }
+        static typename V::Reg Map(typename V::Reg x) {
+            return x;
+        }
+        static float MapScalar(float x) {
+            return x;
+        }
+        static typename V::Reg Combine(typename V::Reg a, typename V::Reg b) {
+            return V::Max(a, b);
+        }
+        static float CombineScalar(float a, float b) {
+            return b > a ? b : a;
+        }
+    };
+    template <typename V>
+    struct VecMinReducer {
+        static constexpr bool kPairwise = false;
+        static float Identity() {
+            return std::numeric_limits<float>::infinity();
+        }
+        static typename V::Reg Map(typename V::Reg x) {
+            return x;
+        }
+        static float MapScalar(float x) {
+            return x;
+        }
+        static typename V::Reg Combine(typename V::Reg a, typename V::Reg b) {
+            return V::Min(a, b);
+        }
+        static float CombineScalar(float a, float b) {
+            return b < a ? b : a;
+        }
+    };
+
+    // The sequences up to this length are reduced without recursion.
+    constexpr size_t kPairwiseBlockSize = 256;
+
+    // Reduces |count| values |stride| apart, one at a time.
+    template <typename R>
+    float ReduceStrided(const float* x, size_t stride, size_t count) {
+        if (R::kPairwise && count > kPairwiseBlockSize) {
+            size_t half = count / 2;
+            return R::CombineScalar(ReduceStrided<R>(x, stride, half),
+                                    ReduceStrided<R>(x + half * stride, stride, count - half));
+        }
+        float result = R::Identity();
+        for (size_t i = 0; i < count; ++i) {
+            result = R::CombineScalar(result, R::MapScalar(x[i * stride]));
+        }
+        return result;
+    }
+
+    // Reduces |count| contiguous values, the horizontal reduction of a row.
+    template <typename V, typename R>
+    float VecReduceRow(const float* x, size_t count) {
+        using Reg = typename V::Reg;
+        if (R::kPairwise && count > kPairwiseBlockSize) {
+            size_t half = count / 2 / V::kWidth * V::kWidth;
+            return R::CombineScalar(VecReduceRow<V, R>(x, half),
+                                    VecReduceRow<V, R>(x + half, count - half));
+        }
+        // Independent accumulators hide the latency of the combination.
+        Reg acc[4];
+        for (Reg& a : acc) {
+            a = V::Set1(R::Identity());
+        }
+        size_t i = 0;
+        for (; i + 4 * V::kWidth <= count; i += 4 * V::kWidth) {
+            for (size_t k = 0; k < 4; ++k) {
+                acc[k] = R::Combine(acc[k], R::Map(V::Load(x + i + k * V::kWidth)));
+            }
+        }
+        for (; i + V::kWidth <= count; i += V::kWidth) {
+            acc[0] = R::Combine(acc[0], R::Map(V::Load(x + i)));
+        }
+        acc[0] = R::Combine(R::Combine(acc[0], acc[1]), R::Combine(acc[2], acc[3]));
+        float lanes[V::kWidth];
+        V::Store(lanes, acc[0]);
+        float result = lanes[0];
+        for (size_t lane = 1; lane < V::kWidth; ++lane) {
+            result = R::CombineScalar(result, lanes[lane]);
+        }
+        for (; i < count; ++i) {
+            result = R::CombineScalar(result, R::MapScalar(x[i]));
+        }
+        return result;
+    }
+
+    // Reduces |rows| rows of kVectors * kWidth contiguous values, |stride| apart, into |acc|.
+    template <typename V, typename R, size_t kVectors>
+    void VecReduceColumnBlock(const float* x,
+                              size_t stride,
+                              size_t rows,
+                              typename V::Reg* acc) {
+        using Reg = typename V::Reg;
+        if (R::kPairwise && rows > kPairwiseBlockSize) {
+            size_t half = rows / 2;
+            Reg second[kVectors];
+            VecReduceColumnBlock<V, R, kVectors>(x, stride, half, acc);
+            VecReduceColumnBlock<V, R, kVectors>(x + half * stride, stride, rows - half, second);
+            for (size_t k = 0; k < kVectors; ++k) {
+                acc[k] = R::Combine(acc[k], second[k]);
+            }
+            return;
+        }
+        for (size_t k = 0; k < kVectors; ++k) {
+            acc[k] = V::Set1(R::Identity());
+        }
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t k = 0; k < kVectors; ++k) {
+                acc[k] = R::Combine(acc[k], R::Map(V::Load(x + r * stride + k * V::kWidth)));
+            }
+        }
+    }
+
+    template <typename V, typename R>
+    void VecReduceRowsLoop(const float* x, float* y, size_t rows, size_t count) {
+        for (size_t r = 0; r < rows; ++r) {
+            y[r] = VecReduceRow<V, R>(x + r * count, count);
+        }
+    }
+
+    // Reduces |rows| rows of |count| values, |stride| apart, into the |count| contiguous
+    // values of y, the vertical accumulation over the rows.
+    template <typename V, typename R>
+    void VecReduceColumnsLoop(const float* x,
+                              size_t stride,
+                              float* y,
+                              size_t rows,
+                              size_t count,
+                              bool accumulate) {
+        using Reg = typename V::Reg;
+        constexpr size_t kVectors = 4;
+        Reg acc[kVectors];
+        size_t i = 0;
+        for (; i + kVectors * V::kWidth <= count; i += kVectors * V::kWidth) {
+            VecReduceColumnBlock<V, R, kVectors>(x + i, stride, rows, acc);
+            for (size_t k = 0; k < kVectors; ++k) {
+                float* p = y + i + k * V::kWidth;
+                V::Store(p, accumulate ? R::Combine(V::Load(p), acc[k]) : acc[k]);
+            }
+        }
+        for (; i + V::kWidth <= count; i += V::kWidth) {
+            VecReduceColumnBlock<V, R, 1>(x + i, stride, rows, acc);
+            V::Store(y + i, accumulate ? R::Combine(V::Load(y + i), acc[0]) : acc[0]);
+        }
+        for (; i < count; ++i) {
+            float result = ReduceStrided<R>(x + i, stride, rows);
+            y[i] = accumulate ? R::CombineScalar(y[i], result) : result;
+        }
+    }
+
+    template <typename V>
+    void VecReduceRows(op::ReduceType opType, const float* x, float* y, size_t rows, size_t count) {
+        switch (opType) {
+            case op::ReduceType::kReduceL1:
+                return VecReduceRowsLoop<V, VecL1Reducer<V>>(x, y, rows, count);
+            case op::ReduceType::kReduceL2:
+                return VecReduceRowsLoop<V, VecSumSquaresReducer<V>>(x, y, rows, count);
+            case op::ReduceType::kReduceMax:
+                return VecReduceRowsLoop<V, VecMaxReducer<V>>(x, y, rows, count);
+            case op::ReduceType::kReduceMin:
+                return VecReduceRowsLoop<V, VecMinReducer<V>>(x, y, rows, count);
+            case op::ReduceType::kReduceProduct:
+                return VecReduceRowsLoop<V, VecProductReducer<V>>(x, y, rows, count);
+            case op::ReduceType::kReduceMean:
+            case op::ReduceType::kReduceSum:
+                return VecReduceRowsLoop<V, VecSumReducer<V>>(x, y, rows, count);
+            default:
+                // ArgMax and ArgMin compute indices, see ReduceKernel.
+                return;
+        }
+    }
+
+    template <typename V>
+    void VecReduceColumns(op::ReduceType opType,
+                          const float* x,
+                          size_t stride,
+                          float* y,
+                          size_t rows,
+                          size_t count,
+                          bool accumulate) {
+        switch (opType) {
+            case op::ReduceType::kReduceL1:
+                return VecReduceColumnsLoop<V, VecL1Reducer<V>>(x, stride, y, rows, count,
+                                                                accumulate);
+            case op::ReduceType::kReduceL2:
+                return VecReduceColumnsLoop<V, VecSumSquaresReducer<V>>(x, stride, y, rows, count,
+                                                                        accumulate);
+            case op::ReduceType::kReduceMax:
+                return VecReduceColumnsLoop<V, VecMaxReducer<V>>(x, stride, y, rows, count,
+                                                                 accumulate);
+            case op::ReduceType::kReduceMin:
+                return VecReduceColumnsLoop<V, VecMinReducer<V>>(x, stride, y, rows, count,
+                                                                 accumulate);
+            case op::ReduceType::kReduceProduct:
+                return VecReduceColumnsLoop<V, VecProductReducer<V>>(x, stride, y, rows, count,
+                                                                     accumulate);
+            case op::ReduceType::kReduceMean:
+            case op::ReduceType::kReduceSum:
+                return VecReduceColumnsLoop<V, VecSumReducer<V>>(x, stride, y, rows, count,
+                                                                 accumulate);
+            default:
+                return;
+        }
+    }
+
+    // Softmax of one row of |count| values.
+    template <typename V>
+    void VecSoftmax(const float* x, float* y, size_t count) {
+        VecUnaryLoop<V>(x, y, count,
+                        VecShiftedExp<V>{VecReduceRow<V, VecMaxReducer<V>>(x, count)});
+        VecUnaryLoop<V>(y, y, count,
+                        VecScale<V>{1.0f / VecReduceRow<V, VecSumReducer<V>>(y, count)});
+    }
+
+    // Converts |count| contiguous values between float16 and float32.
+    template <typename V>
+    void VecHalfToFloat(const uint16_t* x, float* y, size_t count) {
+        size_t i = 0;
+        for (; i + V::kWidth <= count; i += V::kWidth) {
+            V::Store(y + i, V::LoadHalf(x + i));
+        }
+        if (i < count) {
+            uint16_t input[V::kWidth] = {};
+            float output[V::kWidth];
+            memcpy(input, x + i, (count - i) * sizeof(uint16_t));
+            V::Store(output, V::LoadHalf(input));
+            memcpy(y + i, output, (count - i) * sizeof(float));
+        }
+    }
+
+    template <typename V>
+    void VecFloatToHalf(const float* x, uint16_t* y, size_t count) {
+        size_t i = 0;
+        for (; i + V::kWidth <= count; i += V::kWidth) {
+            V::StoreHalf(y + i, V::Load(x + i));
+        }
+        if (i < count) {
+            float input[V::kWidth] = {};
+            uint16_t output[V::kWidth];
+            memcpy(input, x + i, (count - i) * sizeof(float));
+            V::StoreHalf(output, V::Load(input));
+            memcpy(y + i, output, (count - i) * sizeof(uint16_t));
+        }
+    }
+
+    // Loads kWidth float32 values, converted from float16 for the packed half matrices.
+    template <typename V>
+    typename V::Reg VecLoad(const float* p) {
+        return V::Load(p);
+    }
+    template <typename V>
+    typename V::Reg VecLoad(const uint16_t* p) {
+        return V::LoadHalf(p);
+    }
+
+    // The GEMM micro kernel, see SgemmCPU.h: C[kMr, kNv * kWidth] = A * B, plus C when
+    // |accumulate|. A holds kc columns of kMr values and B kc rows of kNv * kWidth values,
+    // stored as float32 or as float16 when T is uint16_t. The products are accumulated in
+    // float32 either way.
+    template <typename V, size_t kMr, size_t kNv, typename T = float>
+    void VecGemmMicroKernel(size_t kc,
+                            const float* a,
+                            const T* b,
+                            float* c,
+                            size_t cRowStride,
+                            bool accumulate) {
+        using Reg = typename V::Reg;
+        Reg acc[kMr][kNv];
+        for (size_t i = 0; i < kMr; ++i) {
+            for (size_t j = 0; j < kNv; ++j) {
+                acc[i][j] = accumulate ? V::Load(c + i * cRowStride + j * V::kWidth) : V::Zero();
+            }
+        }
+        for (size_t p = 0; p < kc; ++p) {
+            Reg bv[kNv];
+            for (size_t j = 0; j < kNv; ++j) {
+                bv[j] = VecLoad<V>(b + j * V::kWidth);
+            }
+            for (size_t i = 0; i < kMr; ++i) {
+                Reg av = V::Set1(a[i]);
+                for (size_t j = 0; j < kNv; ++j) {
+                    acc[i][j] = V::MulAdd(av, bv[j], acc[i][j]);
+                }
+            }
+            a += kMr;
+            b += kNv * V::kWidth;
+        }
+        for (size_t i = 0; i < kMr; ++i) {
+            for (size_t j = 0; j < kNv; ++j) {
+                V::Store(c + i * cRowStride + j * V::kWidth, acc[i][j]);
+            }
+        }
+    }
+
+    template <typename V>
+    void VecClampLoop(const float* x, float* y, size_t count, float minValue, float maxValue) {
+        VecUnaryLoop<V>(x, y, count, VecClamp<V>{minValue, maxValue});
+    }
+
+    template <typename V>
+    void VecLerpLoop(const float* a, const float* b, float t, float* y, size_t count) {
+        VecBinaryLoop<V, false, false>(a, b, y, count, VecLerp<V>{t});
+    }
+
+    // y[c * yStride + r] = x[r * xStride + c] for the |rows| x |cols| matrix x. The
+    // kWidth x kWidth tiles are transposed in registers, the edges one value at a time.
+    template <typename V>
+    void VecTranspose(const float* x,
+                      size_t xStride,
+                      float* y,
+                      size_t yStride,
+                      size_t rows,
+                      size_t cols) {
+        using Reg = typename V::Reg;
+        size_t fullRows = rows / V::kWidth * V::kWidth;
+        size_t fullCols = cols / V::kWidth * V::kWidth;
+        for (size_t r = 0; r < fullRows; r += V::kWidth) {
+            for (size_t c = 0; c < fullCols; c += V::kWidth) {
+                Reg tile[V::kWidth];
+                for (size_t i = 0; i < V::kWidth; ++i) {
+                    tile[i] = V::Load(x + (r + i) * xStride + c);
+                }
+                V::Transpose(tile);
+                for (size_t i = 0; i < V::kWidth; ++i) {
+                    V::Store(y + (c + i) * yStride + r, tile[i]);
+                }
+            }
+            for (size_t c = fullCols; c < cols; ++c) {
+                for (size_t i = 0; i < V::kWidth; ++i) {
+                    y[c * yStride + r + i] = x[(r + i) * xStride + c];
+                }
+            }
+        }
+        for (size_t r = fullRows; r < rows; ++r) {
+            for (size_t c = 0; c < cols; ++c) {
+                y[c * yStride + r] = x[r * xStride + c];
+            }
+        }
+    }
+
+}}  // namespace dawn::native::cpu
+
+#endif  // WEBNN_NATIVE_CPU_VECTOR_MATH_CPU_H_
@@ -41,6 +41,7 @@
 #include "dawn/native/d3d12/StagingDescriptorAllocatorD3D12.h"
 #include "dawn/native/d3d12/SwapChainD3D12.h"
 #include "dawn/native/d3d12/UtilsD3D12.h"
+#include "dawn/native/dml/GraphBuilderDML.h"
 
 #include <sstream>
 
@@ -438,6 +439,9 @@ namespace dawn::native::d3d12 {
         const TextureViewDescriptor* descriptor) {
         return TextureView::Create(texture, descriptor);
     }
+    ResultOrError<Ref<GraphBuilderBase>> Device::CreateGraphBuilderImpl() {
+        return AcquireRef(dml::GraphBuilder::Create(this));
+    }
     void Device::InitializeComputePipelineAsyncImpl(Ref<ComputePipelineBase> computePipeline,
                                                     WGPUCreateComputePipelineAsyncCallback callback,
                                                     void* userdata) {
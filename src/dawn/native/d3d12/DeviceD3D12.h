@@ -177,6 +177,7 @@ namespace dawn::native::d3d12 {
         ResultOrError<Ref<TextureViewBase>> CreateTextureViewImpl(
             TextureBase* texture,
             const TextureViewDescriptor* descriptor) override;
+        ResultOrError<Ref<GraphBuilderBase>> CreateGraphBuilderImpl() override;
         Ref<ComputePipelineBase> CreateUninitializedComputePipelineImpl(
             const ComputePipelineDescriptor* descriptor) override;
         Ref<RenderPipelineBase> CreateUninitializedRenderPipelineImpl(
@@ -15,9 +15,11 @@
 #include "dawn/native/dml/GraphDML.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Log.h"
+#include "dawn/common/Math.h"
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/NamedResources.h"
 #include "dawn/native/d3d12/DeviceD3D12.h"
@@ -59,6 +61,10 @@ namespace dawn::native { namespace dml {
                 dmlTensorDataType = DML_TENSOR_DATA_TYPE_INT32;
             } else if (operandType == wgpu::OperandType::Uint32) {
                 dmlTensorDataType = DML_TENSOR_DATA_TYPE_UINT32;
+            } else if (operandType == wgpu::OperandType::Int8) {
+                dmlTensorDataType = DML_TENSOR_DATA_TYPE_INT8;
+            } else if (operandType == wgpu::OperandType::Uint8) {
+                dmlTensorDataType = DML_TENSOR_DATA_TYPE_UINT8;
             } else {
                 return false;
             }
@@ -346,6 +352,29 @@ namespace dawn::native { namespace dml {
             return input;
         }
 
+        // Applies the activation as a separate operator for the operators that don't support
+        // the fused activation.
+        ::dml::Expression AppendActivation(FusionOperatorBase* activation,
+                                           ::dml::Expression& input) {
+            if (activation == nullptr) {
+                return input;
+            }
+            switch (activation->GetFusionType()) {
+                case FusionType::Clamp:
+                    return EmulateFusedActivation(activation, input);
+                case FusionType::Relu:
+                    return ::dml::ActivationRelu(input);
+                case FusionType::Sigmoid:
+                    return ::dml::ActivationSigmoid(input);
+                case FusionType::LeakyRelu:
+                    return ::dml::ActivationLeakyRelu(
+                        input, reinterpret_cast<op::FusionLeakyRelu*>(activation)->GetAlpha());
+                default:
+                    DAWN_ASSERT(0);
+            }
+            return input;
+        }
+
         std::string OpTypeToString(op::BinaryOpType type) {
             if (type == op::BinaryOpType::kAdd) {
                 return "add";
@@ -507,12 +536,28 @@ namespace dawn::native { namespace dml {
             return DAWN_INTERNAL_ERROR("Failed to get DML tensor dimensions.");
         }
 
-        auto dmlConstant = BindingConstant(dmlTensorType, dmlTensorDims, constant->GetBuffer(),
-                                           constant->GetOffset(), constant->GetSize());
+        Ref<BufferBase> buffer = constant->GetBuffer();
+        size_t offset = constant->GetOffset();
+        if (buffer == nullptr) {
+            // The constant is in host memory, e.g. loaded from a file, upload it to a buffer.
+            BufferDescriptor bufferDesc;
+            bufferDesc.usage = wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc;
+            bufferDesc.size = Align(constant->GetSize(), 4);
+            bufferDesc.mappedAtCreation = true;
+            DAWN_TRY_ASSIGN(buffer, GetDevice()->CreateBuffer(&bufferDesc));
+            void* mappedData = buffer->GetMappedRange(0, bufferDesc.size);
+            if (mappedData == nullptr) {
+                return DAWN_INTERNAL_ERROR("Failed to map the buffer of the constant.");
+            }
+            memcpy(mappedData, constant->GetHostData(), constant->GetSize());
+            buffer->Unmap();
+            offset = 0;
+            mConstantBuffers.push_back(buffer);
+        }
+        auto dmlConstant = BindingConstant(dmlTensorType, dmlTensorDims, buffer.Get(), offset,
+                                           constant->GetSize());
         mExpression.insert(std::make_pair(constant->PrimaryOutput(), dmlConstant));
-        Ref<OperandBase> constantOperand = AcquireRef<OperandBase>(constant->PrimaryOutput());
-        constantOperand->Reference();
-        mConstants.push_back(std::move(constantOperand));
+        mArena = constant->GetArena();
         DAWN_ASSERT(CheckShape(dmlConstant, constant));
         return {};
     }
@@ -552,8 +597,8 @@ namespace dawn::native { namespace dml {
         auto inputs = batchNorm->Inputs();
         // input
         DAWN_ASSERT(inputs.size() == 3 || inputs.size() == 4 || inputs.size() == 5);
-        DAWN_ASSERT(mExpression.find(batchNorm->Inputs()[0].Get()) != mExpression.end());
-        ::dml::Expression input = mExpression.at(batchNorm->Inputs()[0].Get());
+        DAWN_ASSERT(mExpression.find(batchNorm->Inputs()[0]) != mExpression.end());
+        ::dml::Expression input = mExpression.at(batchNorm->Inputs()[0]);
         const BatchNormOptions* options = batchNorm->GetOptions();
         // When input is a 4-D tensor of the "nchw" or "nhwc" layout, options.axis should be set to
         // 1 or 3 respectively.
@@ -568,8 +613,8 @@ namespace dawn::native { namespace dml {
         std::vector<::dml::Expression> expressions;
         expressions.reserve(inputs.size());
         for (size_t i = 1; i < inputs.size(); ++i) {
-            DAWN_ASSERT(mExpression.find(batchNorm->Inputs()[i].Get()) != mExpression.end());
-            ::dml::Expression expression = mExpression.at(batchNorm->Inputs()[i].Get());
+            DAWN_ASSERT(mExpression.find(batchNorm->Inputs()[i]) != mExpression.end());
+            ::dml::Expression expression = mExpression.at(batchNorm->Inputs()[i]);
             ::dml::TensorDimensions dimensions = expression.GetOutputDesc().sizes;
             DAWN_ASSERT(dimensions.size() == 1);
             if (dimensions[0] != inputDims[axis]) {
@@ -605,10 +650,10 @@ namespace dawn::native { namespace dml {
 
     MaybeError Graph::AddBinary(const op::Binary* binary) {
         DAWN_ASSERT(binary->Inputs().size() == 2);
-        DAWN_ASSERT(mExpression.find(binary->Inputs()[0].Get()) != mExpression.end());
-        ::dml::Expression a = mExpression.at(binary->Inputs()[0].Get());
-        DAWN_ASSERT(mExpression.find(binary->Inputs()[1].Get()) != mExpression.end());
-        ::dml::Expression b = mExpression.at(binary->Inputs()[1].Get());
+        DAWN_ASSERT(mExpression.find(binary->Inputs()[0]) != mExpression.end());
+        ::dml::Expression a = mExpression.at(binary->Inputs()[0]);
+        DAWN_ASSERT(mExpression.find(binary->Inputs()[1]) != mExpression.end());
+        ::dml::Expression b = mExpression.at(binary->Inputs()[1]);
         ::dml::Expression c;
         ::dml::TensorDimensions aDims = a.GetOutputDesc().sizes;
         const size_t aRank = aDims.size();
@@ -714,6 +759,7 @@ namespace dawn::native { namespace dml {
             ::dml::TensorDimensions cNewDims = ShrinkDimensions(cDims, cRank);
             c = ::dml::Reinterpret(c, cNewDims, ::dml::NullOpt);
         }
+        c = AppendActivation(binary->GetActivation(), c);
         mExpression.insert(std::make_pair(binary->PrimaryOutput(), c));
         DAWN_ASSERT(CheckShape(c, binary));
         return {};
@@ -722,7 +768,7 @@ namespace dawn::native { namespace dml {
     MaybeError Graph::AddClamp(const op::Clamp* clamp) {
         auto inputsOperand = clamp->Inputs();
         DAWN_ASSERT(inputsOperand.size() == 1);
-        ::dml::Expression input = mExpression.at(inputsOperand[0].Get());
+        ::dml::Expression input = mExpression.at(inputsOperand[0]);
         ::dml::TensorDimensions inputDims = input.GetOutputDesc().sizes;
         if (inputDims.size() > DML_TENSOR_DIMENSION_COUNT_MAX1) {
             return DAWN_INTERNAL_ERROR("The size of input dimensions is greater than max");
@@ -738,7 +784,7 @@ namespace dawn::native { namespace dml {
         auto inputsOperand = concat->Inputs();
         std::vector<::dml::Expression> inputs;
         inputs.reserve(inputsOperand.size());
-        const ::dml::Expression primary = mExpression.at(inputsOperand[0].Get());
+        const ::dml::Expression primary = mExpression.at(inputsOperand[0]);
         const ::dml::TensorDimensions primaryDims = primary.GetOutputDesc().sizes;
         if (primaryDims.size() > DML_TENSOR_DIMENSION_COUNT_MAX) {
             return DAWN_INTERNAL_ERROR("The size of input dimensions is greater than max");
@@ -747,8 +793,8 @@ namespace dawn::native { namespace dml {
         const uint32_t axis = concat->GetAxis();
         uint32_t dmlAxis = axis;
         for (auto& inputOperand : inputsOperand) {
-            DAWN_ASSERT(mExpression.find(inputOperand.Get()) != mExpression.end());
-            ::dml::Expression input = mExpression.at(inputOperand.Get());
+            DAWN_ASSERT(mExpression.find(inputOperand) != mExpression.end());
+            ::dml::Expression input = mExpression.at(inputOperand);
             ::dml::TensorDimensions inputDims = input.GetOutputDesc().sizes;
             DAWN_ASSERT(inputDims.size() == primaryDims.size());
             // All input tensors must have the same shape, except for the size of the dimension to
@@ -782,12 +828,15 @@ namespace dawn::native { namespace dml {
     }
 
     MaybeError Graph::AddConv2d(const op::Conv2d* conv2d) {
+        if (conv2d->GetQuantization() != nullptr) {
+            return DAWN_UNIMPLEMENTED_ERROR("The quantized Conv2d is not implemented.");
+        }
         auto inputsOperand = conv2d->Inputs();
         DAWN_ASSERT(inputsOperand.size() == 2 || inputsOperand.size() == 3);
-        DAWN_ASSERT(mExpression.find(inputsOperand[0].Get()) != mExpression.end());
-        ::dml::Expression input = mExpression.at(inputsOperand[0].Get());
-        DAWN_ASSERT(mExpression.find(inputsOperand[1].Get()) != mExpression.end());
-        ::dml::Expression filter = mExpression.at(inputsOperand[1].Get());
+        DAWN_ASSERT(mExpression.find(inputsOperand[0]) != mExpression.end());
+        ::dml::Expression input = mExpression.at(inputsOperand[0]);
+        DAWN_ASSERT(mExpression.find(inputsOperand[1]) != mExpression.end());
+        ::dml::Expression filter = mExpression.at(inputsOperand[1]);
         const Conv2dOptions* options = conv2d->GetOptions();
 
         if (options->inputLayout == wgpu::InputOperandLayout::Nhwc) {
@@ -816,8 +865,8 @@ namespace dawn::native { namespace dml {
 
         ::dml::Optional<::dml::Expression> bias = ::dml::NullOpt;
         if (options->bias != nullptr) {
-            DAWN_ASSERT(mExpression.find(inputsOperand[2].Get()) != mExpression.end());
-            bias = mExpression.at(inputsOperand[2].Get());
+            DAWN_ASSERT(mExpression.find(inputsOperand[2]) != mExpression.end());
+            bias = mExpression.at(inputsOperand[2]);
             ::dml::TensorDimensions biasDims = bias->GetOutputDesc().sizes;
             if (biasDims[0] != filter.GetOutputDesc().sizes[0] || biasDims.size() != 1) {
                 return DAWN_INTERNAL_ERROR(
@@ -844,12 +893,15 @@ namespace dawn::native { namespace dml {
     }
 
     MaybeError Graph::AddGemm(const op::Gemm* gemm) {
+        if (gemm->GetQuantization() != nullptr) {
+            return DAWN_UNIMPLEMENTED_ERROR("The quantized Gemm is not implemented.");
+        }
         std::vector<uint32_t> outputDims;
         outputDims.reserve(2);
         auto inputs = gemm->Inputs();
         DAWN_ASSERT(inputs.size() == 2 || inputs.size() == 3);
-        DAWN_ASSERT(mExpression.find(inputs[0].Get()) != mExpression.end());
-        ::dml::Expression a = mExpression.at(inputs[0].Get());
+        DAWN_ASSERT(mExpression.find(inputs[0]) != mExpression.end());
+        ::dml::Expression a = mExpression.at(inputs[0]);
         ::dml::TensorDimensions aDims = a.GetOutputDesc().sizes;
         const GemmOptions* options = gemm->GetOptions();
         outputDims.push_back(options->aTranspose ? aDims[1] : aDims[0]);
@@ -859,8 +911,8 @@ namespace dawn::native { namespace dml {
         auto expandDims = ExpandDimensions(aDims, 4);
         a = ::dml::Reinterpret(a, expandDims, ::dml::NullOpt);
 
-        DAWN_ASSERT(mExpression.find(inputs[1].Get()) != mExpression.end());
-        ::dml::Expression b = mExpression.at(inputs[1].Get());
+        DAWN_ASSERT(mExpression.find(inputs[1]) != mExpression.end());
+        ::dml::Expression b = mExpression.at(inputs[1]);
         ::dml::TensorDimensions bDims = b.GetOutputDesc().sizes;
         outputDims.push_back(options->bTranspose ? bDims[0] : bDims[1]);
         // The shape of b tensor is 2D definited in WebNN Spec, but DML only support 4D,
@@ -872,8 +924,8 @@ namespace dawn::native { namespace dml {
         // The operand c is optional.
         ::dml::Optional<::dml::Expression> c = ::dml::NullOpt;
         if (inputs.size() == 3) {
-            DAWN_ASSERT(mExpression.find(inputs[2].Get()) != mExpression.end());
-            c = mExpression.at(inputs[2].Get());
+            DAWN_ASSERT(mExpression.find(inputs[2]) != mExpression.end());
+            c = mExpression.at(inputs[2]);
             ::dml::TensorDimensions cDims = c->GetOutputDesc().sizes;
             if (cDims.size() != 2) {
                 cDims = ExpandDimensions(cDims, 2);
@@ -905,10 +957,12 @@ namespace dawn::native { namespace dml {
                                               ? DML_MATRIX_TRANSFORM_TRANSPOSE
                                               : DML_MATRIX_TRANSFORM_NONE;
         ::dml::Expression output =
-            ::dml::Gemm(a, b, c, aTranspose, bTranspose, options->alpha, options->beta);
+            ::dml::Gemm(a, b, c, aTranspose, bTranspose, options->alpha, options->beta,
+                        CreateFusedActivation(options->activation));
         // Reshape back according to output rank.
         auto shrinkDims = ShrinkDimensions(output.GetOutputDesc().sizes, 2);
         output = ::dml::Reinterpret(output, shrinkDims, ::dml::NullOpt);
+        output = EmulateFusedActivation(options->activation, output);
         mExpression.insert(std::make_pair(gemm->PrimaryOutput(), output));
         DAWN_ASSERT(CheckShape(output, gemm));
         return {};
@@ -917,8 +971,8 @@ namespace dawn::native { namespace dml {
     MaybeError Graph::AddPad(const op::Pad* pad) {
         auto inputsOperand = pad->Inputs();
         DAWN_ASSERT(inputsOperand.size() == 1);
-        DAWN_ASSERT(mExpression.find(inputsOperand[0].Get()) != mExpression.end());
-        ::dml::Expression input = mExpression.at(inputsOperand[0].Get());
+        DAWN_ASSERT(mExpression.find(inputsOperand[0]) != mExpression.end());
+        ::dml::Expression input = mExpression.at(inputsOperand[0]);
 
         ::dml::TensorDimensions inputDims = input.GetOutputDesc().sizes;
         uint32_t inputRank = inputDims.size();
@@ -961,7 +1015,7 @@ namespace dawn::native { namespace dml {
 
     MaybeError Graph::AddPool2d(const op::Pool2d* pool2d) {
         DAWN_ASSERT(pool2d->Inputs().size() == 1);
-        const OperandBase* inputOperand = pool2d->Inputs()[0].Get();
+        const OperandBase* inputOperand = pool2d->Inputs()[0];
         DAWN_ASSERT(mExpression.find(inputOperand) != mExpression.end());
         ::dml::Expression input = mExpression.at(inputOperand);
         const Pool2dOptions* options = pool2d->GetOptions();
@@ -1015,9 +1069,42 @@ namespace dawn::native { namespace dml {
         return {};
     }
 
+    MaybeError Graph::AddQuantize(const op::Quantize* quantize) {
+        auto inputsOperand = quantize->Inputs();
+        DAWN_ASSERT(inputsOperand.size() == 3);
+        bool isQuantize = quantize->GetType() == op::QuantizeOpType::kQuantizeLinear;
+        if (isQuantize && quantize->PrimaryOutput()->Type() != wgpu::OperandType::Uint8) {
+            return DAWN_UNIMPLEMENTED_ERROR("quantizeLinear only supports uint8 output.");
+        }
+        ::dml::Expression input = mExpression.at(inputsOperand[0]);
+        ::dml::TensorDimensions inputDims = input.GetOutputDesc().sizes;
+        if (inputDims.size() > DML_TENSOR_DIMENSION_COUNT_MAX) {
+            return DAWN_INTERNAL_ERROR("The size of input dimensions is greater than max");
+        }
+        // The scale and the zero point are broadcast to the input with zero strides.
+        ::dml::Expression parameters[2];
+        for (size_t i = 0; i < 2; ++i) {
+            ::dml::Expression parameter = mExpression.at(inputsOperand[i + 1]);
+            ::dml::TensorDimensions dims =
+                ExpandDimensions(parameter.GetOutputDesc().sizes, inputDims.size());
+            std::vector<bool> broadcast(inputDims.size(), false);
+            for (size_t j = 0; j < inputDims.size(); ++j) {
+                broadcast[j] = dims[j] != inputDims[j];
+            }
+            parameters[i] = ::dml::Reinterpret(parameter, inputDims,
+                                               CalculateBroadcastStrides(dims, broadcast));
+        }
+        ::dml::Expression output =
+            isQuantize ? ::dml::QuantizeLinear(input, parameters[0], parameters[1])
+                       : ::dml::DequantizeLinear(input, parameters[0], parameters[1]);
+        mExpression.insert(std::make_pair(quantize->PrimaryOutput(), output));
+        DAWN_ASSERT(CheckShape(output, quantize));
+        return {};
+    }
+
     MaybeError Graph::AddReduce(const op::Reduce* reduce) {
         DAWN_ASSERT(reduce->Inputs().size() == 1);
-        const OperandBase* inputOperand = reduce->Inputs()[0].Get();
+        const OperandBase* inputOperand = reduce->Inputs()[0];
         DAWN_ASSERT(mExpression.find(inputOperand) != mExpression.end());
         ::dml::Expression input = mExpression.at(inputOperand);
         const ReduceOptions* options = reduce->GetOptions();
@@ -1085,7 +1172,7 @@ namespace dawn::native { namespace dml {
 
     MaybeError Graph::AddResample2d(const op::Resample2d* resample2d) {
         DAWN_ASSERT(resample2d->Inputs().size() == 1);
-        const OperandBase* inputOperand = resample2d->Inputs()[0].Get();
+        const OperandBase* inputOperand = resample2d->Inputs()[0];
         DAWN_ASSERT(mExpression.find(inputOperand) != mExpression.end());
         ::dml::Expression input = mExpression.at(inputOperand);
         ::dml::TensorDimensions inputDims = input.GetOutputDesc().sizes;
@@ -1121,7 +1208,7 @@ namespace dawn::native { namespace dml {
 
     MaybeError Graph::AddReshape(const op::Reshape* reshape) {
         DAWN_ASSERT(reshape->Inputs().size() == 1);
-        const OperandBase* inputOperand = reshape->Inputs()[0].Get();
+        const OperandBase* inputOperand = reshape->Inputs()[0];
         DAWN_ASSERT(mExpression.find(inputOperand) != mExpression.end());
         ::dml::Expression input = mExpression.at(inputOperand);
         auto newShape = reshape->GetNewShape();
@@ -1163,7 +1250,7 @@ namespace dawn::native { namespace dml {
 
     MaybeError Graph::AddTranspose(const op::Transpose* transpose) {
         DAWN_ASSERT(transpose->Inputs().size() == 1);
-        const OperandBase* inputOperand = transpose->Inputs()[0].Get();
+        const OperandBase* inputOperand = transpose->Inputs()[0];
         DAWN_ASSERT(mExpression.find(inputOperand) != mExpression.end());
         ::dml::Expression input = mExpression.at(inputOperand);
         std::vector<int32_t> permutation = transpose->GetPermutation();
@@ -1203,7 +1290,7 @@ namespace dawn::native { namespace dml {
 
     MaybeError Graph::AddUnary(const op::Unary* unary) {
         DAWN_ASSERT(unary->Inputs().size() == 1);
-        const OperandBase* inputOperand = unary->Inputs()[0].Get();
+        const OperandBase* inputOperand = unary->Inputs()[0];
         DAWN_ASSERT(mExpression.find(inputOperand) != mExpression.end());
         ::dml::Expression input = mExpression.at(inputOperand);
         ::dml::TensorDimensions inputDims = input.GetOutputDesc().sizes;
@@ -1266,14 +1353,15 @@ namespace dawn::native { namespace dml {
         if (mInputs.empty()) {
             return DAWN_VALIDATION_ERROR("Model inputs must be set.");
         }
-        for (auto outputExp : mOutputExpressions) {
+        for (auto& outputExp : mOutputExpressions) {
             auto builder = outputExp.Impl()->GetGraphBuilder();
             auto node = outputExp.Impl()->GetNode();
             if (node.type == ::dml::detail::NodeType::Reinterpret &&
                 builder->m_reinterpretNodes[node.index].input->GetNode().type == ::dml::detail::NodeType::Input) {
-                // Deal with a graph with single reshape node.
+                // The reshapes are reinterpreted in place, but an output that reshapes an input
+                // must be copied out of it.
                 // https://github.com/microsoft/DirectML/issues/71
-                mOutputExpressions[0] = ::dml::ActivationIdentity(outputExp);
+                outputExp = ::dml::ActivationIdentity(outputExp);
             }
         }
 
@@ -1296,13 +1384,32 @@ namespace dawn::native { namespace dml {
         return {};
     }
 
-    void Graph::ComputeImpl(NamedResourcesBase* inputs, NamedResourcesBase* outputs) {
+    MaybeError Graph::ComputeImpl(NamedResourcesBase* inputs, NamedResourcesBase* outputs) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return DispatchLocked(inputs, outputs);
+    }
+
+    void Graph::ComputePendingImpl(std::vector<ComputeRequest>& requests) {
+        // Hold the device once for all the pending requests instead of once per request.
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (ComputeRequest& request : requests) {
+            MaybeError maybeError = DispatchLocked(request.inputs.Get(), request.outputs.Get());
+            if (maybeError.IsError()) {
+                request.errorMessage = maybeError.AcquireError()->GetMessage();
+            }
+        }
+    }
+
+    MaybeError Graph::DispatchLocked(NamedResourcesBase* inputs, NamedResourcesBase* outputs) {
+        // The bindings are D3D12 buffers, host memory would have to be staged.
+        if (!inputs->GetHostResources().empty() || !outputs->GetHostResources().empty()) {
+            return DAWN_UNIMPLEMENTED_ERROR("DirectML doesn't support host resources.");
+        }
         auto namedInputs = inputs->GetResources();
         for (auto& input : mInputs) {
             // All the inputs must be set.
             if (namedInputs.find(input.first) == namedInputs.end()) {
-                dawn::ErrorLog() << "The input must be set.";
-                return;
+                return DAWN_VALIDATION_ERROR("The input must be set.");
             }
 
             ::pydml::Binding* binding = input.second;
@@ -1325,10 +1432,10 @@ namespace dawn::native { namespace dml {
             binding->data.size = bufferView.size != 0 ? bufferView.size : bufferView.resource->GetSize();
             outputBindings.push_back(binding);
         }
-        std::lock_guard<std::mutex> lock(mMutex);
         if (FAILED(mDevice->DispatchOperator(mCompiledModel->op.Get(), inputBindings, outputBindings))) {
-            dawn::ErrorLog() << "Failed to dispatch operator.";
+            return DAWN_INTERNAL_ERROR("Failed to dispatch operator.");
         }
+        return {};
     }
 
 }}  // namespace dawn::native::dml
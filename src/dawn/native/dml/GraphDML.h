@@ -21,6 +21,7 @@
 #include <unordered_set>
 
 #include "dawn/native/Graph.h"
+#include "dawn/native/GraphArena.h"
 #include "dawn/native/Operand.h"
 #include "dawn/native/Operator.h"
 #include "dawn/native/dml/deps/src/precomp.h"
@@ -35,6 +36,7 @@
 #include "dawn/native/ops/Input.h"
 #include "dawn/native/ops/Pad.h"
 #include "dawn/native/ops/Pool2d.h"
+#include "dawn/native/ops/Quantize.h"
 #include "dawn/native/ops/Reduce.h"
 #include "dawn/native/ops/Resample2d.h"
 #include "dawn/native/ops/Reshape.h"
@@ -62,6 +64,7 @@ namespace dawn::native { namespace dml {
         virtual MaybeError AddGemm(const op::Gemm* Gemm) override;
         virtual MaybeError AddPad(const op::Pad* pad) override;
         virtual MaybeError AddPool2d(const op::Pool2d* pool2d) override;
+        virtual MaybeError AddQuantize(const op::Quantize* quantize) override;
         virtual MaybeError AddReduce(const op::Reduce* reduce) override;
         virtual MaybeError AddResample2d(const op::Resample2d* resample2d) override;
         virtual MaybeError AddReshape(const op::Reshape* reshape) override;
@@ -71,8 +74,11 @@ namespace dawn::native { namespace dml {
 
       private:
         MaybeError CompileImpl() override;
-        void ComputeImpl(NamedResourcesBase* inputs,
-                         NamedResourcesBase* outputs) override;
+        MaybeError ComputeImpl(NamedResourcesBase* inputs,
+                               NamedResourcesBase* outputs) override;
+        void ComputePendingImpl(std::vector<ComputeRequest>& requests) override;
+        // Binds the resources and dispatches the compiled model, with mMutex held.
+        MaybeError DispatchLocked(NamedResourcesBase* inputs, NamedResourcesBase* outputs);
 
         ::dml::Expression BindingConstant(DML_TENSOR_DATA_TYPE dmlTensorType,
                                           ::dml::TensorDimensions dmlTensorDims,
@@ -81,13 +87,16 @@ namespace dawn::native { namespace dml {
                                           size_t size);
 
         std::shared_ptr<::pydml::Device> mDevice;
-        // The mutex is used to lock mDevice.
+        // The mutex is used to lock mDevice and the input and output bindings.
         std::mutex mMutex;
         std::unique_ptr<::dml::Graph> mGraph;
         std::map<const OperandBase*, ::dml::Expression> mExpression;
         std::vector<std::unique_ptr<::pydml::Binding>> mInputBindings;
         std::vector<std::unique_ptr<::pydml::Binding>> mOutputBindings;
-        std::vector<Ref<OperandBase>> mConstants;
+        // Keeps the constants, which are owned by the arena of their builder, alive.
+        Ref<GraphArena> mArena;
+        // The buffers uploaded for the constants in host memory.
+        std::vector<Ref<BufferBase>> mConstantBuffers;
         std::vector<::dml::Expression> mOutputExpressions;
         std::map<std::string, ::pydml::Binding*> mInputs;
         std::map<std::string, ::pydml::Binding*> mOutputs;
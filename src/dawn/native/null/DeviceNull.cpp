@@ -19,6 +19,7 @@
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/Surface.h"
+#include "dawn/native/cpu/GraphBuilderCPU.h"
 
 namespace dawn::native::null {
 
@@ -177,6 +178,9 @@ namespace dawn::native::null {
         const TextureViewDescriptor* descriptor) {
         return AcquireRef(new TextureView(texture, descriptor));
     }
+    ResultOrError<Ref<GraphBuilderBase>> Device::CreateGraphBuilderImpl() {
+        return AcquireRef(cpu::GraphBuilder::Create(this));
+    }
 
     ResultOrError<std::unique_ptr<StagingBufferBase>> Device::CreateStagingBuffer(size_t size) {
         std::unique_ptr<StagingBufferBase> stagingBuffer =
@@ -332,6 +336,11 @@ namespace dawn::native::null {
         return mBackingData.get();
     }
 
+    void* Buffer::GetHostVisiblePointerImpl() {
+        // The submissions are complete as soon as they are made, there is nothing to wait for.
+        return mBackingData.get();
+    }
+
     void Buffer::UnmapImpl() {
     }
 
@@ -154,6 +154,8 @@ namespace dawn::native::null {
         ResultOrError<Ref<TextureViewBase>> CreateTextureViewImpl(
             TextureBase* texture,
             const TextureViewDescriptor* descriptor) override;
+        // WebNN graphs are computed on the CPU.
+        ResultOrError<Ref<GraphBuilderBase>> CreateGraphBuilderImpl() override;
 
         ResultOrError<ExecutionSerial> CheckAndUpdateCompletedSerials() override;
 
@@ -234,6 +236,7 @@ namespace dawn::native::null {
         bool IsCPUWritableAtCreation() const override;
         MaybeError MapAtCreationImpl() override;
         void* GetMappedPointerImpl() override;
+        void* GetHostVisiblePointerImpl() override;
 
         std::unique_ptr<uint8_t[]> mBackingData;
     };
@@ -34,6 +34,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddBatchNorm(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::BatchNorm;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
 
         BatchNormOptions const* GetOptions() const {
@@ -18,8 +18,8 @@
 
 namespace dawn::native { namespace op {
 
-    MaybeError BroadcastShape(std::vector<int32_t> shapeA,
-                              std::vector<int32_t> shapeB,
+    MaybeError BroadcastShape(const std::vector<int32_t>& shapeA,
+                              const std::vector<int32_t>& shapeB,
                               std::vector<int32_t>& newShape,
                               size_t skipAxes = 0) {
         // The rank of the output tensor is the maximum rank of the input tensors.
@@ -44,7 +44,8 @@ namespace dawn::native { namespace op {
     }
 
     MaybeError Binary::CaculateMatMulShape() {
-        auto inputShapeA = mInputs[0]->Shape(), inputShapeB = mInputs[1]->Shape();
+        const auto& inputShapeA = mInputs[0]->Shape();
+        const auto& inputShapeB = mInputs[1]->Shape();
         auto rankA = inputShapeA.size(), rankB = inputShapeB.size();
         std::vector<int32_t> outputShape;
         if (rankA == 1 && rankB == 1) {
@@ -82,7 +83,8 @@ namespace dawn::native { namespace op {
     }
 
     MaybeError Binary::CaculateElementWiseBinaryShape() {
-        auto inputShapeA = mInputs[0]->Shape(), inputShapeB = mInputs[1]->Shape();
+        const auto& inputShapeA = mInputs[0]->Shape();
+        const auto& inputShapeB = mInputs[1]->Shape();
         std::vector<int32_t> outputShape;
         auto maybeError = BroadcastShape(inputShapeA, inputShapeB, outputShape);
         if (maybeError.IsError()) {
@@ -98,8 +100,8 @@ namespace dawn::native { namespace op {
             return maybeError;
         }
 
-        Ref<OperandBase> a = mInputs[0];
-        Ref<OperandBase> b = mInputs[1];
+        OperandBase* a = mInputs[0];
+        OperandBase* b = mInputs[1];
         if (a->Type() != b->Type()) {
             return DAWN_VALIDATION_ERROR("Argument types are inconsistent.");
         }
@@ -15,6 +15,7 @@
 #ifndef WEBNN_NATIVE_OPS_BINARY_H_
 #define WEBNN_NATIVE_OPS_BINARY_H_
 
+#include "dawn/native/FusionOperator.h"
 #include "dawn/native/Graph.h"
 #include "dawn/native/Operand.h"
 
@@ -33,17 +34,29 @@ namespace dawn::native { namespace op {
 
     class Binary final : public OperatorBase {
       public:
-        Binary(GraphBuilderBase* builder, BinaryOpType opType, OperandBase* a, OperandBase* b)
-            : OperatorBase(builder, {a, b}), mOpType(opType) {
+        // |activation| is only set by the graph rewrites that fuse the activation following an
+        // element-wise operation, it is not exposed by the WebNN API.
+        Binary(GraphBuilderBase* builder,
+               BinaryOpType opType,
+               OperandBase* a,
+               OperandBase* b,
+               FusionOperatorBase* activation = nullptr)
+            : OperatorBase(builder, {a, b}), mOpType(opType), mActivation(activation) {
         }
         ~Binary() override = default;
 
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddBinary(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Binary;
+        }
         BinaryOpType GetType() const {
             return mOpType;
         }
+        FusionOperatorBase* GetActivation() const {
+            return mActivation.Get();
+        }
 
         MaybeError ValidateAndInferOutputInfo() override;
 
@@ -51,6 +64,7 @@ namespace dawn::native { namespace op {
         MaybeError CaculateMatMulShape();
         MaybeError CaculateElementWiseBinaryShape();
         BinaryOpType mOpType;
+        Ref<FusionOperatorBase> mActivation;
     };
 
 }}  // namespace dawn/native::op
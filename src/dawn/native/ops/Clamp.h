@@ -53,6 +53,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddClamp(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Clamp;
+        }
 
         MaybeError ValidateAndInferOutputInfo() override {
             MaybeError maybeError = OperatorBase::ValidateAndInferOutputInfo();
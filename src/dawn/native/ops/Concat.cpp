@@ -18,7 +18,7 @@
 
 namespace dawn::native { namespace op {
     MaybeError Concat::CalculateShape() {
-        auto outputShape = mInputs[0]->Shape();
+        std::vector<int32_t> outputShape = mInputs[0]->Shape();
         // The size of the dimension along axis is computed as the sum of all the input sizes of
         // the same dimension.
         outputShape[mAxis] = 0;
@@ -40,14 +40,14 @@ namespace dawn::native { namespace op {
         }
 
         auto inputType = mInputs[0]->Type();
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         auto inputRank = inputShape.size();
         for (auto& input : mInputs) {
             if (input->Type() != inputType) {
                 return DAWN_VALIDATION_ERROR("Argument types are inconsistent.");
             }
 
-            auto shape = input->Shape();
+            const auto& shape = input->Shape();
             if (shape.size() != inputShape.size()) {
                 return DAWN_VALIDATION_ERROR("The input tensors must have the same rank.");
             }
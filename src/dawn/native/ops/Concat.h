@@ -24,7 +24,7 @@ namespace dawn::native { namespace op {
 
     class Concat final : public OperatorBase {
       public:
-        Concat(GraphBuilderBase* builder, std::vector<Ref<OperandBase>> inputs, uint32_t axis)
+        Concat(GraphBuilderBase* builder, std::vector<OperandBase*> inputs, uint32_t axis)
             : OperatorBase(builder, std::move(inputs)), mAxis(axis) {
         }
         ~Concat() override = default;
@@ -32,6 +32,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddConcat(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Concat;
+        }
         uint32_t GetAxis() const {
             return mAxis;
         }
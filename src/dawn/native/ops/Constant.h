@@ -39,14 +39,34 @@ namespace dawn::native { namespace op {
             mOffset = view->offset;
             mSize = view->size != 0 ? view->size : mBuffer->GetSize();
         }
+        // A constant reading |size| bytes of host memory at |data|, which is kept alive by
+        // |owner|, e.g. a mapped file. It has no buffer.
+        Constant(GraphBuilderBase* builder,
+                 const OperandDescriptor* desc,
+                 Ref<RefCounted> owner,
+                 const void* data,
+                 size_t size)
+            : OperatorBase(builder),
+              mOwner(std::move(owner)),
+              mData(static_cast<const uint8_t*>(data)),
+              mOffset(0),
+              mSize(size) {
+            mDimensions.assign(desc->dimensions, desc->dimensions + desc->dimensionsCount);
+            mDescriptor.dimensions = mDimensions.data();
+            mDescriptor.dimensionsCount = mDimensions.size();
+            mDescriptor.type = desc->type;
+        }
         ~Constant() override = default;
 
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddConstant(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Constant;
+        }
 
         MaybeError ValidateAndInferOutputInfo() override {
-            if (mBuffer == nullptr || mSize == 0) {
+            if ((mBuffer == nullptr && mData == nullptr) || mSize == 0) {
                 return DAWN_VALIDATION_ERROR("Constant array buffer is invalid.");
             }
             mOutputs[0]->SetType(mDescriptor.type);
@@ -58,10 +78,25 @@ namespace dawn::native { namespace op {
             return &mDescriptor;
         }
 
+        // Null for the constants in host memory.
         BufferBase* GetBuffer() const {
             return mBuffer.Get();
         }
 
+        // Returns the data of the constant if it is readable on the host, else nullptr.
+        const uint8_t* GetHostData() const {
+            if (mData != nullptr) {
+                return mData;
+            }
+            const uint8_t* data = static_cast<const uint8_t*>(mBuffer->GetHostVisiblePointer());
+            return data == nullptr ? nullptr : data + mOffset;
+        }
+
+        // The object keeping the host memory of the constant alive, if any.
+        RefCounted* GetHostDataOwner() const {
+            return mOwner.Get();
+        }
+
         size_t GetOffset() const {
             return mOffset;
         }
@@ -74,6 +109,8 @@ namespace dawn::native { namespace op {
         OperandDescriptor mDescriptor;
         std::vector<int32_t> mDimensions;
         Ref<BufferBase> mBuffer;
+        Ref<RefCounted> mOwner;
+        const uint8_t* mData = nullptr;
         size_t mOffset;
         size_t mSize;
     };
@@ -96,8 +96,8 @@ namespace dawn::native { namespace op {
     }
 
     MaybeError Conv2d::CalculateShape() {
-        auto inputShape = mInputs[0]->Shape();
-        auto filterShape = mInputs[1]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
+        const auto& filterShape = mInputs[1]->Shape();
 
         bool nchw = mOptions.inputLayout == wgpu::InputOperandLayout::Nchw;
         int32_t inputHeight = nchw ? inputShape[2] : inputShape[1];
@@ -179,7 +179,8 @@ namespace dawn::native { namespace op {
 
         auto input = mInputs[0];
         auto filter = mInputs[1];
-        if (input->Type() != filter->Type()) {
+        // A quantized convolution may mix int8 and uint8 values.
+        if (input->Type() != filter->Type() && !mQuantization) {
             return DAWN_VALIDATION_ERROR("Argument types are inconsistent.");
         }
         // The input 4-D tensor
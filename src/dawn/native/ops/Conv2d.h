@@ -15,9 +15,12 @@
 #ifndef WEBNN_NATIVE_OPS_CONV2D_H_
 #define WEBNN_NATIVE_OPS_CONV2D_H_
 
+#include <optional>
+
 #include "dawn/native/FusionOperator.h"
 #include "dawn/native/Graph.h"
 #include "dawn/native/Operand.h"
+#include "dawn/native/ops/Quantize.h"
 
 namespace dawn::native { namespace op {
 
@@ -38,9 +41,21 @@ namespace dawn::native { namespace op {
         ~Conv2d() override = default;
 
         MaybeError AddToGraph(GraphBase* graph) const override;
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Conv2d;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
         Conv2dOptions const* GetOptions() const;
 
+        // Set by GraphOptimizer when the input, the filter and the output are quantized.
+        void SetQuantization(Quantization quantization) {
+            mQuantization = std::move(quantization);
+        }
+        // nullptr when the operator computes on float32 operands.
+        const Quantization* GetQuantization() const {
+            return mQuantization ? &*mQuantization : nullptr;
+        }
+
       private:
         MaybeError CalculateShape();
         Conv2dOptions mOptions;
@@ -48,6 +63,7 @@ namespace dawn::native { namespace op {
         std::vector<int32_t> mStride;
         std::vector<int32_t> mDilations;
         Ref<FusionOperatorBase> mActivation;
+        std::optional<Quantization> mQuantization;
     };
 
 }}  // namespace dawn::native::op
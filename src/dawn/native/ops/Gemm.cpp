@@ -28,17 +28,20 @@ namespace dawn::native { namespace op {
         mOptions.beta = options == nullptr ? 1.0 : options->beta;
         mOptions.aTranspose = options == nullptr ? false : options->aTranspose;
         mOptions.bTranspose = options == nullptr ? false : options->bTranspose;
-        if (options != nullptr && options->c) {
-            mInputs.push_back(options->c);
+        mOptions.c = options == nullptr ? nullptr : options->c;
+        if (mOptions.c != nullptr) {
+            mInputs.push_back(mOptions.c);
         }
+        mOptions.activation = options == nullptr ? nullptr : options->activation;
+        mActivation = Ref<FusionOperatorBase>(mOptions.activation);
     }
 
     MaybeError Gemm::CalculateShape() {
         // The first input 2-D tensor with shape [M, K] if aTranspose is false, or [K, M] if
         // aTranspose is true. The second input 2-D tensor with shape [K, N] if bTranspose is false,
         // or [N, K] if bTranspose is true.
-        auto inputAShape = mInputs[0]->Shape();
-        auto inputBShape = mInputs[1]->Shape();
+        const auto& inputAShape = mInputs[0]->Shape();
+        const auto& inputBShape = mInputs[1]->Shape();
         bool matMulSupported = (mOptions.aTranspose ? inputAShape[0] : inputAShape[1]) ==
                                (mOptions.bTranspose ? inputBShape[1] : inputBShape[0]);
         if (!matMulSupported) {
@@ -50,7 +53,7 @@ namespace dawn::native { namespace op {
         // The third input tensor c is either a scalar, or of the shape that is unidirectionally
         // broadcastable to the shape [M, N].
         if (mInputs.size() == 3) {
-            auto cShape = mInputs[2]->Shape();
+            const auto& cShape = mInputs[2]->Shape();
             if (cShape.size() > 2) {
                 return DAWN_VALIDATION_ERROR(
                     "The specified third input is either a scalar, or of the shape that is "
@@ -15,8 +15,12 @@
 #ifndef WEBNN_NATIVE_OPS_GEMM_H_
 #define WEBNN_NATIVE_OPS_GEMM_H_
 
+#include <optional>
+
+#include "dawn/native/FusionOperator.h"
 #include "dawn/native/Graph.h"
 #include "dawn/native/Operand.h"
+#include "dawn/native/ops/Quantize.h"
 
 namespace dawn::native { namespace op {
 
@@ -28,15 +32,29 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddGemm(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Gemm;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
 
         GemmOptions const* GetOptions() const {
             return &mOptions;
         }
 
+        // Set by GraphOptimizer when the input, b and the output are quantized.
+        void SetQuantization(Quantization quantization) {
+            mQuantization = std::move(quantization);
+        }
+        // nullptr when the operator computes on float32 operands.
+        const Quantization* GetQuantization() const {
+            return mQuantization ? &*mQuantization : nullptr;
+        }
+
       private:
         MaybeError CalculateShape();
         GemmOptions mOptions;
+        Ref<FusionOperatorBase> mActivation;
+        std::optional<Quantization> mQuantization;
     };
 
 }}  // namespace dawn::native::op
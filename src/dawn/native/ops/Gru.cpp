@@ -0,0 +1,111 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/ops/Gru.h"
+
+#include "dawn/native/Error.h"
+
+namespace dawn::native { namespace op {
+
+    Gru::Gru(GraphBuilderBase* builder,
+             OperandBase* input,
+             OperandBase* weight,
+             OperandBase* recurrentWeight,
+             int32_t steps,
+             int32_t hiddenSize,
+             GruOptions const* options)
+        : OperatorBase(builder,
+                       {input, weight, recurrentWeight},
+                       options != nullptr && options->returnSequence ? 2 : 1),
+          mSteps(steps),
+          mHiddenSize(hiddenSize) {
+        if (options != nullptr) {
+            mOptions = *options;
+            if (options->bias != nullptr) {
+                mInputs.push_back(options->bias);
+            }
+            if (options->recurrentBias != nullptr) {
+                mInputs.push_back(options->recurrentBias);
+            }
+            if (options->initialHiddenState != nullptr) {
+                mInputs.push_back(options->initialHiddenState);
+            }
+        } else {
+            mOptions.bias = nullptr;
+            mOptions.recurrentBias = nullptr;
+            mOptions.initialHiddenState = nullptr;
+        }
+    }
+
+    MaybeError Gru::ValidateAndInferOutputInfo() {
+        MaybeError maybeError = OperatorBase::ValidateAndInferOutputInfo();
+        if (maybeError.IsError()) {
+            return maybeError;
+        }
+
+        if (mSteps <= 0 || mHiddenSize <= 0) {
+            return DAWN_VALIDATION_ERROR("Argument steps and hiddenSize must be positive.");
+        }
+        // The input is a 3-D tensor of shape [steps, batchSize, inputSize].
+        const auto& inputShape = mInputs[0]->Shape();
+        if (inputShape.size() != 3 || inputShape[0] != mSteps) {
+            return DAWN_VALIDATION_ERROR("Input is not a 3D tensor of the steps.");
+        }
+        int32_t directions = GetDirectionCount();
+        int32_t batchSize = inputShape[1];
+        int32_t gateSize = 3 * mHiddenSize;
+        auto expectShape = [&](size_t index, const std::vector<int32_t>& shape,
+                               const char* message) -> MaybeError {
+            if (mInputs[index]->Shape() != shape) {
+                return DAWN_VALIDATION_ERROR(message);
+            }
+            return {};
+        };
+        DAWN_TRY(expectShape(1, {directions, gateSize, inputShape[2]},
+                             "Argument weight is not of shape [directions, 3 * hiddenSize, "
+                             "inputSize]."));
+        DAWN_TRY(expectShape(2, {directions, gateSize, mHiddenSize},
+                             "Argument recurrentWeight is not of shape [directions, 3 * "
+                             "hiddenSize, hiddenSize]."));
+        size_t index = 3;
+        if (mOptions.bias != nullptr) {
+            DAWN_TRY(expectShape(index++, {directions, gateSize},
+                                 "Argument bias is not of shape [directions, 3 * hiddenSize]."));
+        }
+        if (mOptions.recurrentBias != nullptr) {
+            DAWN_TRY(expectShape(
+                index++, {directions, gateSize},
+                "Argument recurrentBias is not of shape [directions, 3 * hiddenSize]."));
+        }
+        if (mOptions.initialHiddenState != nullptr) {
+            DAWN_TRY(expectShape(index++, {directions, batchSize, mHiddenSize},
+                                 "Argument initialHiddenState is not of shape [directions, "
+                                 "batchSize, hiddenSize]."));
+        }
+        for (size_t i = 1; i < mInputs.size(); ++i) {
+            if (mInputs[i]->Type() != mInputs[0]->Type()) {
+                return DAWN_VALIDATION_ERROR("Argument types are inconsistent.");
+            }
+        }
+
+        mOutputs[0]->SetShape({directions, batchSize, mHiddenSize});
+        if (mOptions.returnSequence) {
+            mOutputs[1]->SetType(mInputs[0]->Type());
+            mOutputs[1]->SetShape({mSteps, directions, batchSize, mHiddenSize});
+        }
+
+        return {};
+    }
+
+}}  // namespace dawn::native::op
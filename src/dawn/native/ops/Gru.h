@@ -0,0 +1,68 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_OPS_GRU_H_
+#define WEBNN_NATIVE_OPS_GRU_H_
+
+#include "dawn/native/Graph.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native { namespace op {
+
+    // The gated recurrent unit with the default sigmoid and tanh activations. The inputs are
+    // input, weight, recurrent weight and the optional bias, recurrent bias and initial hidden
+    // state in that order. The outputs are the last hidden state and, with returnSequence, the
+    // hidden states of all the steps.
+    class Gru final : public OperatorBase {
+      public:
+        Gru(GraphBuilderBase* builder,
+            OperandBase* input,
+            OperandBase* weight,
+            OperandBase* recurrentWeight,
+            int32_t steps,
+            int32_t hiddenSize,
+            GruOptions const* options);
+        ~Gru() override = default;
+
+        MaybeError AddToGraph(GraphBase* graph) const override {
+            return graph->AddGru(this);
+        }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Gru;
+        }
+        MaybeError ValidateAndInferOutputInfo() override;
+
+        GruOptions const* GetOptions() const {
+            return &mOptions;
+        }
+        int32_t GetSteps() const {
+            return mSteps;
+        }
+        int32_t GetHiddenSize() const {
+            return mHiddenSize;
+        }
+        size_t GetDirectionCount() const {
+            return mOptions.direction == wgpu::RecurrentNetworkDirection::Both ? 2 : 1;
+        }
+
+      private:
+        GruOptions mOptions;
+        int32_t mSteps;
+        int32_t mHiddenSize;
+    };
+
+}}  // namespace dawn::native::op
+
+#endif  // WEBNN_NATIVE_OPS_GRU_H_
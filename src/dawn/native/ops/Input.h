@@ -37,8 +37,18 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddInput(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Input;
+        }
 
+        // The dimensions are positive, or kDynamicDimension for those only known when the
+        // graph is computed.
         MaybeError ValidateAndInferOutputInfo() override {
+            for (int32_t dimension : mDimensions) {
+                if (dimension <= 0 && dimension != kDynamicDimension) {
+                    return DAWN_VALIDATION_ERROR("Argument dimensions are invalid.");
+                }
+            }
             mOutputs[0]->SetType(mDescriptor.type);
             mOutputs[0]->SetShape(mDimensions);
             return {};
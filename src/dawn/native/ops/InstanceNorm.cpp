@@ -0,0 +1,66 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/ops/InstanceNorm.h"
+
+#include "dawn/native/Error.h"
+
+namespace dawn::native { namespace op {
+
+    InstanceNorm::InstanceNorm(GraphBuilderBase* builder,
+                               OperandBase* input,
+                               InstanceNormOptions const* options)
+        : OperatorBase(builder, {input}) {
+        if (options != nullptr) {
+            mOptions = *options;
+            if (options->scale != nullptr) {
+                mInputs.push_back(options->scale);
+            }
+            if (options->bias != nullptr) {
+                mInputs.push_back(options->bias);
+            }
+        } else {
+            mOptions.scale = nullptr;
+            mOptions.bias = nullptr;
+        }
+    }
+
+    MaybeError InstanceNorm::ValidateAndInferOutputInfo() {
+        MaybeError maybeError = OperatorBase::ValidateAndInferOutputInfo();
+        if (maybeError.IsError()) {
+            return maybeError;
+        }
+
+        // The input is 4-D tensor.
+        const auto& inputShape = mInputs[0]->Shape();
+        if (inputShape.size() != 4) {
+            return DAWN_VALIDATION_ERROR("Input is not a 4D tensor.");
+        }
+        int32_t channels =
+            mOptions.layout == wgpu::InputOperandLayout::Nchw ? inputShape[1] : inputShape[3];
+        // The scale and the bias are 1-D tensors of the size of the feature channels.
+        for (size_t i = 1; i < mInputs.size(); ++i) {
+            const auto& shape = mInputs[i]->Shape();
+            if (shape.size() != 1 || shape[0] != channels) {
+                return DAWN_VALIDATION_ERROR(
+                    "Argument scale and bias must be 1D tensors of the input channels.");
+            }
+        }
+
+        mOutputs[0]->SetShape(std::move(inputShape));
+
+        return {};
+    }
+
+}}  // namespace dawn::native::op
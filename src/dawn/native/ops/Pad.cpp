@@ -30,7 +30,7 @@ namespace dawn::native { namespace op {
     }
 
     MaybeError Pad::CalculateShape() {
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         std::vector<int32_t> outputShape(inputShape.size());
         // For each dimension D of input, padding[D, 0] indicates how many values to add before the
         // content in that dimension, and padding[D, 1] indicates how many values to add after the
@@ -48,13 +48,31 @@ namespace dawn::native { namespace op {
             return maybeError;
         }
 
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         if (inputShape.size() * 2 != mPadding.size()) {
             return DAWN_VALIDATION_ERROR(
                 "The padding tensor should has shape [n, 2] where n is the rank of the input "
                 "tensor.");
         }
 
+        // The reflection mode mirrors the values without repeating the edge, and the symmetric
+        // mode repeats it, so the padding can't go past the other edge of the dimension.
+        if (mOptions.mode == wgpu::PaddingMode::Reflection ||
+            mOptions.mode == wgpu::PaddingMode::Symmetric) {
+            bool reflection = mOptions.mode == wgpu::PaddingMode::Reflection;
+            for (size_t i = 0; i < mPadding.size(); ++i) {
+                int64_t size = inputShape[i / 2];
+                int64_t padding = mPadding[i];
+                if (reflection ? padding >= size : padding > size) {
+                    return DAWN_VALIDATION_ERROR(
+                        reflection ? "The reflection padding must be less than the size of the "
+                                     "dimension."
+                                   : "The symmetric padding must not exceed the size of the "
+                                     "dimension.");
+                }
+            }
+        }
+
         return CalculateShape();
     }
 
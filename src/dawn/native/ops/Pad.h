@@ -33,6 +33,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddPad(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Pad;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
 
         PadOptions const* GetOptions() const {
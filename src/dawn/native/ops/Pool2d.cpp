@@ -77,7 +77,7 @@ namespace dawn::native { namespace op {
     }
 
     MaybeError Pool2d::CalculateShape() {
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         bool nchw = mOptions.layout == wgpu::InputOperandLayout::Nchw;
         int32_t inputHeight = nchw ? inputShape[2] : inputShape[1];
         int32_t inputWidth = nchw ? inputShape[3] : inputShape[2];
@@ -97,12 +97,18 @@ namespace dawn::native { namespace op {
                                              paddingBeginningWidth, paddingEndingWidth);
         }
         // TODO(mingming): Support ceil and floor rounding types for pool2d.
-        int32_t outputHeight =
-            1 + (inputHeight - windowHeight + paddingBeginningHeight + paddingEndingHeight) /
-                    mStride[0];
-        int32_t outputWidth =
-            1 +
-            (inputWidth - windowWidth + paddingBeginningWidth + paddingEndingWidth) / mStride[1];
+        int32_t dilatedWindowHeight = mOptions.dilations[0] * (windowHeight - 1) + 1;
+        int32_t dilatedWindowWidth = mOptions.dilations[1] * (windowWidth - 1) + 1;
+        if (dilatedWindowHeight > inputHeight + paddingBeginningHeight + paddingEndingHeight ||
+            dilatedWindowWidth > inputWidth + paddingBeginningWidth + paddingEndingWidth) {
+            return DAWN_VALIDATION_ERROR("The dilated window is larger than the padded input.");
+        }
+        int32_t outputHeight = 1 + (inputHeight - dilatedWindowHeight + paddingBeginningHeight +
+                                    paddingEndingHeight) /
+                                       mStride[0];
+        int32_t outputWidth = 1 + (inputWidth - dilatedWindowWidth + paddingBeginningWidth +
+                                   paddingEndingWidth) /
+                                      mStride[1];
 
         std::vector<int32_t> outputShape;
         int32_t batches = inputShape[0];
@@ -35,6 +35,9 @@ namespace dawn::native { namespace op {
         ~Pool2d() override = default;
 
         MaybeError AddToGraph(GraphBase* graph) const override;
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Pool2d;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
 
         Pool2dOptions const* GetOptions() const;
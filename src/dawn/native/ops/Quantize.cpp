@@ -0,0 +1,79 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/ops/Quantize.h"
+
+#include "dawn/native/Error.h"
+
+namespace dawn::native { namespace op {
+
+    MaybeError Quantize::ValidateAndInferOutputInfo() {
+        MaybeError maybeError = OperatorBase::ValidateAndInferOutputInfo();
+        if (maybeError.IsError()) {
+            return maybeError;
+        }
+
+        auto input = mInputs[0];
+        auto scale = mInputs[1];
+        auto zeroPoint = mInputs[2];
+        if (scale->Type() != wgpu::OperandType::Float32) {
+            return DAWN_VALIDATION_ERROR("The scale must be a float32 tensor.");
+        }
+        if (mOpType == QuantizeOpType::kQuantizeLinear) {
+            if (input->Type() != wgpu::OperandType::Float32) {
+                return DAWN_VALIDATION_ERROR("The input of quantizeLinear must be float32.");
+            }
+            if (zeroPoint->Type() != wgpu::OperandType::Int8 &&
+                zeroPoint->Type() != wgpu::OperandType::Uint8) {
+                return DAWN_VALIDATION_ERROR(
+                    "The zero point of quantizeLinear must be int8 or uint8.");
+            }
+            mOutputs[0]->SetType(zeroPoint->Type());
+        } else {
+            if (input->Type() != wgpu::OperandType::Int8 &&
+                input->Type() != wgpu::OperandType::Uint8 &&
+                input->Type() != wgpu::OperandType::Int32) {
+                return DAWN_VALIDATION_ERROR(
+                    "The input of dequantizeLinear must be int8, uint8 or int32.");
+            }
+            if (zeroPoint->Type() != input->Type()) {
+                return DAWN_VALIDATION_ERROR(
+                    "The zero point of dequantizeLinear must have the type of the input.");
+            }
+            mOutputs[0]->SetType(wgpu::OperandType::Float32);
+        }
+
+        if (scale->Shape() != zeroPoint->Shape()) {
+            return DAWN_VALIDATION_ERROR("The scale and the zero point must have the same shape.");
+        }
+        // The scale is unidirectionally broadcastable to the input.
+        const std::vector<int32_t>& inputShape = input->Shape();
+        const std::vector<int32_t>& scaleShape = scale->Shape();
+        if (scaleShape.size() > inputShape.size()) {
+            return DAWN_VALIDATION_ERROR(
+                "The rank of the scale must not be greater than the rank of the input.");
+        }
+        for (size_t i = 1; i <= scaleShape.size(); ++i) {
+            int32_t dimension = scaleShape[scaleShape.size() - i];
+            if (dimension != 1 && dimension != inputShape[inputShape.size() - i]) {
+                return DAWN_VALIDATION_ERROR(
+                    "The scale must be unidirectionally broadcastable to the input.");
+            }
+        }
+
+        mOutputs[0]->SetShape(inputShape);
+        return {};
+    }
+
+}}  // namespace dawn::native::op
@@ -0,0 +1,79 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_OPS_QUANTIZE_H_
+#define WEBNN_NATIVE_OPS_QUANTIZE_H_
+
+#include <vector>
+
+#include "dawn/native/Graph.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native { namespace op {
+
+    enum QuantizeOpType {
+        kQuantizeLinear = 0,
+        kDequantizeLinear,
+    };
+
+    // quantizeLinear computes saturate(round(input / scale) + zeroPoint) in the type of
+    // zeroPoint, int8 or uint8. dequantizeLinear computes (input - zeroPoint) * scale in
+    // float32 from int8, uint8 or int32. The float32 scale and the zero point have the same
+    // shape, which is unidirectionally broadcastable to the input, e.g. one value per tensor or
+    // per channel.
+    class Quantize final : public OperatorBase {
+      public:
+        Quantize(GraphBuilderBase* builder,
+                 QuantizeOpType opType,
+                 OperandBase* input,
+                 OperandBase* scale,
+                 OperandBase* zeroPoint)
+            : OperatorBase(builder, {input, scale, zeroPoint}), mOpType(opType) {
+        }
+        ~Quantize() override = default;
+
+        MaybeError AddToGraph(GraphBase* graph) const override {
+            return graph->AddQuantize(this);
+        }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Quantize;
+        }
+        MaybeError ValidateAndInferOutputInfo() override;
+        QuantizeOpType GetType() const {
+            return mOpType;
+        }
+
+      private:
+        QuantizeOpType mOpType;
+    };
+
+    // The quantization of a Conv2d or Gemm computing on int8 or uint8 operands, which
+    // GraphOptimizer creates from the dequantizeLinear -> Conv2d or Gemm -> quantizeLinear
+    // chains. A quantized value q of an operand stands for (q - zeroPoint) * scale. The input
+    // and the output have one scale and zero point, the filter of Conv2d and b of Gemm have one
+    // for the whole tensor or one per output channel. The bias of Conv2d and c of Gemm stay
+    // float32 and are added before the output is quantized.
+    struct Quantization {
+        float inputScale = 1.0f;
+        int32_t inputZeroPoint = 0;
+        std::vector<float> filterScales;
+        std::vector<int32_t> filterZeroPoints;
+        float outputScale = 1.0f;
+        int32_t outputZeroPoint = 0;
+    };
+
+}}  // namespace dawn::native::op
+
+#endif  // WEBNN_NATIVE_OPS_QUANTIZE_H_
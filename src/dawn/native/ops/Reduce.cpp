@@ -43,7 +43,7 @@ namespace dawn::native { namespace op {
     }
 
     MaybeError Reduce::CalculateShape() {
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         std::vector<int32_t> reducedShape = inputShape, outputShape;
         std::vector<int32_t> axes = mAxes;
         for (size_t i = 0; i < axes.size(); ++i) {
@@ -78,7 +78,7 @@ namespace dawn::native { namespace op {
             return maybeError;
         }
 
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         // The number of values in the sequence must be smaller than the rank of the input tensor.
         if (mAxes.size() > inputShape.size()) {
             return DAWN_VALIDATION_ERROR("Axes size is invalid.");
@@ -45,6 +45,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddReduce(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Reduce;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
 
         ReduceType GetType() const {
@@ -36,8 +36,8 @@ namespace dawn::native { namespace op {
     }
 
     MaybeError Resample2d::CalculateShape() {
-        auto inputShape = mInputs[0]->Shape();
-        auto outputShape = inputShape;
+        const auto& inputShape = mInputs[0]->Shape();
+        std::vector<int32_t> outputShape = inputShape;
         // When the target sizes are specified, the options.scales argument is ignored as the
         // scaling factor values are derived from the target sizes of each spatial dimension of
         // input.
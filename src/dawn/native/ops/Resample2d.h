@@ -28,6 +28,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddResample2d(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Resample2d;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
 
         Resample2dOptions const* GetOptions() const {
@@ -36,6 +39,9 @@ namespace dawn::native { namespace op {
         std::vector<float> GetScales() const {
             return mScales;
         }
+        std::vector<int32_t> GetSizes() const {
+            return mSizes;
+        }
         std::vector<int32_t> GetAxes() const {
             return mAxes;
         }
@@ -19,7 +19,7 @@
 namespace dawn::native { namespace op {
 
     MaybeError Reshape::CalculateShape() {
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         uint32_t inputSize = 1, capacity = 1;
         for (auto dim : inputShape) {
             inputSize *= dim;
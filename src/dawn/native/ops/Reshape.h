@@ -35,6 +35,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddReshape(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Reshape;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
         std::vector<int32_t> GetNewShape() const {
             return mNewShape;
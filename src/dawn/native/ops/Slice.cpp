@@ -0,0 +1,104 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/ops/Slice.h"
+
+#include "dawn/native/Error.h"
+
+namespace dawn::native { namespace op {
+
+    Slice::Slice(GraphBuilderBase* builder,
+                 OperandBase* input,
+                 int32_t const* starts,
+                 uint32_t startsCount,
+                 int32_t const* sizes,
+                 uint32_t sizesCount,
+                 SliceOptions const* options)
+        : OperatorBase(builder, {input}) {
+        mStarts.assign(starts, starts + startsCount);
+        mSizes.assign(sizes, sizes + sizesCount);
+        if (options != nullptr && options->axes != nullptr) {
+            mAxes.assign(options->axes, options->axes + options->axesCount);
+        }
+    }
+
+    // The axes are all the dimensions in order when they are not present, a negative axis
+    // counts from the last dimension.
+    int32_t Slice::GetAxis(size_t index) const {
+        int32_t rank = mInputs[0]->Shape().size();
+        int32_t axis = mAxes.empty() ? index : mAxes[index];
+        return axis < 0 ? axis + rank : axis;
+    }
+
+    // A negative start counts from the end of the dimension.
+    int32_t Slice::GetStart(size_t index) const {
+        int32_t dimension = mInputs[0]->Shape()[GetAxis(index)];
+        return mStarts[index] < 0 ? mStarts[index] + dimension : mStarts[index];
+    }
+
+    std::vector<int32_t> Slice::GetOffsets() const {
+        std::vector<int32_t> offsets(mInputs[0]->Shape().size(), 0);
+        for (size_t i = 0; i < mStarts.size(); ++i) {
+            offsets[GetAxis(i)] = GetStart(i);
+        }
+        return offsets;
+    }
+
+    MaybeError Slice::CalculateShape() {
+        std::vector<int32_t> outputShape = mInputs[0]->Shape();
+        for (size_t i = 0; i < mStarts.size(); ++i) {
+            int32_t axis = GetAxis(i);
+            int32_t dimension = outputShape[axis];
+            int32_t start = GetStart(i);
+            // A size of -1 takes all the values after the start.
+            int32_t size = mSizes[i] == -1 ? dimension - start : mSizes[i];
+            if (start < 0 || start >= dimension || size <= 0 || size > dimension - start) {
+                return DAWN_VALIDATION_ERROR("The slice is out of the input tensor.");
+            }
+            outputShape[axis] = size;
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
+        return {};
+    }
+
+    MaybeError Slice::ValidateAndInferOutputInfo() {
+        MaybeError maybeError = OperatorBase::ValidateAndInferOutputInfo();
+        if (maybeError.IsError()) {
+            return maybeError;
+        }
+
+        int32_t rank = mInputs[0]->Shape().size();
+        if (mStarts.size() != mSizes.size()) {
+            return DAWN_VALIDATION_ERROR("Argument starts and sizes must have the same length.");
+        }
+        if (mAxes.empty() ? mStarts.size() != static_cast<size_t>(rank)
+                          : mAxes.size() != mStarts.size()) {
+            return DAWN_VALIDATION_ERROR("Argument starts must have a value for every axis.");
+        }
+        std::vector<bool> sliced(rank, false);
+        for (int32_t axis : mAxes) {
+            if (axis < -rank || axis >= rank) {
+                return DAWN_VALIDATION_ERROR("Argument axes is out of the input rank.");
+            }
+            int32_t dimension = axis < 0 ? axis + rank : axis;
+            if (sliced[dimension]) {
+                return DAWN_VALIDATION_ERROR("All the axes must be unique.");
+            }
+            sliced[dimension] = true;
+        }
+
+        return CalculateShape();
+    }
+
+}}  // namespace dawn::native::op
@@ -0,0 +1,69 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_OPS_SLICE_H_
+#define WEBNN_NATIVE_OPS_SLICE_H_
+
+#include <vector>
+
+#include "dawn/native/Graph.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native { namespace op {
+
+    class Slice final : public OperatorBase {
+      public:
+        Slice(GraphBuilderBase* builder,
+              OperandBase* input,
+              int32_t const* starts,
+              uint32_t startsCount,
+              int32_t const* sizes,
+              uint32_t sizesCount,
+              SliceOptions const* options);
+        ~Slice() override = default;
+
+        MaybeError AddToGraph(GraphBase* graph) const override {
+            return graph->AddSlice(this);
+        }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Slice;
+        }
+        MaybeError ValidateAndInferOutputInfo() override;
+
+        // The arguments as they were given, empty axes for all the dimensions.
+        const std::vector<int32_t>& GetStarts() const {
+            return mStarts;
+        }
+        const std::vector<int32_t>& GetSizes() const {
+            return mSizes;
+        }
+        const std::vector<int32_t>& GetAxes() const {
+            return mAxes;
+        }
+        // The start of the slice in every dimension of the input.
+        std::vector<int32_t> GetOffsets() const;
+
+      private:
+        int32_t GetAxis(size_t index) const;
+        int32_t GetStart(size_t index) const;
+        MaybeError CalculateShape();
+        std::vector<int32_t> mStarts;
+        std::vector<int32_t> mSizes;
+        std::vector<int32_t> mAxes;
+    };
+
+}}  // namespace dawn::native::op
+
+#endif  // WEBNN_NATIVE_OPS_SLICE_H_
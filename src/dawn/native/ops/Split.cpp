@@ -0,0 +1,96 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/ops/Split.h"
+
+#include <algorithm>
+
+#include "dawn/native/Error.h"
+
+namespace dawn::native { namespace op {
+
+    namespace {
+        // The number of outputs, at least one so that an invalid split can still be validated.
+        size_t GetOutputCount(uint32_t const* splits, uint32_t splitsCount) {
+            if (splitsCount == 1) {
+                return std::max<size_t>(splits[0], 1);
+            }
+            return std::max<size_t>(splitsCount, 1);
+        }
+    }  // anonymous namespace
+
+    Split::Split(GraphBuilderBase* builder,
+                 OperandBase* input,
+                 uint32_t const* splits,
+                 uint32_t splitsCount,
+                 SplitOptions const* options)
+        : OperatorBase(builder, {input}, GetOutputCount(splits, splitsCount)),
+          mSplits(splits, splits + splitsCount),
+          mAxis(options == nullptr ? 0 : options->axis) {
+    }
+
+    MaybeError Split::CalculateShape() {
+        std::vector<int32_t> outputShape = mInputs[0]->Shape();
+        size_t axis = mAxis < 0 ? mAxis + outputShape.size() : mAxis;
+        uint32_t dimension = outputShape[axis];
+        if (mSplits.size() == 1) {
+            if (dimension % mSplits[0] != 0) {
+                return DAWN_VALIDATION_ERROR(
+                    "The dimension along the axis must be divisible by the number of splits.");
+            }
+            outputShape[axis] = dimension / mSplits[0];
+            for (auto& output : mOutputs) {
+                output->SetShape(outputShape);
+            }
+            return {};
+        }
+        uint32_t sum = 0;
+        for (size_t i = 0; i < mSplits.size(); ++i) {
+            sum += mSplits[i];
+            outputShape[axis] = mSplits[i];
+            mOutputs[i]->SetShape(outputShape);
+        }
+        if (sum != dimension) {
+            return DAWN_VALIDATION_ERROR(
+                "The sum of the splits must be the dimension along the axis.");
+        }
+        return {};
+    }
+
+    MaybeError Split::ValidateAndInferOutputInfo() {
+        MaybeError maybeError = OperatorBase::ValidateAndInferOutputInfo();
+        if (maybeError.IsError()) {
+            return maybeError;
+        }
+
+        int32_t rank = mInputs[0]->Shape().size();
+        if (mAxis < -rank || mAxis >= rank) {
+            return DAWN_VALIDATION_ERROR("The axis is out of rank range.");
+        }
+        if (mSplits.empty()) {
+            return DAWN_VALIDATION_ERROR("Argument splits is empty.");
+        }
+        for (uint32_t split : mSplits) {
+            if (split == 0) {
+                return DAWN_VALIDATION_ERROR("Argument splits must be positive.");
+            }
+        }
+        for (auto& output : mOutputs) {
+            output->SetType(mInputs[0]->Type());
+        }
+
+        return CalculateShape();
+    }
+
+}}  // namespace dawn::native::op
@@ -0,0 +1,61 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_OPS_SPLIT_H_
+#define WEBNN_NATIVE_OPS_SPLIT_H_
+
+#include <vector>
+
+#include "dawn/native/Graph.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native { namespace op {
+
+    class Split final : public OperatorBase {
+      public:
+        Split(GraphBuilderBase* builder,
+              OperandBase* input,
+              uint32_t const* splits,
+              uint32_t splitsCount,
+              SplitOptions const* options);
+        ~Split() override = default;
+
+        MaybeError AddToGraph(GraphBase* graph) const override {
+            return graph->AddSplit(this);
+        }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Split;
+        }
+        MaybeError ValidateAndInferOutputInfo() override;
+
+        // A single value is the number of outputs of the same size, several values are the
+        // sizes of the outputs along the axis.
+        const std::vector<uint32_t>& GetSplits() const {
+            return mSplits;
+        }
+        // The axis as it was given, it may be negative.
+        int32_t GetAxis() const {
+            return mAxis;
+        }
+
+      private:
+        MaybeError CalculateShape();
+        std::vector<uint32_t> mSplits;
+        int32_t mAxis;
+    };
+
+}}  // namespace dawn::native::op
+
+#endif  // WEBNN_NATIVE_OPS_SPLIT_H_
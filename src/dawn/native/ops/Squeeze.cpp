@@ -0,0 +1,65 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/ops/Squeeze.h"
+
+#include "dawn/native/Error.h"
+
+namespace dawn::native { namespace op {
+
+    MaybeError Squeeze::CalculateShape() {
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        std::vector<bool> removed(inputShape.size(), mAxes.empty());
+        for (int32_t axis : mAxes) {
+            removed[axis] = true;
+        }
+        std::vector<int32_t> outputShape;
+        for (size_t i = 0; i < inputShape.size(); ++i) {
+            if (!removed[i] || inputShape[i] != 1) {
+                outputShape.push_back(inputShape[i]);
+            }
+        }
+        // The same as the reductions of all the dimensions.
+        if (outputShape.empty()) {
+            outputShape = {1};
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
+        return {};
+    }
+
+    MaybeError Squeeze::ValidateAndInferOutputInfo() {
+        MaybeError maybeError = OperatorBase::ValidateAndInferOutputInfo();
+        if (maybeError.IsError()) {
+            return maybeError;
+        }
+
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        std::vector<bool> removed(inputShape.size(), false);
+        for (int32_t axis : mAxes) {
+            if (axis < 0 || axis >= static_cast<int32_t>(inputShape.size())) {
+                return DAWN_VALIDATION_ERROR("Argument axes is out of the input rank.");
+            }
+            if (inputShape[axis] != 1) {
+                return DAWN_VALIDATION_ERROR("The squeezed dimensions must be of size 1.");
+            }
+            if (removed[axis]) {
+                return DAWN_VALIDATION_ERROR("All the axes must be unique.");
+            }
+            removed[axis] = true;
+        }
+
+        return CalculateShape();
+    }
+
+}}  // namespace dawn::native::op
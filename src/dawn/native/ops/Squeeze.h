@@ -0,0 +1,56 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_OPS_SQUEEZE_H_
+#define WEBNN_NATIVE_OPS_SQUEEZE_H_
+
+#include <vector>
+
+#include "dawn/native/Graph.h"
+#include "dawn/native/Operand.h"
+#include "dawn/native/Operator.h"
+
+namespace dawn::native { namespace op {
+
+    class Squeeze final : public OperatorBase {
+      public:
+        Squeeze(GraphBuilderBase* builder, OperandBase* input, SqueezeOptions const* options)
+            : OperatorBase(builder, {input}) {
+            if (options != nullptr && options->axes != nullptr) {
+                mAxes.assign(options->axes, options->axes + options->axesCount);
+            }
+        }
+        ~Squeeze() override = default;
+
+        MaybeError AddToGraph(GraphBase* graph) const override {
+            return graph->AddSqueeze(this);
+        }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Squeeze;
+        }
+        MaybeError ValidateAndInferOutputInfo() override;
+
+        // Empty to remove all the dimensions of size 1.
+        const std::vector<int32_t>& GetAxes() const {
+            return mAxes;
+        }
+
+      private:
+        MaybeError CalculateShape();
+        std::vector<int32_t> mAxes;
+    };
+
+}}  // namespace dawn::native::op
+
+#endif  // WEBNN_NATIVE_OPS_SQUEEZE_H_
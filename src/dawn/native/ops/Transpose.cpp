@@ -21,7 +21,7 @@
 namespace dawn::native { namespace op {
 
     MaybeError Transpose::CalculateShape() {
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         size_t rank = inputShape.size();
         std::vector<int32_t> outputShape(rank);
         for (size_t i = 0; i < rank; ++i) {
@@ -37,7 +37,7 @@ namespace dawn::native { namespace op {
             return maybeError;
         }
 
-        auto inputShape = mInputs[0]->Shape();
+        const auto& inputShape = mInputs[0]->Shape();
         // the number of values in the sequence must be the same as the rank of the input
         // tensor
         if (mPermutation.size() != inputShape.size()) {
@@ -41,6 +41,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddTranspose(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Transpose;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
 
         std::vector<int32_t> GetPermutation() const {
@@ -50,6 +50,9 @@ namespace dawn::native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddUnary(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Unary;
+        }
         MaybeError ValidateAndInferOutputInfo() override;
         UnaryOpType GetType() const {
             return mOpType;
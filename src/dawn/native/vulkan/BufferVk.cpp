@@ -329,6 +329,28 @@ namespace dawn::native::vulkan {
         return memory;
     }
 
+    void* Buffer::GetHostVisiblePointerImpl() {
+        // Only mappable buffers are allocated in persistently mapped, host visible memory.
+        uint8_t* memory = mMemoryAllocation.GetMappedPointer();
+        if (memory == nullptr) {
+            return nullptr;
+        }
+
+        // Like a mapping, make the buffer available to the host and wait for the GPU to be done
+        // with it. The mappable memory is host coherent, so the writes of either side need no
+        // flush or invalidation once the queue is idle.
+        Device* device = ToBackend(GetDevice());
+        CommandRecordingContext* recordingContext = device->GetPendingRecordingContext();
+        EnsureDataInitialized(recordingContext);
+        TransitionUsageNow(recordingContext, (GetUsage() & wgpu::BufferUsage::MapRead)
+                                                 ? wgpu::BufferUsage::MapRead
+                                                 : wgpu::BufferUsage::MapWrite);
+        if (device->ConsumedError(device->WaitForSubmittedCommands())) {
+            return nullptr;
+        }
+        return memory;
+    }
+
     void Buffer::DestroyImpl() {
         BufferBase::DestroyImpl();
 
@@ -20,6 +20,7 @@
 #include "dawn/native/Error.h"
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/VulkanBackend.h"
+#include "dawn/native/cpu/GraphBuilderCPU.h"
 #include "dawn/native/vulkan/AdapterVk.h"
 #include "dawn/native/vulkan/BackendVk.h"
 #include "dawn/native/vulkan/BindGroupLayoutVk.h"
@@ -167,6 +168,9 @@ namespace dawn::native::vulkan {
         const TextureViewDescriptor* descriptor) {
         return TextureView::Create(texture, descriptor);
     }
+    ResultOrError<Ref<GraphBuilderBase>> Device::CreateGraphBuilderImpl() {
+        return AcquireRef(cpu::GraphBuilder::Create(this));
+    }
     void Device::InitializeComputePipelineAsyncImpl(Ref<ComputePipelineBase> computePipeline,
                                                     WGPUCreateComputePipelineAsyncCallback callback,
                                                     void* userdata) {
@@ -300,6 +304,17 @@ namespace dawn::native::vulkan {
         return {};
     }
 
+    MaybeError Device::WaitForSubmittedCommands() {
+        DAWN_TRY(SubmitPendingCommands());
+        if (!mFencesInFlight.empty()) {
+            // The fences are signaled in order, so the last one completes every submission.
+            VkFence fence = mFencesInFlight.back().first;
+            DAWN_TRY(CheckVkSuccess(fn.WaitForFences(mVkDevice, 1, &*fence, true, UINT64_MAX),
+                                    "vkWaitForFences"));
+        }
+        return CheckPassedSerials();
+    }
+
     ResultOrError<VulkanDeviceKnobs> Device::CreateDevice(VkPhysicalDevice physicalDevice) {
         VulkanDeviceKnobs usedKnobs = {};
 
@@ -65,6 +65,8 @@ namespace dawn::native::vulkan {
 
         CommandRecordingContext* GetPendingRecordingContext();
         MaybeError SubmitPendingCommands();
+        // Submits the pending commands and waits for every submission to complete.
+        MaybeError WaitForSubmittedCommands();
 
         void EnqueueDeferredDeallocation(DescriptorSetAllocator* allocator);
 
@@ -135,6 +137,8 @@ namespace dawn::native::vulkan {
         ResultOrError<Ref<TextureViewBase>> CreateTextureViewImpl(
             TextureBase* texture,
             const TextureViewDescriptor* descriptor) override;
+        // WebNN graphs are computed on the CPU.
+        ResultOrError<Ref<GraphBuilderBase>> CreateGraphBuilderImpl() override;
         Ref<ComputePipelineBase> CreateUninitializedComputePipelineImpl(
             const ComputePipelineDescriptor* descriptor) override;
         Ref<RenderPipelineBase> CreateUninitializedRenderPipelineImpl(
@@ -0,0 +1,263 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <string>
+
+class ComputeAsyncTests : public WebnnTest {
+  protected:
+    // A computation queued with ComputeAsync(), with the buffers it reads and writes, which the
+    // named resources don't keep alive.
+    struct Request {
+        ComputeAsyncTests* test;
+        size_t index;
+        std::vector<float> input;
+        size_t outputCount;
+        wgpu::Buffer inputBuffer;
+        wgpu::Buffer outputBuffer;
+        wgpu::NamedResources inputs;
+        wgpu::NamedResources outputs;
+        WGPUComputeGraphStatus status;
+        std::string message;
+    };
+
+    static constexpr size_t kCount = 64;
+
+    void SetUp() override {
+        WebnnTest::SetUp();
+        mConstant = RandomData(kCount);
+        mGraph = Build({{"output", builder.Relu(builder.Add(Input("input", {kCount}),
+                                                           Constant({kCount}, mConstant)))}});
+        ASSERT_NE(mGraph.Get(), nullptr);
+    }
+
+    std::unique_ptr<Request> Queue(size_t index) {
+        return Queue(mGraph, index, RandomData(kCount), kCount);
+    }
+
+    // Queues the computation of |graph| from |input| into an output of |outputCount| floats.
+    std::unique_ptr<Request> Queue(const wgpu::Graph& graph,
+                                   size_t index,
+                                   std::vector<float> input,
+                                   size_t outputCount) {
+        auto request = std::make_unique<Request>();
+        request->test = this;
+        request->index = index;
+        request->input = std::move(input);
+        request->outputCount = outputCount;
+        size_t inputSize = request->input.size() * sizeof(float);
+        request->inputBuffer =
+            CreateBuffer(inputSize, wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc,
+                         request->input.data());
+        size_t outputSize = outputCount * sizeof(float);
+        request->outputBuffer = CreateBuffer(
+            outputSize, wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst, nullptr);
+        wgpu::BufferResourceView view = {};
+        request->inputs = graph.CreateNamedResources();
+        view.resource = request->inputBuffer;
+        view.size = inputSize;
+        request->inputs.Set("input", &view);
+        request->outputs = graph.CreateNamedResources();
+        view.resource = request->outputBuffer;
+        view.size = outputSize;
+        request->outputs.Set("output", &view);
+
+        graph.ComputeAsync(
+            request->inputs, request->outputs,
+            [](WGPUComputeGraphStatus status, char const* message, void* userdata) {
+                Request* request = static_cast<Request*>(userdata);
+                request->status = status;
+                request->message = message;
+                request->test->mCompleted.push_back(request->index);
+            },
+            request.get());
+        return request;
+    }
+
+    void WaitForCompletion(size_t count) {
+        while (mCompleted.size() < count) {
+            WaitABit();
+        }
+    }
+
+    void ExpectOutput(const Request& request) {
+        std::vector<float> expected(kCount);
+        for (size_t i = 0; i < kCount; ++i) {
+            expected[i] = std::max(request.input[i] + mConstant[i], 0.0f);
+        }
+        ExpectOutput(request, expected);
+    }
+
+    void ExpectOutput(const Request& request,
+                      const std::vector<float>& expected,
+                      float tolerance = 1e-5f) {
+        EXPECT_EQ(request.status, WGPUComputeGraphStatus_Success) << request.message;
+        size_t size = request.outputCount * sizeof(float);
+        MapAsyncAndWait(request.outputBuffer, wgpu::MapMode::Read, size);
+        const float* output =
+            static_cast<const float*>(request.outputBuffer.GetConstMappedRange(0, size));
+        ExpectNear(std::vector<float>(output, output + request.outputCount), expected, tolerance);
+        request.outputBuffer.Unmap();
+    }
+
+    // The [rows, 8] input multiplied by the [8, 4] |weights|, with a Relu.
+    static std::vector<float> GemmRelu(const std::vector<float>& input,
+                                       const std::vector<float>& weights) {
+        size_t rows = input.size() / 8;
+        std::vector<float> output(rows * 4);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                double sum = 0;
+                for (size_t k = 0; k < 8; ++k) {
+                    sum += static_cast<double>(input[i * 8 + k]) * weights[k * 4 + j];
+                }
+                output[i * 4 + j] = std::max(static_cast<float>(sum), 0.0f);
+            }
+        }
+        return output;
+    }
+
+    wgpu::Graph mGraph;
+    std::vector<float> mConstant;
+    // The indices of the requests whose callback was called, in call order.
+    std::vector<size_t> mCompleted;
+};
+
+// Test a single asynchronous computation.
+TEST_P(ComputeAsyncTests, Single) {
+    std::unique_ptr<Request> request = Queue(0);
+    WaitForCompletion(1);
+    ExpectOutput(*request);
+}
+
+// Test many computations queued at once, which must each compute their own inputs and complete
+// in order.
+TEST_P(ComputeAsyncTests, Many) {
+    std::vector<std::unique_ptr<Request>> requests;
+    for (size_t i = 0; i < 32; ++i) {
+        requests.push_back(Queue(i));
+    }
+    WaitForCompletion(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(mCompleted[i], i);
+        ExpectOutput(*requests[i]);
+    }
+}
+
+// Test computations queued while the previous ones are running, and mixed with synchronous
+// computations of the same graph.
+TEST_P(ComputeAsyncTests, Interleaved) {
+    std::vector<std::unique_ptr<Request>> requests;
+    for (size_t i = 0; i < 16; ++i) {
+        requests.push_back(Queue(i));
+        if (i % 4 == 3) {
+            std::vector<float> input = RandomData(kCount);
+            std::map<std::string, std::vector<uint8_t>> outputs;
+            outputs["output"].resize(kCount * sizeof(float));
+            Compute(mGraph, {{"input", ToBytes(input)}}, &outputs);
+            std::vector<float> expected(kCount);
+            for (size_t j = 0; j < kCount; ++j) {
+                expected[j] = std::max(input[j] + mConstant[j], 0.0f);
+            }
+            ExpectNear(FromBytes<float>(outputs["output"]), expected);
+        }
+    }
+    WaitForCompletion(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(mCompleted[i], i);
+        ExpectOutput(*requests[i]);
+    }
+}
+
+// Test the computations of a graph with a dynamic batch dimension, which are merged along it when
+// they are pending together, and must each compute their own rows and complete in order.
+TEST_P(ComputeAsyncTests, DynamicBatch) {
+    std::vector<float> weights = RandomData(8 * 4);
+    wgpu::Operand output =
+        builder.Relu(builder.Gemm(Input("input", {-1, 8}), Constant({8, 4}, weights)));
+    wgpu::Graph graph = Build({{"output", output}});
+    ASSERT_NE(graph.Get(), nullptr);
+    graph.SetProfilingEnabled(true);
+
+    std::vector<std::unique_ptr<Request>> requests;
+    for (size_t i = 0; i < 32; ++i) {
+        size_t rows = i % 5 + 1;
+        requests.push_back(Queue(graph, i, RandomData(rows * 8), rows * 4));
+    }
+    WaitForCompletion(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(mCompleted[i], i);
+        ExpectOutput(*requests[i], GemmRelu(requests[i]->input, weights), 1e-4f);
+    }
+    wgpu::OperatorProfile profile = {};
+    ASSERT_TRUE(graph.GetOperatorProfile(0, &profile));
+    EXPECT_LE(profile.computeCount, requests.size());
+}
+
+// Test that a computation with invalid inputs fails on its own among the computations it would
+// be merged with.
+TEST_P(ComputeAsyncTests, DynamicBatchError) {
+    std::vector<float> weights = RandomData(8 * 4);
+    wgpu::Operand output =
+        builder.Relu(builder.Gemm(Input("input", {-1, 8}), Constant({8, 4}, weights)));
+    wgpu::Graph graph = Build({{"output", output}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    std::vector<std::unique_ptr<Request>> requests;
+    for (size_t i = 0; i < 16; ++i) {
+        // The input of every fourth request isn't a whole number of rows.
+        size_t inputCount = i % 4 == 3 ? 12 : 2 * 8;
+        requests.push_back(Queue(graph, i, RandomData(inputCount), 2 * 4));
+    }
+    WaitForCompletion(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(mCompleted[i], i);
+        if (i % 4 == 3) {
+            EXPECT_EQ(requests[i]->status, WGPUComputeGraphStatus_Error);
+        } else {
+            ExpectOutput(*requests[i], GemmRelu(requests[i]->input, weights), 1e-4f);
+        }
+    }
+}
+
+// Test the computations of a graph whose output doesn't have the batch dimension of its input,
+// which can't be merged.
+TEST_P(ComputeAsyncTests, UnbatchedOutput) {
+    const int32_t axes[] = {0};
+    wgpu::ReduceOptions options = {};
+    options.axes = axes;
+    options.axesCount = 1;
+    wgpu::Graph graph = Build({{"output", builder.ReduceSum(Input("input", {-1, 4}), &options)}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    std::vector<std::unique_ptr<Request>> requests;
+    for (size_t i = 0; i < 16; ++i) {
+        // The sums have the size of a batch of four.
+        size_t rows = i % 2 == 0 ? 4 : 2;
+        requests.push_back(Queue(graph, i, RandomData(rows * 4), 4));
+    }
+    WaitForCompletion(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(mCompleted[i], i);
+        std::vector<float> expected(4, 0.0f);
+        for (size_t j = 0; j < requests[i]->input.size(); ++j) {
+            expected[j % 4] += requests[i]->input[j];
+        }
+        ExpectOutput(*requests[i], expected);
+    }
+}
+
+DAWN_INSTANTIATE_TEST(ComputeAsyncTests, NullBackend());
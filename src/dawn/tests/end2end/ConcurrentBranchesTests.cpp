@@ -0,0 +1,160 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+
+// The independent branches of a graph are computed concurrently, with their intermediate
+// tensors in memory that the other branches reuse once they are no longer read.
+class ConcurrentBranchesTests : public WebnnTest {};
+
+// Test element-wise branches reading the same input, which some of them could compute in place
+// of it, against values computed on the host.
+TEST_P(ConcurrentBranchesTests, Elementwise) {
+    const int32_t size = 4096;
+    std::vector<float> input = RandomData(size);
+    std::vector<float> bias = RandomData(size);
+    wgpu::Operand x = Input("input", {size});
+    wgpu::Operand b = Constant({size}, bias);
+    wgpu::Operand relu = builder.Relu(builder.Add(x, b));
+    wgpu::Operand sigmoid = builder.Sigmoid(builder.Mul(x, x));
+    wgpu::Operand difference = builder.Sub(builder.Max(x, b), x);
+    wgpu::Operand branches[] = {builder.Mul(relu, sigmoid), builder.Add(difference, x),
+                                builder.Min(builder.Relu(x), relu)};
+    wgpu::Operand output = builder.Concat(3, branches, 0);
+
+    std::vector<float> expected(3 * size);
+    for (int32_t i = 0; i < size; ++i) {
+        float r = std::max(input[i] + bias[i], 0.0f);
+        float s = 1.0f / (1.0f + std::exp(-input[i] * input[i]));
+        expected[i] = r * s;
+        expected[size + i] = std::max(input[i], bias[i]) - input[i] + input[i];
+        expected[2 * size + i] = std::min(std::max(input[i], 0.0f), r);
+    }
+
+    wgpu::Graph graph = Build({{"output", output}});
+    ASSERT_NE(graph.Get(), nullptr);
+    std::map<std::string, std::vector<uint8_t>> outputs;
+    // The branches are scheduled differently from one computation to the other.
+    for (int i = 0; i < 10; ++i) {
+        outputs["output"].assign(3 * size * sizeof(float), 0);
+        Compute(graph, {{"input", ToBytes(input)}}, &outputs);
+        ExpectNear(FromBytes<float>(outputs["output"]), expected);
+    }
+}
+
+// Test Inception-like towers of convolutions, whose results are concatenated, against each tower
+// computed in a graph of its own.
+TEST_P(ConcurrentBranchesTests, Towers) {
+    const int32_t channels = 8, size = 12;
+    std::vector<float> input = RandomData(channels * size * size);
+    const int32_t padding[] = {1, 1, 1, 1};
+    wgpu::Conv2dOptions padded = {};
+    padded.padding = padding;
+    padded.paddingCount = 4;
+    padded.activation = builder.ReluOperator();
+    wgpu::Conv2dOptions pointwise = {};
+    pointwise.activation = builder.ReluOperator();
+
+    // Each tower is a 1x1 convolution followed by a number of 3x3 ones.
+    wgpu::Operand x = Input("input", {1, channels, size, size});
+    std::vector<wgpu::Operand> towers;
+    std::vector<std::vector<float>> expected;
+    for (int32_t depth = 0; depth < 4; ++depth) {
+        std::vector<std::pair<std::vector<int32_t>, std::vector<float>>> filters;
+        filters.emplace_back(std::vector<int32_t>{4, channels, 1, 1}, RandomData(4 * channels));
+        for (int32_t i = 0; i < depth; ++i) {
+            filters.emplace_back(std::vector<int32_t>{4, 4, 3, 3}, RandomData(4 * 4 * 3 * 3));
+        }
+        auto makeTower = [&](const wgpu::Operand& towerInput) {
+            wgpu::Operand tower = towerInput;
+            for (size_t i = 0; i < filters.size(); ++i) {
+                tower = builder.Conv2d(tower, Constant(filters[i].first, filters[i].second),
+                                       i == 0 ? &pointwise : &padded);
+            }
+            return tower;
+        };
+        towers.push_back(makeTower(x));
+        expected.push_back(Compute(makeTower(Input("input", {1, channels, size, size})),
+                                   4 * size * size, {{"input", input}}));
+    }
+    wgpu::Operand output = builder.Concat(towers.size(), towers.data(), 1);
+    wgpu::Graph graph = Build({{"output", output}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    std::map<std::string, std::vector<uint8_t>> outputs;
+    for (int i = 0; i < 10; ++i) {
+        outputs["output"].assign(towers.size() * 4 * size * size * sizeof(float), 0);
+        Compute(graph, {{"input", ToBytes(input)}}, &outputs);
+        std::vector<float> result = FromBytes<float>(outputs["output"]);
+        for (size_t t = 0; t < towers.size(); ++t) {
+            std::vector<float> tower(result.begin() + t * 4 * size * size,
+                                     result.begin() + (t + 1) * 4 * size * size);
+            ExpectNear(tower, expected[t], 1e-4f);
+        }
+    }
+}
+
+// Test the heads of an attention-like block, each multiplying the input by its own weights,
+// against values computed on the host.
+TEST_P(ConcurrentBranchesTests, Heads) {
+    const int32_t rows = 16, width = 32, headWidth = 8, heads = 4;
+    std::vector<float> input = RandomData(rows * width);
+    wgpu::Operand x = Input("input", {rows, width});
+    std::vector<wgpu::Operand> outputs;
+    std::vector<float> expected;
+    for (int32_t h = 0; h < heads; ++h) {
+        std::vector<float> query = RandomData(width * headWidth);
+        std::vector<float> key = RandomData(width * headWidth);
+        wgpu::GemmOptions options = {};
+        options.bTranspose = true;
+        wgpu::Operand scores =
+            builder.Gemm(builder.Matmul(x, Constant({width, headWidth}, query)),
+                         builder.Matmul(x, Constant({width, headWidth}, key)), &options);
+        outputs.push_back(builder.Softmax(scores));
+
+        std::vector<double> q(rows * headWidth, 0), k(rows * headWidth, 0);
+        for (int32_t r = 0; r < rows; ++r) {
+            for (int32_t c = 0; c < headWidth; ++c) {
+                for (int32_t i = 0; i < width; ++i) {
+                    q[r * headWidth + c] += input[r * width + i] * query[i * headWidth + c];
+                    k[r * headWidth + c] += input[r * width + i] * key[i * headWidth + c];
+                }
+            }
+        }
+        for (int32_t r = 0; r < rows; ++r) {
+            std::vector<double> row(rows, 0);
+            for (int32_t c = 0; c < rows; ++c) {
+                for (int32_t i = 0; i < headWidth; ++i) {
+                    row[c] += q[r * headWidth + i] * k[c * headWidth + i];
+                }
+            }
+            double maximum = *std::max_element(row.begin(), row.end());
+            double sum = 0;
+            for (double& value : row) {
+                value = std::exp(value - maximum);
+                sum += value;
+            }
+            for (double value : row) {
+                expected.push_back(static_cast<float>(value / sum));
+            }
+        }
+    }
+    wgpu::Operand output = builder.Concat(outputs.size(), outputs.data(), 0);
+    ExpectNear(Compute(output, expected.size(), {{"input", input}}), expected, 1e-4f);
+}
+
+DAWN_INSTANTIATE_TEST(ConcurrentBranchesTests, NullBackend());
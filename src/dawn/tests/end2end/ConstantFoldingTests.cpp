@@ -0,0 +1,80 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+
+class ConstantFoldingTests : public WebnnTest {};
+
+// Test that the operators of constants are folded to their result.
+TEST_P(ConstantFoldingTests, BinaryAndUnary) {
+    std::vector<float> a = RandomData(12);
+    std::vector<float> b = RandomData(4);
+    std::vector<float> input = RandomData(12);
+    std::vector<float> expected(12);
+    for (size_t i = 0; i < 12; ++i) {
+        expected[i] = input[i] + std::max(a[i] * b[i % 4], 0.0f);
+    }
+
+    wgpu::Operand folded = builder.Relu(builder.Mul(Constant({3, 4}, a), Constant({4}, b)));
+    wgpu::Operand output = builder.Add(Input("input", {3, 4}), folded);
+    ExpectNear(Compute(output, 12, {{"input", input}}), expected);
+}
+
+// Test the folding of Transpose, Concat and Reshape, whose result is read by two operators.
+TEST_P(ConstantFoldingTests, TransposeConcatReshape) {
+    std::vector<float> a = RandomData(6);
+    std::vector<float> b = RandomData(6);
+    std::vector<float> input = RandomData(12);
+    // The [2, 3] transpose of the [3, 2] |a|, concatenated with |b| and reshaped to [12].
+    std::vector<float> folded;
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            folded.push_back(a[j * 2 + i]);
+        }
+    }
+    folded.insert(folded.end(), b.begin(), b.end());
+    std::vector<float> expected(12);
+    for (size_t i = 0; i < 12; ++i) {
+        expected[i] = (input[i] - folded[i]) * folded[i];
+    }
+
+    wgpu::TransposeOptions options = {};
+    int32_t permutation[] = {1, 0};
+    options.permutation = permutation;
+    options.permutationCount = 2;
+    wgpu::Operand concatInputs[] = {builder.Transpose(Constant({3, 2}, a), &options),
+                                    Constant({2, 3}, b)};
+    int32_t newShape[] = {12};
+    wgpu::Operand constant = builder.Reshape(builder.Concat(2, concatInputs, 0), newShape, 1);
+    wgpu::Operand output = builder.Mul(builder.Sub(Input("input", {12}), constant), constant);
+    ExpectNear(Compute(output, 12, {{"input", input}}), expected);
+}
+
+// Test an output computed from constants only, which isn't folded.
+TEST_P(ConstantFoldingTests, ConstantOutput) {
+    wgpu::Graph graph =
+        Build({{"output", builder.Relu(Input("input", {4}))},
+               {"constant", builder.Sub(Constant({4}, {1, 2, 3, 4}), Constant({1}, {1}))}});
+    ASSERT_NE(graph.Get(), nullptr);
+    std::map<std::string, std::vector<uint8_t>> outputs;
+    outputs["output"].resize(4 * sizeof(float));
+    outputs["constant"].resize(4 * sizeof(float));
+    Compute(graph, {{"input", ToBytes(std::vector<float>{-1, 1, -2, 2})}}, &outputs);
+    ExpectNear(FromBytes<float>(outputs["output"]), {0, 1, 0, 2});
+    ExpectNear(FromBytes<float>(outputs["constant"]), {0, 1, 2, 3});
+}
+
+DAWN_INSTANTIATE_TEST(ConstantFoldingTests, NullBackend());
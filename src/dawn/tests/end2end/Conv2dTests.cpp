@@ -0,0 +1,189 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+
+class Conv2dTests : public WebnnTest {
+  protected:
+    // Reorders the [O, I, H, W] |filter| to |layout|.
+    static std::vector<float> ReorderFilter(const std::vector<float>& filter,
+                                            const std::vector<int32_t>& shape,
+                                            wgpu::FilterOperandLayout layout,
+                                            std::vector<int32_t>* reorderedShape) {
+        // The position of the O, I, H and W dimensions in |layout|.
+        int32_t order[4];
+        switch (layout) {
+            case wgpu::FilterOperandLayout::Hwio:
+                order[0] = 3, order[1] = 2, order[2] = 0, order[3] = 1;
+                break;
+            case wgpu::FilterOperandLayout::Ohwi:
+                order[0] = 0, order[1] = 3, order[2] = 1, order[3] = 2;
+                break;
+            case wgpu::FilterOperandLayout::Ihwo:
+                order[0] = 3, order[1] = 0, order[2] = 1, order[3] = 2;
+                break;
+            default:
+                order[0] = 0, order[1] = 1, order[2] = 2, order[3] = 3;
+                break;
+        }
+        reorderedShape->resize(4);
+        for (int32_t d = 0; d < 4; ++d) {
+            (*reorderedShape)[order[d]] = shape[d];
+        }
+        std::vector<float> reordered(filter.size());
+        size_t i = 0;
+        for (int32_t o = 0; o < shape[0]; ++o) {
+            for (int32_t c = 0; c < shape[1]; ++c) {
+                for (int32_t h = 0; h < shape[2]; ++h) {
+                    for (int32_t w = 0; w < shape[3]; ++w, ++i) {
+                        int32_t index[4];
+                        index[order[0]] = o, index[order[1]] = c, index[order[2]] = h,
+                        index[order[3]] = w;
+                        size_t offset = 0;
+                        for (int32_t d = 0; d < 4; ++d) {
+                            offset = offset * (*reorderedShape)[d] + index[d];
+                        }
+                        reordered[offset] = filter[i];
+                    }
+                }
+            }
+        }
+        return reordered;
+    }
+};
+
+// Test a convolution against values computed by hand.
+TEST_P(Conv2dTests, Simple) {
+    wgpu::Operand input = Input("input", {1, 1, 3, 3});
+    wgpu::Operand filter = Constant({1, 1, 2, 2}, {1, 0, 0, -1});
+    std::vector<float> output =
+        Compute(builder.Conv2d(input, filter), 4, {{"input", {1, 2, 3, 4, 5, 6, 7, 8, 9}}});
+    ExpectNear(output, {-4, -4, -4, -4});
+}
+
+// Test that every filter layout computes the same convolution as the default one.
+TEST_P(Conv2dTests, FilterLayouts) {
+    const std::vector<int32_t> inputShape = {1, 6, 7, 7};
+    const std::vector<int32_t> filterShape = {10, 6, 3, 3};
+    std::vector<float> input = RandomData(ElementCount(inputShape));
+    std::vector<float> filter = RandomData(ElementCount(filterShape));
+    const size_t outputCount = 10 * 5 * 5;
+
+    std::vector<float> expected =
+        Compute(builder.Conv2d(Input("input", inputShape), Constant(filterShape, filter)),
+                outputCount, {{"input", input}});
+    for (wgpu::FilterOperandLayout layout :
+         {wgpu::FilterOperandLayout::Hwio, wgpu::FilterOperandLayout::Ohwi,
+          wgpu::FilterOperandLayout::Ihwo}) {
+        std::vector<int32_t> shape;
+        std::vector<float> reordered = ReorderFilter(filter, filterShape, layout, &shape);
+        wgpu::Conv2dOptions options = {};
+        options.filterLayout = layout;
+        wgpu::Operand output =
+            builder.Conv2d(Input("input", inputShape), Constant(shape, reordered), &options);
+        ExpectNear(Compute(output, outputCount, {{"input", input}}), expected, 1e-4f);
+    }
+}
+
+// Test that the automatic padding matches the equivalent explicit padding.
+TEST_P(Conv2dTests, AutoPad) {
+    const std::vector<int32_t> inputShape = {1, 4, 8, 8};
+    const std::vector<int32_t> filterShape = {4, 4, 4, 4};
+    std::vector<float> input = RandomData(ElementCount(inputShape));
+    std::vector<float> filter = RandomData(ElementCount(filterShape));
+    const int32_t strides[] = {2, 2};
+
+    for (wgpu::AutoPad autoPad : {wgpu::AutoPad::SameUpper, wgpu::AutoPad::SameLower}) {
+        // The output is 4x4 and the total padding 2 on each axis, split evenly.
+        const int32_t padding[] = {1, 1, 1, 1};
+        wgpu::Conv2dOptions explicitOptions = {};
+        explicitOptions.padding = padding;
+        explicitOptions.paddingCount = 4;
+        explicitOptions.strides = strides;
+        explicitOptions.stridesCount = 2;
+        std::vector<float> expected = Compute(
+            builder.Conv2d(Input("input", inputShape), Constant(filterShape, filter),
+                           &explicitOptions),
+            4 * 4 * 4, {{"input", input}});
+
+        wgpu::Conv2dOptions options = {};
+        options.autoPad = autoPad;
+        options.strides = strides;
+        options.stridesCount = 2;
+        wgpu::Operand output =
+            builder.Conv2d(Input("input", inputShape), Constant(filterShape, filter), &options);
+        ExpectNear(Compute(output, 4 * 4 * 4, {{"input", input}}), expected, 1e-4f);
+    }
+}
+
+// Test the bias and the fused activation.
+TEST_P(Conv2dTests, BiasAndActivation) {
+    const std::vector<int32_t> inputShape = {1, 3, 5, 5};
+    const std::vector<int32_t> filterShape = {8, 3, 3, 3};
+    std::vector<float> input = RandomData(ElementCount(inputShape));
+    std::vector<float> filter = RandomData(ElementCount(filterShape));
+    std::vector<float> bias = RandomData(8);
+    const size_t outputCount = 8 * 3 * 3;
+
+    std::vector<float> expected =
+        Compute(builder.Conv2d(Input("input", inputShape), Constant(filterShape, filter)),
+                outputCount, {{"input", input}});
+    for (size_t i = 0; i < outputCount; ++i) {
+        expected[i] = std::max(expected[i] + bias[i / 9], 0.0f);
+    }
+
+    wgpu::Conv2dOptions options = {};
+    options.bias = Constant({8}, bias);
+    options.activation = builder.ReluOperator();
+    wgpu::Operand output =
+        builder.Conv2d(Input("input", inputShape), Constant(filterShape, filter), &options);
+    ExpectNear(Compute(output, outputCount, {{"input", input}}), expected, 1e-4f);
+}
+
+// Test that the NHWC layout computes the same convolution as NCHW.
+TEST_P(Conv2dTests, Nhwc) {
+    const int32_t channels = 5, size = 6, outputChannels = 16;
+    std::vector<float> input = RandomData(channels * size * size);
+    std::vector<float> filter = RandomData(outputChannels * channels * 3 * 3);
+    const int32_t padding[] = {1, 1, 1, 1};
+    wgpu::Conv2dOptions options = {};
+    options.padding = padding;
+    options.paddingCount = 4;
+
+    std::vector<float> expected = Compute(
+        builder.Conv2d(Input("input", {1, channels, size, size}),
+                       Constant({outputChannels, channels, 3, 3}, filter), &options),
+        outputChannels * size * size, {{"input", input}});
+
+    std::vector<float> nhwcInput(input.size());
+    for (int32_t c = 0; c < channels; ++c) {
+        for (int32_t i = 0; i < size * size; ++i) {
+            nhwcInput[i * channels + c] = input[c * size * size + i];
+        }
+    }
+    options.inputLayout = wgpu::InputOperandLayout::Nhwc;
+    std::vector<float> output = Compute(
+        builder.Conv2d(Input("input", {1, size, size, channels}),
+                       Constant({outputChannels, channels, 3, 3}, filter), &options),
+        outputChannels * size * size, {{"input", nhwcInput}});
+    for (int32_t c = 0; c < outputChannels; ++c) {
+        for (int32_t i = 0; i < size * size; ++i) {
+            ASSERT_NEAR(output[i * outputChannels + c], expected[c * size * size + i], 1e-4f);
+        }
+    }
+}
+
+DAWN_INSTANTIATE_TEST(Conv2dTests, NullBackend());
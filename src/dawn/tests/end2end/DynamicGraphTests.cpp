@@ -0,0 +1,184 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cstring>
+
+class DynamicGraphTests : public WebnnTest {
+  protected:
+    // Computes the |outputCount| floats of the output of |graph| from |input|, whose dimensions
+    // are set to |dimensions| unless it is empty.
+    std::vector<float> ComputeDynamic(const wgpu::Graph& graph,
+                                      const std::vector<float>& input,
+                                      const std::vector<int32_t>& dimensions,
+                                      size_t outputCount) {
+        size_t inputSize = input.size() * sizeof(float);
+        wgpu::NamedResources namedInputs = graph.CreateNamedResources();
+        wgpu::BufferResourceView inputView = {};
+        inputView.resource =
+            CreateBuffer(inputSize, wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc,
+                         input.data());
+        inputView.size = inputSize;
+        namedInputs.Set("input", &inputView);
+        if (!dimensions.empty()) {
+            namedInputs.SetDimensions("input", dimensions.data(), dimensions.size());
+        }
+
+        size_t outputSize = outputCount * sizeof(float);
+        wgpu::NamedResources namedOutputs = graph.CreateNamedResources();
+        wgpu::BufferResourceView outputView = {};
+        outputView.resource = CreateBuffer(
+            outputSize, wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst, nullptr);
+        outputView.size = outputSize;
+        namedOutputs.Set("output", &outputView);
+
+        graph.Compute(namedInputs, namedOutputs);
+
+        std::vector<float> output(outputCount);
+        MapAsyncAndWait(outputView.resource, wgpu::MapMode::Read, BufferSize(outputSize));
+        memcpy(output.data(), outputView.resource.GetConstMappedRange(0, BufferSize(outputSize)),
+               outputSize);
+        outputView.resource.Unmap();
+        return output;
+    }
+
+    // The [rows, 8] input multiplied by the [8, 4] |weights|, with a Relu.
+    static std::vector<float> GemmRelu(const std::vector<float>& input,
+                                       const std::vector<float>& weights) {
+        size_t rows = input.size() / 8;
+        std::vector<float> output(rows * 4);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                double sum = 0;
+                for (size_t k = 0; k < 8; ++k) {
+                    sum += static_cast<double>(input[i * 8 + k]) * weights[k * 4 + j];
+                }
+                output[i * 4 + j] = std::max(static_cast<float>(sum), 0.0f);
+            }
+        }
+        return output;
+    }
+};
+
+// Test a batch dimension inferred from the size of the input buffer, against values computed on
+// the host, with more batch sizes than the graph keeps variants for.
+TEST_P(DynamicGraphTests, InferredBatch) {
+    std::vector<float> weights = RandomData(8 * 4);
+    wgpu::Operand output =
+        builder.Relu(builder.Gemm(Input("input", {-1, 8}), Constant({8, 4}, weights)));
+    wgpu::Graph graph = Build({{"output", output}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    for (int32_t batches : {1, 3, 1, 7, 2, 4, 5, 6, 8, 9, 10, 11, 3, 1}) {
+        std::vector<float> input = RandomData(batches * 8);
+        ExpectNear(ComputeDynamic(graph, input, {}, batches * 4), GemmRelu(input, weights),
+                   1e-4f);
+    }
+}
+
+// Test dimensions set with the input, which are required when several of them are dynamic,
+// against the graph built with static dimensions.
+TEST_P(DynamicGraphTests, SetDimensions) {
+    const std::vector<int32_t> filterShape = {6, 3, 3, 3};
+    std::vector<float> filter = RandomData(ElementCount(filterShape));
+    std::vector<float> bias = RandomData(6);
+    const int32_t padding[] = {1, 0, 0, 1};
+    wgpu::Conv2dOptions options = {};
+    options.padding = padding;
+    options.paddingCount = 4;
+    options.activation = builder.ReluOperator();
+    options.bias = Constant({6}, bias);
+    auto conv = [&](const wgpu::Operand& input) {
+        return builder.AveragePool2d(
+            builder.Conv2d(input, Constant(filterShape, filter), &options));
+    };
+    wgpu::Graph graph = Build({{"output", conv(Input("input", {1, 3, -1, -1}))}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    for (auto [height, width] : {std::make_pair(8, 8), std::make_pair(5, 11),
+                                 std::make_pair(3, 3), std::make_pair(8, 8)}) {
+        std::vector<float> input = RandomData(3 * height * width);
+        // The global average pooling leaves one value per channel.
+        std::vector<float> expected =
+            Compute(conv(Input("input", {1, 3, height, width})), 6, {{"input", input}});
+        ExpectNear(ComputeDynamic(graph, input, {1, 3, height, width}, 6), expected, 1e-4f);
+    }
+}
+
+// Test the dynamic dimensions inferred through the operators, in the outputs of a Transpose, a
+// Reshape and a Concat.
+TEST_P(DynamicGraphTests, InferredShapes) {
+    std::vector<float> constant = RandomData(2 * 3);
+    wgpu::Operand input = Input("input", {-1, 2, 3});
+    const int32_t permutation[] = {0, 2, 1};
+    wgpu::TransposeOptions transposeOptions = {};
+    transposeOptions.permutation = permutation;
+    transposeOptions.permutationCount = 3;
+    wgpu::Operand transposed = builder.Transpose(input, &transposeOptions);
+    const int32_t newShape[] = {-1, 6};
+    wgpu::Operand operands[] = {builder.Reshape(transposed, newShape, 2),
+                                Constant({1, 6}, constant)};
+    wgpu::Graph graph = Build({{"output", builder.Concat(2, operands, 0)}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    for (int32_t batches : {4, 1}) {
+        std::vector<float> data = RandomData(batches * 6);
+        std::vector<float> expected;
+        for (int32_t n = 0; n < batches; ++n) {
+            for (int32_t j = 0; j < 3; ++j) {
+                for (int32_t i = 0; i < 2; ++i) {
+                    expected.push_back(data[n * 6 + i * 3 + j]);
+                }
+            }
+        }
+        expected.insert(expected.end(), constant.begin(), constant.end());
+        ExpectNear(ComputeDynamic(graph, data, {}, (batches + 1) * 6), expected);
+    }
+}
+
+// Test that the profile of the variants is the profile of the graph.
+TEST_P(DynamicGraphTests, Profiling) {
+    wgpu::Operand output =
+        builder.Relu(builder.Gemm(Input("input", {-1, 8}), Constant({8, 4}, RandomData(32))));
+    wgpu::Graph graph = Build({{"output", output}});
+    ASSERT_NE(graph.Get(), nullptr);
+    graph.SetProfilingEnabled(true);
+    ComputeDynamic(graph, RandomData(2 * 8), {}, 2 * 4);
+    ComputeDynamic(graph, RandomData(5 * 8), {}, 5 * 4);
+    ASSERT_GT(graph.GetOperatorProfileCount(), 0u);
+    wgpu::OperatorProfile profile = {};
+    ASSERT_TRUE(graph.GetOperatorProfile(0, &profile));
+    EXPECT_EQ(profile.computeCount, 2u);
+}
+
+// Test the computations whose input dimensions can't be inferred or don't fit the graph.
+TEST_P(DynamicGraphTests, InvalidDimensions) {
+    std::vector<float> weights = RandomData(8 * 4);
+    wgpu::Operand output =
+        builder.Relu(builder.Matmul(Input("input", {-1, -1, 8}), Constant({8, 4}, weights)));
+    wgpu::Graph graph = Build({{"output", output}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    // Two dimensions are dynamic, so they must be set.
+    ASSERT_DEVICE_ERROR(ComputeDynamic(graph, RandomData(6 * 8), {}, 6 * 4));
+    // The dimensions don't fit the constant.
+    ASSERT_DEVICE_ERROR(ComputeDynamic(graph, RandomData(6 * 5), {2, 3, 5}, 6 * 4));
+    // The graph still computes the dimensions that fit.
+    std::vector<float> input = RandomData(6 * 8);
+    ExpectNear(ComputeDynamic(graph, input, {2, 3, 8}, 6 * 4), GemmRelu(input, weights), 1e-4f);
+}
+
+DAWN_INSTANTIATE_TEST(DynamicGraphTests, NullBackend());
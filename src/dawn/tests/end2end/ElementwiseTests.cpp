@@ -0,0 +1,167 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+class ElementwiseTests : public WebnnTest {
+  protected:
+    using BinaryFunction = std::function<float(float, float)>;
+    using UnaryFunction = std::function<float(float)>;
+
+    // Computes |function| on |aShape| and |bShape| with the numpy broadcasting rules.
+    static std::vector<float> BroadcastReference(const std::vector<int32_t>& aShape,
+                                                 const std::vector<float>& a,
+                                                 const std::vector<int32_t>& bShape,
+                                                 const std::vector<float>& b,
+                                                 const BinaryFunction& function) {
+        size_t rank = std::max(aShape.size(), bShape.size());
+        std::vector<int32_t> aDims(rank - aShape.size(), 1);
+        aDims.insert(aDims.end(), aShape.begin(), aShape.end());
+        std::vector<int32_t> bDims(rank - bShape.size(), 1);
+        bDims.insert(bDims.end(), bShape.begin(), bShape.end());
+        std::vector<int32_t> outputDims(rank);
+        for (size_t i = 0; i < rank; ++i) {
+            outputDims[i] = std::max(aDims[i], bDims[i]);
+        }
+
+        std::vector<float> output(ElementCount(outputDims));
+        std::vector<int32_t> index(rank, 0);
+        for (float& value : output) {
+            size_t aOffset = 0;
+            size_t bOffset = 0;
+            for (size_t i = 0; i < rank; ++i) {
+                aOffset = aOffset * aDims[i] + (aDims[i] == 1 ? 0 : index[i]);
+                bOffset = bOffset * bDims[i] + (bDims[i] == 1 ? 0 : index[i]);
+            }
+            value = function(a[aOffset], b[bOffset]);
+            for (size_t i = rank; i-- > 0;) {
+                if (++index[i] < outputDims[i]) {
+                    break;
+                }
+                index[i] = 0;
+            }
+        }
+        return output;
+    }
+
+    void TestBinary(wgpu::Operand (wgpu::GraphBuilder::*build)(wgpu::Operand const&,
+                                                                wgpu::Operand const&) const,
+                    const BinaryFunction& function,
+                    const std::vector<int32_t>& aShape,
+                    const std::vector<int32_t>& bShape,
+                    float min = -1.0f) {
+        std::vector<float> a = RandomData(ElementCount(aShape), min);
+        std::vector<float> b = RandomData(ElementCount(bShape), min);
+        std::vector<float> expected = BroadcastReference(aShape, a, bShape, b, function);
+        wgpu::Operand output = (builder.*build)(Input("a", aShape), Input("b", bShape));
+        ExpectNear(Compute(output, expected.size(), {{"a", a}, {"b", b}}), expected, 1e-4f);
+    }
+
+    void TestUnary(const wgpu::Operand& output,
+                   const std::vector<float>& input,
+                   const UnaryFunction& function,
+                   float tolerance = 1e-5f) {
+        std::vector<float> expected(input.size());
+        std::transform(input.begin(), input.end(), expected.begin(), function);
+        ExpectNear(Compute(output, expected.size(), {{"input", input}}), expected, tolerance);
+    }
+};
+
+// The operand sizes that aren't a multiple of the vector width, to cover the tails of the
+// vectorized loops.
+static const std::vector<int32_t> kOddShape = {3, 37};
+static const std::vector<int32_t> kLargeShape = {4, 1021};
+
+// Test the binary operators on operands of the same shape.
+TEST_P(ElementwiseTests, SameShape) {
+    for (const std::vector<int32_t>& shape : {kOddShape, kLargeShape}) {
+        TestBinary(&wgpu::GraphBuilder::Add, std::plus<float>(), shape, shape);
+        TestBinary(&wgpu::GraphBuilder::Sub, std::minus<float>(), shape, shape);
+        TestBinary(&wgpu::GraphBuilder::Mul, std::multiplies<float>(), shape, shape);
+        TestBinary(
+            &wgpu::GraphBuilder::Max, [](float a, float b) { return std::max(a, b); }, shape,
+            shape);
+        TestBinary(
+            &wgpu::GraphBuilder::Min, [](float a, float b) { return std::min(a, b); }, shape,
+            shape);
+    }
+}
+
+// Test the division and the power, away from 0.
+TEST_P(ElementwiseTests, DivAndPow) {
+    TestBinary(&wgpu::GraphBuilder::Div, std::divides<float>(), kOddShape, kOddShape, 0.5f);
+    TestBinary(
+        &wgpu::GraphBuilder::Pow, [](float a, float b) { return std::pow(a, b); }, kOddShape,
+        kOddShape, 0.5f);
+}
+
+// Test the binary operators that broadcast one of their operands.
+TEST_P(ElementwiseTests, Broadcast) {
+    TestBinary(&wgpu::GraphBuilder::Add, std::plus<float>(), {2, 3, 37}, {37});
+    TestBinary(&wgpu::GraphBuilder::Mul, std::multiplies<float>(), {5}, {4, 5});
+    TestBinary(&wgpu::GraphBuilder::Sub, std::minus<float>(), {2, 1, 9}, {3, 1});
+    TestBinary(&wgpu::GraphBuilder::Add, std::plus<float>(), {3, 1}, {1, 17});
+    TestBinary(&wgpu::GraphBuilder::Mul, std::multiplies<float>(), {2, 3, 4}, {1});
+}
+
+// Test the unary operators.
+TEST_P(ElementwiseTests, Unary) {
+    std::vector<float> input = RandomData(ElementCount(kLargeShape), -6.0f, 6.0f);
+
+    TestUnary(builder.Relu(Input("input", kLargeShape)), input,
+              [](float x) { return std::max(x, 0.0f); });
+
+    TestUnary(
+        builder.Sigmoid(Input("input", kLargeShape)), input,
+        [](float x) { return 1.0f / (1.0f + std::exp(-x)); }, 1e-4f);
+
+    wgpu::LeakyReluOptions leakyReluOptions = {};
+    leakyReluOptions.alpha = 0.2f;
+    TestUnary(builder.LeakyRelu(Input("input", kLargeShape), &leakyReluOptions), input,
+              [](float x) { return x < 0 ? 0.2f * x : x; });
+
+    wgpu::ClampOptions clampOptions = {};
+    clampOptions.minValue = -1.5f;
+    clampOptions.maxValue = 2.5f;
+    TestUnary(builder.Clamp(Input("input", kLargeShape), &clampOptions), input,
+              [](float x) { return std::min(std::max(x, -1.5f), 2.5f); });
+}
+
+// Test that the softmax is computed over the rows.
+TEST_P(ElementwiseTests, Softmax) {
+    const std::vector<int32_t> shape = {3, 37};
+    std::vector<float> input = RandomData(ElementCount(shape), -10.0f, 10.0f);
+    std::vector<float> expected(input.size());
+    for (int32_t row = 0; row < shape[0]; ++row) {
+        const float* x = &input[row * shape[1]];
+        float* y = &expected[row * shape[1]];
+        float max = *std::max_element(x, x + shape[1]);
+        float sum = 0;
+        for (int32_t i = 0; i < shape[1]; ++i) {
+            y[i] = std::exp(x[i] - max);
+            sum += y[i];
+        }
+        for (int32_t i = 0; i < shape[1]; ++i) {
+            y[i] /= sum;
+        }
+    }
+    ExpectNear(Compute(builder.Softmax(Input("input", shape)), input.size(), {{"input", input}}),
+               expected, 1e-4f);
+}
+
+DAWN_INSTANTIATE_TEST(ElementwiseTests, NullBackend());
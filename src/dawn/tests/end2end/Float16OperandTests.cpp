@@ -0,0 +1,140 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+
+#include "dawn/common/Math.h"
+
+class Float16OperandTests : public WebnnTest {
+  protected:
+    static std::vector<uint16_t> ToHalf(const std::vector<float>& data) {
+        std::vector<uint16_t> halves(data.size());
+        std::transform(data.begin(), data.end(), halves.begin(), Float32ToFloat16);
+        return halves;
+    }
+
+    static std::vector<float> ToFloat(const std::vector<uint16_t>& data) {
+        std::vector<float> floats(data.size());
+        std::transform(data.begin(), data.end(), floats.begin(), Float16ToFloat32);
+        return floats;
+    }
+
+    // The values of |data| rounded to float16.
+    static std::vector<float> Round(const std::vector<float>& data) {
+        return ToFloat(ToHalf(data));
+    }
+
+    wgpu::Operand HalfConstant(const std::vector<int32_t>& shape, const std::vector<float>& data) {
+        std::vector<uint16_t> halves = ToHalf(data);
+        return Constant(shape, wgpu::OperandType::Float16, halves.data(),
+                        halves.size() * sizeof(uint16_t));
+    }
+
+    // Computes the float16 |output| of |count| elements from the float16 values of |input|.
+    std::vector<float> ComputeHalf(const wgpu::Operand& output,
+                                   size_t count,
+                                   const std::vector<float>& input) {
+        wgpu::Graph graph = Build({{"output", output}});
+        EXPECT_NE(graph.Get(), nullptr);
+        if (graph.Get() == nullptr) {
+            return {};
+        }
+        std::map<std::string, std::vector<uint8_t>> outputs;
+        outputs["output"].resize(count * sizeof(uint16_t));
+        Compute(graph, {{"input", ToBytes(ToHalf(input))}}, &outputs);
+        return ToFloat(FromBytes<uint16_t>(outputs["output"]));
+    }
+};
+
+// Test element-wise operators on float16 inputs, constants and outputs, which are converted
+// at the boundaries of the graph.
+TEST_P(Float16OperandTests, Elementwise) {
+    std::vector<float> input = Round(RandomData(4 * 33));
+    std::vector<float> constant = Round(RandomData(33));
+    std::vector<float> expected(input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        expected[i] = std::max(input[i] * constant[i % 33] - 0.25f, 0.0f);
+    }
+
+    wgpu::Operand output = builder.Relu(builder.Sub(
+        builder.Mul(Input("input", {4, 33}, wgpu::OperandType::Float16),
+                    HalfConstant({33}, constant)),
+        HalfConstant({1}, {0.25f})));
+    ExpectNear(ComputeHalf(output, expected.size(), input), Round(expected), 1e-3f);
+}
+
+// Test Gemm with float16 weights, which are packed as float16 and widened by the micro
+// kernels.
+TEST_P(Float16OperandTests, Gemm) {
+    const int32_t m = 17, k = 40, n = 35;
+    std::vector<float> a = Round(RandomData(m * k));
+    std::vector<float> b = Round(RandomData(k * n));
+    std::vector<float> expected(m * n);
+    for (int32_t i = 0; i < m; ++i) {
+        for (int32_t j = 0; j < n; ++j) {
+            double sum = 0;
+            for (int32_t l = 0; l < k; ++l) {
+                sum += a[i * k + l] * b[l * n + j];
+            }
+            expected[i * n + j] = static_cast<float>(sum);
+        }
+    }
+
+    wgpu::Operand output = builder.Gemm(Input("input", {m, k}, wgpu::OperandType::Float16),
+                                        HalfConstant({k, n}, b));
+    ExpectNear(ComputeHalf(output, expected.size(), a), expected, 2e-3f);
+}
+
+// Test the NHWC Conv2d with a float16 filter, which is computed by the algorithms packing
+// their weights as float16.
+TEST_P(Float16OperandTests, Conv2d) {
+    const int32_t channels = 6, size = 9, outputChannels = 16;
+    std::vector<float> input = Round(RandomData(size * size * channels));
+    std::vector<float> filter = Round(RandomData(outputChannels * channels * 3 * 3));
+    std::vector<float> expected(size * size * outputChannels);
+    for (int32_t y = 0; y < size; ++y) {
+        for (int32_t x = 0; x < size; ++x) {
+            for (int32_t oc = 0; oc < outputChannels; ++oc) {
+                double sum = 0;
+                for (int32_t ky = 0; ky < 3; ++ky) {
+                    for (int32_t kx = 0; kx < 3; ++kx) {
+                        int32_t iy = y + ky - 1, ix = x + kx - 1;
+                        if (iy < 0 || iy >= size || ix < 0 || ix >= size) {
+                            continue;
+                        }
+                        for (int32_t ic = 0; ic < channels; ++ic) {
+                            sum += input[(iy * size + ix) * channels + ic] *
+                                   filter[((oc * channels + ic) * 3 + ky) * 3 + kx];
+                        }
+                    }
+                }
+                expected[(y * size + x) * outputChannels + oc] = static_cast<float>(sum);
+            }
+        }
+    }
+
+    const int32_t padding[] = {1, 1, 1, 1};
+    wgpu::Conv2dOptions options = {};
+    options.padding = padding;
+    options.paddingCount = 4;
+    options.inputLayout = wgpu::InputOperandLayout::Nhwc;
+    wgpu::Operand output =
+        builder.Conv2d(Input("input", {1, size, size, channels}, wgpu::OperandType::Float16),
+                       HalfConstant({outputChannels, channels, 3, 3}, filter), &options);
+    ExpectNear(ComputeHalf(output, expected.size(), input), expected, 2e-3f);
+}
+
+DAWN_INSTANTIATE_TEST(Float16OperandTests, NullBackend());
@@ -0,0 +1,102 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+
+class FusionTests : public WebnnTest {
+  protected:
+    // Expects |output| to be computed the same whether the operators producing it are fused or
+    // not. They are not fused when their |intermediate| result is also an output of the graph.
+    void ExpectSameAsUnfused(const wgpu::Operand& output,
+                             size_t outputCount,
+                             const wgpu::Operand& intermediate,
+                             size_t intermediateCount,
+                             const std::vector<float>& input) {
+        std::map<std::string, std::vector<uint8_t>> inputs = {{"input", ToBytes(input)}};
+
+        std::map<std::string, std::vector<uint8_t>> unfused;
+        unfused["output"].resize(outputCount * sizeof(float));
+        unfused["intermediate"].resize(intermediateCount * sizeof(float));
+        wgpu::Graph unfusedGraph = Build({{"output", output}, {"intermediate", intermediate}});
+        ASSERT_NE(unfusedGraph.Get(), nullptr);
+        Compute(unfusedGraph, inputs, &unfused);
+
+        std::map<std::string, std::vector<uint8_t>> fused;
+        fused["output"].resize(outputCount * sizeof(float));
+        wgpu::Graph fusedGraph = Build({{"output", output}});
+        ASSERT_NE(fusedGraph.Get(), nullptr);
+        Compute(fusedGraph, inputs, &fused);
+
+        ExpectNear(FromBytes<float>(fused["output"]), FromBytes<float>(unfused["output"]),
+                   1e-4f);
+    }
+};
+
+// Test Conv2d followed by the Add of a per-channel bias and Relu.
+TEST_P(FusionTests, Conv2dAddRelu) {
+    std::vector<float> input = RandomData(3 * 8 * 8);
+    wgpu::Operand conv =
+        builder.Conv2d(Input("input", {1, 3, 8, 8}), Constant({4, 3, 3, 3}, RandomData(108)));
+    wgpu::Operand output = builder.Relu(builder.Add(conv, Constant({1, 4, 1, 1}, RandomData(4))));
+    ExpectSameAsUnfused(output, 4 * 6 * 6, conv, 4 * 6 * 6, input);
+}
+
+// Test Conv2d followed by BatchNorm, which is folded into the filter and the bias.
+TEST_P(FusionTests, Conv2dBatchNorm) {
+    std::vector<float> input = RandomData(3 * 8 * 8);
+    wgpu::Conv2dOptions convOptions = {};
+    convOptions.bias = Constant({4}, RandomData(4));
+    wgpu::Operand conv = builder.Conv2d(Input("input", {1, 3, 8, 8}),
+                                        Constant({4, 3, 3, 3}, RandomData(108)), &convOptions);
+    wgpu::BatchNormOptions options = {};
+    options.scale = Constant({4}, RandomData(4));
+    options.bias = Constant({4}, RandomData(4));
+    options.epsilon = 1e-3f;
+    wgpu::Operand output = builder.BatchNorm(conv, Constant({4}, RandomData(4)),
+                                             Constant({4}, RandomData(4, 0.5f, 2.0f)), &options);
+    ExpectSameAsUnfused(output, 4 * 6 * 6, conv, 4 * 6 * 6, input);
+}
+
+// Test Gemm followed by Clamp.
+TEST_P(FusionTests, GemmClamp) {
+    std::vector<float> input = RandomData(5 * 7);
+    wgpu::Operand gemm = builder.Gemm(Input("input", {5, 7}), Constant({7, 3}, RandomData(21)));
+    wgpu::ClampOptions options = {};
+    options.minValue = -0.5f;
+    options.maxValue = 0.5f;
+    ExpectSameAsUnfused(builder.Clamp(gemm, &options), 15, gemm, 15, input);
+}
+
+// Test an element-wise Binary followed by LeakyRelu.
+TEST_P(FusionTests, BinaryLeakyRelu) {
+    std::vector<float> input = RandomData(4 * 37);
+    wgpu::Operand sub = builder.Sub(Input("input", {4, 37}), Constant({37}, RandomData(37)));
+    wgpu::LeakyReluOptions options = {};
+    options.alpha = 0.3f;
+    ExpectSameAsUnfused(builder.LeakyRelu(sub, &options), 4 * 37, sub, 4 * 37, input);
+}
+
+// Test consecutive Clamp and Relu.
+TEST_P(FusionTests, ClampRelu) {
+    std::vector<float> input = RandomData(64, -3.0f, 3.0f);
+    wgpu::ClampOptions options = {};
+    options.minValue = -1.0f;
+    options.maxValue = 2.0f;
+    wgpu::Operand clamp = builder.Clamp(Input("input", {64}), &options);
+    ExpectSameAsUnfused(builder.Relu(clamp), 64, clamp, 64, input);
+}
+
+DAWN_INSTANTIATE_TEST(FusionTests, NullBackend());
@@ -0,0 +1,169 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+class GemmTests : public WebnnTest {
+  protected:
+    // The [m, n] product of |a| and |b|, stored as [m, k] or [k, m] and [k, n] or [n, k].
+    static std::vector<float> Multiply(const float* a,
+                                       const float* b,
+                                       int32_t m,
+                                       int32_t k,
+                                       int32_t n,
+                                       bool aTranspose = false,
+                                       bool bTranspose = false) {
+        std::vector<float> output(m * n, 0.0f);
+        for (int32_t i = 0; i < m; ++i) {
+            for (int32_t j = 0; j < n; ++j) {
+                double sum = 0;
+                for (int32_t l = 0; l < k; ++l) {
+                    float x = aTranspose ? a[l * m + i] : a[i * k + l];
+                    float y = bTranspose ? b[j * k + l] : b[l * n + j];
+                    sum += static_cast<double>(x) * y;
+                }
+                output[i * n + j] = static_cast<float>(sum);
+            }
+        }
+        return output;
+    }
+
+    void TestGemm(int32_t m,
+                  int32_t k,
+                  int32_t n,
+                  bool aTranspose,
+                  bool bTranspose,
+                  bool constantB) {
+        std::vector<int32_t> aShape = aTranspose ? std::vector<int32_t>{k, m} : std::vector{m, k};
+        std::vector<int32_t> bShape = bTranspose ? std::vector<int32_t>{n, k} : std::vector{k, n};
+        std::vector<float> a = RandomData(m * k);
+        std::vector<float> b = RandomData(k * n);
+        std::vector<float> expected =
+            Multiply(a.data(), b.data(), m, k, n, aTranspose, bTranspose);
+
+        wgpu::GemmOptions options = {};
+        options.aTranspose = aTranspose;
+        options.bTranspose = bTranspose;
+        std::map<std::string, std::vector<float>> inputs = {{"a", a}};
+        wgpu::Operand bOperand;
+        if (constantB) {
+            bOperand = Constant(bShape, b);
+        } else {
+            bOperand = Input("b", bShape);
+            inputs["b"] = b;
+        }
+        wgpu::Operand output = builder.Gemm(Input("a", aShape), bOperand, &options);
+        ExpectNear(Compute(output, m * n, inputs), expected, 1e-4f);
+    }
+};
+
+// Test the Gemm of small matrices.
+TEST_P(GemmTests, Small) {
+    wgpu::Operand a = Input("a", {2, 3});
+    wgpu::Operand b = Constant({3, 2}, {1, 2, 3, 4, 5, 6});
+    ExpectNear(Compute(builder.Gemm(a, b), 4, {{"a", {1, 0, -1, 2, 1, 0}}}), {-4, -4, 5, 8});
+}
+
+// Test the Gemm of matrices that aren't a multiple of the blocks of the packed kernels, with a
+// constant b, which is packed once, and with a b that is packed at every computation.
+TEST_P(GemmTests, Blocked) {
+    for (bool constantB : {true, false}) {
+        TestGemm(67, 131, 45, false, false, constantB);
+        TestGemm(1, 300, 257, false, false, constantB);
+        TestGemm(129, 7, 1, false, false, constantB);
+    }
+}
+
+// Test the transposed operands.
+TEST_P(GemmTests, Transpose) {
+    for (bool constantB : {true, false}) {
+        TestGemm(33, 65, 17, true, false, constantB);
+        TestGemm(33, 65, 17, false, true, constantB);
+        TestGemm(33, 65, 17, true, true, constantB);
+    }
+}
+
+// Test alpha, beta and the broadcasting of c.
+TEST_P(GemmTests, AlphaBetaAndC) {
+    const int32_t m = 19, k = 23, n = 29;
+    std::vector<float> a = RandomData(m * k);
+    std::vector<float> b = RandomData(k * n);
+    std::vector<float> c = RandomData(n);
+    std::vector<float> expected = Multiply(a.data(), b.data(), m, k, n);
+    for (int32_t i = 0; i < m; ++i) {
+        for (int32_t j = 0; j < n; ++j) {
+            expected[i * n + j] = 0.5f * expected[i * n + j] + 2.0f * c[j];
+        }
+    }
+
+    wgpu::GemmOptions options = {};
+    options.alpha = 0.5f;
+    options.beta = 2.0f;
+    options.c = Constant({n}, c);
+    wgpu::Operand output = builder.Gemm(Input("a", {m, k}), Constant({k, n}, b), &options);
+    ExpectNear(Compute(output, m * n, {{"a", a}}), expected, 1e-4f);
+}
+
+// Test the MatMul of batches, with a b that is broadcast to all the matrices of a.
+TEST_P(GemmTests, BatchedMatMul) {
+    const int32_t m = 13, k = 37, n = 21;
+    std::vector<float> a = RandomData(2 * 3 * m * k);
+    std::vector<float> b = RandomData(3 * k * n);
+    std::vector<float> expected;
+    for (int32_t batch = 0; batch < 6; ++batch) {
+        std::vector<float> product =
+            Multiply(&a[batch * m * k], &b[(batch % 3) * k * n], m, k, n);
+        expected.insert(expected.end(), product.begin(), product.end());
+    }
+
+    for (bool constantB : {true, false}) {
+        std::map<std::string, std::vector<float>> inputs = {{"a", a}};
+        wgpu::Operand bOperand;
+        if (constantB) {
+            bOperand = Constant({3, k, n}, b);
+        } else {
+            bOperand = Input("b", {3, k, n});
+            inputs["b"] = b;
+        }
+        wgpu::Operand output = builder.Matmul(Input("a", {2, 3, m, k}), bOperand);
+        ExpectNear(Compute(output, expected.size(), inputs), expected, 1e-4f);
+    }
+}
+
+// Test the MatMul of vectors, which are rows when they are a and columns when they are b.
+TEST_P(GemmTests, VectorMatMul) {
+    const int32_t k = 11, n = 5;
+    std::vector<float> vector = RandomData(k);
+    std::vector<float> matrix = RandomData(k * n);
+
+    std::vector<float> expected = Multiply(vector.data(), matrix.data(), 1, k, n);
+    wgpu::Operand output = builder.Matmul(Input("a", {k}), Constant({k, n}, matrix));
+    ExpectNear(Compute(output, n, {{"a", vector}}), expected, 1e-4f);
+
+    std::vector<float> transposed(n * k);
+    for (int32_t i = 0; i < k; ++i) {
+        for (int32_t j = 0; j < n; ++j) {
+            transposed[j * k + i] = matrix[i * n + j];
+        }
+    }
+    expected = Multiply(transposed.data(), vector.data(), n, k, 1);
+    output = builder.Matmul(Input("a", {n, k}), Constant({k}, vector));
+    ExpectNear(Compute(output, n, {{"a", transposed}}), expected, 1e-4f);
+
+    expected = Multiply(vector.data(), vector.data(), 1, k, 1);
+    output = builder.Matmul(Input("a", {k}), Input("b", {k}));
+    ExpectNear(Compute(output, 1, {{"a", vector}, {"b", vector}}), expected, 1e-4f);
+}
+
+DAWN_INSTANTIATE_TEST(GemmTests, NullBackend());
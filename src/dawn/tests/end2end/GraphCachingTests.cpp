@@ -0,0 +1,143 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <string>
+#include <unordered_map>
+
+#include "dawn/platform/DawnPlatform.h"
+
+namespace {
+
+    // An in-memory persistent cache that counts the loads that hit.
+    class GraphCache : public dawn::platform::CachingInterface {
+      public:
+        void StoreData(const WGPUDevice device,
+                       const void* key,
+                       size_t keySize,
+                       const void* value,
+                       size_t valueSize) override {
+            const std::string keyString(static_cast<const char*>(key), keySize);
+            const uint8_t* bytes = static_cast<const uint8_t*>(value);
+            EXPECT_TRUE(
+                mEntries.insert({keyString, std::vector<uint8_t>(bytes, bytes + valueSize)})
+                    .second);
+        }
+
+        size_t LoadData(const WGPUDevice device,
+                        const void* key,
+                        size_t keySize,
+                        void* value,
+                        size_t valueSize) override {
+            auto entry = mEntries.find(std::string(static_cast<const char*>(key), keySize));
+            if (entry == mEntries.end()) {
+                return 0;
+            }
+            if (valueSize >= entry->second.size()) {
+                memcpy(value, entry->second.data(), entry->second.size());
+                mHitCount++;
+            }
+            return entry->second.size();
+        }
+
+        std::unordered_map<std::string, std::vector<uint8_t>> mEntries;
+        size_t mHitCount = 0;
+    };
+
+    class GraphCachePlatform : public dawn::platform::Platform {
+      public:
+        explicit GraphCachePlatform(dawn::platform::CachingInterface* cache) : mCache(cache) {
+        }
+
+        dawn::platform::CachingInterface* GetCachingInterface(const void* fingerprint,
+                                                              size_t fingerprintSize) override {
+            return mCache;
+        }
+
+      private:
+        dawn::platform::CachingInterface* mCache;
+    };
+
+}  // anonymous namespace
+
+class GraphCachingTests : public WebnnTest {
+  protected:
+    std::unique_ptr<dawn::platform::Platform> CreateTestPlatform() override {
+        return std::make_unique<GraphCachePlatform>(&mCache);
+    }
+
+    void SetUp() override {
+        WebnnTest::SetUp();
+        mInput = RandomData(3 * 8 * 8);
+        mFilter = RandomData(4 * 3 * 3 * 3);
+        mWeights = RandomData(4 * 6 * 6 * 10);
+    }
+
+    // Computes a network whose Conv2d and Gemm pack their constant weights, with |filter| as
+    // the weights of the Conv2d, in a new builder.
+    std::vector<float> ComputeNetwork(const std::vector<float>& filter) {
+        builder = device.CreateGraphBuilder();
+        wgpu::Operand conv =
+            builder.Conv2d(Input("input", {1, 3, 8, 8}), Constant({4, 3, 3, 3}, filter));
+        const int32_t newShape[] = {1, 4 * 6 * 6};
+        wgpu::Operand output = builder.Gemm(builder.Reshape(builder.Relu(conv), newShape, 2),
+                                            Constant({4 * 6 * 6, 10}, mWeights));
+        return Compute(output, 10, {{"input", mInput}});
+    }
+
+    GraphCache mCache;
+    std::vector<float> mInput;
+    std::vector<float> mFilter;
+    std::vector<float> mWeights;
+};
+
+// Test that the prepared weights of a graph are stored once and restored when the same graph
+// is built again.
+TEST_P(GraphCachingTests, SameGraph) {
+    std::vector<float> expected = ComputeNetwork(mFilter);
+    EXPECT_EQ(mCache.mEntries.size(), 1u);
+    EXPECT_EQ(mCache.mHitCount, 0u);
+
+    ExpectNear(ComputeNetwork(mFilter), expected);
+    EXPECT_EQ(mCache.mEntries.size(), 1u);
+    EXPECT_EQ(mCache.mHitCount, 1u);
+}
+
+// Test that graphs that only differ by the data of their constants don't share an entry.
+TEST_P(GraphCachingTests, DifferentConstants) {
+    ComputeNetwork(mFilter);
+    std::vector<float> filter = mFilter;
+    filter[0] += 1.0f;
+    std::vector<float> expected = ComputeNetwork(filter);
+    EXPECT_EQ(mCache.mEntries.size(), 2u);
+    EXPECT_EQ(mCache.mHitCount, 0u);
+
+    ExpectNear(ComputeNetwork(filter), expected);
+    EXPECT_EQ(mCache.mHitCount, 1u);
+}
+
+// Test that an entry that doesn't match the kernels is ignored and the weights are prepared
+// again.
+TEST_P(GraphCachingTests, MismatchedEntry) {
+    std::vector<float> expected = ComputeNetwork(mFilter);
+    ASSERT_EQ(mCache.mEntries.size(), 1u);
+    std::vector<uint8_t>& entry = mCache.mEntries.begin()->second;
+    entry.resize(entry.size() / 2);
+
+    ExpectNear(ComputeNetwork(mFilter), expected);
+    EXPECT_EQ(mCache.mHitCount, 1u);
+}
+
+DAWN_INSTANTIATE_TEST(GraphCachingTests, NullBackend());
@@ -0,0 +1,85 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+
+class GraphComputeTests : public WebnnTest {};
+
+// Test computing a graph of a single operator.
+TEST_P(GraphComputeTests, Add) {
+    wgpu::Operand a = Input("a", {2, 3});
+    wgpu::Operand b = Input("b", {2, 3});
+    std::vector<float> output =
+        Compute(builder.Add(a, b), 6,
+                {{"a", {1, 2, 3, 4, 5, 6}}, {"b", {10, 20, 30, 40, 50, 60}}});
+    ExpectNear(output, {11, 22, 33, 44, 55, 66});
+}
+
+// Test computing a chain of operators with a constant.
+TEST_P(GraphComputeTests, Chain) {
+    wgpu::Operand input = Input("input", {4});
+    wgpu::Operand constant = Constant({4}, {1, -2, 3, -4});
+    wgpu::Operand output = builder.Relu(builder.Mul(input, constant));
+    ExpectNear(Compute(output, 4, {{"input", {1, 1, -1, -1}}}), {1, 0, 0, 4});
+}
+
+// Test that the elements of a large operand, which are split between the threads, are all
+// computed.
+TEST_P(GraphComputeTests, LargeOperand) {
+    const int32_t size = 1 << 18;
+    std::vector<float> a = RandomData(size);
+    std::vector<float> b = RandomData(size);
+    std::vector<float> expected(size);
+    for (int32_t i = 0; i < size; ++i) {
+        expected[i] = std::max(a[i] - b[i], 0.0f);
+    }
+    wgpu::Operand output = builder.Relu(builder.Sub(Input("a", {size}), Input("b", {size})));
+    ExpectNear(Compute(output, size, {{"a", a}, {"b", b}}), expected);
+}
+
+// Test computing a graph of several outputs.
+TEST_P(GraphComputeTests, MultipleOutputs) {
+    wgpu::Operand a = Input("a", {3});
+    wgpu::Operand b = Input("b", {3});
+    wgpu::Graph graph = Build({{"sum", builder.Add(a, b)}, {"max", builder.Max(a, b)}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    std::map<std::string, std::vector<uint8_t>> outputs;
+    outputs["sum"].resize(3 * sizeof(float));
+    outputs["max"].resize(3 * sizeof(float));
+    std::map<std::string, std::vector<uint8_t>> inputs;
+    inputs["a"] = ToBytes(std::vector<float>{1, 5, -3});
+    inputs["b"] = ToBytes(std::vector<float>{4, 2, -6});
+    Compute(graph, inputs, &outputs);
+    ExpectNear(FromBytes<float>(outputs["sum"]), {5, 7, -9});
+    ExpectNear(FromBytes<float>(outputs["max"]), {4, 5, -3});
+}
+
+// Test that a graph is computed again with new inputs.
+TEST_P(GraphComputeTests, ComputeTwice) {
+    wgpu::Operand input = Input("input", {2});
+    wgpu::Graph graph = Build({{"output", builder.Mul(input, input)}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    for (float value : {3.0f, -5.0f}) {
+        std::map<std::string, std::vector<uint8_t>> outputs;
+        outputs["output"].resize(2 * sizeof(float));
+        Compute(graph, {{"input", ToBytes(std::vector<float>{value, 1})}}, &outputs);
+        ExpectNear(FromBytes<float>(outputs["output"]), {value * value, 1});
+    }
+}
+
+DAWN_INSTANTIATE_TEST(GraphComputeTests, NullBackend());
@@ -0,0 +1,194 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+
+class GruTests : public WebnnTest {
+  protected:
+    static constexpr int32_t kSteps = 4;
+    static constexpr int32_t kBatchSize = 3;
+    static constexpr int32_t kInputSize = 5;
+    static constexpr int32_t kHiddenSize = 6;
+
+    static float Sigmoid(float x) {
+        return 1.0f / (1.0f + std::exp(-x));
+    }
+
+    // The product of the [kHiddenSize, size] rows of |weight| starting at row |gate| with |x|.
+    static std::vector<float> Project(const float* weight,
+                                      size_t gate,
+                                      const float* x,
+                                      size_t size) {
+        std::vector<float> result(kHiddenSize);
+        for (size_t i = 0; i < kHiddenSize; ++i) {
+            double sum = 0;
+            for (size_t j = 0; j < size; ++j) {
+                sum += weight[(gate * kHiddenSize + i) * size + j] * x[j];
+            }
+            result[i] = static_cast<float>(sum);
+        }
+        return result;
+    }
+
+    // Computes the GRU with |options| on the host and compares it to the graph, with the last
+    // hidden state and the sequence of hidden states when |options| returns it.
+    void TestGru(wgpu::GruOptions options, bool hasBiases, bool hasInitialHiddenState) {
+        int32_t directions = options.direction == wgpu::RecurrentNetworkDirection::Both ? 2 : 1;
+        int32_t gateSize = 3 * kHiddenSize;
+        std::vector<float> input = RandomData(kSteps * kBatchSize * kInputSize);
+        std::vector<float> weight = RandomData(directions * gateSize * kInputSize);
+        std::vector<float> recurrentWeight = RandomData(directions * gateSize * kHiddenSize);
+        std::vector<float> bias = RandomData(directions * gateSize);
+        std::vector<float> recurrentBias = RandomData(directions * gateSize);
+        std::vector<float> initialHiddenState = RandomData(directions * kBatchSize * kHiddenSize);
+        if (!hasBiases) {
+            std::fill(bias.begin(), bias.end(), 0.0f);
+            std::fill(recurrentBias.begin(), recurrentBias.end(), 0.0f);
+        }
+        if (!hasInitialHiddenState) {
+            std::fill(initialHiddenState.begin(), initialHiddenState.end(), 0.0f);
+        }
+
+        // The index of the gates in the weights.
+        bool zrn = options.layout == wgpu::RecurrentNetworkWeightLayout::Zrn;
+        size_t zGate = zrn ? 0 : 1, rGate = zrn ? 1 : 0, nGate = 2;
+        size_t stateSize = kBatchSize * kHiddenSize;
+        std::vector<float> expected(directions * stateSize);
+        std::vector<float> expectedSequence(kSteps * directions * stateSize);
+        for (int32_t d = 0; d < directions; ++d) {
+            bool backward =
+                d == 1 || options.direction == wgpu::RecurrentNetworkDirection::Backward;
+            const float* w = &weight[d * gateSize * kInputSize];
+            const float* r = &recurrentWeight[d * gateSize * kHiddenSize];
+            const float* b = &bias[d * gateSize];
+            const float* rb = &recurrentBias[d * gateSize];
+            std::vector<float> hidden(initialHiddenState.begin() + d * stateSize,
+                                      initialHiddenState.begin() + (d + 1) * stateSize);
+            for (int32_t step = 0; step < kSteps; ++step) {
+                int32_t t = backward ? kSteps - step - 1 : step;
+                std::vector<float> next(stateSize);
+                for (int32_t n = 0; n < kBatchSize; ++n) {
+                    const float* x = &input[(t * kBatchSize + n) * kInputSize];
+                    const float* h = &hidden[n * kHiddenSize];
+                    std::vector<float> xz = Project(w, zGate, x, kInputSize);
+                    std::vector<float> xr = Project(w, rGate, x, kInputSize);
+                    std::vector<float> xn = Project(w, nGate, x, kInputSize);
+                    std::vector<float> hz = Project(r, zGate, h, kHiddenSize);
+                    std::vector<float> hr = Project(r, rGate, h, kHiddenSize);
+                    std::vector<float> z(kHiddenSize), reset(kHiddenSize);
+                    for (int32_t i = 0; i < kHiddenSize; ++i) {
+                        z[i] = Sigmoid(xz[i] + b[zGate * kHiddenSize + i] + hz[i] +
+                                       rb[zGate * kHiddenSize + i]);
+                        reset[i] = Sigmoid(xr[i] + b[rGate * kHiddenSize + i] + hr[i] +
+                                           rb[rGate * kHiddenSize + i]);
+                    }
+                    std::vector<float> hn;
+                    if (options.resetAfter) {
+                        hn = Project(r, nGate, h, kHiddenSize);
+                        for (int32_t i = 0; i < kHiddenSize; ++i) {
+                            hn[i] = reset[i] * (hn[i] + rb[nGate * kHiddenSize + i]);
+                        }
+                    } else {
+                        std::vector<float> resetHidden(kHiddenSize);
+                        for (int32_t i = 0; i < kHiddenSize; ++i) {
+                            resetHidden[i] = reset[i] * h[i];
+                        }
+                        hn = Project(r, nGate, resetHidden.data(), kHiddenSize);
+                        for (int32_t i = 0; i < kHiddenSize; ++i) {
+                            hn[i] += rb[nGate * kHiddenSize + i];
+                        }
+                    }
+                    for (int32_t i = 0; i < kHiddenSize; ++i) {
+                        float newGate = std::tanh(xn[i] + b[nGate * kHiddenSize + i] + hn[i]);
+                        next[n * kHiddenSize + i] = (1 - z[i]) * newGate + z[i] * h[i];
+                    }
+                }
+                hidden = next;
+                std::copy(hidden.begin(), hidden.end(),
+                          expectedSequence.begin() + (step * directions + d) * stateSize);
+            }
+            std::copy(hidden.begin(), hidden.end(), expected.begin() + d * stateSize);
+        }
+
+        if (hasBiases) {
+            options.bias = Constant({directions, gateSize}, bias);
+            options.recurrentBias = Constant({directions, gateSize}, recurrentBias);
+        }
+        if (hasInitialHiddenState) {
+            options.initialHiddenState =
+                Constant({directions, kBatchSize, kHiddenSize}, initialHiddenState);
+        }
+        wgpu::OperandArray outputs = builder.Gru(
+            Input("input", {kSteps, kBatchSize, kInputSize}),
+            Constant({directions, gateSize, kInputSize}, weight),
+            Constant({directions, gateSize, kHiddenSize}, recurrentWeight), kSteps, kHiddenSize,
+            &options);
+        ASSERT_EQ(outputs.Size(), options.returnSequence ? 2u : 1u);
+        std::map<std::string, wgpu::Operand> namedOutputs = {{"output", outputs.GetOperand(0)}};
+        std::map<std::string, std::vector<uint8_t>> results;
+        results["output"].resize(expected.size() * sizeof(float));
+        if (options.returnSequence) {
+            namedOutputs["sequence"] = outputs.GetOperand(1);
+            results["sequence"].resize(expectedSequence.size() * sizeof(float));
+        }
+        wgpu::Graph graph = Build(namedOutputs);
+        ASSERT_NE(graph.Get(), nullptr);
+        Compute(graph, {{"input", ToBytes(input)}}, &results);
+        ExpectNear(FromBytes<float>(results["output"]), expected, 1e-4f);
+        if (options.returnSequence) {
+            ExpectNear(FromBytes<float>(results["sequence"]), expectedSequence, 1e-4f);
+        }
+    }
+};
+
+// Test the default options, without biases nor initial hidden state.
+TEST_P(GruTests, Default) {
+    TestGru({}, false, false);
+}
+
+// Test the biases, the initial hidden state and the sequence of hidden states.
+TEST_P(GruTests, BiasesAndSequence) {
+    wgpu::GruOptions options = {};
+    options.returnSequence = true;
+    TestGru(options, true, true);
+}
+
+// Test the reset gate applied before the recurrent projection of the new gate, and the rzn
+// layout of the weights.
+TEST_P(GruTests, ResetBeforeAndRzn) {
+    wgpu::GruOptions options = {};
+    options.resetAfter = false;
+    TestGru(options, true, true);
+    options.layout = wgpu::RecurrentNetworkWeightLayout::Rzn;
+    TestGru(options, true, false);
+    options.resetAfter = true;
+    TestGru(options, true, false);
+}
+
+// Test the backward and bidirectional GRU.
+TEST_P(GruTests, Directions) {
+    wgpu::GruOptions options = {};
+    options.returnSequence = true;
+    options.direction = wgpu::RecurrentNetworkDirection::Backward;
+    TestGru(options, true, true);
+    options.direction = wgpu::RecurrentNetworkDirection::Both;
+    TestGru(options, true, true);
+    options.resetAfter = false;
+    TestGru(options, false, false);
+}
+
+DAWN_INSTANTIATE_TEST(GruTests, NullBackend());
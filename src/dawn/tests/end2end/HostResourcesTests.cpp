@@ -0,0 +1,218 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// The inputs and the outputs bound to host memory are read and written in place, without being
+// staged in buffers.
+class HostResourcesTests : public WebnnTest {
+  protected:
+    // Binds |data| to |name| in |resources|.
+    static void SetHost(const wgpu::NamedResources& resources,
+                        const char* name,
+                        std::vector<float>* data) {
+        wgpu::HostResourceView view = {};
+        view.buffer = data->data();
+        view.size = data->size() * sizeof(float);
+        resources.SetHost(name, &view);
+    }
+
+    // Binds a buffer holding |data| to |name| in |resources|, which is read back from it when
+    // |output| is set. The returned view keeps the buffer alive.
+    wgpu::BufferResourceView SetBuffer(const wgpu::NamedResources& resources,
+                                       const char* name,
+                                       const std::vector<float>& data,
+                                       bool output = false) {
+        size_t size = data.size() * sizeof(float);
+        wgpu::BufferResourceView view = {};
+        view.resource = output ? CreateBuffer(size,
+                                              wgpu::BufferUsage::MapRead |
+                                                  wgpu::BufferUsage::CopyDst,
+                                              nullptr)
+                               : CreateBuffer(size,
+                                              wgpu::BufferUsage::MapWrite |
+                                                  wgpu::BufferUsage::CopySrc,
+                                              data.data());
+        view.size = size;
+        resources.Set(name, &view);
+        return view;
+    }
+
+    std::vector<float> ReadBuffer(const wgpu::BufferResourceView& view) {
+        std::vector<float> data(view.size / sizeof(float));
+        MapAsyncAndWait(view.resource, wgpu::MapMode::Read, BufferSize(view.size));
+        memcpy(data.data(), view.resource.GetConstMappedRange(0, BufferSize(view.size)),
+               view.size);
+        view.resource.Unmap();
+        return data;
+    }
+
+    // Relu(input * weights + bias) for the [rows, 8] input, the [8, 4] weights and the [4]
+    // bias.
+    static std::vector<float> Dense(const std::vector<float>& input,
+                                    const std::vector<float>& weights,
+                                    const std::vector<float>& bias) {
+        size_t rows = input.size() / 8;
+        std::vector<float> output(rows * 4);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                double sum = bias[j];
+                for (size_t k = 0; k < 8; ++k) {
+                    sum += static_cast<double>(input[i * 8 + k]) * weights[k * 4 + j];
+                }
+                output[i * 4 + j] = std::max(static_cast<float>(sum), 0.0f);
+            }
+        }
+        return output;
+    }
+
+    void SetUp() override {
+        WebnnTest::SetUp();
+        mWeights = RandomData(8 * 4);
+        mBias = RandomData(4);
+    }
+
+    // The graph of Dense() over a [rows, 8] input, -1 for a dynamic one.
+    wgpu::Graph BuildDense(int32_t rows) {
+        wgpu::Operand output = builder.Relu(builder.Add(
+            builder.Gemm(Input("input", {rows, 8}), Constant({8, 4}, mWeights)),
+            Constant({4}, mBias)));
+        return Build({{"output", output}});
+    }
+
+    std::vector<float> mWeights;
+    std::vector<float> mBias;
+};
+
+// Test inputs and outputs in host memory, alone or along with buffers, and that the inputs are
+// left as they are.
+TEST_P(HostResourcesTests, InputsAndOutputs) {
+    wgpu::Graph graph = BuildDense(5);
+    ASSERT_NE(graph.Get(), nullptr);
+    std::vector<float> input = RandomData(5 * 8);
+    const std::vector<float> original = input;
+    std::vector<float> expected = Dense(input, mWeights, mBias);
+
+    for (bool hostInput : {true, false}) {
+        for (bool hostOutput : {true, false}) {
+            wgpu::NamedResources inputs = graph.CreateNamedResources();
+            wgpu::BufferResourceView inputView;
+            if (hostInput) {
+                SetHost(inputs, "input", &input);
+            } else {
+                inputView = SetBuffer(inputs, "input", input);
+            }
+            std::vector<float> output(expected.size(), NAN);
+            wgpu::NamedResources outputs = graph.CreateNamedResources();
+            wgpu::BufferResourceView outputView;
+            if (hostOutput) {
+                SetHost(outputs, "output", &output);
+            } else {
+                outputView = SetBuffer(outputs, "output", output, true);
+            }
+            graph.Compute(inputs, outputs);
+            ExpectNear(hostOutput ? output : ReadBuffer(outputView), expected, 1e-4f);
+            EXPECT_EQ(input, original);
+        }
+    }
+}
+
+// Test an output that other operators read too, which is computed in the host memory of the
+// output.
+TEST_P(HostResourcesTests, IntermediateOutput) {
+    wgpu::Operand hidden = builder.Relu(Input("input", {64}));
+    wgpu::Operand output = builder.Mul(hidden, hidden);
+    wgpu::Graph graph = Build({{"hidden", hidden}, {"output", output}});
+    ASSERT_NE(graph.Get(), nullptr);
+
+    std::vector<float> input = RandomData(64);
+    std::vector<float> expectedHidden(64), expectedOutput(64);
+    for (size_t i = 0; i < input.size(); ++i) {
+        expectedHidden[i] = std::max(input[i], 0.0f);
+        expectedOutput[i] = expectedHidden[i] * expectedHidden[i];
+    }
+    wgpu::NamedResources inputs = graph.CreateNamedResources();
+    SetHost(inputs, "input", &input);
+    std::vector<float> hiddenData(64, NAN), outputData(64, NAN);
+    wgpu::NamedResources outputs = graph.CreateNamedResources();
+    SetHost(outputs, "hidden", &hiddenData);
+    SetHost(outputs, "output", &outputData);
+    graph.Compute(inputs, outputs);
+    ExpectNear(hiddenData, expectedHidden);
+    ExpectNear(outputData, expectedOutput);
+}
+
+// Test that a later Set() or SetHost() of a name replaces its earlier binding.
+TEST_P(HostResourcesTests, Rebinding) {
+    wgpu::Graph graph = BuildDense(2);
+    ASSERT_NE(graph.Get(), nullptr);
+    std::vector<float> input = RandomData(2 * 8);
+    std::vector<float> other = RandomData(2 * 8);
+    std::vector<float> output(2 * 4, NAN);
+
+    // The buffer replaces the host memory.
+    wgpu::NamedResources inputs = graph.CreateNamedResources();
+    SetHost(inputs, "input", &other);
+    wgpu::BufferResourceView inputView = SetBuffer(inputs, "input", input);
+    wgpu::NamedResources outputs = graph.CreateNamedResources();
+    SetHost(outputs, "output", &output);
+    graph.Compute(inputs, outputs);
+    ExpectNear(output, Dense(input, mWeights, mBias), 1e-4f);
+
+    // The host memory replaces the buffer.
+    SetHost(inputs, "input", &other);
+    graph.Compute(inputs, outputs);
+    ExpectNear(output, Dense(other, mWeights, mBias), 1e-4f);
+}
+
+// Test that the host memory must hold the whole tensor.
+TEST_P(HostResourcesTests, TooSmall) {
+    wgpu::Graph graph = BuildDense(2);
+    ASSERT_NE(graph.Get(), nullptr);
+    std::vector<float> input = RandomData(2 * 8);
+    std::vector<float> smallInput(2 * 8 - 1);
+    std::vector<float> output(2 * 4), smallOutput(2 * 4 - 1);
+
+    wgpu::NamedResources inputs = graph.CreateNamedResources();
+    SetHost(inputs, "input", &smallInput);
+    wgpu::NamedResources outputs = graph.CreateNamedResources();
+    SetHost(outputs, "output", &output);
+    ASSERT_DEVICE_ERROR(graph.Compute(inputs, outputs));
+
+    SetHost(inputs, "input", &input);
+    SetHost(outputs, "output", &smallOutput);
+    ASSERT_DEVICE_ERROR(graph.Compute(inputs, outputs));
+}
+
+// Test a dynamic dimension inferred from the size of the host memory.
+TEST_P(HostResourcesTests, DynamicDimension) {
+    wgpu::Graph graph = BuildDense(-1);
+    ASSERT_NE(graph.Get(), nullptr);
+    for (int32_t rows : {3, 1, 6}) {
+        std::vector<float> input = RandomData(rows * 8);
+        std::vector<float> output(rows * 4, NAN);
+        wgpu::NamedResources inputs = graph.CreateNamedResources();
+        SetHost(inputs, "input", &input);
+        wgpu::NamedResources outputs = graph.CreateNamedResources();
+        SetHost(outputs, "output", &output);
+        graph.Compute(inputs, outputs);
+        ExpectNear(output, Dense(input, mWeights, mBias), 1e-4f);
+    }
+}
+
+DAWN_INSTANTIATE_TEST(HostResourcesTests, NullBackend());
@@ -0,0 +1,91 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <cmath>
+
+class InstanceNormTests : public WebnnTest {
+  protected:
+    // Normalizes every channel of every batch of the [N, C, H, W] or [N, H, W, C] |input| on
+    // the host, then applies |scale| and |bias| when they aren't empty.
+    static std::vector<float> Normalize(const std::vector<float>& input,
+                                        int32_t batches,
+                                        int32_t channels,
+                                        int32_t spatialSize,
+                                        bool nhwc,
+                                        const std::vector<float>& scale,
+                                        const std::vector<float>& bias,
+                                        float epsilon) {
+        auto index = [&](int32_t n, int32_t c, int32_t i) {
+            return nhwc ? (n * spatialSize + i) * channels + c
+                        : (n * channels + c) * spatialSize + i;
+        };
+        std::vector<float> output(input.size());
+        for (int32_t n = 0; n < batches; ++n) {
+            for (int32_t c = 0; c < channels; ++c) {
+                double mean = 0, variance = 0;
+                for (int32_t i = 0; i < spatialSize; ++i) {
+                    mean += input[index(n, c, i)];
+                }
+                mean /= spatialSize;
+                for (int32_t i = 0; i < spatialSize; ++i) {
+                    double difference = input[index(n, c, i)] - mean;
+                    variance += difference * difference;
+                }
+                variance /= spatialSize;
+                for (int32_t i = 0; i < spatialSize; ++i) {
+                    double value = (input[index(n, c, i)] - mean) / std::sqrt(variance + epsilon);
+                    if (!scale.empty()) {
+                        value = value * scale[c] + bias[c];
+                    }
+                    output[index(n, c, i)] = static_cast<float>(value);
+                }
+            }
+        }
+        return output;
+    }
+};
+
+// Test the normalization without scale and bias.
+TEST_P(InstanceNormTests, Default) {
+    std::vector<float> input = RandomData(2 * 3 * 5 * 7, -2.0f, 3.0f);
+    wgpu::Operand output = builder.InstanceNorm(Input("input", {2, 3, 5, 7}));
+    ExpectNear(Compute(output, input.size(), {{"input", input}}),
+               Normalize(input, 2, 3, 35, false, {}, {}, 1e-5f), 1e-4f);
+}
+
+// Test the scale, the bias and the epsilon, in both layouts.
+TEST_P(InstanceNormTests, ScaleBiasAndLayouts) {
+    const int32_t channels = 9;
+    std::vector<float> input = RandomData(2 * 4 * 6 * channels);
+    std::vector<float> scale = RandomData(channels);
+    std::vector<float> bias = RandomData(channels);
+    for (bool nhwc : {false, true}) {
+        wgpu::InstanceNormOptions options = {};
+        options.scale = Constant({channels}, scale);
+        options.bias = Constant({channels}, bias);
+        options.epsilon = 0.1f;
+        std::vector<int32_t> shape = {2, channels, 4, 6};
+        if (nhwc) {
+            options.layout = wgpu::InputOperandLayout::Nhwc;
+            shape = {2, 4, 6, channels};
+        }
+        wgpu::Operand output = builder.InstanceNorm(Input("input", shape), &options);
+        ExpectNear(Compute(output, input.size(), {{"input", input}}),
+                   Normalize(input, 2, channels, 24, nhwc, scale, bias, 0.1f), 1e-4f);
+    }
+}
+
+DAWN_INSTANTIATE_TEST(InstanceNormTests, NullBackend());
@@ -0,0 +1,129 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+
+class LayoutPropagationTests : public WebnnTest {
+  protected:
+    wgpu::Operand Transpose(const wgpu::Operand& input, const std::vector<int32_t>& permutation) {
+        wgpu::TransposeOptions options = {};
+        options.permutation = permutation.data();
+        options.permutationCount = permutation.size();
+        return builder.Transpose(input, &options);
+    }
+
+    // Transposes the |data| of |shape| on the host.
+    static std::vector<float> TransposeData(const std::vector<float>& data,
+                                            const std::vector<int32_t>& shape,
+                                            const std::vector<int32_t>& permutation) {
+        size_t rank = shape.size();
+        std::vector<size_t> strides(rank, 1);
+        for (size_t i = rank - 1; i > 0; --i) {
+            strides[i - 1] = strides[i] * shape[i];
+        }
+        std::vector<int32_t> index(rank, 0);
+        std::vector<float> result;
+        for (size_t i = 0; i < data.size(); ++i) {
+            size_t offset = 0;
+            for (size_t d = 0; d < rank; ++d) {
+                offset += index[d] * strides[permutation[d]];
+            }
+            result.push_back(data[offset]);
+            // The index in the transposed shape, the last dimension first.
+            for (size_t d = rank; d-- > 0;) {
+                if (++index[d] < shape[permutation[d]]) {
+                    break;
+                }
+                index[d] = 0;
+            }
+        }
+        return result;
+    }
+};
+
+// Test a Conv2d and a Pool2d between the Transpose to nchw and the one back to nhwc, which
+// are computed in nhwc instead.
+TEST_P(LayoutPropagationTests, Conv2dInNhwc) {
+    const std::vector<int32_t> nhwcShape = {1, 8, 8, 3};
+    std::vector<float> input = RandomData(ElementCount(nhwcShape));
+    std::vector<float> filter = RandomData(4 * 3 * 3 * 3);
+    std::vector<float> bias = RandomData(4);
+    const int32_t padding[] = {1, 1, 1, 1};
+    wgpu::Conv2dOptions options = {};
+    options.padding = padding;
+    options.paddingCount = 4;
+    options.bias = Constant({4}, bias);
+
+    // The nchw graph computed from the input transposed on the host.
+    wgpu::Operand nchw = builder.AveragePool2d(builder.Relu(builder.Conv2d(
+        Input("input", {1, 3, 8, 8}), Constant({4, 3, 3, 3}, filter), &options)));
+    std::vector<float> expected = TransposeData(
+        Compute(nchw, 4, {{"input", TransposeData(input, nhwcShape, {0, 3, 1, 2})}}),
+        {1, 4, 1, 1}, {0, 2, 3, 1});
+
+    options.bias = Constant({4}, bias);
+    wgpu::Operand conv = builder.Conv2d(Transpose(Input("input", nhwcShape), {0, 3, 1, 2}),
+                                        Constant({4, 3, 3, 3}, filter), &options);
+    wgpu::Operand output = Transpose(builder.AveragePool2d(builder.Relu(conv)), {0, 2, 3, 1});
+    ExpectNear(Compute(output, 4, {{"input", input}}), expected, 1e-4f);
+}
+
+// Test element-wise operators between opposite Transpose, with a constant operand that is
+// transposed to the layout of the input.
+TEST_P(LayoutPropagationTests, Elementwise) {
+    const std::vector<int32_t> shape = {2, 3, 5};
+    std::vector<float> input = RandomData(30);
+    std::vector<float> constant = RandomData(30);
+    // |constant| is in the [5, 2, 3] layout of the transposed input.
+    std::vector<float> expected = TransposeData(constant, {5, 2, 3}, {1, 2, 0});
+    for (size_t i = 0; i < expected.size(); ++i) {
+        expected[i] = std::min(std::max(input[i] * expected[i], -0.1f), 0.1f);
+        expected[i] = 1.0f / (1.0f + std::exp(-expected[i]));
+    }
+
+    wgpu::Operand transposed = Transpose(Input("input", shape), {2, 0, 1});
+    wgpu::ClampOptions clampOptions = {};
+    clampOptions.minValue = -0.1f;
+    clampOptions.maxValue = 0.1f;
+    wgpu::Operand clamped =
+        builder.Clamp(builder.Mul(transposed, Constant({5, 2, 3}, constant)), &clampOptions);
+    wgpu::Operand output = Transpose(builder.Sigmoid(clamped), {1, 2, 0});
+    ExpectNear(Compute(output, 30, {{"input", input}}), expected);
+}
+
+// Test consecutive Transpose, merged into one or removed, and those that become a Reshape.
+TEST_P(LayoutPropagationTests, ConsecutiveTransposes) {
+    const std::vector<int32_t> shape = {2, 3, 4, 5};
+    std::vector<float> input = RandomData(ElementCount(shape));
+
+    wgpu::Operand output = Transpose(Transpose(Input("input", shape), {0, 2, 3, 1}), {3, 1, 0, 2});
+    std::vector<float> expected = TransposeData(
+        TransposeData(input, shape, {0, 2, 3, 1}), {2, 4, 5, 3}, {3, 1, 0, 2});
+    ExpectNear(Compute(output, input.size(), {{"input", input}}), expected);
+
+    output =
+        builder.Relu(Transpose(Transpose(Input("input", shape), {0, 2, 3, 1}), {0, 3, 1, 2}));
+    std::vector<float> relu(input.size());
+    std::transform(input.begin(), input.end(), relu.begin(),
+                   [](float value) { return std::max(value, 0.0f); });
+    ExpectNear(Compute(output, input.size(), {{"input", input}}), relu);
+
+    output = Transpose(Input("input", {1, 4, 1, 5}), {2, 1, 0, 3});
+    std::vector<float> small(input.begin(), input.begin() + 20);
+    ExpectNear(Compute(output, 20, {{"input", small}}), small);
+}
+
+DAWN_INSTANTIATE_TEST(LayoutPropagationTests, NullBackend());
@@ -0,0 +1,75 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+
+class PadTests : public WebnnTest {
+  protected:
+    // Pads the [2, 3] input [[1, 2, 3], [4, 5, 6]] by one row before and two columns on each
+    // side.
+    std::vector<float> PadMatrix(wgpu::PaddingMode mode, float value = 0) {
+        const uint32_t padding[] = {1, 0, 2, 2};
+        wgpu::PadOptions options = {};
+        options.mode = mode;
+        options.value = value;
+        return Compute(builder.Pad(Input("input", {2, 3}), padding, 4, &options), 3 * 7,
+                       {{"input", {1, 2, 3, 4, 5, 6}}});
+    }
+};
+
+// Test every padding mode against values computed by hand.
+TEST_P(PadTests, Modes) {
+    ExpectNear(PadMatrix(wgpu::PaddingMode::Constant, 9),
+               {9, 9, 9, 9, 9, 9, 9,  //
+                9, 9, 1, 2, 3, 9, 9,  //
+                9, 9, 4, 5, 6, 9, 9});
+    ExpectNear(PadMatrix(wgpu::PaddingMode::Edge),
+               {1, 1, 1, 2, 3, 3, 3,  //
+                1, 1, 1, 2, 3, 3, 3,  //
+                4, 4, 4, 5, 6, 6, 6});
+    ExpectNear(PadMatrix(wgpu::PaddingMode::Reflection),
+               {6, 5, 4, 5, 6, 5, 4,  //
+                3, 2, 1, 2, 3, 2, 1,  //
+                6, 5, 4, 5, 6, 5, 4});
+    ExpectNear(PadMatrix(wgpu::PaddingMode::Symmetric),
+               {2, 1, 1, 2, 3, 3, 2,  //
+                2, 1, 1, 2, 3, 3, 2,  //
+                5, 4, 4, 5, 6, 6, 5});
+}
+
+// Test the padding of the spatial dimensions of an NCHW image, consumed by a convolution.
+TEST_P(PadTests, Image) {
+    std::vector<float> input = RandomData(2 * 3 * 4);
+    const uint32_t padding[] = {0, 0, 0, 0, 1, 1, 1, 1};
+    // The 3x3 filter of ones sums the neighbours of each value, the padding counting as 0.
+    wgpu::Operand output = builder.Conv2d(builder.Pad(Input("input", {1, 2, 3, 4}), padding, 8),
+                                          Constant({1, 2, 3, 3}, std::vector<float>(18, 1.0f)));
+    std::vector<float> expected(3 * 4, 0);
+    for (int32_t h = 0; h < 3; ++h) {
+        for (int32_t w = 0; w < 4; ++w) {
+            for (int32_t c = 0; c < 2; ++c) {
+                for (int32_t y = std::max(h - 1, 0); y <= std::min(h + 1, 2); ++y) {
+                    for (int32_t x = std::max(w - 1, 0); x <= std::min(w + 1, 3); ++x) {
+                        expected[h * 4 + w] += input[(c * 3 + y) * 4 + x];
+                    }
+                }
+            }
+        }
+    }
+    ExpectNear(Compute(output, 3 * 4, {{"input", input}}), expected, 1e-4f);
+}
+
+DAWN_INSTANTIATE_TEST(PadTests, NullBackend());
@@ -0,0 +1,234 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <limits>
+
+class Pool2dTests : public WebnnTest {
+  protected:
+    // A pooling of an [N, C, H, W] input, or [N, H, W, C] when |nhwc| is set.
+    struct Pool2dCase {
+        int32_t batches;
+        int32_t channels;
+        int32_t inputHeight;
+        int32_t inputWidth;
+        int32_t windowHeight;
+        int32_t windowWidth;
+        std::vector<int32_t> padding = {0, 0, 0, 0};
+        std::vector<int32_t> strides = {1, 1};
+        std::vector<int32_t> dilations = {1, 1};
+        bool nhwc = false;
+    };
+
+    static int32_t OutputSize(int32_t input,
+                              int32_t window,
+                              int32_t paddingBegin,
+                              int32_t paddingEnd,
+                              int32_t stride,
+                              int32_t dilation) {
+        return (input + paddingBegin + paddingEnd - dilation * (window - 1) - 1) / stride + 1;
+    }
+
+    static size_t Index(const Pool2dCase& c,
+                        int32_t channels,
+                        int32_t height,
+                        int32_t width,
+                        int32_t n,
+                        int32_t ch,
+                        int32_t h,
+                        int32_t w) {
+        return c.nhwc ? ((static_cast<size_t>(n) * height + h) * width + w) * channels + ch
+                      : ((static_cast<size_t>(n) * channels + ch) * height + h) * width + w;
+    }
+
+    // Pools |input| on the host, the padding is not counted by the average.
+    static std::vector<float> Reference(const Pool2dCase& c,
+                                        bool isMax,
+                                        const std::vector<float>& input) {
+        int32_t outputHeight = OutputSize(c.inputHeight, c.windowHeight, c.padding[0],
+                                          c.padding[1], c.strides[0], c.dilations[0]);
+        int32_t outputWidth = OutputSize(c.inputWidth, c.windowWidth, c.padding[2], c.padding[3],
+                                         c.strides[1], c.dilations[1]);
+        std::vector<float> output(static_cast<size_t>(c.batches) * c.channels * outputHeight *
+                                  outputWidth);
+        for (int32_t n = 0; n < c.batches; ++n) {
+            for (int32_t ch = 0; ch < c.channels; ++ch) {
+                for (int32_t oh = 0; oh < outputHeight; ++oh) {
+                    for (int32_t ow = 0; ow < outputWidth; ++ow) {
+                        double value = isMax ? std::numeric_limits<double>::lowest() : 0.0;
+                        int32_t count = 0;
+                        for (int32_t kh = 0; kh < c.windowHeight; ++kh) {
+                            int32_t ih = oh * c.strides[0] - c.padding[0] + kh * c.dilations[0];
+                            for (int32_t kw = 0; kw < c.windowWidth; ++kw) {
+                                int32_t iw =
+                                    ow * c.strides[1] - c.padding[2] + kw * c.dilations[1];
+                                if (ih < 0 || ih >= c.inputHeight || iw < 0 ||
+                                    iw >= c.inputWidth) {
+                                    continue;
+                                }
+                                float v = input[Index(c, c.channels, c.inputHeight, c.inputWidth,
+                                                      n, ch, ih, iw)];
+                                value = isMax ? std::max<double>(value, v) : value + v;
+                                ++count;
+                            }
+                        }
+                        output[Index(c, c.channels, outputHeight, outputWidth, n, ch, oh, ow)] =
+                            static_cast<float>(isMax ? value : value / count);
+                    }
+                }
+            }
+        }
+        return output;
+    }
+
+    // Checks the max and the average pooling of |c| against Reference().
+    void Check(const Pool2dCase& c) {
+        std::vector<int32_t> shape =
+            c.nhwc ? std::vector<int32_t>{c.batches, c.inputHeight, c.inputWidth, c.channels}
+                   : std::vector<int32_t>{c.batches, c.channels, c.inputHeight, c.inputWidth};
+        std::vector<float> input = RandomData(ElementCount(shape));
+        const int32_t windowDimensions[] = {c.windowHeight, c.windowWidth};
+        wgpu::Pool2dOptions options = {};
+        options.windowDimensions = windowDimensions;
+        options.windowDimensionsCount = 2;
+        options.padding = c.padding.data();
+        options.paddingCount = 4;
+        options.strides = c.strides.data();
+        options.stridesCount = 2;
+        options.dilations = c.dilations.data();
+        options.dilationsCount = 2;
+        options.layout = c.nhwc ? wgpu::InputOperandLayout::Nhwc : wgpu::InputOperandLayout::Nchw;
+        for (bool isMax : {true, false}) {
+            std::vector<float> expected = Reference(c, isMax, input);
+            wgpu::Operand x = Input("input", shape);
+            wgpu::Operand output =
+                isMax ? builder.MaxPool2d(x, &options) : builder.AveragePool2d(x, &options);
+            ExpectNear(Compute(output, expected.size(), {{"input", input}}), expected, 1e-4f);
+        }
+    }
+};
+
+// Test the pooling against values computed by hand.
+TEST_P(Pool2dTests, Simple) {
+    const int32_t windowDimensions[] = {2, 2};
+    wgpu::Pool2dOptions options = {};
+    options.windowDimensions = windowDimensions;
+    options.windowDimensionsCount = 2;
+    std::map<std::string, std::vector<float>> inputs = {{"input", {1, 2, 3, 4, 5, 6, 7, 8, 9}}};
+    ExpectNear(Compute(builder.MaxPool2d(Input("input", {1, 1, 3, 3}), &options), 4, inputs),
+               {5, 6, 8, 9});
+    ExpectNear(Compute(builder.AveragePool2d(Input("input", {1, 1, 3, 3}), &options), 4, inputs),
+               {3, 4, 6, 7});
+}
+
+// Test windows of various sizes, whose rows are reduced together in NCHW.
+TEST_P(Pool2dTests, Windows) {
+    for (bool nhwc : {false, true}) {
+        Pool2dCase c = {2, 5, 17, 23, 3, 3};
+        c.nhwc = nhwc;
+        Check(c);
+        c.windowHeight = 1;
+        c.windowWidth = 7;
+        Check(c);
+        c.windowHeight = 5;
+        c.windowWidth = 2;
+        Check(c);
+    }
+}
+
+// Test the padding, whose values the average doesn't count, on each side separately.
+TEST_P(Pool2dTests, Padding) {
+    for (bool nhwc : {false, true}) {
+        Pool2dCase c = {1, 19, 9, 11, 3, 3};
+        c.nhwc = nhwc;
+        c.padding = {1, 1, 1, 1};
+        Check(c);
+        c.padding = {2, 0, 0, 2};
+        Check(c);
+        c.padding = {0, 1, 2, 0};
+        Check(c);
+    }
+}
+
+// Test the strides and the dilations.
+TEST_P(Pool2dTests, StridesAndDilations) {
+    for (bool nhwc : {false, true}) {
+        Pool2dCase c = {1, 8, 15, 16, 3, 3};
+        c.nhwc = nhwc;
+        c.strides = {2, 2};
+        c.padding = {1, 1, 1, 1};
+        Check(c);
+        c.strides = {1, 3};
+        Check(c);
+        c.strides = {1, 1};
+        c.dilations = {2, 3};
+        Check(c);
+    }
+}
+
+// Test the global pooling, without window dimensions, in both layouts.
+TEST_P(Pool2dTests, Global) {
+    const int32_t channels = 6, size = 7;
+    std::vector<float> input = RandomData(channels * size * size);
+    std::vector<float> expected(channels, 0.0f);
+    std::vector<float> nhwcInput(input.size());
+    for (int32_t c = 0; c < channels; ++c) {
+        for (int32_t i = 0; i < size * size; ++i) {
+            expected[c] += input[c * size * size + i] / (size * size);
+            nhwcInput[i * channels + c] = input[c * size * size + i];
+        }
+    }
+    ExpectNear(Compute(builder.AveragePool2d(Input("input", {1, channels, size, size})),
+                       channels, {{"input", input}}),
+               expected);
+
+    wgpu::Pool2dOptions options = {};
+    options.layout = wgpu::InputOperandLayout::Nhwc;
+    ExpectNear(Compute(builder.AveragePool2d(Input("input", {1, size, size, channels}), &options),
+                       channels, {{"input", nhwcInput}}),
+               expected);
+}
+
+// Test that the automatic padding matches the equivalent explicit padding.
+TEST_P(Pool2dTests, AutoPad) {
+    std::vector<float> input = RandomData(3 * 8 * 8);
+    const int32_t windowDimensions[] = {3, 3};
+    const int32_t strides[] = {2, 2};
+    // The output is 4x4 and the total padding 1 on each axis.
+    for (auto [autoPad, padding] : {std::make_pair(wgpu::AutoPad::SameUpper,
+                                                   std::vector<int32_t>{0, 1, 0, 1}),
+                                    std::make_pair(wgpu::AutoPad::SameLower,
+                                                   std::vector<int32_t>{1, 0, 1, 0})}) {
+        wgpu::Pool2dOptions options = {};
+        options.windowDimensions = windowDimensions;
+        options.windowDimensionsCount = 2;
+        options.strides = strides;
+        options.stridesCount = 2;
+        options.padding = padding.data();
+        options.paddingCount = 4;
+        std::vector<float> expected = Compute(
+            builder.AveragePool2d(Input("input", {1, 3, 8, 8}), &options), 48, {{"input", input}});
+
+        options.padding = nullptr;
+        options.paddingCount = 0;
+        options.autoPad = autoPad;
+        ExpectNear(Compute(builder.AveragePool2d(Input("input", {1, 3, 8, 8}), &options), 48,
+                           {{"input", input}}),
+                   expected);
+    }
+}
+
+DAWN_INSTANTIATE_TEST(Pool2dTests, NullBackend());
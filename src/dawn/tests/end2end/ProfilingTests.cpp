@@ -0,0 +1,118 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <cstring>
+
+class ProfilingTests : public WebnnTest {
+  protected:
+    void SetUp() override {
+        WebnnTest::SetUp();
+        // A convolution of a [1, 3, 8, 8] input into [1, 4, 6, 6], multiplied as [4, 36] by a
+        // [36, 5] matrix.
+        wgpu::Operand conv =
+            builder.Conv2d(Input("input", {1, 3, 8, 8}), Constant({4, 3, 3, 3}, RandomData(108)));
+        const int32_t newShape[] = {4, 36};
+        wgpu::Operand output =
+            builder.Gemm(builder.Reshape(conv, newShape, 2), Constant({36, 5}, RandomData(180)));
+        graph = Build({{"output", output}});
+        inputs["input"] = ToBytes(RandomData(3 * 8 * 8));
+        outputs["output"].resize(4 * 5 * sizeof(float));
+    }
+
+    void ComputeGraph() {
+        Compute(graph, inputs, &outputs);
+    }
+
+    // The profile of the operator named |name|, which fails the test when there isn't exactly
+    // one.
+    wgpu::OperatorProfile FindProfile(const char* name) {
+        wgpu::OperatorProfile found = {};
+        size_t count = 0;
+        for (size_t i = 0; i < graph.GetOperatorProfileCount(); ++i) {
+            wgpu::OperatorProfile profile = {};
+            EXPECT_TRUE(graph.GetOperatorProfile(i, &profile));
+            if (strcmp(profile.name, name) == 0) {
+                found = profile;
+                ++count;
+            }
+        }
+        EXPECT_EQ(count, 1u) << name;
+        return found;
+    }
+
+    wgpu::Graph graph;
+    std::map<std::string, std::vector<uint8_t>> inputs;
+    std::map<std::string, std::vector<uint8_t>> outputs;
+};
+
+// Test that the computations aren't profiled unless it is enabled.
+TEST_P(ProfilingTests, DisabledByDefault) {
+    ComputeGraph();
+    EXPECT_EQ(graph.GetOperatorProfileCount(), 0u);
+}
+
+// Test that the profile accumulates one entry per operator over the computations.
+TEST_P(ProfilingTests, Accumulate) {
+    graph.SetProfilingEnabled(true);
+    ComputeGraph();
+    ComputeGraph();
+    size_t count = graph.GetOperatorProfileCount();
+    ASSERT_GE(count, 2u);
+    for (size_t i = 0; i < count; ++i) {
+        wgpu::OperatorProfile profile = {};
+        ASSERT_TRUE(graph.GetOperatorProfile(i, &profile));
+        ASSERT_NE(profile.name, nullptr);
+        ASSERT_NE(profile.variant, nullptr);
+        EXPECT_EQ(profile.computeCount, 2u) << profile.name;
+        EXPECT_GT(profile.byteCount, 0u) << profile.name;
+    }
+
+    wgpu::OperatorProfile conv = FindProfile("Conv2d");
+    EXPECT_EQ(conv.operationCount, 2u * 4 * 6 * 6 * 3 * 3 * 3);
+    EXPECT_GT(strlen(conv.variant), 0u);
+    EXPECT_STRNE(conv.variant, "Auto");
+    wgpu::OperatorProfile gemm = FindProfile("Gemm");
+    EXPECT_EQ(gemm.operationCount, 2u * 4 * 36 * 5);
+}
+
+// Test that disabling the profiling keeps the profile and that enabling it again clears it.
+TEST_P(ProfilingTests, EnableAndDisable) {
+    graph.SetProfilingEnabled(true);
+    ComputeGraph();
+    size_t count = graph.GetOperatorProfileCount();
+    ASSERT_GT(count, 0u);
+
+    graph.SetProfilingEnabled(false);
+    ComputeGraph();
+    ASSERT_EQ(graph.GetOperatorProfileCount(), count);
+    EXPECT_EQ(FindProfile("Gemm").computeCount, 1u);
+
+    graph.SetProfilingEnabled(true);
+    EXPECT_EQ(graph.GetOperatorProfileCount(), 0u);
+    ComputeGraph();
+    EXPECT_EQ(graph.GetOperatorProfileCount(), count);
+    EXPECT_EQ(FindProfile("Gemm").computeCount, 1u);
+}
+
+// Test that the profiles past the last operator aren't returned.
+TEST_P(ProfilingTests, OutOfRange) {
+    graph.SetProfilingEnabled(true);
+    ComputeGraph();
+    wgpu::OperatorProfile profile = {};
+    EXPECT_FALSE(graph.GetOperatorProfile(graph.GetOperatorProfileCount(), &profile));
+}
+
+DAWN_INSTANTIATE_TEST(ProfilingTests, NullBackend());
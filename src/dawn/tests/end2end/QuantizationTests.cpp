@@ -0,0 +1,252 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+class QuantizationTests : public WebnnTest {
+  protected:
+    template <typename T>
+    static T QuantizeValue(float value, float scale, int32_t zeroPoint) {
+        float q = std::nearbyint(value / scale) + zeroPoint;
+        q = std::min(std::max(q, float(std::numeric_limits<T>::min())),
+                     float(std::numeric_limits<T>::max()));
+        return static_cast<T>(q);
+    }
+
+    template <typename T>
+    static std::vector<float> Dequantize(const std::vector<T>& data,
+                                         float scale,
+                                         int32_t zeroPoint) {
+        std::vector<float> result(data.size());
+        for (size_t i = 0; i < data.size(); ++i) {
+            result[i] = (static_cast<int32_t>(data[i]) - zeroPoint) * scale;
+        }
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> RandomQuantized(size_t count) {
+        std::vector<float> values =
+            RandomData(count, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+        return std::vector<T>(values.begin(), values.end());
+    }
+
+    template <typename T>
+    static wgpu::OperandType TypeOf() {
+        return std::is_signed<T>::value ? wgpu::OperandType::Int8 : wgpu::OperandType::Uint8;
+    }
+
+    template <typename T>
+    wgpu::Operand QuantizedConstant(const std::vector<int32_t>& shape,
+                                    const std::vector<T>& data) {
+        return Constant(shape, TypeOf<T>(), data.data(), data.size());
+    }
+
+    template <typename T>
+    wgpu::Operand ZeroPoint(T zeroPoint) {
+        return Constant({1}, TypeOf<T>(), &zeroPoint, 1);
+    }
+
+    // Computes |output| from the bytes of |input| and returns the |size| bytes of the output.
+    std::vector<uint8_t> ComputeBytes(const wgpu::Operand& output,
+                                      size_t size,
+                                      std::vector<uint8_t> input) {
+        wgpu::Graph graph = Build({{"output", output}});
+        EXPECT_NE(graph.Get(), nullptr);
+        if (graph.Get() == nullptr) {
+            return {};
+        }
+        std::map<std::string, std::vector<uint8_t>> outputs;
+        outputs["output"].resize(size);
+        Compute(graph, {{"input", std::move(input)}}, &outputs);
+        return outputs["output"];
+    }
+
+    // Expects the quantized |actual| to be at most one step away from |expected|, since the
+    // quantized operators round their accumulators in another order than the reference.
+    template <typename T>
+    static void ExpectQuantizedNear(const std::vector<T>& actual, const std::vector<T>& expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i) {
+            ASSERT_LE(std::abs(int32_t(actual[i]) - int32_t(expected[i])), 1) << "at index " << i;
+        }
+    }
+};
+
+// Test quantizeLinear to uint8 with a scale and a zero point per channel, and its saturation.
+TEST_P(QuantizationTests, QuantizeLinear) {
+    std::vector<float> input = RandomData(3 * 4, -40.0f, 40.0f);
+    std::vector<float> scales = {0.1f, 0.25f, 0.5f, 1.0f};
+    std::vector<uint8_t> zeroPoints = {0, 10, 128, 255};
+    std::vector<uint8_t> expected(input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        expected[i] = QuantizeValue<uint8_t>(input[i], scales[i % 4], zeroPoints[i % 4]);
+    }
+
+    wgpu::Operand output =
+        builder.QuantizeLinear(Input("input", {3, 4}), Constant({4}, scales),
+                               QuantizedConstant<uint8_t>({4}, zeroPoints));
+    EXPECT_EQ(ComputeBytes(output, expected.size(), ToBytes(input)), expected);
+}
+
+// Test quantizeLinear to int8 with one scale and zero point.
+TEST_P(QuantizationTests, QuantizeLinearInt8) {
+    std::vector<float> input = RandomData(37, -10.0f, 10.0f);
+    std::vector<int8_t> expected(input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        expected[i] = QuantizeValue<int8_t>(input[i], 0.05f, -3);
+    }
+
+    wgpu::Operand output = builder.QuantizeLinear(Input("input", {37}), Constant({1}, {0.05f}),
+                                                  ZeroPoint<int8_t>(-3));
+    EXPECT_EQ(FromBytes<int8_t>(ComputeBytes(output, expected.size(), ToBytes(input))),
+              expected);
+}
+
+// Test dequantizeLinear of int8 and uint8 inputs.
+TEST_P(QuantizationTests, DequantizeLinear) {
+    std::vector<int8_t> input = RandomQuantized<int8_t>(2 * 5);
+    std::vector<float> scales = {0.5f, 0.125f};
+    std::vector<int8_t> zeroPoints = {-7, 9};
+    std::vector<float> expected(input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        expected[i] = (input[i] - zeroPoints[i / 5]) * scales[i / 5];
+    }
+    wgpu::Operand output = builder.DequantizeLinear(
+        Input("input", {2, 5}, wgpu::OperandType::Int8), Constant({2, 1}, scales),
+        QuantizedConstant<int8_t>({2, 1}, zeroPoints));
+    ExpectNear(
+        FromBytes<float>(ComputeBytes(output, input.size() * sizeof(float), ToBytes(input))),
+        expected);
+
+    std::vector<uint8_t> unsignedInput = RandomQuantized<uint8_t>(9);
+    output = builder.DequantizeLinear(Input("input", {9}, wgpu::OperandType::Uint8),
+                                      Constant({1}, {0.02f}), ZeroPoint<uint8_t>(100));
+    ExpectNear(FromBytes<float>(ComputeBytes(output, 9 * sizeof(float), unsignedInput)),
+               Dequantize(unsignedInput, 0.02f, 100));
+}
+
+// Test the quantized Conv2d computed from a uint8 input, an int8 filter quantized per output
+// channel and a float32 bias, with regular and depthwise convolutions.
+TEST_P(QuantizationTests, Conv2d) {
+    const int32_t channels = 8, size = 7;
+    for (int32_t groups : {1, channels}) {
+        SCOPED_TRACE(groups);
+        const int32_t outputChannels = 8, filterChannels = channels / groups;
+        std::vector<uint8_t> input = RandomQuantized<uint8_t>(channels * size * size);
+        std::vector<int8_t> filter =
+            RandomQuantized<int8_t>(outputChannels * filterChannels * 3 * 3);
+        std::vector<float> filterScales = RandomData(outputChannels, 0.0005f, 0.002f);
+        std::vector<int8_t> filterZeroPoints = RandomQuantized<int8_t>(outputChannels);
+        std::vector<float> bias = RandomData(outputChannels);
+        const float inputScale = 0.02f, outputScale = 0.05f;
+        const uint8_t inputZeroPoint = 120, outputZeroPoint = 130;
+
+        // The reference is computed on the dequantized values, with a padding of 1.
+        std::vector<float> dequantizedInput = Dequantize(input, inputScale, inputZeroPoint);
+        std::vector<uint8_t> expected(outputChannels * size * size);
+        for (int32_t oc = 0; oc < outputChannels; ++oc) {
+            int32_t group = oc / (outputChannels / groups);
+            for (int32_t y = 0; y < size; ++y) {
+                for (int32_t x = 0; x < size; ++x) {
+                    double sum = bias[oc];
+                    for (int32_t ic = 0; ic < filterChannels; ++ic) {
+                        for (int32_t ky = 0; ky < 3; ++ky) {
+                            for (int32_t kx = 0; kx < 3; ++kx) {
+                                int32_t iy = y + ky - 1, ix = x + kx - 1;
+                                if (iy < 0 || iy >= size || ix < 0 || ix >= size) {
+                                    continue;
+                                }
+                                int32_t channel = group * filterChannels + ic;
+                                float weight =
+                                    (filter[((oc * filterChannels + ic) * 3 + ky) * 3 + kx] -
+                                     filterZeroPoints[oc]) *
+                                    filterScales[oc];
+                                sum += dequantizedInput[(channel * size + iy) * size + ix] *
+                                       weight;
+                            }
+                        }
+                    }
+                    expected[(oc * size + y) * size + x] = QuantizeValue<uint8_t>(
+                        static_cast<float>(sum), outputScale, outputZeroPoint);
+                }
+            }
+        }
+
+        wgpu::Operand dequantizedFilter = builder.DequantizeLinear(
+            QuantizedConstant<int8_t>({outputChannels, filterChannels, 3, 3}, filter),
+            Constant({outputChannels, 1, 1, 1}, filterScales),
+            QuantizedConstant<int8_t>({outputChannels, 1, 1, 1}, filterZeroPoints));
+        const int32_t padding[] = {1, 1, 1, 1};
+        wgpu::Conv2dOptions options = {};
+        options.padding = padding;
+        options.paddingCount = 4;
+        options.groups = groups;
+        options.bias = Constant({outputChannels}, bias);
+        wgpu::Operand conv = builder.Conv2d(
+            builder.DequantizeLinear(Input("input", {1, channels, size, size},
+                                           wgpu::OperandType::Uint8),
+                                     Constant({1}, {inputScale}), ZeroPoint(inputZeroPoint)),
+            dequantizedFilter, &options);
+        wgpu::Operand output = builder.QuantizeLinear(conv, Constant({1}, {outputScale}),
+                                                      ZeroPoint(outputZeroPoint));
+        ExpectQuantizedNear(ComputeBytes(output, expected.size(), input), expected);
+    }
+}
+
+// Test the quantized Gemm of an int8 a and a transposed uint8 b, with a float32 c.
+TEST_P(QuantizationTests, Gemm) {
+    const int32_t m = 9, k = 70, n = 13;
+    std::vector<int8_t> a = RandomQuantized<int8_t>(m * k);
+    std::vector<uint8_t> b = RandomQuantized<uint8_t>(n * k);
+    std::vector<float> c = RandomData(n);
+    const float aScale = 0.01f, bScale = 0.02f, outputScale = 0.5f;
+    const int8_t aZeroPoint = 5, outputZeroPoint = -10;
+    const uint8_t bZeroPoint = 128;
+
+    std::vector<float> dequantizedA = Dequantize(a, aScale, aZeroPoint);
+    std::vector<float> dequantizedB = Dequantize(b, bScale, bZeroPoint);
+    std::vector<int8_t> expected(m * n);
+    for (int32_t i = 0; i < m; ++i) {
+        for (int32_t j = 0; j < n; ++j) {
+            double sum = c[j];
+            for (int32_t l = 0; l < k; ++l) {
+                sum += dequantizedA[i * k + l] * dequantizedB[j * k + l];
+            }
+            expected[i * n + j] =
+                QuantizeValue<int8_t>(static_cast<float>(sum), outputScale, outputZeroPoint);
+        }
+    }
+
+    wgpu::GemmOptions options = {};
+    options.bTranspose = true;
+    options.c = Constant({n}, c);
+    wgpu::Operand gemm = builder.Gemm(
+        builder.DequantizeLinear(Input("input", {m, k}, wgpu::OperandType::Int8),
+                                 Constant({1}, {aScale}), ZeroPoint(aZeroPoint)),
+        builder.DequantizeLinear(QuantizedConstant<uint8_t>({n, k}, b), Constant({1}, {bScale}),
+                                 ZeroPoint(bZeroPoint)),
+        &options);
+    wgpu::Operand output =
+        builder.QuantizeLinear(gemm, Constant({1}, {outputScale}), ZeroPoint(outputZeroPoint));
+    ExpectQuantizedNear(FromBytes<int8_t>(ComputeBytes(output, expected.size(), ToBytes(a))),
+                        expected);
+}
+
+DAWN_INSTANTIATE_TEST(QuantizationTests, NullBackend());
@@ -0,0 +1,114 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+
+class ReduceTests : public WebnnTest {
+  protected:
+    wgpu::ReduceOptions Options(const std::vector<int32_t>& axes, bool keepDimensions = false) {
+        mAxes = axes;
+        wgpu::ReduceOptions options = {};
+        options.axes = mAxes.data();
+        options.axesCount = mAxes.size();
+        options.keepDimensions = keepDimensions;
+        return options;
+    }
+
+    std::vector<int32_t> mAxes;
+};
+
+// Test the reductions against values computed by hand.
+TEST_P(ReduceTests, Simple) {
+    // [[1, -2, 3], [-4, 5, -6]] reduced over the rows.
+    std::map<std::string, std::vector<float>> inputs = {{"input", {1, -2, 3, -4, 5, -6}}};
+    wgpu::ReduceOptions options = Options({1});
+    auto compute = [&](wgpu::Operand (wgpu::GraphBuilder::*reduce)(
+                           wgpu::Operand const&, wgpu::ReduceOptions const*) const) {
+        return Compute((builder.*reduce)(Input("input", {2, 3}), &options), 2, inputs);
+    };
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceSum), {2, -5});
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceMean), {2.0f / 3, -5.0f / 3});
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceProduct), {-6, 120});
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceMax), {3, 5});
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceMin), {-2, -6});
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceL1), {6, 15});
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceL2), {std::sqrt(14.0f), std::sqrt(77.0f)});
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceArgMax), {2, 1});
+    ExpectNear(compute(&wgpu::GraphBuilder::ReduceArgMin), {1, 2});
+}
+
+// Test that all the dimensions are reduced without axes, and that -1 is the last dimension.
+TEST_P(ReduceTests, DefaultAndNegativeAxes) {
+    std::vector<float> input = RandomData(4 * 5 * 6);
+    double total = 0;
+    std::vector<float> lastAxis(4 * 5, 0);
+    for (size_t i = 0; i < input.size(); ++i) {
+        total += input[i];
+        lastAxis[i / 6] += input[i];
+    }
+    ExpectNear(Compute(builder.ReduceSum(Input("input", {4, 5, 6})), 1, {{"input", input}}),
+               {static_cast<float>(total)}, 1e-4f);
+
+    wgpu::ReduceOptions options = Options({-1});
+    ExpectNear(
+        Compute(builder.ReduceSum(Input("input", {4, 5, 6}), &options), 20, {{"input", input}}),
+        lastAxis, 1e-4f);
+}
+
+// Test that keepDimensions leaves the reduced dimensions of size 1, so that the result
+// broadcasts back to the input, here to center it per channel.
+TEST_P(ReduceTests, KeepDimensions) {
+    const int32_t batches = 2, channels = 3, size = 5 * 5;
+    std::vector<float> input = RandomData(batches * channels * size);
+    std::vector<float> expected(input.size());
+    for (int32_t c = 0; c < channels; ++c) {
+        double mean = 0;
+        for (int32_t n = 0; n < batches; ++n) {
+            for (int32_t i = 0; i < size; ++i) {
+                mean += input[(n * channels + c) * size + i];
+            }
+        }
+        mean /= batches * size;
+        for (int32_t n = 0; n < batches; ++n) {
+            for (int32_t i = 0; i < size; ++i) {
+                size_t index = (n * channels + c) * size + i;
+                expected[index] = input[index] - static_cast<float>(mean);
+            }
+        }
+    }
+
+    wgpu::Operand x = Input("input", {batches, channels, 5, 5});
+    wgpu::ReduceOptions options = Options({0, 2, 3}, true);
+    wgpu::Operand output = builder.Sub(x, builder.ReduceMean(x, &options));
+    ExpectNear(Compute(output, input.size(), {{"input", input}}), expected, 1e-4f);
+}
+
+// Test ArgMax and ArgMin over several axes, whose indices count in the reduced dimensions
+// taken in order, the first of equal values winning.
+TEST_P(ReduceTests, ArgOverSeveralAxes) {
+    // [2, 2, 3] reduced over the axes 0 and 2, the index is d0 * 3 + d2.
+    std::vector<float> input = {0, 4, 1, 7, 2, 2, 4, 0, 4, 2, 7, -1};
+    wgpu::ReduceOptions options = Options({0, 2});
+    ExpectNear(Compute(builder.ReduceArgMax(Input("input", {2, 2, 3}), &options), 2,
+                       {{"input", input}}),
+               {1, 0});
+    ExpectNear(Compute(builder.ReduceArgMin(Input("input", {2, 2, 3}), &options), 2,
+                       {{"input", input}}),
+               {0, 5});
+}
+
+DAWN_INSTANTIATE_TEST(ReduceTests, NullBackend());
@@ -0,0 +1,168 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+
+class Resample2dTests : public WebnnTest {
+  protected:
+    // Resamples the two consecutive |axes| of |input| to |outputSizes| on the host, with half
+    // pixel centers.
+    static std::vector<float> Reference(wgpu::InterpolationMode mode,
+                                        const std::vector<float>& input,
+                                        const std::vector<int32_t>& shape,
+                                        const std::vector<int32_t>& axes,
+                                        const std::vector<int32_t>& outputSizes) {
+        size_t outerSize = 1, innerSize = 1;
+        for (int32_t i = 0; i < axes[0]; ++i) {
+            outerSize *= shape[i];
+        }
+        for (size_t i = axes[1] + 1; i < shape.size(); ++i) {
+            innerSize *= shape[i];
+        }
+        const int32_t inputSizes[] = {shape[axes[0]], shape[axes[1]]};
+        // The two source indices of each output index along an axis, and the weight of the
+        // second one.
+        struct Source {
+            int32_t first;
+            int32_t second;
+            float weight;
+        };
+        std::vector<Source> sources[2];
+        for (int a = 0; a < 2; ++a) {
+            float scale = static_cast<float>(outputSizes[a]) / inputSizes[a];
+            for (int32_t o = 0; o < outputSizes[a]; ++o) {
+                float s = (o + 0.5f) / scale - 0.5f;
+                if (mode == wgpu::InterpolationMode::NearestNeighbor) {
+                    int32_t index = static_cast<int32_t>(std::floor(s + 0.5f));
+                    index = std::max(std::min(index, inputSizes[a] - 1), 0);
+                    sources[a].push_back({index, index, 0.0f});
+                } else {
+                    s = std::min(std::max(s, 0.0f), inputSizes[a] - 1.0f);
+                    int32_t index = static_cast<int32_t>(s);
+                    sources[a].push_back(
+                        {index, std::min(index + 1, inputSizes[a] - 1), s - index});
+                }
+            }
+        }
+
+        std::vector<float> output;
+        for (size_t outer = 0; outer < outerSize; ++outer) {
+            auto at = [&](int32_t h, int32_t w, size_t inner) {
+                return input[((outer * inputSizes[0] + h) * inputSizes[1] + w) * innerSize +
+                             inner];
+            };
+            for (const Source& row : sources[0]) {
+                for (const Source& column : sources[1]) {
+                    for (size_t inner = 0; inner < innerSize; ++inner) {
+                        float top = at(row.first, column.first, inner) * (1 - column.weight) +
+                                    at(row.first, column.second, inner) * column.weight;
+                        float bottom = at(row.second, column.first, inner) * (1 - column.weight) +
+                                       at(row.second, column.second, inner) * column.weight;
+                        output.push_back(top * (1 - row.weight) + bottom * row.weight);
+                    }
+                }
+            }
+        }
+        return output;
+    }
+
+    // Checks the resampling of a random input of |shape| to |outputSizes| against Reference(),
+    // with the output sizes given as they are or as |scales| when it isn't empty.
+    void Check(wgpu::InterpolationMode mode,
+               const std::vector<int32_t>& shape,
+               const std::vector<int32_t>& axes,
+               const std::vector<int32_t>& outputSizes,
+               const std::vector<float>& scales = {}) {
+        std::vector<float> input = RandomData(ElementCount(shape));
+        std::vector<float> expected = Reference(mode, input, shape, axes, outputSizes);
+        wgpu::Resample2dOptions options = {};
+        options.mode = mode;
+        options.axes = axes.data();
+        options.axesCount = 2;
+        if (scales.empty()) {
+            options.sizes = outputSizes.data();
+            options.sizesCount = 2;
+        } else {
+            options.scales = scales.data();
+            options.scalesCount = 2;
+        }
+        ExpectNear(Compute(builder.Resample2d(Input("input", shape), &options), expected.size(),
+                           {{"input", input}}),
+                   expected);
+    }
+
+    static constexpr wgpu::InterpolationMode kModes[] = {
+        wgpu::InterpolationMode::NearestNeighbor, wgpu::InterpolationMode::Linear};
+};
+
+// Test the resampling against values computed by hand.
+TEST_P(Resample2dTests, Simple) {
+    // [[1, 2], [3, 4]] upsampled by 2.
+    std::map<std::string, std::vector<float>> inputs = {{"input", {1, 2, 3, 4}}};
+    const float scales[] = {2.0f, 2.0f};
+    wgpu::Resample2dOptions options = {};
+    options.scales = scales;
+    options.scalesCount = 2;
+    ExpectNear(Compute(builder.Resample2d(Input("input", {1, 1, 2, 2}), &options), 16, inputs),
+               {1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4});
+    options.mode = wgpu::InterpolationMode::Linear;
+    ExpectNear(Compute(builder.Resample2d(Input("input", {1, 1, 2, 2}), &options), 16, inputs),
+               {1, 1.25, 1.75, 2, 1.5, 1.75, 2.25, 2.5, 2.5, 2.75, 3.25, 3.5, 3, 3.25, 3.75, 4});
+}
+
+// Test the upsampling and the downsampling by ratios that aren't integers, in rows long enough
+// to be computed with vectors.
+TEST_P(Resample2dTests, Sizes) {
+    for (wgpu::InterpolationMode mode : kModes) {
+        Check(mode, {2, 3, 7, 9}, {2, 3}, {16, 37});
+        Check(mode, {1, 4, 20, 33}, {2, 3}, {7, 10});
+        Check(mode, {1, 2, 5, 40}, {2, 3}, {11, 17});
+        Check(mode, {1, 1, 1, 1}, {2, 3}, {3, 5});
+    }
+}
+
+// Test the output sizes given by the scales, and that the sizes take precedence over them.
+TEST_P(Resample2dTests, Scales) {
+    for (wgpu::InterpolationMode mode : kModes) {
+        Check(mode, {1, 3, 6, 8}, {2, 3}, {12, 24}, {2.0f, 3.0f});
+        Check(mode, {1, 3, 6, 8}, {2, 3}, {3, 4}, {0.5f, 0.5f});
+
+        std::vector<float> input = RandomData(3 * 6 * 8);
+        const int32_t sizes[] = {9, 5};
+        const float scales[] = {2.0f, 2.0f};
+        wgpu::Resample2dOptions options = {};
+        options.mode = mode;
+        options.sizes = sizes;
+        options.sizesCount = 2;
+        options.scales = scales;
+        options.scalesCount = 2;
+        ExpectNear(Compute(builder.Resample2d(Input("input", {1, 3, 6, 8}), &options), 3 * 9 * 5,
+                           {{"input", input}}),
+                   Reference(mode, input, {1, 3, 6, 8}, {2, 3}, {9, 5}));
+    }
+}
+
+// Test the resampling of the other pairs of axes, the channels of NHWC being inner to them.
+TEST_P(Resample2dTests, Axes) {
+    for (wgpu::InterpolationMode mode : kModes) {
+        Check(mode, {2, 6, 5, 3}, {1, 2}, {13, 8});
+        Check(mode, {2, 6, 5, 17}, {1, 2}, {3, 4});
+        Check(mode, {4, 3, 2, 5}, {0, 1}, {9, 2});
+    }
+}
+
+DAWN_INSTANTIATE_TEST(Resample2dTests, NullBackend());
@@ -0,0 +1,160 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+
+class ReshapeConcatTests : public WebnnTest {
+  protected:
+    wgpu::Operand Reshape(const wgpu::Operand& input, const std::vector<int32_t>& newShape) {
+        return builder.Reshape(input, newShape.data(), newShape.size());
+    }
+
+    wgpu::Operand Concat(const std::vector<wgpu::Operand>& inputs, uint32_t axis) {
+        return builder.Concat(inputs.size(), inputs.data(), axis);
+    }
+
+    // Computes the float32 named |outputs| of the element counts |outputSizes| from |input|.
+    std::map<std::string, std::vector<float>> ComputeOutputs(
+        const std::map<std::string, wgpu::Operand>& outputs,
+        const std::map<std::string, size_t>& outputSizes,
+        const std::vector<float>& input) {
+        wgpu::Graph graph = Build(outputs);
+        EXPECT_NE(graph.Get(), nullptr);
+        if (graph.Get() == nullptr) {
+            return {};
+        }
+        std::map<std::string, std::vector<uint8_t>> outputBytes;
+        for (const auto& size : outputSizes) {
+            outputBytes[size.first].resize(size.second * sizeof(float));
+        }
+        Compute(graph, {{"input", ToBytes(input)}}, &outputBytes);
+        std::map<std::string, std::vector<float>> results;
+        for (const auto& output : outputBytes) {
+            results[output.first] = FromBytes<float>(output.second);
+        }
+        return results;
+    }
+
+    static std::vector<float> Relu(std::vector<float> data) {
+        for (float& value : data) {
+            value = std::max(value, 0.0f);
+        }
+        return data;
+    }
+
+    static std::vector<float> Join(std::vector<float> a, const std::vector<float>& b) {
+        a.insert(a.end(), b.begin(), b.end());
+        return a;
+    }
+};
+
+// Test Reshape views of intermediate operands, read by other operators and as outputs.
+TEST_P(ReshapeConcatTests, ReshapeViews) {
+    std::vector<float> input = RandomData(24);
+    wgpu::Operand relu = builder.Relu(Input("input", {4, 6}));
+    wgpu::Operand reshaped = Reshape(Reshape(relu, {2, 12}), {3, 8});
+    wgpu::Operand output = builder.Add(reshaped, Reshape(relu, {3, 8}));
+
+    std::vector<float> expected = Relu(input);
+    for (float& value : expected) {
+        value *= 2;
+    }
+    ExpectNear(Compute(output, 24, {{"input", input}}), expected);
+
+    // The reshaped operand and the operand it views are both outputs.
+    std::map<std::string, std::vector<float>> outputs = ComputeOutputs(
+        {{"relu", relu}, {"reshaped", reshaped}}, {{"relu", 24}, {"reshaped", 24}}, input);
+    ExpectNear(outputs["relu"], Relu(input));
+    ExpectNear(outputs["reshaped"], Relu(input));
+}
+
+// Test the Reshape of a graph input, and of a constant, as outputs.
+TEST_P(ReshapeConcatTests, ReshapeInputAndConstant) {
+    std::vector<float> input = RandomData(12);
+    std::vector<float> constant = RandomData(6);
+    std::map<std::string, std::vector<float>> outputs = ComputeOutputs(
+        {{"input", Reshape(Input("input", {3, 4}), {12})},
+         {"constant", builder.Add(Reshape(Constant({2, 3}, constant), {6}), Constant({1}, {0}))}},
+        {{"input", 12}, {"constant", 6}}, input);
+    ExpectNear(outputs["input"], input);
+    ExpectNear(outputs["constant"], constant);
+}
+
+// Test a Concat along the outermost axis, whose computed inputs are written in place in the
+// output, mixed with a graph input and a constant, which are copied.
+TEST_P(ReshapeConcatTests, ConcatInPlace) {
+    std::vector<float> input = RandomData(2 * 5);
+    std::vector<float> constant = RandomData(5);
+    wgpu::Operand x = Input("input", {2, 5});
+    wgpu::Operand concat = Concat({builder.Relu(x), x, Constant({1, 5}, constant),
+                                   builder.Sigmoid(builder.Relu(x))},
+                                  0);
+    std::vector<float> sigmoid = Relu(input);
+    for (float& value : sigmoid) {
+        value = 1.0f / (1.0f + std::exp(-value));
+    }
+    std::vector<float> expected = Join(Join(Join(Relu(input), input), constant), sigmoid);
+    ExpectNear(Compute(builder.Mul(concat, Constant({1}, {1})), expected.size(),
+                       {{"input", input}}),
+               expected);
+}
+
+// Test Concat inputs that are outputs of the graph as well, or read by another operator after
+// the Concat, and the same operand concatenated twice.
+TEST_P(ReshapeConcatTests, ConcatSharedInputs) {
+    std::vector<float> input = RandomData(3 * 4);
+    wgpu::Operand x = Input("input", {3, 4});
+    wgpu::Operand a = builder.Relu(x);
+    wgpu::Operand b = builder.Sigmoid(x);
+    wgpu::Operand concat = Concat({a, b, a}, 0);
+    wgpu::Operand later = builder.Add(b, Constant({1}, {1}));
+
+    std::vector<float> sigmoid(input.size());
+    std::transform(input.begin(), input.end(), sigmoid.begin(),
+                   [](float value) { return 1.0f / (1.0f + std::exp(-value)); });
+    std::vector<float> plusOne = sigmoid;
+    for (float& value : plusOne) {
+        value += 1;
+    }
+    std::map<std::string, std::vector<float>> outputs =
+        ComputeOutputs({{"concat", concat}, {"a", a}, {"later", later}},
+                       {{"concat", 36}, {"a", 12}, {"later", 12}}, input);
+    ExpectNear(outputs["concat"], Join(Join(Relu(input), sigmoid), Relu(input)));
+    ExpectNear(outputs["a"], Relu(input));
+    ExpectNear(outputs["later"], plusOne);
+}
+
+// Test a Concat along an inner axis, whose slices aren't contiguous, of nested Concat.
+TEST_P(ReshapeConcatTests, ConcatInnerAxis) {
+    std::vector<float> input = RandomData(2 * 3);
+    wgpu::Operand x = Input("input", {2, 3});
+    wgpu::Operand inner = Concat({builder.Relu(x), x}, 1);
+    wgpu::Operand output = Concat({inner, builder.Relu(inner)}, 0);
+
+    std::vector<float> relu = Relu(input);
+    std::vector<float> expectedInner;
+    for (size_t row = 0; row < 2; ++row) {
+        expectedInner.insert(expectedInner.end(), relu.begin() + row * 3,
+                             relu.begin() + row * 3 + 3);
+        expectedInner.insert(expectedInner.end(), input.begin() + row * 3,
+                             input.begin() + row * 3 + 3);
+    }
+    std::vector<float> expected = Join(expectedInner, Relu(expectedInner));
+    ExpectNear(Compute(output, expected.size(), {{"input", input}}), expected);
+}
+
+DAWN_INSTANTIATE_TEST(ReshapeConcatTests, NullBackend());
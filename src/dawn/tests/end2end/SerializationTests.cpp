@@ -0,0 +1,175 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "dawn/native/DawnNative.h"
+
+class SerializationTests : public WebnnTest {
+  protected:
+    void SetUp() override {
+        WebnnTest::SetUp();
+        mPath = testing::TempDir() + "webnn_serialization_test.bin";
+    }
+
+    void TearDown() override {
+        std::remove(mPath.c_str());
+        WebnnTest::TearDown();
+    }
+
+    // Expects the graph computing the named |outputs| from the float32 |inputs| to compute the
+    // same outputs once serialized and loaded. |outputSizes| gives the element count of each
+    // output.
+    void ExpectSameAfterLoading(const std::map<std::string, wgpu::Operand>& outputs,
+                                const std::map<std::string, size_t>& outputSizes,
+                                const std::map<std::string, std::vector<float>>& inputs) {
+        wgpu::NamedOperands namedOperands = builder.CreateNamedOperands();
+        for (const auto& output : outputs) {
+            namedOperands.Set(output.first.c_str(), output.second);
+        }
+        ASSERT_TRUE(dawn::native::SerializeGraph(builder.Get(), namedOperands.Get(),
+                                                 mPath.c_str()));
+        wgpu::Graph graph = builder.Build(namedOperands);
+        ASSERT_NE(graph.Get(), nullptr);
+        wgpu::Graph loadedGraph =
+            wgpu::Graph::Acquire(dawn::native::LoadGraph(device.Get(), mPath.c_str()));
+        ASSERT_NE(loadedGraph.Get(), nullptr);
+
+        std::map<std::string, std::vector<uint8_t>> inputBytes;
+        for (const auto& input : inputs) {
+            inputBytes[input.first] = ToBytes(input.second);
+        }
+        std::map<std::string, std::vector<uint8_t>> expected;
+        for (const auto& size : outputSizes) {
+            expected[size.first].resize(size.second * sizeof(float));
+        }
+        std::map<std::string, std::vector<uint8_t>> actual = expected;
+        Compute(graph, inputBytes, &expected);
+        Compute(loadedGraph, inputBytes, &actual);
+        for (const auto& output : expected) {
+            SCOPED_TRACE(output.first);
+            ExpectNear(FromBytes<float>(actual[output.first]), FromBytes<float>(output.second));
+        }
+    }
+
+    std::string mPath;
+};
+
+// Test a convolutional network, whose operators are fused before they are serialized.
+TEST_P(SerializationTests, ConvolutionalNetwork) {
+    const int32_t padding[] = {1, 1, 1, 1};
+    wgpu::Conv2dOptions convOptions = {};
+    convOptions.padding = padding;
+    convOptions.paddingCount = 4;
+    wgpu::Operand conv = builder.Conv2d(Input("input", {1, 3, 8, 8}),
+                                        Constant({4, 3, 3, 3}, RandomData(108)), &convOptions);
+    conv = builder.Relu(builder.Add(conv, Constant({1, 4, 1, 1}, RandomData(4))));
+
+    const int32_t windowDimensions[] = {2, 2};
+    const int32_t strides[] = {2, 2};
+    wgpu::Pool2dOptions poolOptions = {};
+    poolOptions.windowDimensions = windowDimensions;
+    poolOptions.windowDimensionsCount = 2;
+    poolOptions.strides = strides;
+    poolOptions.stridesCount = 2;
+    wgpu::Operand pool = builder.MaxPool2d(conv, &poolOptions);
+
+    const int32_t newShape[] = {1, 64};
+    wgpu::GemmOptions gemmOptions = {};
+    gemmOptions.c = Constant({10}, RandomData(10));
+    gemmOptions.alpha = 0.5f;
+    wgpu::Operand gemm = builder.Gemm(builder.Reshape(pool, newShape, 2),
+                                      Constant({64, 10}, RandomData(640)), &gemmOptions);
+    ExpectSameAfterLoading({{"output", builder.Softmax(gemm)}}, {{"output", 10}},
+                           {{"input", RandomData(3 * 8 * 8)}});
+}
+
+// Test operators with attributes of every kind, and several outputs.
+TEST_P(SerializationTests, Attributes) {
+    wgpu::Operand input = Input("input", {1, 4, 6, 6});
+
+    wgpu::TransposeOptions transposeOptions = {};
+    const int32_t permutation[] = {0, 1, 3, 2};
+    transposeOptions.permutation = permutation;
+    transposeOptions.permutationCount = 4;
+    wgpu::Operand transposed = builder.Transpose(input, &transposeOptions);
+
+    const int32_t starts[] = {1, 0};
+    const int32_t sizes[] = {4, 5};
+    const int32_t sliceAxes[] = {2, 3};
+    wgpu::SliceOptions sliceOptions = {};
+    sliceOptions.axes = sliceAxes;
+    sliceOptions.axesCount = 2;
+    wgpu::Operand sliced = builder.Slice(transposed, starts, 2, sizes, 2, &sliceOptions);
+
+    const uint32_t padding[] = {0, 0, 0, 0, 1, 1, 2, 0};
+    wgpu::PadOptions padOptions = {};
+    padOptions.mode = wgpu::PaddingMode::Reflection;
+    wgpu::Operand padded = builder.Pad(sliced, padding, 8, &padOptions);
+
+    const float scales[] = {2.0f, 1.5f};
+    wgpu::Resample2dOptions resampleOptions = {};
+    resampleOptions.mode = wgpu::InterpolationMode::Linear;
+    resampleOptions.scales = scales;
+    resampleOptions.scalesCount = 2;
+    wgpu::Operand resampled = builder.Resample2d(padded, &resampleOptions);
+
+    const uint32_t splits[] = {1, 3};
+    wgpu::SplitOptions splitOptions = {};
+    splitOptions.axis = 1;
+    wgpu::OperandArray split = builder.Split(resampled, splits, 2, &splitOptions);
+
+    const int32_t reduceAxes[] = {2};
+    wgpu::ReduceOptions reduceOptions = {};
+    reduceOptions.axes = reduceAxes;
+    reduceOptions.axesCount = 1;
+    reduceOptions.keepDimensions = true;
+    wgpu::Operand reduced = builder.ReduceMean(split.GetOperand(1), &reduceOptions);
+
+    wgpu::InstanceNormOptions normOptions = {};
+    normOptions.scale = Constant({1}, {1.5f});
+    normOptions.bias = Constant({1}, {-0.5f});
+    wgpu::Operand normalized = builder.InstanceNorm(split.GetOperand(0), &normOptions);
+
+    wgpu::ClampOptions clampOptions = {};
+    clampOptions.minValue = -0.25f;
+    clampOptions.maxValue = 0.75f;
+    wgpu::Operand clamped = builder.Clamp(normalized, &clampOptions);
+
+    // The padded operand is [1, 4, 6, 7], resampled to [1, 4, 12, 10] and split in
+    // [1, 1, 12, 10] and [1, 3, 12, 10].
+    ExpectSameAfterLoading({{"reduced", reduced}, {"clamped", clamped}},
+                           {{"reduced", 3 * 10}, {"clamped", 12 * 10}},
+                           {{"input", RandomData(4 * 6 * 6)}});
+}
+
+// Test that loading a file that isn't a serialized graph fails.
+TEST_P(SerializationTests, InvalidFile) {
+    {
+        std::ofstream file(mPath, std::ios::binary);
+        file << "not a graph";
+    }
+    wgpu::Graph graph;
+    ASSERT_DEVICE_ERROR(
+        graph = wgpu::Graph::Acquire(dawn::native::LoadGraph(device.Get(), mPath.c_str())));
+
+    std::remove(mPath.c_str());
+    ASSERT_DEVICE_ERROR(
+        graph = wgpu::Graph::Acquire(dawn::native::LoadGraph(device.Get(), mPath.c_str())));
+}
+
+DAWN_INSTANTIATE_TEST(SerializationTests, NullBackend());
@@ -0,0 +1,125 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <string>
+
+class SliceSplitTests : public WebnnTest {
+  protected:
+    // The [begin, begin + size) ranges of |starts| and |sizes| of the [d0, d1, d2] |data|.
+    static std::vector<float> SliceData(const std::vector<float>& data,
+                                        const std::vector<int32_t>& shape,
+                                        const std::vector<int32_t>& starts,
+                                        const std::vector<int32_t>& sizes) {
+        std::vector<float> result;
+        for (int32_t i = starts[0]; i < starts[0] + sizes[0]; ++i) {
+            for (int32_t j = starts[1]; j < starts[1] + sizes[1]; ++j) {
+                for (int32_t k = starts[2]; k < starts[2] + sizes[2]; ++k) {
+                    result.push_back(data[(i * shape[1] + j) * shape[2] + k]);
+                }
+            }
+        }
+        return result;
+    }
+};
+
+// Test Slice along all the dimensions and along some axes, with negative starts and axes and a
+// size of -1.
+TEST_P(SliceSplitTests, Slice) {
+    const std::vector<int32_t> shape = {4, 5, 6};
+    std::vector<float> input = RandomData(4 * 5 * 6);
+
+    const int32_t starts[] = {1, 0, 2};
+    const int32_t sizes[] = {2, 5, 3};
+    wgpu::Operand output = builder.Slice(Input("input", shape), starts, 3, sizes, 3);
+    ExpectNear(Compute(output, 2 * 5 * 3, {{"input", input}}),
+               SliceData(input, shape, {1, 0, 2}, {2, 5, 3}));
+
+    const int32_t axes[] = {-1, 1};
+    const int32_t axisStarts[] = {-4, 3};
+    const int32_t axisSizes[] = {-1, 1};
+    wgpu::SliceOptions options = {};
+    options.axes = axes;
+    options.axesCount = 2;
+    output = builder.Slice(Input("input", shape), axisStarts, 2, axisSizes, 2, &options);
+    ExpectNear(Compute(output, 4 * 1 * 4, {{"input", input}}),
+               SliceData(input, shape, {0, 3, 2}, {4, 1, 4}));
+}
+
+// Test Split in outputs of the same size and of given sizes, along inner and outer axes.
+TEST_P(SliceSplitTests, Split) {
+    const std::vector<int32_t> shape = {2, 6, 3};
+    std::vector<float> input = RandomData(2 * 6 * 3);
+
+    const uint32_t count[] = {3};
+    wgpu::SplitOptions options = {};
+    options.axis = 1;
+    wgpu::OperandArray outputs = builder.Split(Input("input", shape), count, 1, &options);
+    ASSERT_EQ(outputs.Size(), 3u);
+    std::map<std::string, wgpu::Operand> namedOutputs;
+    std::map<std::string, std::vector<uint8_t>> results;
+    for (uint32_t i = 0; i < 3; ++i) {
+        namedOutputs["output" + std::to_string(i)] = outputs.GetOperand(i);
+        results["output" + std::to_string(i)].resize(2 * 2 * 3 * sizeof(float));
+    }
+    wgpu::Graph graph = Build(namedOutputs);
+    ASSERT_NE(graph.Get(), nullptr);
+    Compute(graph, {{"input", ToBytes(input)}}, &results);
+    for (int32_t i = 0; i < 3; ++i) {
+        ExpectNear(FromBytes<float>(results["output" + std::to_string(i)]),
+                   SliceData(input, shape, {0, 2 * i, 0}, {2, 2, 3}));
+    }
+
+    const uint32_t sizes[] = {1, 2};
+    options.axis = -1;
+    outputs = builder.Split(Input("input", shape), sizes, 2, &options);
+    ASSERT_EQ(outputs.Size(), 2u);
+    graph = Build({{"first", outputs.GetOperand(0)}, {"second", outputs.GetOperand(1)}});
+    ASSERT_NE(graph.Get(), nullptr);
+    results.clear();
+    results["first"].resize(2 * 6 * 1 * sizeof(float));
+    results["second"].resize(2 * 6 * 2 * sizeof(float));
+    Compute(graph, {{"input", ToBytes(input)}}, &results);
+    ExpectNear(FromBytes<float>(results["first"]), SliceData(input, shape, {0, 0, 0}, {2, 6, 1}));
+    ExpectNear(FromBytes<float>(results["second"]),
+               SliceData(input, shape, {0, 0, 1}, {2, 6, 2}));
+}
+
+// Test Squeeze of all the dimensions of size 1 and of some axes, which views its input.
+TEST_P(SliceSplitTests, Squeeze) {
+    std::vector<float> input = RandomData(3 * 4);
+    wgpu::Operand output = builder.Squeeze(builder.Relu(Input("input", {1, 3, 1, 4, 1})));
+    std::vector<float> expected = input;
+    for (float& value : expected) {
+        value = std::max(value, 0.0f);
+    }
+    ExpectNear(Compute(output, 12, {{"input", input}}), expected);
+
+    const int32_t axes[] = {0, 4};
+    wgpu::SqueezeOptions options = {};
+    options.axes = axes;
+    options.axesCount = 2;
+    wgpu::Operand squeezed = builder.Squeeze(Input("input", {1, 3, 1, 4, 1}), &options);
+    // The squeezed shape is [3, 1, 4], a [1, 4] constant broadcasts to it.
+    std::vector<float> constant = RandomData(4);
+    output = builder.Add(squeezed, Constant({1, 4}, constant));
+    for (size_t i = 0; i < 12; ++i) {
+        expected[i] = input[i] + constant[i % 4];
+    }
+    ExpectNear(Compute(output, 12, {{"input", input}}), expected);
+}
+
+DAWN_INSTANTIATE_TEST(SliceSplitTests, NullBackend());
@@ -0,0 +1,61 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+class TransposeTests : public WebnnTest {
+  protected:
+    wgpu::Operand Transpose(const wgpu::Operand& input, const std::vector<int32_t>& permutation) {
+        wgpu::TransposeOptions options = {};
+        options.permutation = permutation.data();
+        options.permutationCount = permutation.size();
+        return builder.Transpose(input, &options);
+    }
+};
+
+// Test the transposes against values computed by hand, the dimensions being reversed without
+// a permutation.
+TEST_P(TransposeTests, Simple) {
+    std::map<std::string, std::vector<float>> inputs = {{"input", {1, 2, 3, 4, 5, 6}}};
+    ExpectNear(Compute(builder.Transpose(Input("input", {2, 3})), 6, inputs), {1, 4, 2, 5, 3, 6});
+    // [1, 2, 3] to [3, 1, 2].
+    ExpectNear(Compute(Transpose(Input("input", {1, 2, 3}), {2, 0, 1}), 6, inputs),
+               {1, 4, 2, 5, 3, 6});
+    // [2, 1, 3] to [2, 3, 1], the dimension of size 1 doesn't move the values.
+    ExpectNear(Compute(Transpose(Input("input", {2, 1, 3}), {0, 2, 1}), 6, inputs),
+               {1, 2, 3, 4, 5, 6});
+}
+
+// Test an NCHW image transposed to NHWC and back, against values computed on the host.
+TEST_P(TransposeTests, Layouts) {
+    const int32_t channels = 19, height = 13, width = 21;
+    std::vector<float> input = RandomData(channels * height * width);
+    std::vector<float> expected(input.size());
+    for (int32_t c = 0; c < channels; ++c) {
+        for (int32_t i = 0; i < height * width; ++i) {
+            expected[i * channels + c] = input[c * height * width + i];
+        }
+    }
+    wgpu::Operand nhwc = Transpose(Input("input", {2, channels, height, width}), {0, 2, 3, 1});
+    std::vector<float> batches = input;
+    batches.insert(batches.end(), input.begin(), input.end());
+    std::vector<float> output = Compute(nhwc, batches.size(), {{"input", batches}});
+    ExpectNear(std::vector<float>(output.begin(), output.begin() + input.size()), expected);
+    ExpectNear(std::vector<float>(output.begin() + input.size(), output.end()), expected);
+
+    wgpu::Operand nchw = Transpose(Input("input", {1, height, width, channels}), {0, 3, 1, 2});
+    ExpectNear(Compute(nchw, input.size(), {{"input", expected}}), input);
+}
+
+DAWN_INSTANTIATE_TEST(TransposeTests, NullBackend());
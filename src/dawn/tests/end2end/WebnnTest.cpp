@@ -0,0 +1,181 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/end2end/WebnnTest.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "dawn/common/Math.h"
+
+void WebnnTest::SetUp() {
+    DawnTest::SetUp();
+    mRandom.seed(1);
+    builder = device.CreateGraphBuilder();
+}
+
+// static
+size_t WebnnTest::ElementCount(const std::vector<int32_t>& shape) {
+    size_t count = 1;
+    for (int32_t dimension : shape) {
+        count *= dimension;
+    }
+    return count;
+}
+
+std::vector<float> WebnnTest::RandomData(size_t count, float min, float max) {
+    std::uniform_real_distribution<float> distribution(min, max);
+    std::vector<float> data(count);
+    for (float& value : data) {
+        value = distribution(mRandom);
+    }
+    return data;
+}
+
+// static
+size_t WebnnTest::BufferSize(size_t size) {
+    // The size of a buffer and of its mapped ranges must be a multiple of 4.
+    return Align(std::max(size, size_t(4)), 4);
+}
+
+wgpu::Buffer WebnnTest::CreateBuffer(size_t size, wgpu::BufferUsage usage, const void* data) {
+    wgpu::BufferDescriptor desc = {};
+    desc.size = BufferSize(size);
+    desc.usage = usage;
+    desc.mappedAtCreation = data != nullptr;
+    wgpu::Buffer buffer = device.CreateBuffer(&desc);
+    if (data != nullptr) {
+        memcpy(buffer.GetMappedRange(0, desc.size), data, size);
+        buffer.Unmap();
+    }
+    return buffer;
+}
+
+void WebnnTest::MapAsyncAndWait(const wgpu::Buffer& buffer, wgpu::MapMode mode, size_t size) {
+    bool done = false;
+    buffer.MapAsync(
+        mode, 0, size,
+        [](WGPUBufferMapAsyncStatus status, void* userdata) {
+            ASSERT_EQ(WGPUBufferMapAsyncStatus_Success, status);
+            *static_cast<bool*>(userdata) = true;
+        },
+        &done);
+    while (!done) {
+        WaitABit();
+    }
+}
+
+wgpu::Operand WebnnTest::Input(const char* name,
+                               const std::vector<int32_t>& shape,
+                               wgpu::OperandType type) {
+    wgpu::OperandDescriptor desc = {type, shape.data(), static_cast<uint32_t>(shape.size())};
+    return builder.Input(name, &desc);
+}
+
+wgpu::Operand WebnnTest::Constant(const std::vector<int32_t>& shape,
+                                  const std::vector<float>& data) {
+    return Constant(shape, wgpu::OperandType::Float32, data.data(), data.size() * sizeof(float));
+}
+
+wgpu::Operand WebnnTest::Constant(const std::vector<int32_t>& shape,
+                                  wgpu::OperandType type,
+                                  const void* data,
+                                  size_t byteSize) {
+    wgpu::OperandDescriptor desc = {type, shape.data(), static_cast<uint32_t>(shape.size())};
+    wgpu::BufferResourceView view = {};
+    view.resource =
+        CreateBuffer(byteSize, wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc, data);
+    view.size = byteSize;
+    return builder.Constant(&desc, &view);
+}
+
+wgpu::Graph WebnnTest::Build(const std::map<std::string, wgpu::Operand>& outputs) {
+    wgpu::NamedOperands namedOperands = builder.CreateNamedOperands();
+    for (const auto& output : outputs) {
+        namedOperands.Set(output.first.c_str(), output.second);
+    }
+    return builder.Build(namedOperands);
+}
+
+void WebnnTest::Compute(const wgpu::Graph& graph,
+                        const std::map<std::string, std::vector<uint8_t>>& inputs,
+                        std::map<std::string, std::vector<uint8_t>>* outputs) {
+    // The named resources don't keep the buffers alive.
+    std::vector<wgpu::Buffer> inputBuffers;
+    wgpu::NamedResources namedInputs = graph.CreateNamedResources();
+    for (const auto& input : inputs) {
+        wgpu::BufferResourceView view = {};
+        view.resource = CreateBuffer(input.second.size(),
+                                     wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc,
+                                     input.second.data());
+        view.size = input.second.size();
+        namedInputs.Set(input.first.c_str(), &view);
+        inputBuffers.push_back(view.resource);
+    }
+
+    wgpu::NamedResources namedOutputs = graph.CreateNamedResources();
+    std::vector<wgpu::Buffer> outputBuffers;
+    for (const auto& output : *outputs) {
+        wgpu::BufferResourceView view = {};
+        view.resource = CreateBuffer(output.second.size(),
+                                     wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst,
+                                     nullptr);
+        view.size = output.second.size();
+        namedOutputs.Set(output.first.c_str(), &view);
+        outputBuffers.push_back(view.resource);
+    }
+
+    graph.Compute(namedInputs, namedOutputs);
+
+    auto buffer = outputBuffers.begin();
+    for (auto& output : *outputs) {
+        size_t size = BufferSize(output.second.size());
+        MapAsyncAndWait(*buffer, wgpu::MapMode::Read, size);
+        memcpy(output.second.data(), buffer->GetConstMappedRange(0, size), output.second.size());
+        buffer->Unmap();
+        ++buffer;
+    }
+}
+
+std::vector<float> WebnnTest::Compute(const wgpu::Operand& output,
+                                      size_t outputCount,
+                                      const std::map<std::string, std::vector<float>>& inputs) {
+    wgpu::Graph graph = Build({{"output", output}});
+    EXPECT_NE(graph.Get(), nullptr);
+    if (graph.Get() == nullptr) {
+        return {};
+    }
+    std::map<std::string, std::vector<uint8_t>> inputBytes;
+    for (const auto& input : inputs) {
+        inputBytes[input.first] = ToBytes(input.second);
+    }
+    std::map<std::string, std::vector<uint8_t>> outputs;
+    outputs["output"].resize(outputCount * sizeof(float));
+    Compute(graph, inputBytes, &outputs);
+    return FromBytes<float>(outputs["output"]);
+}
+
+void WebnnTest::ExpectNear(const std::vector<float>& actual,
+                           const std::vector<float>& expected,
+                           float tolerance) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        float bound = tolerance * std::max(1.0f, std::abs(expected[i]));
+        if (std::isnan(expected[i])) {
+            EXPECT_TRUE(std::isnan(actual[i])) << "at index " << i;
+        } else {
+            ASSERT_NEAR(actual[i], expected[i], bound) << "at index " << i;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TESTS_END2END_WEBNNTEST_H_
+#define TESTS_END2END_WEBNNTEST_H_
+
+#include "dawn/tests/DawnTest.h"
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// The base of the tests of WebNN graphs, which compare the outputs computed by the graph
+// backend of the device to reference outputs.
+class WebnnTest : public DawnTest {
+  protected:
+    void SetUp() override;
+
+    static size_t ElementCount(const std::vector<int32_t>& shape);
+    // |count| values drawn uniformly from [min, max], the same ones for every run.
+    std::vector<float> RandomData(size_t count, float min = -1.0f, float max = 1.0f);
+
+    wgpu::Operand Input(const char* name,
+                        const std::vector<int32_t>& shape,
+                        wgpu::OperandType type = wgpu::OperandType::Float32);
+    wgpu::Operand Constant(const std::vector<int32_t>& shape, const std::vector<float>& data);
+    // A constant of |type| made of the |byteSize| bytes of |data|.
+    wgpu::Operand Constant(const std::vector<int32_t>& shape,
+                           wgpu::OperandType type,
+                           const void* data,
+                           size_t byteSize);
+
+    wgpu::Graph Build(const std::map<std::string, wgpu::Operand>& outputs);
+    // Computes |graph| with the bytes of |inputs| and reads back |outputs|, which are resized
+    // by the caller to the size of each output.
+    void Compute(const wgpu::Graph& graph,
+                 const std::map<std::string, std::vector<uint8_t>>& inputs,
+                 std::map<std::string, std::vector<uint8_t>>* outputs);
+
+    // Builds the float32 |output| and computes it with the float32 |inputs|.
+    std::vector<float> Compute(const wgpu::Operand& output,
+                               size_t outputCount,
+                               const std::map<std::string, std::vector<float>>& inputs = {});
+
+    // Expects every element of |actual| to be within |tolerance| of |expected|, relative to
+    // the magnitude of |expected| above 1.
+    void ExpectNear(const std::vector<float>& actual,
+                    const std::vector<float>& expected,
+                    float tolerance = 1e-5f);
+
+    template <typename T>
+    static std::vector<uint8_t> ToBytes(const std::vector<T>& data) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data.data());
+        return std::vector<uint8_t>(bytes, bytes + data.size() * sizeof(T));
+    }
+    template <typename T>
+    static std::vector<T> FromBytes(const std::vector<uint8_t>& bytes) {
+        std::vector<T> data(bytes.size() / sizeof(T));
+        memcpy(data.data(), bytes.data(), data.size() * sizeof(T));
+        return data;
+    }
+
+    // The size of a buffer holding |size| bytes.
+    static size_t BufferSize(size_t size);
+    // A buffer of |size| bytes initialized with |data| unless it is null.
+    wgpu::Buffer CreateBuffer(size_t size, wgpu::BufferUsage usage, const void* data);
+    void MapAsyncAndWait(const wgpu::Buffer& buffer, wgpu::MapMode mode, size_t size);
+
+    wgpu::GraphBuilder builder;
+
+  private:
+    std::mt19937 mRandom;
+};
+
+#endif  // TESTS_END2END_WEBNNTEST_H_
@@ -0,0 +1,469 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace {
+
+    constexpr unsigned int kNumIterations = 10;
+
+    enum class Workload {
+        Conv2d3x3,
+        Conv2d1x1,
+        DepthwiseConv2d,
+        Gemm,
+        MaxPool2d,
+        AveragePool2d,
+        ReduceMean,
+        Resample2d,
+        ElementwiseChain,
+        // The canonical graphs built from the operators above.
+        MobileNet,
+        Mlp,
+    };
+
+    // Every workload scales its shapes with the size, see the builders of WebnnPerf.
+    enum class WorkloadSize {
+        Small,
+        Medium,
+        Large,
+    };
+
+    struct WebnnParams : AdapterTestParam {
+        WebnnParams(const AdapterTestParam& param, Workload workload, WorkloadSize size)
+            : AdapterTestParam(param), workload(workload), size(size) {
+        }
+
+        Workload workload;
+        WorkloadSize size;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const WebnnParams& param) {
+        ostream << static_cast<const AdapterTestParam&>(param);
+
+        switch (param.workload) {
+            case Workload::Conv2d3x3:
+                ostream << "_Conv2d3x3";
+                break;
+            case Workload::Conv2d1x1:
+                ostream << "_Conv2d1x1";
+                break;
+            case Workload::DepthwiseConv2d:
+                ostream << "_DepthwiseConv2d";
+                break;
+            case Workload::Gemm:
+                ostream << "_Gemm";
+                break;
+            case Workload::MaxPool2d:
+                ostream << "_MaxPool2d";
+                break;
+            case Workload::AveragePool2d:
+                ostream << "_AveragePool2d";
+                break;
+            case Workload::ReduceMean:
+                ostream << "_ReduceMean";
+                break;
+            case Workload::Resample2d:
+                ostream << "_Resample2d";
+                break;
+            case Workload::ElementwiseChain:
+                ostream << "_ElementwiseChain";
+                break;
+            case Workload::MobileNet:
+                ostream << "_MobileNet";
+                break;
+            case Workload::Mlp:
+                ostream << "_Mlp";
+                break;
+        }
+
+        switch (param.size) {
+            case WorkloadSize::Small:
+                ostream << "_Small";
+                break;
+            case WorkloadSize::Medium:
+                ostream << "_Medium";
+                break;
+            case WorkloadSize::Large:
+                ostream << "_Large";
+                break;
+        }
+
+        return ostream;
+    }
+
+    // Picks the value of |size| in {small, medium, large}.
+    int32_t Pick(WorkloadSize size, int32_t small, int32_t medium, int32_t large) {
+        switch (size) {
+            case WorkloadSize::Small:
+                return small;
+            case WorkloadSize::Medium:
+                return medium;
+            case WorkloadSize::Large:
+                return large;
+        }
+        return small;
+    }
+
+    size_t GetElementCount(const std::vector<int32_t>& shape) {
+        size_t count = 1;
+        for (int32_t dimension : shape) {
+            count *= static_cast<size_t>(dimension);
+        }
+        return count;
+    }
+
+}  // namespace
+
+// Builds a graph of the workload of the parameters and computes it |kNumIterations| times per
+// step. The graphs run on the host whatever the backend, so only the Null backend is used. Besides
+// the time per computation, the test reports the GFLOP/s of the computations and the time of every
+// operator from the profile of the graph.
+class WebnnPerf : public DawnTestWithParams<WebnnParams>, public DawnPerfTestBase {
+  public:
+    WebnnPerf() : DawnTestWithParams(), DawnPerfTestBase(this, kNumIterations, 1) {
+    }
+    ~WebnnPerf() override = default;
+
+    void SetUp() override;
+
+  protected:
+    // Prints the GFLOP/s of the steps and the average time of every operator.
+    void PrintOperatorResults();
+
+  private:
+    void Step() override;
+
+    wgpu::Operand Input(const char* name, const std::vector<int32_t>& shape);
+    wgpu::Operand Constant(const std::vector<int32_t>& shape);
+    // activation(conv2d(input, filter) + bias), with the padding of a "same" convolution.
+    wgpu::Operand Conv2d(const wgpu::Operand& input,
+                         int32_t inputChannels,
+                         int32_t outputChannels,
+                         int32_t filterSize,
+                         int32_t stride,
+                         int32_t groups,
+                         const wgpu::FusionOperator& activation);
+    wgpu::Operand Dense(const wgpu::Operand& input,
+                        int32_t inputSize,
+                        int32_t outputSize,
+                        const wgpu::FusionOperator& activation);
+    // The inverted residual block of MobileNetV2.
+    wgpu::Operand InvertedResidual(const wgpu::Operand& input,
+                                   int32_t inputChannels,
+                                   int32_t outputChannels,
+                                   int32_t stride);
+    wgpu::Operand BuildWorkload();
+    wgpu::Buffer CreateBuffer(uint64_t size, wgpu::BufferUsage usage, bool randomData);
+
+    wgpu::GraphBuilder mBuilder;
+    wgpu::Graph mGraph;
+    // The inputs are set on the resources of the graph once it is built.
+    std::vector<std::pair<std::string, wgpu::BufferResourceView>> mInputViews;
+    wgpu::NamedResources mInputs;
+    wgpu::NamedResources mOutputs;
+    // The buffers of the inputs, the constants and the output.
+    std::vector<wgpu::Buffer> mBuffers;
+    uint64_t mLargestBufferSize = 0;
+    std::mt19937 mRandom;
+    // The arithmetic operations of a computation, from the profile of the graph.
+    uint64_t mOperationCount = 0;
+    uint64_t mComputeCount = 0;
+    double mComputeSeconds = 0;
+};
+
+wgpu::Buffer WebnnPerf::CreateBuffer(uint64_t size, wgpu::BufferUsage usage, bool randomData) {
+    wgpu::BufferDescriptor desc = {};
+    desc.size = size;
+    desc.usage = usage;
+    desc.mappedAtCreation = randomData;
+    wgpu::Buffer buffer = device.CreateBuffer(&desc);
+    if (randomData) {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        float* data = static_cast<float*>(buffer.GetMappedRange(0, size));
+        for (size_t i = 0; i < size / sizeof(float); ++i) {
+            data[i] = distribution(mRandom);
+        }
+        buffer.Unmap();
+    }
+    mBuffers.push_back(buffer);
+    mLargestBufferSize = std::max(mLargestBufferSize, size);
+    return buffer;
+}
+
+wgpu::Operand WebnnPerf::Input(const char* name, const std::vector<int32_t>& shape) {
+    wgpu::OperandDescriptor desc = {wgpu::OperandType::Float32, shape.data(),
+                                    static_cast<uint32_t>(shape.size())};
+    uint64_t size = GetElementCount(shape) * sizeof(float);
+    wgpu::BufferResourceView view = {};
+    view.resource = CreateBuffer(size, wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc,
+                                 true);
+    view.size = size;
+    mInputViews.push_back(std::make_pair(std::string(name), view));
+    return mBuilder.Input(name, &desc);
+}
+
+wgpu::Operand WebnnPerf::Constant(const std::vector<int32_t>& shape) {
+    wgpu::OperandDescriptor desc = {wgpu::OperandType::Float32, shape.data(),
+                                    static_cast<uint32_t>(shape.size())};
+    uint64_t size = GetElementCount(shape) * sizeof(float);
+    wgpu::BufferResourceView view = {};
+    view.resource = CreateBuffer(size, wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc,
+                                 true);
+    view.size = size;
+    return mBuilder.Constant(&desc, &view);
+}
+
+wgpu::Operand WebnnPerf::Conv2d(const wgpu::Operand& input,
+                                int32_t inputChannels,
+                                int32_t outputChannels,
+                                int32_t filterSize,
+                                int32_t stride,
+                                int32_t groups,
+                                const wgpu::FusionOperator& activation) {
+    std::vector<int32_t> strides = {stride, stride};
+    wgpu::Conv2dOptions options = {};
+    options.strides = strides.data();
+    options.stridesCount = strides.size();
+    options.autoPad = wgpu::AutoPad::SameUpper;
+    options.groups = groups;
+    options.bias = Constant({outputChannels});
+    options.activation = activation;
+    return mBuilder.Conv2d(
+        input, Constant({outputChannels, inputChannels / groups, filterSize, filterSize}),
+        &options);
+}
+
+wgpu::Operand WebnnPerf::Dense(const wgpu::Operand& input,
+                               int32_t inputSize,
+                               int32_t outputSize,
+                               const wgpu::FusionOperator& activation) {
+    wgpu::GemmOptions options = {};
+    options.c = Constant({outputSize});
+    options.activation = activation;
+    return mBuilder.Gemm(input, Constant({inputSize, outputSize}), &options);
+}
+
+wgpu::Operand WebnnPerf::InvertedResidual(const wgpu::Operand& input,
+                                          int32_t inputChannels,
+                                          int32_t outputChannels,
+                                          int32_t stride) {
+    constexpr int32_t kExpansion = 6;
+    wgpu::ClampOptions relu6 = {};
+    relu6.minValue = 0;
+    relu6.maxValue = 6;
+    int32_t expanded = inputChannels * kExpansion;
+    wgpu::Operand x = Conv2d(input, inputChannels, expanded, 1, 1, 1,
+                             mBuilder.ClampOperator(&relu6));
+    x = Conv2d(x, expanded, expanded, 3, stride, expanded, mBuilder.ClampOperator(&relu6));
+    x = Conv2d(x, expanded, outputChannels, 1, 1, 1, nullptr);
+    if (stride == 1 && inputChannels == outputChannels) {
+        x = mBuilder.Add(x, input);
+    }
+    return x;
+}
+
+wgpu::Operand WebnnPerf::BuildWorkload() {
+    WorkloadSize size = GetParam().size;
+    switch (GetParam().workload) {
+        case Workload::Conv2d3x3:
+        case Workload::Conv2d1x1:
+        case Workload::DepthwiseConv2d: {
+            int32_t channels = Pick(size, 32, 64, 256);
+            int32_t spatial = Pick(size, 56, 56, 14);
+            wgpu::Operand input = Input("input", {1, channels, spatial, spatial});
+            if (GetParam().workload == Workload::DepthwiseConv2d) {
+                return Conv2d(input, channels, channels, 3, 1, channels,
+                              mBuilder.ReluOperator());
+            }
+            int32_t filterSize = GetParam().workload == Workload::Conv2d3x3 ? 3 : 1;
+            return Conv2d(input, channels, channels, filterSize, 1, 1, mBuilder.ReluOperator());
+        }
+        case Workload::Gemm: {
+            int32_t n = Pick(size, 64, 256, 1024);
+            return mBuilder.Gemm(Input("input", {n, n}), Constant({n, n}));
+        }
+        case Workload::MaxPool2d:
+        case Workload::AveragePool2d: {
+            int32_t channels = Pick(size, 32, 64, 128);
+            int32_t spatial = Pick(size, 56, 112, 112);
+            std::vector<int32_t> window = {3, 3};
+            std::vector<int32_t> strides = {2, 2};
+            wgpu::Pool2dOptions options = {};
+            options.windowDimensions = window.data();
+            options.windowDimensionsCount = window.size();
+            options.strides = strides.data();
+            options.stridesCount = strides.size();
+            options.autoPad = wgpu::AutoPad::SameUpper;
+            wgpu::Operand input = Input("input", {1, channels, spatial, spatial});
+            return GetParam().workload == Workload::MaxPool2d
+                       ? mBuilder.MaxPool2d(input, &options)
+                       : mBuilder.AveragePool2d(input, &options);
+        }
+        case Workload::ReduceMean: {
+            int32_t channels = Pick(size, 64, 256, 1024);
+            int32_t spatial = Pick(size, 28, 14, 7);
+            std::vector<int32_t> axes = {2, 3};
+            wgpu::ReduceOptions options = {};
+            options.axes = axes.data();
+            options.axesCount = axes.size();
+            return mBuilder.ReduceMean(Input("input", {1, channels, spatial, spatial}),
+                                       &options);
+        }
+        case Workload::Resample2d: {
+            int32_t channels = Pick(size, 16, 32, 64);
+            int32_t spatial = Pick(size, 32, 64, 128);
+            std::vector<float> scales = {2.0f, 2.0f};
+            wgpu::Resample2dOptions options = {};
+            options.mode = wgpu::InterpolationMode::Linear;
+            options.scales = scales.data();
+            options.scalesCount = scales.size();
+            return mBuilder.Resample2d(Input("input", {1, channels, spatial, spatial}),
+                                       &options);
+        }
+        case Workload::ElementwiseChain: {
+            // The batch normalization of an inference graph as separate operators.
+            int32_t channels = Pick(size, 32, 64, 128);
+            int32_t spatial = Pick(size, 28, 56, 112);
+            wgpu::Operand x = Input("input", {1, channels, spatial, spatial});
+            x = mBuilder.Mul(x, Constant({1, channels, 1, 1}));
+            x = mBuilder.Add(x, Constant({1, channels, 1, 1}));
+            x = mBuilder.Relu(x);
+            return mBuilder.Sigmoid(x);
+        }
+        case Workload::MobileNet: {
+            // The stem, a stride 2 and a stride 1 block of every stage, then the classifier.
+            int32_t spatial = Pick(size, 96, 160, 224);
+            wgpu::ClampOptions relu6 = {};
+            relu6.minValue = 0;
+            relu6.maxValue = 6;
+            wgpu::Operand x = Input("input", {1, 3, spatial, spatial});
+            x = Conv2d(x, 3, 32, 3, 2, 1, mBuilder.ClampOperator(&relu6));
+            x = InvertedResidual(x, 32, 16, 1);
+            int32_t channels = 16;
+            for (int32_t stageChannels : {24, 32, 64, 96}) {
+                x = InvertedResidual(x, channels, stageChannels, stageChannels == 96 ? 1 : 2);
+                x = InvertedResidual(x, stageChannels, stageChannels, 1);
+                channels = stageChannels;
+            }
+            x = Conv2d(x, channels, 1280, 1, 1, 1, mBuilder.ClampOperator(&relu6));
+            std::vector<int32_t> axes = {2, 3};
+            wgpu::ReduceOptions options = {};
+            options.axes = axes.data();
+            options.axesCount = axes.size();
+            x = mBuilder.ReduceMean(x, &options);
+            return Dense(x, 1280, 1000, nullptr);
+        }
+        case Workload::Mlp: {
+            // A transformer feed forward block with its residual connection.
+            int32_t batch = Pick(size, 1, 16, 128);
+            constexpr int32_t kModelSize = 512;
+            constexpr int32_t kHiddenSize = 2048;
+            wgpu::Operand input = Input("input", {batch, kModelSize});
+            wgpu::Operand x = Dense(input, kModelSize, kHiddenSize, mBuilder.ReluOperator());
+            x = Dense(x, kHiddenSize, kModelSize, nullptr);
+            return mBuilder.Add(x, input);
+        }
+    }
+    return nullptr;
+}
+
+void WebnnPerf::SetUp() {
+    // Unlike DawnPerfTestWithParams, the CPU adapters are supported.
+    DawnTestWithParams<WebnnParams>::SetUp();
+
+    mBuilder = device.CreateGraphBuilder();
+    wgpu::Operand output = BuildWorkload();
+    wgpu::NamedOperands namedOperands = mBuilder.CreateNamedOperands();
+    namedOperands.Set("output", output);
+    mGraph = mBuilder.Build(namedOperands);
+    ASSERT_NE(mGraph.Get(), nullptr);
+
+    mInputs = mGraph.CreateNamedResources();
+    for (const auto& input : mInputViews) {
+        mInputs.Set(input.first.c_str(), &input.second);
+    }
+    // No workload has an output larger than 4 times its largest input or constant, the 2x
+    // upsampling of Resample2d.
+    uint64_t outputSize = 4 * mLargestBufferSize;
+    wgpu::BufferResourceView outputView = {};
+    outputView.resource =
+        CreateBuffer(outputSize, wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst, false);
+    outputView.size = outputSize;
+    mOutputs = mGraph.CreateNamedResources();
+    mOutputs.Set("output", &outputView);
+
+    // Count the operations of a computation from its profile.
+    mGraph.SetProfilingEnabled(true);
+    mGraph.Compute(mInputs, mOutputs);
+    mGraph.SetProfilingEnabled(false);
+    for (size_t i = 0; i < mGraph.GetOperatorProfileCount(); ++i) {
+        wgpu::OperatorProfile profile = {};
+        mGraph.GetOperatorProfile(i, &profile);
+        mOperationCount += profile.operationCount;
+    }
+}
+
+void WebnnPerf::Step() {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        mGraph.Compute(mInputs, mOutputs);
+    }
+    mComputeSeconds +=
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    mComputeCount += kNumIterations;
+}
+
+void WebnnPerf::PrintOperatorResults() {
+    if (mComputeSeconds > 0 && mOperationCount > 0) {
+        PrintResult("gflops",
+                    static_cast<double>(mOperationCount) * mComputeCount / mComputeSeconds * 1e-9,
+                    "GFLOP/s", true);
+    }
+
+    mGraph.SetProfilingEnabled(true);
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        mGraph.Compute(mInputs, mOutputs);
+    }
+    mGraph.SetProfilingEnabled(false);
+    for (size_t i = 0; i < mGraph.GetOperatorProfileCount(); ++i) {
+        wgpu::OperatorProfile profile = {};
+        mGraph.GetOperatorProfile(i, &profile);
+        std::string trace = "op" + std::to_string(i) + "_" + profile.name;
+        if (profile.variant[0] != '\0') {
+            trace += std::string("_") + profile.variant;
+        }
+        PrintResult(trace, profile.totalNanoseconds * 1e-3 / profile.computeCount, "us", false);
+    }
+}
+
+TEST_P(WebnnPerf, Run) {
+    RunTest();
+    PrintOperatorResults();
+}
+
+DAWN_INSTANTIATE_TEST_P(WebnnPerf,
+                        {NullBackend()},
+                        {Workload::Conv2d3x3, Workload::Conv2d1x1, Workload::DepthwiseConv2d,
+                         Workload::Gemm, Workload::MaxPool2d, Workload::AveragePool2d,
+                         Workload::ReduceMean, Workload::Resample2d, Workload::ElementwiseChain,
+                         Workload::MobileNet, Workload::Mlp},
+                        {WorkloadSize::Small, WorkloadSize::Medium, WorkloadSize::Large});
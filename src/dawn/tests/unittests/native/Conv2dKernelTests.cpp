@@ -0,0 +1,295 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "dawn/native/cpu/Conv2dCPU.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+
+        const Conv2dAlgorithm kAlgorithms[] = {
+            Conv2dAlgorithm::Direct,      Conv2dAlgorithm::Depthwise,
+            Conv2dAlgorithm::Im2col,      Conv2dAlgorithm::Winograd2x2,
+            Conv2dAlgorithm::Winograd4x4,
+        };
+
+        // The tensor ids of the kernels.
+        enum Tensor : uint32_t { kInput, kFilter, kBias, kOutput };
+
+        // A convolution of an [N, C, H, W] or [N, H, W, C] input with an [O, I, H, W] filter.
+        struct Conv2dCase {
+            int32_t batches;
+            int32_t inputChannels;
+            int32_t inputHeight;
+            int32_t inputWidth;
+            int32_t outputChannels;
+            int32_t filterHeight;
+            int32_t filterWidth;
+            int32_t groups = 1;
+            std::vector<int32_t> padding = {0, 0, 0, 0};
+            std::vector<int32_t> strides = {1, 1};
+            std::vector<int32_t> dilations = {1, 1};
+            bool nhwc = false;
+        };
+
+        class Conv2dKernelTests : public testing::Test {
+          protected:
+            void SetUp() override {
+                mThreadPool = std::make_unique<ThreadPool>(4);
+            }
+
+            std::vector<float> RandomData(size_t count) {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                std::vector<float> data(count);
+                for (float& value : data) {
+                    value = distribution(mRandom);
+                }
+                return data;
+            }
+
+            static int32_t OutputSize(int32_t input,
+                                      int32_t filter,
+                                      int32_t paddingBegin,
+                                      int32_t paddingEnd,
+                                      int32_t stride,
+                                      int32_t dilation) {
+                return (input + paddingBegin + paddingEnd - dilation * (filter - 1) - 1) / stride +
+                       1;
+            }
+
+            static std::vector<int32_t> Shape(const Conv2dCase& c,
+                                              int32_t channels,
+                                              int32_t height,
+                                              int32_t width) {
+                return c.nhwc ? std::vector<int32_t>{c.batches, height, width, channels}
+                              : std::vector<int32_t>{c.batches, channels, height, width};
+            }
+
+            static size_t Index(const std::vector<int32_t>& shape,
+                                bool nhwc,
+                                int32_t n,
+                                int32_t ch,
+                                int32_t h,
+                                int32_t w) {
+                return nhwc ? ((static_cast<size_t>(n) * shape[1] + h) * shape[2] + w) * shape[3] +
+                                  ch
+                            : ((static_cast<size_t>(n) * shape[1] + ch) * shape[2] + h) *
+                                      shape[3] +
+                                  w;
+            }
+
+            // Checks |algorithm| against a direct computation of the convolution |c|, with the
+            // filter and the bias prepared as constants, and read at every computation.
+            void Check(const Conv2dCase& c, Conv2dAlgorithm algorithm) {
+                int32_t outputHeight =
+                    OutputSize(c.inputHeight, c.filterHeight, c.padding[0], c.padding[1],
+                               c.strides[0], c.dilations[0]);
+                int32_t outputWidth = OutputSize(c.inputWidth, c.filterWidth, c.padding[2],
+                                                 c.padding[3], c.strides[1], c.dilations[1]);
+                std::vector<int32_t> inputShape =
+                    Shape(c, c.inputChannels, c.inputHeight, c.inputWidth);
+                std::vector<int32_t> outputShape =
+                    Shape(c, c.outputChannels, outputHeight, outputWidth);
+                int32_t inputChannelsPerGroup = c.inputChannels / c.groups;
+                int32_t outputChannelsPerGroup = c.outputChannels / c.groups;
+                std::vector<int32_t> filterShape = {c.outputChannels, inputChannelsPerGroup,
+                                                    c.filterHeight, c.filterWidth};
+
+                std::vector<float> input = RandomData(GetElementCount(inputShape));
+                std::vector<float> filter = RandomData(GetElementCount(filterShape));
+                std::vector<float> bias = RandomData(c.outputChannels);
+
+                std::vector<float> expected(GetElementCount(outputShape));
+                for (int32_t n = 0; n < c.batches; ++n) {
+                    for (int32_t oc = 0; oc < c.outputChannels; ++oc) {
+                        int32_t group = oc / outputChannelsPerGroup;
+                        for (int32_t oh = 0; oh < outputHeight; ++oh) {
+                            for (int32_t ow = 0; ow < outputWidth; ++ow) {
+                                double sum = bias[oc];
+                                for (int32_t ic = 0; ic < inputChannelsPerGroup; ++ic) {
+                                    for (int32_t kh = 0; kh < c.filterHeight; ++kh) {
+                                        int32_t ih = oh * c.strides[0] - c.padding[0] +
+                                                     kh * c.dilations[0];
+                                        for (int32_t kw = 0; kw < c.filterWidth; ++kw) {
+                                            int32_t iw = ow * c.strides[1] - c.padding[2] +
+                                                         kw * c.dilations[1];
+                                            if (ih < 0 || ih >= c.inputHeight || iw < 0 ||
+                                                iw >= c.inputWidth) {
+                                                continue;
+                                            }
+                                            int32_t channel = group * inputChannelsPerGroup + ic;
+                                            sum += input[Index(inputShape, c.nhwc, n, channel, ih,
+                                                               iw)] *
+                                                   filter[((oc * inputChannelsPerGroup + ic) *
+                                                               c.filterHeight +
+                                                           kh) *
+                                                              c.filterWidth +
+                                                          kw];
+                                        }
+                                    }
+                                }
+                                expected[Index(outputShape, c.nhwc, n, oc, oh, ow)] =
+                                    static_cast<float>(sum);
+                            }
+                        }
+                    }
+                }
+
+                Conv2dOptions options = {};
+                options.padding = c.padding.data();
+                options.paddingCount = 4;
+                options.strides = c.strides.data();
+                options.stridesCount = 2;
+                options.dilations = c.dilations.data();
+                options.dilationsCount = 2;
+                options.groups = c.groups;
+                options.inputLayout =
+                    c.nhwc ? wgpu::InputOperandLayout::Nhwc : wgpu::InputOperandLayout::Nchw;
+
+                for (bool prepare : {true, false}) {
+                    Conv2dKernel kernel(kInput, kFilter, kBias, kOutput, true, inputShape,
+                                        filterShape, outputShape, &options, algorithm);
+                    ASSERT_EQ(kernel.GetAlgorithm(), algorithm);
+                    if (prepare) {
+                        kernel.Prepare(ExecutionContext(
+                            mThreadPool.get(), {nullptr, filter.data(), bias.data(), nullptr}));
+                    }
+                    std::vector<float> output(expected.size(), NAN);
+                    kernel.Compute(ExecutionContext(
+                        mThreadPool.get(),
+                        {input.data(), filter.data(), bias.data(), output.data()}));
+                    for (size_t i = 0; i < expected.size(); ++i) {
+                        ASSERT_NEAR(output[i], expected[i], 1e-4f)
+                            << Conv2dAlgorithmToString(algorithm) << (prepare ? " prepared" : "")
+                            << " at index " << i;
+                    }
+                }
+            }
+
+            // Checks every algorithm that supports the convolution |c|.
+            void CheckAll(const Conv2dCase& c) {
+                Conv2dOptions options = {};
+                options.padding = c.padding.data();
+                options.strides = c.strides.data();
+                options.dilations = c.dilations.data();
+                options.groups = c.groups;
+                Conv2dCase nchw = c;
+                nchw.nhwc = false;
+                size_t filterStrides[4];
+                Conv2dParams params = GetConv2dParams(
+                    Shape(nchw, c.inputChannels, c.inputHeight, c.inputWidth),
+                    {c.outputChannels, c.inputChannels / c.groups, c.filterHeight, c.filterWidth},
+                    Shape(nchw, c.outputChannels, 1, 1), &options, filterStrides);
+                for (Conv2dAlgorithm algorithm : kAlgorithms) {
+                    if (IsConv2dAlgorithmSupported(algorithm, params)) {
+                        Check(c, algorithm);
+                    }
+                }
+            }
+
+            std::unique_ptr<ThreadPool> mThreadPool;
+            std::mt19937 mRandom{1};
+        };
+
+        // Test the 3x3 convolutions, which every algorithm but Depthwise supports, on outputs
+        // that aren't a multiple of the Winograd tiles.
+        TEST_F(Conv2dKernelTests, Filter3x3) {
+            Conv2dCase c = {2, 16, 13, 11, 24, 3, 3};
+            CheckAll(c);
+            c.padding = {1, 1, 1, 1};
+            CheckAll(c);
+            c.padding = {0, 2, 1, 0};
+            c.outputChannels = 5;
+            CheckAll(c);
+        }
+
+        // Test the channels last layout.
+        TEST_F(Conv2dKernelTests, Nhwc) {
+            Conv2dCase c = {1, 8, 9, 10, 20, 3, 3};
+            c.padding = {1, 1, 1, 1};
+            c.nhwc = true;
+            CheckAll(c);
+            c.filterHeight = 1;
+            c.filterWidth = 1;
+            CheckAll(c);
+        }
+
+        // Test the strides, the dilations and the filters that aren't square.
+        TEST_F(Conv2dKernelTests, StridesAndDilations) {
+            Conv2dCase c = {1, 5, 17, 19, 7, 5, 3};
+            c.padding = {2, 1, 0, 3};
+            c.strides = {2, 3};
+            CheckAll(c);
+            c.strides = {1, 1};
+            c.dilations = {2, 3};
+            CheckAll(c);
+        }
+
+        // Test the grouped convolutions.
+        TEST_F(Conv2dKernelTests, Groups) {
+            Conv2dCase c = {1, 12, 8, 8, 18, 3, 3};
+            c.groups = 3;
+            c.padding = {1, 1, 1, 1};
+            CheckAll(c);
+        }
+
+        // Test the depthwise convolutions, with one and two filters per channel.
+        TEST_F(Conv2dKernelTests, Depthwise) {
+            Conv2dCase c = {2, 19, 10, 9, 19, 3, 3};
+            c.groups = 19;
+            c.padding = {1, 1, 1, 1};
+            CheckAll(c);
+            c.outputChannels = 38;
+            c.strides = {2, 2};
+            CheckAll(c);
+            c.nhwc = true;
+            CheckAll(c);
+        }
+
+        // Test that the selection only picks algorithms that support the convolution.
+        TEST_F(Conv2dKernelTests, Selection) {
+            Conv2dParams params = {};
+            params.batches = 1;
+            params.inputChannels = 32;
+            params.outputChannels = 64;
+            params.inputHeight = params.outputHeight = 16;
+            params.inputWidth = params.outputWidth = 16;
+            params.filterHeight = params.filterWidth = 3;
+            params.groups = 1;
+            params.strideHeight = params.strideWidth = 1;
+            params.dilationHeight = params.dilationWidth = 1;
+            EXPECT_EQ(SelectConv2dAlgorithm(params), Conv2dAlgorithm::Winograd4x4);
+
+            params.outputHeight = params.outputWidth = 4;
+            EXPECT_EQ(SelectConv2dAlgorithm(params), Conv2dAlgorithm::Winograd2x2);
+
+            params.strideHeight = 2;
+            EXPECT_TRUE(IsConv2dAlgorithmSupported(SelectConv2dAlgorithm(params), params));
+            EXPECT_NE(SelectConv2dAlgorithm(params), Conv2dAlgorithm::Winograd2x2);
+
+            params.groups = params.inputChannels;
+            params.outputChannels = params.inputChannels;
+            EXPECT_EQ(SelectConv2dAlgorithm(params), Conv2dAlgorithm::Depthwise);
+        }
+
+    }  // namespace
+
+}}  // namespace dawn::native::cpu
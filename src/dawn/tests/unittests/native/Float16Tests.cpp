@@ -0,0 +1,126 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "dawn/native/cpu/Float16CPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+
+        uint32_t FloatBits(float value) {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        bool IsHalfNaN(uint16_t value) {
+            return (value & 0x7C00) == 0x7C00 && (value & 0x03FF) != 0;
+        }
+
+        // Test the conversion of the normal numbers, the signed zeros, the largest finite value
+        // and the infinities.
+        TEST(Float16Tests, SpecialValues) {
+            EXPECT_EQ(FloatToHalf(1.0f), 0x3C00);
+            EXPECT_EQ(FloatToHalf(-2.0f), 0xC000);
+            EXPECT_EQ(FloatToHalf(0.0f), 0x0000);
+            EXPECT_EQ(FloatToHalf(-0.0f), 0x8000);
+            EXPECT_EQ(FloatToHalf(65504.0f), 0x7BFF);
+            EXPECT_EQ(FloatToHalf(std::numeric_limits<float>::infinity()), 0x7C00);
+            EXPECT_EQ(FloatToHalf(-std::numeric_limits<float>::infinity()), 0xFC00);
+            EXPECT_TRUE(IsHalfNaN(FloatToHalf(std::numeric_limits<float>::quiet_NaN())));
+
+            EXPECT_EQ(HalfToFloat(0x3555), 0.333251953125f);
+            EXPECT_EQ(FloatBits(HalfToFloat(0x8000)), FloatBits(-0.0f));
+            EXPECT_EQ(HalfToFloat(0x7C00), std::numeric_limits<float>::infinity());
+            EXPECT_TRUE(std::isnan(HalfToFloat(0x7E00)));
+        }
+
+        // Test the denormals, which are kept in both directions.
+        TEST(Float16Tests, Denormals) {
+            EXPECT_EQ(HalfToFloat(0x0001), std::ldexp(1.0f, -24));
+            EXPECT_EQ(HalfToFloat(0x03FF), std::ldexp(1023.0f, -24));
+            EXPECT_EQ(FloatToHalf(std::ldexp(1.0f, -24)), 0x0001);
+            EXPECT_EQ(FloatToHalf(-std::ldexp(3.0f, -24)), 0x8003);
+            // Below half of the smallest denormal, the values round to zero.
+            EXPECT_EQ(FloatToHalf(std::ldexp(1.0f, -26)), 0x0000);
+        }
+
+        // Test the rounding to nearest even, and the overflow to infinity.
+        TEST(Float16Tests, Rounding) {
+            // 1 + 2^-11 is halfway between 1 and the next float16, whose mantissa is odd.
+            EXPECT_EQ(FloatToHalf(1.0f + std::ldexp(1.0f, -11)), 0x3C00);
+            EXPECT_EQ(FloatToHalf(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3C02);
+            EXPECT_EQ(FloatToHalf(1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20)), 0x3C01);
+            // The rounding of the denormals.
+            EXPECT_EQ(FloatToHalf(std::ldexp(1.5f, -24)), 0x0002);
+            EXPECT_EQ(FloatToHalf(std::ldexp(2.5f, -24)), 0x0002);
+            // 65520 is halfway between 65504 and the next power of 2.
+            EXPECT_EQ(FloatToHalf(65519.0f), 0x7BFF);
+            EXPECT_EQ(FloatToHalf(65520.0f), 0x7C00);
+            EXPECT_EQ(FloatToHalf(-1e10f), 0xFC00);
+        }
+
+        // Test that every float16 value but the NaNs is the same after the round trip through
+        // float32, and that the conversions of arrays match the scalar ones.
+        TEST(Float16Tests, AllValues) {
+            // An odd count, so that the SIMD loops have a remainder.
+            const size_t count = 0x10001;
+            std::vector<uint16_t> halves(count);
+            for (size_t i = 0; i < count; ++i) {
+                halves[i] = static_cast<uint16_t>(i);
+            }
+            std::vector<float> floats(count);
+            ConvertHalfToFloat(halves.data(), floats.data(), count);
+            std::vector<uint16_t> roundTrip(count);
+            ConvertFloatToHalf(floats.data(), roundTrip.data(), count);
+            for (size_t i = 0; i < count; ++i) {
+                float value = HalfToFloat(halves[i]);
+                if (IsHalfNaN(halves[i])) {
+                    ASSERT_TRUE(std::isnan(value)) << "at index " << i;
+                    ASSERT_TRUE(std::isnan(floats[i])) << "at index " << i;
+                    ASSERT_TRUE(IsHalfNaN(roundTrip[i])) << "at index " << i;
+                    continue;
+                }
+                ASSERT_EQ(FloatBits(floats[i]), FloatBits(value)) << "at index " << i;
+                ASSERT_EQ(FloatToHalf(value), halves[i]) << "at index " << i;
+                ASSERT_EQ(roundTrip[i], halves[i]) << "at index " << i;
+            }
+        }
+
+        // Test that the conversions of float32 arrays round as the scalar one.
+        TEST(Float16Tests, ConvertFloats) {
+            std::vector<float> floats;
+            for (int32_t exponent = -30; exponent <= 17; ++exponent) {
+                for (float mantissa : {1.0f, 1.0001f, 1.00048828125f, 1.3f, 1.9999f}) {
+                    floats.push_back(std::ldexp(mantissa, exponent));
+                    floats.push_back(-std::ldexp(mantissa, exponent));
+                }
+            }
+            std::vector<uint16_t> halves(floats.size());
+            ConvertFloatToHalf(floats.data(), halves.data(), floats.size());
+            for (size_t i = 0; i < floats.size(); ++i) {
+                ASSERT_EQ(halves[i], FloatToHalf(floats[i])) << floats[i];
+            }
+        }
+
+    }  // namespace
+
+}}  // namespace dawn::native::cpu
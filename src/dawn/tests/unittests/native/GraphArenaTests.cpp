@@ -0,0 +1,132 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "dawn/native/GraphArena.h"
+#include "dawn/native/ObjectBase.h"
+#include "dawn/native/Operand.h"
+#include "dawn/tests/DawnNativeTest.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        // A node that records its destruction in |destroyed|.
+        class Node final : public ObjectBase {
+          public:
+            Node(int id, std::vector<int>* destroyed)
+                : ObjectBase(nullptr), mId(id), mDestroyed(destroyed) {
+            }
+            ~Node() override {
+                mDestroyed->push_back(mId);
+            }
+
+          private:
+            int mId;
+            std::vector<int>* mDestroyed;
+        };
+
+        bool IsAligned(const void* ptr) {
+            return reinterpret_cast<uintptr_t>(ptr) % alignof(std::max_align_t) == 0;
+        }
+
+        // Test that the allocations are aligned and don't overlap, in the current chunk and in
+        // chunks of their own.
+        TEST(GraphArenaTests, Allocate) {
+            Ref<GraphArena> arena = AcquireRef(new GraphArena());
+            std::vector<std::pair<char*, size_t>> allocations;
+            for (size_t size : {1, 7, 16, 24, 100, 3000, 40000, 200000, 5, 17000, 64}) {
+                for (int i = 0; i < 20; ++i) {
+                    char* allocation = static_cast<char*>(arena->Allocate(size));
+                    ASSERT_NE(allocation, nullptr);
+                    ASSERT_TRUE(IsAligned(allocation)) << size;
+                    memset(allocation, static_cast<int>(allocations.size() % 256), size);
+                    allocations.emplace_back(allocation, size);
+                }
+            }
+            // The allocations that overlap another one were overwritten by it.
+            for (size_t i = 0; i < allocations.size(); ++i) {
+                const auto& [allocation, size] = allocations[i];
+                for (size_t j = 0; j < size; ++j) {
+                    ASSERT_EQ(static_cast<unsigned char>(allocation[j]), i % 256)
+                        << "allocation " << i << " of " << size << " bytes at byte " << j;
+                }
+            }
+        }
+
+        // Test that the adopted nodes are destroyed with the arena, in the reverse order.
+        TEST(GraphArenaTests, Adopt) {
+            std::vector<int> destroyed;
+            Ref<GraphArena> arena = AcquireRef(new GraphArena());
+            for (int id = 0; id < 1000; ++id) {
+                arena->Adopt(new (arena->Allocate(sizeof(Node))) Node(id, &destroyed));
+            }
+            EXPECT_TRUE(destroyed.empty());
+
+            arena = nullptr;
+            ASSERT_EQ(destroyed.size(), 1000u);
+            for (int i = 0; i < 1000; ++i) {
+                ASSERT_EQ(destroyed[i], 999 - i);
+            }
+        }
+
+        class GraphArenaBuilderTests : public DawnNativeTest {
+          protected:
+            wgpu::Operand Input(const wgpu::GraphBuilder& builder,
+                                const std::vector<int32_t>& shape) {
+                wgpu::OperandDescriptor desc = {wgpu::OperandType::Float32, shape.data(),
+                                                static_cast<uint32_t>(shape.size())};
+                return builder.Input("input", &desc);
+            }
+        };
+
+        // Test that the operands that the builder returned stay valid once it is released, as
+        // they hold a reference to its arena.
+        TEST_F(GraphArenaBuilderTests, OperandsOutliveBuilder) {
+            wgpu::GraphBuilder builder = device.CreateGraphBuilder();
+            wgpu::Operand input = Input(builder, {2, 3});
+            wgpu::Operand output = builder.Relu(builder.Add(input, input));
+            builder = nullptr;
+
+            const OperandBase* operand = FromAPI(output.Get());
+            EXPECT_EQ(std::vector<int32_t>(operand->Shape()), (std::vector<int32_t>{2, 3}));
+            ASSERT_NE(operand->Operator(), nullptr);
+            EXPECT_EQ(operand->Operator()->Inputs().size(), 1u);
+            input = nullptr;
+            EXPECT_EQ(operand->Operator()->Inputs()[0]->Operator()->Inputs()[0]->Shape().size(),
+                      2u);
+        }
+
+        // Test that the operands of different builders are allocated in different arenas.
+        TEST_F(GraphArenaBuilderTests, ArenaPerBuilder) {
+            wgpu::GraphBuilder first = device.CreateGraphBuilder();
+            wgpu::GraphBuilder second = device.CreateGraphBuilder();
+            const OperatorBase* firstOperator =
+                FromAPI(first.Relu(Input(first, {4})).Get())->Operator();
+            const OperatorBase* secondOperator =
+                FromAPI(second.Relu(Input(second, {4})).Get())->Operator();
+            EXPECT_NE(firstOperator->GetArena(), nullptr);
+            EXPECT_NE(firstOperator->GetArena(), secondOperator->GetArena());
+            EXPECT_EQ(firstOperator->GetArena(), FromAPI(first.Get())->GetArena());
+        }
+
+    }  // namespace
+
+}  // namespace dawn::native
@@ -0,0 +1,198 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <vector>
+
+#include "dawn/native/GraphIndex.h"
+#include "dawn/tests/DawnNativeTest.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        class GraphIndexTests : public DawnNativeTest {
+          protected:
+            void SetUp() override {
+                DawnNativeTest::SetUp();
+                builder = device.CreateGraphBuilder();
+            }
+
+            wgpu::Operand Input(const std::vector<int32_t>& shape) {
+                wgpu::OperandDescriptor desc = {wgpu::OperandType::Float32, shape.data(),
+                                                static_cast<uint32_t>(shape.size())};
+                return builder.Input("input", &desc);
+            }
+
+            static const OperandBase* Operand(const wgpu::Operand& operand) {
+                return FromAPI(operand.Get());
+            }
+
+            static const OperatorBase* Operator(const wgpu::Operand& operand) {
+                return Operand(operand)->Operator();
+            }
+
+            // Indexes the graph computing |outputs|.
+            void Index(const std::vector<wgpu::Operand>& outputs) {
+                std::vector<const OperandBase*> operands;
+                for (const wgpu::Operand& output : outputs) {
+                    operands.push_back(Operand(output));
+                }
+                ASSERT_TRUE(mIndex.Initialize(operands));
+            }
+
+            // Expects |sorted| to hold every indexed operator once, after the producers of its
+            // inputs.
+            void ExpectSorted(const std::vector<const OperatorBase*>& sorted) const {
+                ASSERT_EQ(sorted.size(), mIndex.GetOperatorCount());
+                std::vector<size_t> positions(sorted.size(), sorted.size());
+                for (size_t i = 0; i < sorted.size(); ++i) {
+                    uint32_t id = mIndex.GetOperatorId(sorted[i]);
+                    ASSERT_NE(id, GraphIndex::kInvalidId);
+                    ASSERT_EQ(positions[id], sorted.size()) << "operator " << id << " twice";
+                    positions[id] = i;
+                }
+                for (uint32_t id = 0; id < sorted.size(); ++id) {
+                    for (uint32_t input : mIndex.GetInputs(id)) {
+                        EXPECT_LT(positions[mIndex.GetProducer(input)], positions[id]);
+                    }
+                }
+            }
+
+            wgpu::GraphBuilder builder;
+            GraphIndex mIndex;
+        };
+
+        // Test the producers, the inputs and the consumers of the operands, with an operator
+        // of several outputs and one reading the same operand twice.
+        TEST_F(GraphIndexTests, Edges) {
+            wgpu::Operand input = Input({2, 4});
+            const uint32_t splits[] = {2};
+            wgpu::SplitOptions options = {};
+            options.axis = 1;
+            wgpu::OperandArray halves = builder.Split(input, splits, 1, &options);
+            wgpu::Operand first = halves.GetOperand(0);
+            wgpu::Operand second = halves.GetOperand(1);
+            wgpu::Operand sum = builder.Add(first, first);
+            wgpu::Operand product = builder.Mul(second, first);
+            Index({sum, product});
+            ASSERT_EQ(mIndex.GetOperatorCount(), 4u);
+            ASSERT_EQ(mIndex.GetOperandCount(), 5u);
+
+            uint32_t split = mIndex.GetOperatorId(Operator(first));
+            ASSERT_NE(split, GraphIndex::kInvalidId);
+            EXPECT_EQ(mIndex.GetOperator(split), Operator(first));
+            ASSERT_EQ(mIndex.GetOutputCount(split), 2u);
+            uint32_t firstId = mIndex.GetOperandId(Operand(first));
+            uint32_t secondId = mIndex.GetOperandId(Operand(second));
+            EXPECT_EQ(firstId, mIndex.GetFirstOutput(split));
+            EXPECT_EQ(secondId, firstId + 1);
+            EXPECT_EQ(mIndex.GetProducer(firstId), split);
+            EXPECT_EQ(mIndex.GetProducer(secondId), split);
+
+            uint32_t inputId = mIndex.GetOperandId(Operand(input));
+            ASSERT_NE(inputId, GraphIndex::kInvalidId);
+            GraphIndex::IdRange splitInputs = mIndex.GetInputs(split);
+            ASSERT_EQ(splitInputs.size(), 1u);
+            EXPECT_EQ(*splitInputs.begin(), inputId);
+            EXPECT_EQ(mIndex.GetInputs(mIndex.GetProducer(inputId)).size(), 0u);
+
+            uint32_t add = mIndex.GetOperatorId(Operator(sum));
+            uint32_t mul = mIndex.GetOperatorId(Operator(product));
+            EXPECT_EQ(std::vector<uint32_t>(mIndex.GetInputs(add).begin(),
+                                            mIndex.GetInputs(add).end()),
+                      (std::vector<uint32_t>{firstId, firstId}));
+            EXPECT_EQ(std::vector<uint32_t>(mIndex.GetInputs(mul).begin(),
+                                            mIndex.GetInputs(mul).end()),
+                      (std::vector<uint32_t>{secondId, firstId}));
+
+            // The consumers are in increasing order, Add appearing twice.
+            std::vector<uint32_t> expected = {add, add, mul};
+            std::sort(expected.begin(), expected.end());
+            GraphIndex::IdRange consumers = mIndex.GetConsumers(firstId);
+            EXPECT_EQ(std::vector<uint32_t>(consumers.begin(), consumers.end()), expected);
+            consumers = mIndex.GetConsumers(secondId);
+            EXPECT_EQ(std::vector<uint32_t>(consumers.begin(), consumers.end()),
+                      std::vector<uint32_t>{mul});
+            EXPECT_EQ(mIndex.GetConsumers(mIndex.GetOperandId(Operand(sum))).size(), 0u);
+
+            ExpectSorted(mIndex.TopologicalSort());
+        }
+
+        // Test the operators and the operands that aren't indexed.
+        TEST_F(GraphIndexTests, NotIndexed) {
+            wgpu::Operand input = Input({3});
+            wgpu::Operand relu = builder.Relu(input);
+            wgpu::Operand unused = builder.Sigmoid(input);
+            wgpu::Operand output = builder.Transpose(relu);
+            Index({output});
+            EXPECT_EQ(mIndex.GetOperatorCount(), 3u);
+            EXPECT_EQ(mIndex.GetOperatorId(Operator(unused)), GraphIndex::kInvalidId);
+            EXPECT_EQ(mIndex.GetOperandId(Operand(unused)), GraphIndex::kInvalidId);
+
+            // The inputs produced by operators outside of a given list of operators are
+            // kInvalidId and don't order the operators.
+            GraphIndex subgraph({Operator(output), Operator(relu)});
+            EXPECT_EQ(subgraph.GetOperatorId(Operator(output)), 0u);
+            EXPECT_EQ(subgraph.GetOperatorId(Operator(input)), GraphIndex::kInvalidId);
+            EXPECT_EQ(*subgraph.GetInputs(1).begin(), GraphIndex::kInvalidId);
+            EXPECT_EQ(*subgraph.GetInputs(0).begin(), subgraph.GetOperandId(Operand(relu)));
+            EXPECT_EQ(subgraph.TopologicalSort(),
+                      (std::vector<const OperatorBase*>{Operator(relu), Operator(output)}));
+        }
+
+        // Test that the operators of a branch are sorted one after the other, so that its
+        // intermediate operands aren't alive while the other branches are computed.
+        TEST_F(GraphIndexTests, DepthFirst) {
+            wgpu::Operand input = Input({3});
+            std::vector<wgpu::Operand> branches;
+            for (int i = 0; i < 3; ++i) {
+                branches.push_back(builder.Transpose(builder.Sigmoid(builder.Relu(input))));
+            }
+            wgpu::Operand output = builder.Add(builder.Add(branches[0], branches[1]), branches[2]);
+            Index({output});
+            std::vector<const OperatorBase*> sorted = mIndex.TopologicalSort();
+            ExpectSorted(sorted);
+            for (const wgpu::Operand& branch : branches) {
+                size_t last = std::find(sorted.begin(), sorted.end(), Operator(branch)) -
+                              sorted.begin();
+                ASSERT_GE(last, 2u);
+                const OperatorBase* sigmoid = Operator(branch)->Inputs()[0]->Operator();
+                EXPECT_EQ(sorted[last - 1], sigmoid);
+                EXPECT_EQ(sorted[last - 2], sigmoid->Inputs()[0]->Operator());
+            }
+        }
+
+        // Test graphs deep and wide enough to overflow the stack of a recursive walk or to
+        // make a quadratic sort noticeably slow.
+        TEST_F(GraphIndexTests, Large) {
+            wgpu::Operand input = Input({2});
+            wgpu::Operand chain = input;
+            for (int i = 0; i < 50000; ++i) {
+                chain = builder.Relu(chain);
+            }
+            std::vector<wgpu::Operand> branches;
+            for (int i = 0; i < 5000; ++i) {
+                branches.push_back(builder.Sigmoid(builder.Add(chain, input)));
+            }
+            wgpu::Operand output = builder.Concat(branches.size(), branches.data(), 0);
+            Index({output});
+            EXPECT_EQ(mIndex.GetOperatorCount(), 1u + 50000 + 2 * 5000 + 1);
+            EXPECT_EQ(mIndex.GetConsumers(mIndex.GetOperandId(Operand(input))).size(), 5001u);
+            ExpectSorted(mIndex.TopologicalSort());
+        }
+
+    }  // namespace
+
+}  // namespace dawn::native
@@ -0,0 +1,461 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "dawn/common/Math.h"
+#include "dawn/native/GraphIndex.h"
+#include "dawn/native/GraphOptimizer.h"
+#include "dawn/native/ops/Binary.h"
+#include "dawn/native/ops/Clamp.h"
+#include "dawn/native/ops/Conv2d.h"
+#include "dawn/native/ops/Gemm.h"
+#include "dawn/tests/DawnNativeTest.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        class GraphOptimizerTests : public DawnNativeTest {
+          protected:
+            void SetUp() override {
+                DawnNativeTest::SetUp();
+                builder = device.CreateGraphBuilder();
+            }
+
+            wgpu::Operand Input(const std::vector<int32_t>& shape,
+                                wgpu::OperandType type = wgpu::OperandType::Float32) {
+                wgpu::OperandDescriptor desc = {type, shape.data(),
+                                                static_cast<uint32_t>(shape.size())};
+                return builder.Input("input", &desc);
+            }
+
+            wgpu::Operand Constant(const std::vector<int32_t>& shape, float value = 1.0f) {
+                std::vector<float> data(GetElementCount(shape), value);
+                return Constant(shape, wgpu::OperandType::Float32, data.data(),
+                                data.size() * sizeof(float));
+            }
+
+            // A constant of |type| made of the |byteSize| bytes of |data|.
+            wgpu::Operand Constant(const std::vector<int32_t>& shape,
+                                   wgpu::OperandType type,
+                                   const void* data,
+                                   size_t byteSize) {
+                wgpu::BufferDescriptor bufferDesc = {};
+                bufferDesc.size = Align(byteSize, 4);
+                bufferDesc.usage = wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc;
+                bufferDesc.mappedAtCreation = true;
+                wgpu::Buffer buffer = device.CreateBuffer(&bufferDesc);
+                memcpy(buffer.GetMappedRange(), data, byteSize);
+                buffer.Unmap();
+
+                wgpu::OperandDescriptor desc = {type, shape.data(),
+                                                static_cast<uint32_t>(shape.size())};
+                wgpu::BufferResourceView view = {};
+                view.resource = buffer;
+                view.size = byteSize;
+                return builder.Constant(&desc, &view);
+            }
+
+            // The dequantizeLinear of |input| with constant scales and zero points of
+            // |scaleShape| and |zeroPointType|.
+            wgpu::Operand Dequantize(const wgpu::Operand& input,
+                                     const std::vector<int32_t>& scaleShape,
+                                     wgpu::OperandType zeroPointType) {
+                std::vector<uint8_t> zeroPoints(GetElementCount(scaleShape), 3);
+                return builder.DequantizeLinear(
+                    input, Constant(scaleShape, 0.1f),
+                    Constant(scaleShape, zeroPointType, zeroPoints.data(), zeroPoints.size()));
+            }
+
+            wgpu::Operand Quantize(const wgpu::Operand& input) {
+                uint8_t zeroPoint = 128;
+                return builder.QuantizeLinear(
+                    input, Constant({1}, 0.2f),
+                    Constant({1}, wgpu::OperandType::Uint8, &zeroPoint, 1));
+            }
+
+            wgpu::Operand Transpose(const wgpu::Operand& input,
+                                    const std::vector<int32_t>& permutation) {
+                wgpu::TransposeOptions options = {};
+                options.permutation = permutation.data();
+                options.permutationCount = permutation.size();
+                return builder.Transpose(input, &options);
+            }
+
+            // Sorts the operators computing |outputs| and runs |pass| of the optimizer on them.
+            std::vector<const OperatorBase*> Optimize(
+                const std::vector<wgpu::Operand>& outputs,
+                MaybeError (GraphOptimizer::*pass)()) {
+                std::vector<const OperandBase*> nativeOutputs;
+                for (const wgpu::Operand& output : outputs) {
+                    nativeOutputs.push_back(FromAPI(output.Get()));
+                }
+                GraphIndex index;
+                EXPECT_TRUE(index.Initialize(nativeOutputs));
+                GraphOptimizer optimizer(FromAPI(builder.Get()), index.TopologicalSort(),
+                                         nativeOutputs);
+                EXPECT_FALSE(FromAPI(device.Get())->ConsumedError((optimizer.*pass)()));
+                optimizer.EliminateDeadOperators();
+                return optimizer.GetOperators();
+            }
+
+            static size_t Count(const std::vector<const OperatorBase*>& operators,
+                                OperatorType type) {
+                return std::count_if(
+                    operators.begin(), operators.end(),
+                    [type](const OperatorBase* op) { return op->GetOperatorType() == type; });
+            }
+
+            static const OperatorBase* Find(const std::vector<const OperatorBase*>& operators,
+                                            OperatorType type) {
+                for (const OperatorBase* op : operators) {
+                    if (op->GetOperatorType() == type) {
+                        return op;
+                    }
+                }
+                return nullptr;
+            }
+
+            wgpu::GraphBuilder builder;
+        };
+
+        // Test that Conv2d followed by the Add of a per-channel constant and by Relu becomes one
+        // Conv2d with a bias and a fused activation.
+        TEST_F(GraphOptimizerTests, Conv2dAddRelu) {
+            wgpu::Operand conv = builder.Conv2d(Input({1, 3, 8, 8}), Constant({4, 3, 3, 3}));
+            wgpu::Operand output = builder.Relu(builder.Add(conv, Constant({1, 4, 1, 1})));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Binary), 0u);
+            EXPECT_EQ(Count(operators, OperatorType::Unary), 0u);
+            const op::Conv2d* fused =
+                static_cast<const op::Conv2d*>(Find(operators, OperatorType::Conv2d));
+            ASSERT_NE(fused, nullptr);
+            EXPECT_NE(fused->GetOptions()->bias, nullptr);
+            ASSERT_NE(fused->GetOptions()->activation, nullptr);
+            EXPECT_EQ(fused->GetOptions()->activation->GetFusionType(), FusionType::Relu);
+            EXPECT_EQ(fused->PrimaryOutput(), FromAPI(output.Get()));
+        }
+
+        // Test that the Add of an operand that varies along other axes than the channels isn't
+        // fused into Conv2d.
+        TEST_F(GraphOptimizerTests, Conv2dAddNotPerChannel) {
+            wgpu::Operand conv = builder.Conv2d(Input({1, 3, 8, 8}), Constant({4, 3, 3, 3}));
+            wgpu::Operand output = builder.Add(conv, Constant({1, 4, 6, 1}));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Binary), 1u);
+        }
+
+        // Test that BatchNorm with constant parameters is folded into the preceding Conv2d.
+        TEST_F(GraphOptimizerTests, Conv2dBatchNorm) {
+            wgpu::Operand conv = builder.Conv2d(Input({1, 3, 8, 8}), Constant({4, 3, 3, 3}));
+            wgpu::BatchNormOptions options = {};
+            options.scale = Constant({4}, 2.0f);
+            options.bias = Constant({4}, 0.5f);
+            wgpu::Operand output =
+                builder.BatchNorm(conv, Constant({4}, 0.1f), Constant({4}, 4.0f), &options);
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::BatchNorm), 0u);
+            EXPECT_EQ(Count(operators, OperatorType::Conv2d), 1u);
+        }
+
+        // Test that BatchNorm isn't folded when its parameters are computed by the graph.
+        TEST_F(GraphOptimizerTests, Conv2dBatchNormNotConstant) {
+            wgpu::Operand conv = builder.Conv2d(Input({1, 3, 8, 8}), Constant({4, 3, 3, 3}));
+            wgpu::Operand mean = builder.Relu(Constant({4}));
+            wgpu::Operand output = builder.BatchNorm(conv, mean, Constant({4}));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::BatchNorm), 1u);
+        }
+
+        // Test that Clamp becomes the activation of the preceding Gemm.
+        TEST_F(GraphOptimizerTests, GemmClamp) {
+            wgpu::ClampOptions clampOptions = {};
+            clampOptions.minValue = 0;
+            clampOptions.maxValue = 6;
+            wgpu::Operand output =
+                builder.Clamp(builder.Gemm(Input({2, 5}), Constant({5, 3})), &clampOptions);
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Clamp), 0u);
+            const op::Gemm* gemm =
+                static_cast<const op::Gemm*>(Find(operators, OperatorType::Gemm));
+            ASSERT_NE(gemm, nullptr);
+            ASSERT_NE(gemm->GetOptions()->activation, nullptr);
+            EXPECT_EQ(gemm->GetOptions()->activation->GetFusionType(), FusionType::Clamp);
+        }
+
+        // Test that Sigmoid becomes the activation of the preceding element-wise Binary.
+        TEST_F(GraphOptimizerTests, BinarySigmoid) {
+            wgpu::Operand output = builder.Sigmoid(builder.Mul(Input({4, 4}), Constant({4})));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Unary), 0u);
+            const op::Binary* binary =
+                static_cast<const op::Binary*>(Find(operators, OperatorType::Binary));
+            ASSERT_NE(binary, nullptr);
+            ASSERT_NE(binary->GetActivation(), nullptr);
+            EXPECT_EQ(binary->GetActivation()->GetFusionType(), FusionType::Sigmoid);
+        }
+
+        // Test that consecutive Clamp and Relu become the Clamp of the intersection of their
+        // ranges.
+        TEST_F(GraphOptimizerTests, ClampRelu) {
+            wgpu::ClampOptions clampOptions = {};
+            clampOptions.minValue = -1;
+            clampOptions.maxValue = 6;
+            wgpu::Operand output = builder.Relu(builder.Clamp(Input({8}), &clampOptions));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Unary), 0u);
+            ASSERT_EQ(Count(operators, OperatorType::Clamp), 1u);
+            const op::Clamp* clamp =
+                static_cast<const op::Clamp*>(Find(operators, OperatorType::Clamp));
+            EXPECT_EQ(clamp->GetMinValue(), 0.0f);
+            EXPECT_EQ(clamp->GetMaxValue(), 6.0f);
+        }
+
+        // Test that an operator isn't fused when its result is also a graph output or read by
+        // another operator.
+        TEST_F(GraphOptimizerTests, SharedIntermediate) {
+            wgpu::Operand conv = builder.Conv2d(Input({1, 3, 8, 8}), Constant({4, 3, 3, 3}));
+            wgpu::Operand relu = builder.Relu(conv);
+            std::vector<const OperatorBase*> operators =
+                Optimize({relu, conv}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Unary), 1u);
+
+            wgpu::Operand gemm = builder.Gemm(Input({2, 5}), Constant({5, 3}));
+            wgpu::Operand output = builder.Add(builder.Relu(gemm), builder.Sigmoid(gemm));
+            operators = Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Unary), 2u);
+            const op::Gemm* unfused =
+                static_cast<const op::Gemm*>(Find(operators, OperatorType::Gemm));
+            ASSERT_NE(unfused, nullptr);
+            EXPECT_EQ(unfused->GetOptions()->activation, nullptr);
+        }
+
+        // Test that the operators computed from constants only are replaced by the constant of
+        // their result, and that the constants they read are removed.
+        TEST_F(GraphOptimizerTests, FoldConstants) {
+            int32_t newShape[] = {6, 4};
+            wgpu::Operand folded = builder.Relu(builder.Reshape(
+                builder.Mul(Constant({4, 6}, 2.0f), Constant({6}, 3.0f)), newShape, 2));
+            wgpu::Operand output = builder.Add(Input({6, 4}), folded);
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FoldConstants);
+            EXPECT_EQ(Count(operators, OperatorType::Unary), 0u);
+            EXPECT_EQ(Count(operators, OperatorType::Reshape), 0u);
+            EXPECT_EQ(Count(operators, OperatorType::Constant), 1u);
+            EXPECT_EQ(Count(operators, OperatorType::Binary), 1u);
+            EXPECT_EQ(operators.size(), 3u);
+        }
+
+        // Test that the constant Transpose and Concat are folded.
+        TEST_F(GraphOptimizerTests, FoldTransposeAndConcat) {
+            wgpu::TransposeOptions options = {};
+            int32_t permutation[] = {1, 0};
+            options.permutation = permutation;
+            options.permutationCount = 2;
+            wgpu::Operand transposed = builder.Transpose(Constant({3, 2}), &options);
+            wgpu::Operand concatInputs[] = {transposed, Constant({2, 3})};
+            wgpu::Operand output = builder.Sub(Input({4, 3}), builder.Concat(2, concatInputs, 0));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FoldConstants);
+            EXPECT_EQ(Count(operators, OperatorType::Transpose), 0u);
+            EXPECT_EQ(Count(operators, OperatorType::Concat), 0u);
+            EXPECT_EQ(Count(operators, OperatorType::Constant), 1u);
+        }
+
+        // Test that an operator reading an input isn't folded, and that the result of a constant
+        // operator that is a graph output is still computed by the graph.
+        TEST_F(GraphOptimizerTests, NotFolded) {
+            wgpu::Operand constantOutput = builder.Relu(Constant({4}));
+            wgpu::Operand output = builder.Relu(Input({4}));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output, constantOutput}, &GraphOptimizer::FoldConstants);
+            EXPECT_EQ(Count(operators, OperatorType::Unary), 2u);
+        }
+
+        // Test that the dequantizeLinear of the input and of the filter, Conv2d and the
+        // quantizeLinear of the output become one quantized Conv2d, with a filter quantized per
+        // output channel.
+        TEST_F(GraphOptimizerTests, QuantizedConv2d) {
+            wgpu::Operand input =
+                Dequantize(Input({1, 3, 6, 6}, wgpu::OperandType::Uint8), {1},
+                           wgpu::OperandType::Uint8);
+            std::vector<int8_t> filterData(4 * 3 * 3 * 3, 1);
+            wgpu::Operand filter = Dequantize(
+                Constant({4, 3, 3, 3}, wgpu::OperandType::Int8, filterData.data(),
+                         filterData.size()),
+                {4, 1, 1, 1}, wgpu::OperandType::Int8);
+            wgpu::Operand output = Quantize(builder.Conv2d(input, filter));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Quantize), 0u);
+            const op::Conv2d* conv =
+                static_cast<const op::Conv2d*>(Find(operators, OperatorType::Conv2d));
+            ASSERT_NE(conv, nullptr);
+            EXPECT_EQ(conv->PrimaryOutput(), FromAPI(output.Get()));
+            const op::Quantization* quantization = conv->GetQuantization();
+            ASSERT_NE(quantization, nullptr);
+            EXPECT_FLOAT_EQ(quantization->inputScale, 0.1f);
+            EXPECT_EQ(quantization->inputZeroPoint, 3);
+            EXPECT_EQ(quantization->filterScales.size(), 4u);
+            EXPECT_EQ(quantization->filterZeroPoints, std::vector<int32_t>(4, 3));
+            EXPECT_FLOAT_EQ(quantization->outputScale, 0.2f);
+            EXPECT_EQ(quantization->outputZeroPoint, 128);
+        }
+
+        // Test the quantized Gemm, whose b is quantized per tensor.
+        TEST_F(GraphOptimizerTests, QuantizedGemm) {
+            wgpu::Operand a =
+                Dequantize(Input({2, 5}, wgpu::OperandType::Int8), {1}, wgpu::OperandType::Int8);
+            std::vector<int8_t> bData(5 * 3, 1);
+            wgpu::Operand b = Dequantize(
+                Constant({5, 3}, wgpu::OperandType::Int8, bData.data(), bData.size()), {1},
+                wgpu::OperandType::Int8);
+            wgpu::Operand output = Quantize(builder.Gemm(a, b));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Quantize), 0u);
+            const op::Gemm* gemm =
+                static_cast<const op::Gemm*>(Find(operators, OperatorType::Gemm));
+            ASSERT_NE(gemm, nullptr);
+            ASSERT_NE(gemm->GetQuantization(), nullptr);
+            EXPECT_EQ(gemm->GetQuantization()->filterScales.size(), 1u);
+        }
+
+        // Test that the chains whose scales aren't constants, or whose float32 result is also
+        // read, aren't quantized.
+        TEST_F(GraphOptimizerTests, NotQuantized) {
+            wgpu::Operand scale = Input({1});
+            uint8_t zeroPoint = 0;
+            wgpu::Operand input = builder.DequantizeLinear(
+                Input({2, 5}, wgpu::OperandType::Uint8), scale,
+                Constant({1}, wgpu::OperandType::Uint8, &zeroPoint, 1));
+            std::vector<int8_t> bData(5 * 3, 1);
+            wgpu::Operand b = Dequantize(
+                Constant({5, 3}, wgpu::OperandType::Int8, bData.data(), bData.size()), {1},
+                wgpu::OperandType::Int8);
+            wgpu::Operand output = Quantize(builder.Gemm(input, b));
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Quantize), 3u);
+
+            input = Dequantize(Input({2, 5}, wgpu::OperandType::Uint8), {1},
+                               wgpu::OperandType::Uint8);
+            wgpu::Operand gemm = builder.Gemm(input, b);
+            operators = Optimize({Quantize(gemm), gemm}, &GraphOptimizer::FuseOperators);
+            EXPECT_EQ(Count(operators, OperatorType::Quantize), 3u);
+            ASSERT_NE(Find(operators, OperatorType::Gemm), nullptr);
+            EXPECT_EQ(static_cast<const op::Gemm*>(Find(operators, OperatorType::Gemm))
+                          ->GetQuantization(),
+                      nullptr);
+        }
+
+        // Test that a Transpose followed by its inverse is removed, and that consecutive
+        // Transpose are merged.
+        TEST_F(GraphOptimizerTests, ConsecutiveTransposes) {
+            wgpu::Operand input = Input({2, 3, 4, 5});
+            wgpu::Operand output =
+                builder.Relu(Transpose(Transpose(input, {0, 2, 3, 1}), {0, 3, 1, 2}));
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::PropagateLayouts);
+            EXPECT_EQ(Count(operators, OperatorType::Transpose), 0u);
+            EXPECT_EQ(Find(operators, OperatorType::Unary)->Inputs()[0], FromAPI(input.Get()));
+
+            output = builder.Relu(Transpose(Transpose(input, {0, 2, 3, 1}), {1, 0, 2, 3}));
+            operators = Optimize({output}, &GraphOptimizer::PropagateLayouts);
+            EXPECT_EQ(Count(operators, OperatorType::Transpose), 1u);
+        }
+
+        // Test that a Transpose that only moves the dimensions of size 1 becomes a Reshape.
+        TEST_F(GraphOptimizerTests, TransposeToReshape) {
+            wgpu::Operand output = builder.Relu(Transpose(Input({1, 4, 1, 5}), {2, 1, 0, 3}));
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::PropagateLayouts);
+            EXPECT_EQ(Count(operators, OperatorType::Transpose), 0u);
+            EXPECT_EQ(Count(operators, OperatorType::Reshape), 1u);
+        }
+
+        // Test that the Transpose from nhwc to nchw before Conv2d and Pool2d and the one back
+        // after them are removed by switching them to the nhwc layout.
+        TEST_F(GraphOptimizerTests, Conv2dInNhwc) {
+            wgpu::Operand input = Input({1, 8, 8, 3});
+            wgpu::Operand conv =
+                builder.Conv2d(Transpose(input, {0, 3, 1, 2}), Constant({4, 3, 3, 3}));
+            wgpu::Operand pool = builder.MaxPool2d(builder.Relu(conv));
+            wgpu::Operand output = builder.Sigmoid(Transpose(pool, {0, 2, 3, 1}));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::PropagateLayouts);
+            EXPECT_EQ(Count(operators, OperatorType::Transpose), 0u);
+            const op::Conv2d* rewritten =
+                static_cast<const op::Conv2d*>(Find(operators, OperatorType::Conv2d));
+            ASSERT_NE(rewritten, nullptr);
+            EXPECT_EQ(rewritten->Inputs()[0], FromAPI(input.Get()));
+            EXPECT_EQ(rewritten->GetOptions()->inputLayout, wgpu::InputOperandLayout::Nhwc);
+            EXPECT_EQ(rewritten->PrimaryOutput()->Shape(), std::vector<int32_t>({1, 6, 6, 4}));
+        }
+
+        // Test that a Transpose is moved after a Binary whose other operand is a constant,
+        // which is transposed back for FoldConstants(), to meet the opposite Transpose.
+        TEST_F(GraphOptimizerTests, TransposeThroughBinary) {
+            wgpu::Operand transposed = Transpose(Input({2, 3, 4}), {2, 0, 1});
+            wgpu::Operand constant = Constant({4, 2, 3});
+            wgpu::Operand sum = builder.Add(transposed, constant);
+            wgpu::Operand output = builder.Relu(Transpose(builder.Clamp(sum), {1, 2, 0}));
+
+            std::vector<const OperatorBase*> operators =
+                Optimize({output}, &GraphOptimizer::PropagateLayouts);
+            ASSERT_EQ(Count(operators, OperatorType::Transpose), 1u);
+            EXPECT_EQ(Find(operators, OperatorType::Transpose)->Inputs()[0],
+                      FromAPI(constant.Get()));
+            const OperatorBase* binary = Find(operators, OperatorType::Binary);
+            ASSERT_NE(binary, nullptr);
+            EXPECT_EQ(binary->PrimaryOutput()->Shape(), std::vector<int32_t>({2, 3, 4}));
+        }
+
+        // Test that a Transpose whose result is also an output of the graph is kept.
+        TEST_F(GraphOptimizerTests, TransposedOutput) {
+            wgpu::Operand transposed = Transpose(Input({2, 3, 4}), {2, 0, 1});
+            wgpu::Operand output = Transpose(builder.Relu(transposed), {1, 2, 0});
+            std::vector<const OperatorBase*> operators =
+                Optimize({output, transposed}, &GraphOptimizer::PropagateLayouts);
+            EXPECT_GE(Count(operators, OperatorType::Transpose), 1u);
+            EXPECT_EQ(FromAPI(transposed.Get())->Operator()->GetOperatorType(),
+                      OperatorType::Transpose);
+        }
+
+    }  // namespace
+
+}  // namespace dawn::native
@@ -0,0 +1,253 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <vector>
+
+#include "dawn/common/Math.h"
+#include "dawn/native/GraphIndex.h"
+#include "dawn/native/MemoryPlan.h"
+#include "dawn/tests/DawnNativeTest.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        class MemoryPlanTests : public DawnNativeTest {
+          protected:
+            void SetUp() override {
+                DawnNativeTest::SetUp();
+                builder = device.CreateGraphBuilder();
+            }
+
+            wgpu::Operand Input(const std::vector<int32_t>& shape) {
+                wgpu::OperandDescriptor desc = {wgpu::OperandType::Float32, shape.data(),
+                                                static_cast<uint32_t>(shape.size())};
+                return builder.Input("input", &desc);
+            }
+
+            wgpu::Operand Constant(const std::vector<int32_t>& shape) {
+                std::vector<float> data(GetElementCount(shape), 1.0f);
+                wgpu::BufferDescriptor bufferDesc = {};
+                bufferDesc.size = data.size() * sizeof(float);
+                bufferDesc.usage = wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc;
+                bufferDesc.mappedAtCreation = true;
+                wgpu::Buffer buffer = device.CreateBuffer(&bufferDesc);
+                memcpy(buffer.GetMappedRange(), data.data(), bufferDesc.size);
+                buffer.Unmap();
+
+                wgpu::OperandDescriptor desc = {wgpu::OperandType::Float32, shape.data(),
+                                                static_cast<uint32_t>(shape.size())};
+                wgpu::BufferResourceView view = {};
+                view.resource = buffer;
+                view.size = bufferDesc.size;
+                return builder.Constant(&desc, &view);
+            }
+
+            wgpu::Operand Transpose(const wgpu::Operand& input) {
+                return builder.Transpose(input);
+            }
+
+            // Plans the float32 operands of the graph computing |outputs|.
+            void Plan(const std::vector<wgpu::Operand>& outputs) {
+                mOutputs.clear();
+                for (const wgpu::Operand& output : outputs) {
+                    mOutputs.push_back(FromAPI(output.Get()));
+                }
+                GraphIndex index;
+                ASSERT_TRUE(index.Initialize(mOutputs));
+                mOperators = index.TopologicalSort();
+                mPlan = MemoryPlan(mOperators, mOutputs, [](wgpu::OperandType) { return 4; });
+            }
+
+            bool HasOffset(const wgpu::Operand& operand) const {
+                return mPlan.HasOffset(FromAPI(operand.Get()));
+            }
+
+            size_t GetOffset(const wgpu::Operand& operand) const {
+                return mPlan.GetOffset(FromAPI(operand.Get()));
+            }
+
+            static size_t Bytes(const OperandBase* operand) {
+                return GetElementCount(operand->Shape()) * sizeof(float);
+            }
+
+            // Expects the operands that have an offset to be aligned and to never share memory
+            // while they are alive, which holds when no operand is computed in place of another.
+            void ExpectNoAliasing() const {
+                // The step computing each operand and the last step reading it.
+                std::vector<const OperandBase*> operands;
+                std::vector<size_t> firstSteps;
+                std::vector<size_t> lastSteps;
+                for (size_t step = 0; step < mOperators.size(); ++step) {
+                    for (const OperandBase* input : mOperators[step]->Inputs()) {
+                        for (size_t i = 0; i < operands.size(); ++i) {
+                            if (operands[i] == input) {
+                                lastSteps[i] = step;
+                            }
+                        }
+                    }
+                    for (const OperandBase* output : mOperators[step]->Outputs()) {
+                        if (mPlan.HasOffset(output)) {
+                            operands.push_back(output);
+                            firstSteps.push_back(step);
+                            lastSteps.push_back(step);
+                        }
+                    }
+                }
+                for (size_t i = 0; i < operands.size(); ++i) {
+                    for (const OperandBase* output : mOutputs) {
+                        if (operands[i] == output) {
+                            lastSteps[i] = mOperators.size();
+                        }
+                    }
+                }
+
+                for (size_t i = 0; i < operands.size(); ++i) {
+                    size_t offset = mPlan.GetOffset(operands[i]);
+                    EXPECT_EQ(offset % MemoryPlan::kAlignment, 0u);
+                    EXPECT_LE(offset + Bytes(operands[i]), mPlan.GetSize());
+                    for (size_t j = 0; j < i; ++j) {
+                        if (firstSteps[i] > lastSteps[j] || firstSteps[j] > lastSteps[i]) {
+                            continue;
+                        }
+                        size_t otherOffset = mPlan.GetOffset(operands[j]);
+                        EXPECT_TRUE(offset >= otherOffset + Bytes(operands[j]) ||
+                                    otherOffset >= offset + Bytes(operands[i]))
+                            << "operands " << j << " and " << i << " overlap";
+                    }
+                }
+            }
+
+            wgpu::GraphBuilder builder;
+            std::vector<const OperandBase*> mOutputs;
+            std::vector<const OperatorBase*> mOperators;
+            MemoryPlan mPlan;
+        };
+
+        // Test that the inputs, the constants and their views aren't planned.
+        TEST_F(MemoryPlanTests, NotPlanned) {
+            wgpu::Operand input = Input({4, 4});
+            wgpu::Operand constant = Constant({4, 4});
+            int32_t newShape[] = {16};
+            wgpu::Operand reshaped = builder.Reshape(input, newShape, 1);
+            wgpu::Operand output = builder.Add(reshaped, builder.Reshape(constant, newShape, 1));
+            Plan({output});
+            EXPECT_FALSE(HasOffset(input));
+            EXPECT_FALSE(HasOffset(constant));
+            EXPECT_FALSE(HasOffset(reshaped));
+            ASSERT_TRUE(HasOffset(output));
+            EXPECT_EQ(mPlan.GetSize(), Align(16 * sizeof(float), MemoryPlan::kAlignment));
+        }
+
+        // Test that the operands of a chain reuse the memory of those that are no longer read,
+        // so that two blocks are enough.
+        TEST_F(MemoryPlanTests, Reuse) {
+            wgpu::Operand a = Transpose(Input({5, 7}));
+            wgpu::Operand b = Transpose(a);
+            wgpu::Operand c = Transpose(b);
+            wgpu::Operand d = Transpose(c);
+            Plan({d});
+            ExpectNoAliasing();
+            EXPECT_EQ(GetOffset(a), GetOffset(c));
+            EXPECT_EQ(GetOffset(b), GetOffset(d));
+            EXPECT_EQ(mPlan.GetSize(), 2 * Align(35 * sizeof(float), MemoryPlan::kAlignment));
+        }
+
+        // Test that the outputs are kept alive until the end.
+        TEST_F(MemoryPlanTests, Outputs) {
+            wgpu::Operand a = Transpose(Input({5, 7}));
+            wgpu::Operand b = Transpose(a);
+            wgpu::Operand c = Transpose(b);
+            wgpu::Operand d = Transpose(c);
+            Plan({a, d});
+            ExpectNoAliasing();
+            EXPECT_NE(GetOffset(a), GetOffset(c));
+            EXPECT_EQ(mPlan.GetSize(), 3 * Align(35 * sizeof(float), MemoryPlan::kAlignment));
+        }
+
+        // Test the operands of branches that are alive at the same time and have different
+        // sizes.
+        TEST_F(MemoryPlanTests, Branches) {
+            wgpu::Operand input = Input({3, 8});
+            std::vector<wgpu::Operand> branches;
+            for (int32_t n : {5, 17, 1, 64}) {
+                wgpu::Operand branch = builder.Matmul(input, Constant({8, n}));
+                branch = Transpose(Transpose(branch));
+                branches.push_back(builder.Matmul(branch, Constant({n, 3})));
+            }
+            wgpu::Operand sum = builder.Matmul(branches[0], branches[1]);
+            wgpu::Operand output = builder.Matmul(sum, builder.Matmul(branches[2], branches[3]));
+            Plan({output, branches[1]});
+            ExpectNoAliasing();
+        }
+
+        // Test that the output of an element-wise operator is computed in place of an input
+        // that isn't read afterwards, but not of one that is.
+        TEST_F(MemoryPlanTests, InPlace) {
+            wgpu::Operand a = Transpose(Input({4, 6}));
+            wgpu::Operand b = builder.Relu(a);
+            wgpu::Operand c = builder.Sigmoid(b);
+            wgpu::Operand output = builder.Add(c, b);
+            Plan({output});
+            EXPECT_EQ(GetOffset(a), GetOffset(b));
+            EXPECT_NE(GetOffset(b), GetOffset(c));
+            EXPECT_TRUE(GetOffset(output) == GetOffset(b) || GetOffset(output) == GetOffset(c));
+
+            // Softmax reads the whole row of its input, and its output can't overwrite it.
+            a = Transpose(Input({4, 6}));
+            output = builder.Softmax(a);
+            Plan({output});
+            EXPECT_NE(GetOffset(a), GetOffset(output));
+        }
+
+        // Test that a Reshape of a planned operand views its memory, and keeps it alive.
+        TEST_F(MemoryPlanTests, View) {
+            wgpu::Operand a = Transpose(Input({4, 6}));
+            int32_t newShape[] = {6, 2, 2};
+            wgpu::Operand reshaped = builder.Reshape(a, newShape, 3);
+            wgpu::Operand b = Transpose(reshaped);
+            wgpu::Operand output = builder.Matmul(Transpose(b), reshaped);
+            Plan({output});
+            ASSERT_TRUE(HasOffset(reshaped));
+            EXPECT_EQ(GetOffset(reshaped), GetOffset(a));
+            EXPECT_NE(GetOffset(b), GetOffset(a));
+        }
+
+        // Test that the inputs of a Concat along its outermost axis are computed in place in
+        // their slices of its output.
+        TEST_F(MemoryPlanTests, Concat) {
+            wgpu::Operand a = Transpose(Input({3, 2}));
+            wgpu::Operand b = Transpose(Input({3, 5}));
+            wgpu::Operand inputs[] = {a, b};
+            wgpu::Operand concat = builder.Concat(2, inputs, 0);
+            wgpu::Operand output = Transpose(concat);
+            Plan({output});
+            EXPECT_EQ(GetOffset(a), GetOffset(concat));
+            EXPECT_EQ(GetOffset(b), GetOffset(concat) + 2 * 3 * sizeof(float));
+            EXPECT_NE(GetOffset(output), GetOffset(concat));
+
+            // The slices along an inner axis aren't contiguous.
+            a = Transpose(Input({2, 3}));
+            b = Transpose(Input({2, 3}));
+            wgpu::Operand innerInputs[] = {a, b};
+            concat = builder.Concat(2, innerInputs, 1);
+            Plan({Transpose(concat)});
+            EXPECT_NE(GetOffset(a), GetOffset(concat));
+            EXPECT_NE(GetOffset(b), GetOffset(concat));
+        }
+
+    }  // namespace
+
+}  // namespace dawn::native
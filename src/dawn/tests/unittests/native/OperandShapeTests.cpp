@@ -0,0 +1,97 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "dawn/native/OperandShape.h"
+
+namespace dawn::native {
+
+    namespace {
+
+        // Test that a default shape is the shape of a scalar.
+        TEST(OperandShapeTests, Empty) {
+            OperandShape shape;
+            EXPECT_TRUE(shape.empty());
+            EXPECT_EQ(shape.size(), 0u);
+            EXPECT_EQ(shape.begin(), shape.end());
+            EXPECT_EQ(std::vector<int32_t>(shape), std::vector<int32_t>{});
+        }
+
+        // Test the shapes that are stored inline.
+        TEST(OperandShapeTests, Inline) {
+            std::vector<int32_t> dimensions = {1, 3, 224, 224};
+            OperandShape shape(dimensions);
+            ASSERT_EQ(shape.size(), 4u);
+            EXPECT_EQ(shape[0], 1);
+            EXPECT_EQ(shape[2], 224);
+            EXPECT_EQ(shape.back(), 224);
+            EXPECT_EQ(std::vector<int32_t>(shape.begin(), shape.end()), dimensions);
+            EXPECT_TRUE(shape == dimensions);
+            EXPECT_TRUE(dimensions == shape);
+        }
+
+        // Test the shapes that have more dimensions than are stored inline.
+        TEST(OperandShapeTests, OutOfLine) {
+            std::vector<int32_t> dimensions(OperandShape::kInlineRank + 2);
+            for (size_t i = 0; i < dimensions.size(); ++i) {
+                dimensions[i] = static_cast<int32_t>(i + 1);
+            }
+            OperandShape shape(dimensions);
+            ASSERT_EQ(shape.size(), dimensions.size());
+            EXPECT_EQ(shape.back(), static_cast<int32_t>(dimensions.size()));
+            EXPECT_EQ(std::vector<int32_t>(shape), dimensions);
+
+            // Assigning a smaller shape stores it inline again.
+            shape = OperandShape(std::vector<int32_t>{2, 3});
+            EXPECT_EQ(shape, (std::vector<int32_t>{2, 3}));
+
+            // And a larger one is stored out of line again.
+            shape = dimensions;
+            EXPECT_EQ(std::vector<int32_t>(shape), dimensions);
+        }
+
+        // Test that the copies don't share their dimensions.
+        TEST(OperandShapeTests, Copy) {
+            std::vector<int32_t> small = {4, 5};
+            std::vector<int32_t> large(OperandShape::kInlineRank + 1, 7);
+
+            OperandShape a(small);
+            OperandShape b(a);
+            EXPECT_EQ(a, b);
+            b = large;
+            EXPECT_EQ(a, small);
+            EXPECT_EQ(b, large);
+
+            OperandShape c(b);
+            EXPECT_NE(c.data(), b.data());
+            c = a;
+            EXPECT_EQ(c, small);
+            EXPECT_EQ(b, large);
+        }
+
+        // Test that the shapes compare their dimensions.
+        TEST(OperandShapeTests, Equality) {
+            OperandShape a(std::vector<int32_t>{2, 3});
+            EXPECT_EQ(a, OperandShape(std::vector<int32_t>{2, 3}));
+            EXPECT_NE(a, OperandShape(std::vector<int32_t>{3, 2}));
+            EXPECT_NE(a, OperandShape(std::vector<int32_t>{2, 3, 1}));
+            EXPECT_NE(a, OperandShape());
+        }
+
+    }  // namespace
+
+}  // namespace dawn::native
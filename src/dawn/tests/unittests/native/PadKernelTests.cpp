@@ -0,0 +1,156 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "dawn/native/cpu/PadCPU.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+
+        const wgpu::PaddingMode kModes[] = {
+            wgpu::PaddingMode::Constant,
+            wgpu::PaddingMode::Edge,
+            wgpu::PaddingMode::Reflection,
+            wgpu::PaddingMode::Symmetric,
+        };
+
+        // The tensor ids of the kernel.
+        enum Tensor : uint32_t { kInput, kOutput };
+
+        class PadKernelTests : public testing::Test {
+          protected:
+            void SetUp() override {
+                mThreadPool = std::make_unique<ThreadPool>(4);
+            }
+
+            // Pads |input| of |shape| one element at a time, each output coordinate mapped
+            // into the input independently.
+            static std::vector<float> Reference(wgpu::PaddingMode mode,
+                                                float value,
+                                                const std::vector<float>& input,
+                                                const std::vector<int32_t>& shape,
+                                                const std::vector<uint32_t>& padding) {
+                size_t rank = shape.size();
+                std::vector<int32_t> outputShape(rank);
+                size_t count = 1;
+                for (size_t d = 0; d < rank; ++d) {
+                    outputShape[d] = shape[d] + padding[2 * d] + padding[2 * d + 1];
+                    count *= outputShape[d];
+                }
+                std::vector<float> output;
+                std::vector<int32_t> index(rank, 0);
+                for (size_t o = 0; o < count; ++o) {
+                    size_t offset = 0;
+                    bool inside = true;
+                    for (size_t d = 0; d < rank; ++d) {
+                        int32_t i = index[d] - static_cast<int32_t>(padding[2 * d]);
+                        int32_t size = shape[d];
+                        if (i < 0 || i >= size) {
+                            switch (mode) {
+                                case wgpu::PaddingMode::Constant:
+                                    inside = false;
+                                    break;
+                                case wgpu::PaddingMode::Edge:
+                                    i = i < 0 ? 0 : size - 1;
+                                    break;
+                                case wgpu::PaddingMode::Reflection:
+                                    i = i < 0 ? -i : 2 * (size - 1) - i;
+                                    break;
+                                case wgpu::PaddingMode::Symmetric:
+                                    i = i < 0 ? -i - 1 : 2 * size - 1 - i;
+                                    break;
+                            }
+                        }
+                        offset = offset * size + i;
+                    }
+                    output.push_back(inside ? input[offset] : value);
+                    for (size_t d = rank; d-- > 0;) {
+                        if (++index[d] < outputShape[d]) {
+                            break;
+                        }
+                        index[d] = 0;
+                    }
+                }
+                return output;
+            }
+
+            // Checks the padding of an input of |shape| whose values are their indices, in
+            // every mode.
+            void Check(const std::vector<int32_t>& shape, const std::vector<uint32_t>& padding) {
+                size_t count = 1;
+                std::vector<int32_t> outputShape;
+                for (size_t d = 0; d < shape.size(); ++d) {
+                    count *= shape[d];
+                    outputShape.push_back(shape[d] + padding[2 * d] + padding[2 * d + 1]);
+                }
+                std::vector<float> input(count);
+                std::iota(input.begin(), input.end(), 0.0f);
+                for (wgpu::PaddingMode mode : kModes) {
+                    PadOptions options = {};
+                    options.mode = mode;
+                    options.value = -1.5f;
+                    std::vector<float> expected =
+                        Reference(mode, options.value, input, shape, padding);
+                    PadKernel kernel(kInput, kOutput, shape, outputShape, padding, &options);
+                    std::vector<float> output(expected.size(), NAN);
+                    kernel.Compute(
+                        ExecutionContext(mThreadPool.get(), {input.data(), output.data()}));
+                    for (size_t i = 0; i < expected.size(); ++i) {
+                        ASSERT_EQ(output[i], expected[i])
+                            << "mode " << static_cast<uint32_t>(mode) << " at index " << i;
+                    }
+                }
+            }
+
+            std::unique_ptr<ThreadPool> mThreadPool;
+        };
+
+        // Test the padding of a single dimension, at the beginning, the end or both.
+        TEST_F(PadKernelTests, OneDimension) {
+            Check({5}, {2, 3});
+            Check({5}, {0, 4});
+            Check({5}, {4, 0});
+            Check({1}, {0, 0});
+        }
+
+        // Test the padding of the inner, the outer and the middle dimensions, where the
+        // dimensions without padding are merged into the rows.
+        TEST_F(PadKernelTests, Dimensions) {
+            Check({3, 4}, {1, 2, 2, 1});
+            Check({3, 4, 5}, {0, 0, 0, 0, 2, 3});
+            Check({3, 4, 5}, {2, 1, 0, 0, 0, 0});
+            Check({3, 4, 5}, {0, 0, 3, 2, 0, 0});
+            Check({2, 3, 4, 5}, {1, 0, 0, 0, 0, 0, 0, 2});
+            Check({2, 3, 4, 5}, {0, 0, 1, 1, 0, 0, 2, 2});
+            Check({2, 3, 4, 5}, {0, 0, 0, 0, 0, 0, 0, 0});
+        }
+
+        // Test rows long enough to be split across the threads, with the padding of NCHW
+        // images.
+        TEST_F(PadKernelTests, Large) {
+            Check({2, 16, 33, 47}, {0, 0, 0, 0, 3, 3, 3, 3});
+            Check({1, 4, 300, 300}, {0, 0, 0, 0, 1, 2, 2, 1});
+        }
+
+    }  // namespace
+
+}}  // namespace dawn::native::cpu
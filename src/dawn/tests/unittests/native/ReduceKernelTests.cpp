@@ -0,0 +1,274 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "dawn/native/cpu/ReduceCPU.h"
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+
+        const op::ReduceType kReduceTypes[] = {
+            op::ReduceType::kReduceL1,      op::ReduceType::kReduceL2,
+            op::ReduceType::kReduceMax,     op::ReduceType::kReduceMean,
+            op::ReduceType::kReduceMin,     op::ReduceType::kReduceProduct,
+            op::ReduceType::kReduceSum,     op::ReduceType::kReduceArgMax,
+            op::ReduceType::kReduceArgMin,
+        };
+
+        // The tensor ids of the kernels.
+        enum Tensor : uint32_t { kInput, kOutput };
+
+        // The instruction sets of the running CPU.
+        std::vector<SimdLevel> GetSupportedSimdLevels() {
+            std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+#if defined(WEBNN_CPU_X86)
+            if (GetSimdLevel() == SimdLevel::AVX2 || GetSimdLevel() == SimdLevel::AVX512) {
+                levels.push_back(SimdLevel::AVX2);
+            }
+            if (GetSimdLevel() == SimdLevel::AVX512) {
+                levels.push_back(SimdLevel::AVX512);
+            }
+#elif defined(WEBNN_CPU_ARM64)
+            levels.push_back(SimdLevel::NEON);
+#endif
+            return levels;
+        }
+
+        class ReduceKernelTests : public testing::Test {
+          protected:
+            void SetUp() override {
+                mThreadPool = std::make_unique<ThreadPool>(4);
+            }
+
+            std::vector<float> RandomData(size_t count, float min = -1.0f, float max = 1.0f) {
+                std::uniform_real_distribution<float> distribution(min, max);
+                std::vector<float> data(count);
+                for (float& value : data) {
+                    value = distribution(mRandom);
+                }
+                return data;
+            }
+
+            // Reduces |input| of |shape| over |axes| in double precision, the outputs in the
+            // order of the kept dimensions. The indices of ArgMax and ArgMin are those of the
+            // first best value in the reduced dimensions taken in order.
+            static std::vector<float> Reference(op::ReduceType opType,
+                                                const std::vector<float>& input,
+                                                const std::vector<int32_t>& shape,
+                                                const std::vector<int32_t>& axes) {
+                std::vector<bool> reduced(shape.size(), false);
+                for (int32_t axis : axes) {
+                    reduced[axis == -1 ? shape.size() - 1 : axis] = true;
+                }
+                size_t outputCount = 1, reducedCount = 1;
+                for (size_t d = 0; d < shape.size(); ++d) {
+                    (reduced[d] ? reducedCount : outputCount) *= shape[d];
+                }
+                std::vector<std::vector<double>> groups(outputCount);
+                std::vector<size_t> index(shape.size(), 0);
+                for (float value : input) {
+                    size_t output = 0;
+                    for (size_t d = 0; d < shape.size(); ++d) {
+                        if (!reduced[d]) {
+                            output = output * shape[d] + index[d];
+                        }
+                    }
+                    groups[output].push_back(value);
+                    for (size_t d = shape.size(); d-- > 0;) {
+                        if (++index[d] < static_cast<size_t>(shape[d])) {
+                            break;
+                        }
+                        index[d] = 0;
+                    }
+                }
+
+                std::vector<float> output;
+                for (const std::vector<double>& values : groups) {
+                    double result = 0;
+                    switch (opType) {
+                        case op::ReduceType::kReduceL1:
+                            for (double value : values) {
+                                result += std::abs(value);
+                            }
+                            break;
+                        case op::ReduceType::kReduceL2:
+                            for (double value : values) {
+                                result += value * value;
+                            }
+                            result = std::sqrt(result);
+                            break;
+                        case op::ReduceType::kReduceMax:
+                            result = *std::max_element(values.begin(), values.end());
+                            break;
+                        case op::ReduceType::kReduceMin:
+                            result = *std::min_element(values.begin(), values.end());
+                            break;
+                        case op::ReduceType::kReduceMean:
+                        case op::ReduceType::kReduceSum:
+                            for (double value : values) {
+                                result += value;
+                            }
+                            if (opType == op::ReduceType::kReduceMean) {
+                                result /= reducedCount;
+                            }
+                            break;
+                        case op::ReduceType::kReduceProduct:
+                            result = 1;
+                            for (double value : values) {
+                                result *= value;
+                            }
+                            break;
+                        case op::ReduceType::kReduceArgMax:
+                            result = std::max_element(values.begin(), values.end()) -
+                                     values.begin();
+                            break;
+                        case op::ReduceType::kReduceArgMin:
+                            result = std::min_element(values.begin(), values.end()) -
+                                     values.begin();
+                            break;
+                    }
+                    output.push_back(static_cast<float>(result));
+                }
+                return output;
+            }
+
+            // Checks every reduction of |input| over |axes| against Reference().
+            void Check(const std::vector<float>& input,
+                       const std::vector<int32_t>& shape,
+                       const std::vector<int32_t>& axes,
+                       float tolerance = 1e-4f) {
+                for (op::ReduceType opType : kReduceTypes) {
+                    std::vector<float> expected = Reference(opType, input, shape, axes);
+                    ReduceKernel kernel(kInput, kOutput, opType, shape, axes);
+                    std::vector<float> output(expected.size(), NAN);
+                    kernel.Compute(ExecutionContext(
+                        mThreadPool.get(),
+                        {const_cast<float*>(input.data()), output.data()}));
+                    for (size_t i = 0; i < expected.size(); ++i) {
+                        ASSERT_NEAR(output[i], expected[i],
+                                    tolerance * std::max(1.0f, std::abs(expected[i])))
+                            << "reduce " << opType << " " << kernel.GetVariant()
+                            << " at index " << i;
+                    }
+                }
+            }
+
+            std::unique_ptr<ThreadPool> mThreadPool;
+            std::mt19937 mRandom{1};
+        };
+
+        // Test the reductions over the inner, the outer and the middle axes of small tensors,
+        // whose values are close to 1 so that the products stay in range.
+        TEST_F(ReduceKernelTests, Axes) {
+            const std::vector<int32_t> shape = {3, 5, 7, 2};
+            std::vector<float> input = RandomData(3 * 5 * 7 * 2, 0.5f, 1.5f);
+            for (const std::vector<int32_t>& axes :
+                 std::vector<std::vector<int32_t>>{{3}, {-1}, {0}, {1}, {2}, {1, 2}, {0, 3},
+                                                   {2, 0}, {0, 1, 2, 3}, {0, 2}, {1, 3}}) {
+                Check(input, shape, axes);
+            }
+        }
+
+        // Test that the dimensions of size 1 don't split the groups of reduced dimensions.
+        TEST_F(ReduceKernelTests, UnitDimensions) {
+            const std::vector<int32_t> shape = {1, 6, 1, 9, 1};
+            std::vector<float> input = RandomData(6 * 9, 0.5f, 1.5f);
+            Check(input, shape, {1, 2, 3});
+            Check(input, shape, {0, 2, 4});
+            Check(input, shape, {1, 3});
+        }
+
+        // Test reductions large enough to be split across the threads, along the reduced and
+        // the kept dimensions.
+        TEST_F(ReduceKernelTests, Large) {
+            std::vector<float> input = RandomData(4 * 40009);
+            Check(input, {4, 40009}, {1});
+            Check(input, {40009, 4}, {0});
+            Check(input, {2, 40009, 2}, {1});
+            Check(input, {4, 40009}, {0});
+        }
+
+        // Test that ArgMax and ArgMin give the first of the equal best values.
+        TEST_F(ReduceKernelTests, ArgTies) {
+            std::vector<float> input = {1, 3, 3, 0, 0, 2, 0, 3, 1, 3, 2, 0};
+            Check(input, {3, 4}, {1});
+            Check(input, {3, 4}, {0});
+            Check(input, {12}, {0});
+            Check(input, {2, 3, 2}, {0, 2});
+        }
+
+        // Test that long sums stay accurate, which a sequential float32 accumulation isn't.
+        TEST_F(ReduceKernelTests, Accuracy) {
+            const size_t count = 1 << 22;
+            std::vector<float> input(count, 0.1f);
+            ReduceKernel kernel(kInput, kOutput, op::ReduceType::kReduceSum,
+                                {static_cast<int32_t>(count)}, {0});
+            float output = NAN;
+            kernel.Compute(ExecutionContext(mThreadPool.get(), {input.data(), &output}));
+            EXPECT_NEAR(output, count * 0.1, count * 0.1 * 1e-5);
+        }
+
+        // Test the row and the column stages of every instruction set of the CPU against those
+        // of the scalar one, with counts that aren't a multiple of the vectors.
+        TEST_F(ReduceKernelTests, SimdLevels) {
+            const ElementwiseFunctions& scalar = GetElementwiseFunctions(SimdLevel::Scalar);
+            for (SimdLevel level : GetSupportedSimdLevels()) {
+                const ElementwiseFunctions& functions = GetElementwiseFunctions(level);
+                for (op::ReduceType opType : kReduceTypes) {
+                    if (opType == op::ReduceType::kReduceArgMax ||
+                        opType == op::ReduceType::kReduceArgMin) {
+                        continue;
+                    }
+                    for (size_t count : {1u, 7u, 16u, 37u, 100u}) {
+                        const size_t rows = 5, stride = count + 3;
+                        std::vector<float> x = RandomData(rows * stride, 0.5f, 1.5f);
+                        std::vector<float> expected(rows), actual(rows);
+                        scalar.reduceRows(opType, x.data(), expected.data(), rows, stride);
+                        functions.reduceRows(opType, x.data(), actual.data(), rows, stride);
+                        for (size_t i = 0; i < rows; ++i) {
+                            ASSERT_NEAR(actual[i], expected[i], 1e-4f * std::abs(expected[i]))
+                                << SimdLevelToString(level) << " rows " << opType;
+                        }
+
+                        for (bool accumulate : {false, true}) {
+                            std::vector<float> expectedColumns(count, 1.0f);
+                            std::vector<float> actualColumns(count, 1.0f);
+                            scalar.reduceColumns(opType, x.data(), stride,
+                                                 expectedColumns.data(), rows, count,
+                                                 accumulate);
+                            functions.reduceColumns(opType, x.data(), stride,
+                                                    actualColumns.data(), rows, count,
+                                                    accumulate);
+                            for (size_t i = 0; i < count; ++i) {
+                                ASSERT_NEAR(actualColumns[i], expectedColumns[i],
+                                            1e-4f * std::abs(expectedColumns[i]))
+                                    << SimdLevelToString(level) << " columns " << opType;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+    }  // namespace
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,222 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+
+        // Runs ParallelFor() over |count| items and checks that each one was visited once.
+        void ExpectEachItemOnce(ThreadPool* pool, size_t count, size_t grainSize) {
+            std::vector<std::atomic<uint32_t>> visits(count);
+            pool->ParallelFor(
+                count,
+                [&](size_t begin, size_t end) {
+                    EXPECT_LT(begin, end);
+                    for (size_t i = begin; i < end; ++i) {
+                        visits[i]++;
+                    }
+                },
+                grainSize);
+            for (size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(visits[i].load(), 1u) << "at index " << i;
+            }
+        }
+
+        // Runs |graph| and checks that each node ran once, after the nodes it depends on.
+        void ExpectRunInOrder(ThreadPool* pool, const TaskGraph& graph) {
+            size_t nodeCount = graph.dependencyCounts.size();
+            // The position of each node in the order the nodes finished, 0 until it ran.
+            std::vector<std::atomic<uint32_t>> positions(nodeCount);
+            std::atomic<uint32_t> finished{0};
+            pool->RunGraph(graph, [&](uint32_t node) {
+                ASSERT_LT(node, nodeCount);
+                for (uint32_t dependency = 0; dependency < nodeCount; ++dependency) {
+                    for (uint32_t i = graph.dependentOffsets[dependency];
+                         i < graph.dependentOffsets[dependency + 1]; ++i) {
+                        if (graph.dependents[i] == node) {
+                            EXPECT_NE(positions[dependency].load(), 0u)
+                                << "node " << node << " ran before " << dependency;
+                        }
+                    }
+                }
+                EXPECT_EQ(positions[node].exchange(++finished), 0u) << "node " << node;
+            });
+            EXPECT_EQ(finished.load(), nodeCount);
+        }
+
+        // Builds the graph of |nodeCount| nodes where |edges| are the pairs of a node and a node
+        // depending on it.
+        TaskGraph MakeGraph(uint32_t nodeCount,
+                            const std::vector<std::pair<uint32_t, uint32_t>>& edges) {
+            TaskGraph graph;
+            graph.dependencyCounts.assign(nodeCount, 0);
+            graph.dependentOffsets.assign(nodeCount + 1, 0);
+            for (const auto& [node, dependent] : edges) {
+                graph.dependencyCounts[dependent]++;
+                graph.dependentOffsets[node + 1]++;
+            }
+            for (uint32_t node = 0; node < nodeCount; ++node) {
+                graph.dependentOffsets[node + 1] += graph.dependentOffsets[node];
+            }
+            graph.dependents.resize(edges.size());
+            std::vector<uint32_t> counts(nodeCount, 0);
+            for (const auto& [node, dependent] : edges) {
+                graph.dependents[graph.dependentOffsets[node] + counts[node]++] = dependent;
+            }
+            return graph;
+        }
+
+        // Test that a pool of one thread runs everything on the calling thread.
+        TEST(ThreadPoolTests, SingleThread) {
+            ThreadPool pool(1);
+            EXPECT_EQ(pool.GetThreadCount(), 1u);
+            std::thread::id caller = std::this_thread::get_id();
+            pool.ParallelFor(100, [&](size_t, size_t) {
+                EXPECT_EQ(std::this_thread::get_id(), caller);
+            });
+            ExpectEachItemOnce(&pool, 100, 1);
+        }
+
+        // Test that ParallelFor() visits every item once for various counts and grain sizes.
+        TEST(ThreadPoolTests, ParallelFor) {
+            ThreadPool pool(4);
+            EXPECT_EQ(pool.GetThreadCount(), 4u);
+            for (size_t count : {1u, 3u, 64u, 1000u, 100003u}) {
+                for (size_t grainSize : {1u, 7u, 4096u}) {
+                    ExpectEachItemOnce(&pool, count, grainSize);
+                }
+            }
+        }
+
+        // Test that a ParallelFor() over no items doesn't run the task.
+        TEST(ThreadPoolTests, Empty) {
+            ThreadPool pool(4);
+            pool.ParallelFor(0, [](size_t, size_t) { FAIL(); });
+        }
+
+        // Test that the chunks are no smaller than the grain size, except the last one.
+        TEST(ThreadPoolTests, GrainSize) {
+            ThreadPool pool(4);
+            std::atomic<size_t> chunks{0};
+            pool.ParallelFor(
+                1000,
+                [&](size_t begin, size_t end) {
+                    if (end != 1000) {
+                        EXPECT_GE(end - begin, 300u);
+                    }
+                    chunks++;
+                },
+                300);
+            EXPECT_LE(chunks.load(), 4u);
+        }
+
+        // Test that a ParallelFor() issued from inside another one completes, even though the
+        // workers are all busy with the outer one.
+        TEST(ThreadPoolTests, Nested) {
+            ThreadPool pool(3);
+            std::atomic<size_t> total{0};
+            pool.ParallelFor(8, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    pool.ParallelFor(100, [&](size_t innerBegin, size_t innerEnd) {
+                        total += innerEnd - innerBegin;
+                    });
+                }
+            });
+            EXPECT_EQ(total.load(), 800u);
+        }
+
+        // Test that RunGraph() runs every node after the nodes it depends on, for a chain, a
+        // diamond and independent nodes.
+        TEST(ThreadPoolTests, RunGraph) {
+            for (uint32_t threadCount : {1u, 4u}) {
+                ThreadPool pool(threadCount);
+                ExpectRunInOrder(&pool, MakeGraph(0, {}));
+                ExpectRunInOrder(&pool, MakeGraph(5, {{0, 1}, {1, 2}, {2, 3}, {3, 4}}));
+                ExpectRunInOrder(&pool, MakeGraph(4, {{0, 1}, {0, 2}, {1, 3}, {2, 3}}));
+                ExpectRunInOrder(&pool, MakeGraph(100, {}));
+            }
+        }
+
+        // Test random graphs of many nodes, the edges going from lower to higher nodes.
+        TEST(ThreadPoolTests, RunRandomGraphs) {
+            ThreadPool pool(4);
+            std::mt19937 random(1);
+            for (int i = 0; i < 20; ++i) {
+                const uint32_t nodeCount = 500;
+                std::vector<std::pair<uint32_t, uint32_t>> edges;
+                for (uint32_t dependent = 1; dependent < nodeCount; ++dependent) {
+                    for (int j = random() % 4; j > 0; --j) {
+                        edges.emplace_back(random() % dependent, dependent);
+                    }
+                }
+                ExpectRunInOrder(&pool, MakeGraph(nodeCount, edges));
+            }
+        }
+
+        // Test that the nodes that are ready at the same time run concurrently: each of them
+        // waits until all of them have started.
+        TEST(ThreadPoolTests, RunGraphConcurrently) {
+            ThreadPool pool(4);
+            std::atomic<uint32_t> started{0};
+            pool.RunGraph(MakeGraph(4, {}), [&](uint32_t) {
+                started++;
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                while (started.load() < 4 && std::chrono::steady_clock::now() < deadline) {
+                    std::this_thread::yield();
+                }
+                EXPECT_EQ(started.load(), 4u);
+            });
+        }
+
+        // Test that the ParallelFor() issued from the nodes complete, sharing the workers with
+        // the other nodes.
+        TEST(ThreadPoolTests, RunGraphNested) {
+            ThreadPool pool(3);
+            std::atomic<size_t> total{0};
+            TaskGraph graph = MakeGraph(6, {{0, 1}, {0, 2}, {0, 3}, {1, 5}, {2, 5}, {3, 4}});
+            pool.RunGraph(graph, [&](uint32_t) {
+                pool.ParallelFor(1000, [&](size_t begin, size_t end) { total += end - begin; });
+            });
+            EXPECT_EQ(total.load(), 6000u);
+        }
+
+        // Test that several threads can share the pool.
+        TEST(ThreadPoolTests, ConcurrentCallers) {
+            ThreadPool pool(4);
+            std::vector<std::thread> callers;
+            for (int i = 0; i < 4; ++i) {
+                callers.emplace_back([&pool] {
+                    for (int j = 0; j < 20; ++j) {
+                        ExpectEachItemOnce(&pool, 5000, 16);
+                    }
+                });
+            }
+            for (std::thread& caller : callers) {
+                caller.join();
+            }
+        }
+
+    }  // namespace
+
+}}  // namespace dawn::native::cpu
@@ -0,0 +1,188 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "dawn/native/cpu/ThreadPoolCPU.h"
+#include "dawn/native/cpu/TransposeCPU.h"
+
+namespace dawn::native { namespace cpu {
+
+    namespace {
+
+        // The tensor ids of the kernel.
+        enum Tensor : uint32_t { kInput, kOutput };
+
+        // The instruction sets of the running CPU.
+        std::vector<SimdLevel> GetSupportedSimdLevels() {
+            std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+#if defined(WEBNN_CPU_X86)
+            if (GetSimdLevel() == SimdLevel::AVX2 || GetSimdLevel() == SimdLevel::AVX512) {
+                levels.push_back(SimdLevel::AVX2);
+            }
+            if (GetSimdLevel() == SimdLevel::AVX512) {
+                levels.push_back(SimdLevel::AVX512);
+            }
+#elif defined(WEBNN_CPU_ARM64)
+            levels.push_back(SimdLevel::NEON);
+#endif
+            return levels;
+        }
+
+        class TransposeKernelTests : public testing::Test {
+          protected:
+            void SetUp() override {
+                mThreadPool = std::make_unique<ThreadPool>(4);
+            }
+
+            // Permutes |input| of |shape| one element at a time.
+            template <typename T>
+            static std::vector<T> Reference(const std::vector<T>& input,
+                                            const std::vector<int32_t>& shape,
+                                            const std::vector<int32_t>& permutation) {
+                size_t rank = shape.size();
+                std::vector<size_t> strides(rank);
+                for (size_t d = rank, stride = 1; d-- > 0;) {
+                    strides[d] = stride;
+                    stride *= shape[d];
+                }
+                std::vector<T> output;
+                std::vector<int32_t> index(rank, 0);
+                for (size_t i = 0; i < input.size(); ++i) {
+                    size_t offset = 0;
+                    for (size_t d = 0; d < rank; ++d) {
+                        offset += index[d] * strides[permutation[d]];
+                    }
+                    output.push_back(input[offset]);
+                    for (size_t d = rank; d-- > 0;) {
+                        if (++index[d] < shape[permutation[d]]) {
+                            break;
+                        }
+                        index[d] = 0;
+                    }
+                }
+                return output;
+            }
+
+            // Checks the permutation of an input of |shape| whose elements are their indices.
+            template <typename T>
+            void Check(const std::vector<int32_t>& shape,
+                       const std::vector<int32_t>& permutation) {
+                size_t count = 1;
+                for (int32_t size : shape) {
+                    count *= size;
+                }
+                std::vector<T> input(count);
+                std::iota(input.begin(), input.end(), T(0));
+                std::vector<T> expected = Reference(input, shape, permutation);
+                TransposeKernel kernel(kInput, kOutput, sizeof(T), shape, permutation);
+                std::vector<T> output(count, T(0));
+                kernel.Compute(
+                    ExecutionContext(mThreadPool.get(), {input.data(), output.data()}));
+                for (size_t i = 0; i < count; ++i) {
+                    ASSERT_EQ(output[i], expected[i])
+                        << kernel.GetVariant() << " " << sizeof(T) << " bytes at index " << i;
+                }
+            }
+
+            // Checks |shape| permuted by |permutation| for every element size.
+            void CheckAllTypes(const std::vector<int32_t>& shape,
+                               const std::vector<int32_t>& permutation) {
+                Check<uint8_t>(shape, permutation);
+                Check<uint16_t>(shape, permutation);
+                Check<uint32_t>(shape, permutation);
+            }
+
+            std::unique_ptr<ThreadPool> mThreadPool;
+            std::mt19937 mRandom{1};
+        };
+
+        // Test the permutations that keep the innermost dimension, which are copied in runs.
+        TEST_F(TransposeKernelTests, Runs) {
+            CheckAllTypes({2, 3, 4}, {0, 1, 2});
+            CheckAllTypes({2, 3, 4}, {1, 0, 2});
+            CheckAllTypes({5, 6, 7, 8}, {2, 0, 1, 3});
+            CheckAllTypes({3, 4, 5, 6}, {1, 2, 0, 3});
+        }
+
+        // Test the permutations that move the innermost dimension, which are transposed in
+        // tiles, with sizes that aren't a multiple of the tiles or of the vectors.
+        TEST_F(TransposeKernelTests, Tiles) {
+            CheckAllTypes({17, 23}, {1, 0});
+            CheckAllTypes({130, 67}, {1, 0});
+            CheckAllTypes({2, 3, 4}, {2, 1, 0});
+            CheckAllTypes({2, 9, 10, 11}, {0, 2, 3, 1});
+            CheckAllTypes({2, 11, 10, 9}, {0, 3, 1, 2});
+            CheckAllTypes({3, 70, 5, 40}, {3, 1, 2, 0});
+        }
+
+        // Test that the dimensions of size 1 are dropped and that the adjacent ones are merged,
+        // including when every dimension merges into one.
+        TEST_F(TransposeKernelTests, SimplifiedDimensions) {
+            CheckAllTypes({1, 5, 1, 7}, {3, 2, 1, 0});
+            CheckAllTypes({4, 1, 6}, {1, 0, 2});
+            CheckAllTypes({1, 1, 1}, {2, 0, 1});
+            CheckAllTypes({4, 5, 6, 7}, {2, 3, 0, 1});
+            CheckAllTypes({4, 5, 6, 7}, {3, 0, 1, 2});
+        }
+
+        // Test random shapes and permutations of up to 6 dimensions.
+        TEST_F(TransposeKernelTests, Random) {
+            for (int i = 0; i < 50; ++i) {
+                size_t rank = std::uniform_int_distribution<size_t>(1, 6)(mRandom);
+                std::vector<int32_t> shape(rank);
+                for (int32_t& size : shape) {
+                    size = std::uniform_int_distribution<int32_t>(1, 9)(mRandom);
+                }
+                std::vector<int32_t> permutation(rank);
+                std::iota(permutation.begin(), permutation.end(), 0);
+                std::shuffle(permutation.begin(), permutation.end(), mRandom);
+                CheckAllTypes(shape, permutation);
+            }
+        }
+
+        // Test the transpose of every instruction set of the CPU, with strided matrices whose
+        // sizes aren't a multiple of the registers.
+        TEST_F(TransposeKernelTests, SimdLevels) {
+            for (SimdLevel level : GetSupportedSimdLevels()) {
+                const ElementwiseFunctions& functions = GetElementwiseFunctions(level);
+                for (auto [rows, cols] :
+                     {std::make_pair(1, 1), std::make_pair(4, 4), std::make_pair(8, 8),
+                      std::make_pair(16, 16), std::make_pair(5, 19), std::make_pair(33, 17),
+                      std::make_pair(64, 64)}) {
+                    const size_t xStride = cols + 3, yStride = rows + 5;
+                    std::vector<float> x(rows * xStride);
+                    std::iota(x.begin(), x.end(), 0.0f);
+                    std::vector<float> y(cols * yStride, -1.0f);
+                    functions.transpose(x.data(), xStride, y.data(), yStride, rows, cols);
+                    for (int32_t c = 0; c < cols; ++c) {
+                        for (size_t r = 0; r < yStride; ++r) {
+                            float expected = r < static_cast<size_t>(rows) ? x[r * xStride + c]
+                                                                           : -1.0f;
+                            ASSERT_EQ(y[c * yStride + r], expected)
+                                << SimdLevelToString(level) << " " << rows << "x" << cols;
+                        }
+                    }
+                }
+            }
+        }
+
+    }  // namespace
+
+}}  // namespace dawn::native::cpu
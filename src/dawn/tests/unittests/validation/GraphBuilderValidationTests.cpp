@@ -0,0 +1,102 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/unittests/validation/ValidationTest.h"
+
+#include <vector>
+
+class GraphBuilderValidationTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+        builder = device.CreateGraphBuilder();
+    }
+
+    wgpu::Operand Input(const std::vector<int32_t>& shape, char const* name = "input") {
+        wgpu::OperandDescriptor desc = {wgpu::OperandType::Float32, shape.data(),
+                                        static_cast<uint32_t>(shape.size())};
+        return builder.Input(name, &desc);
+    }
+
+    wgpu::Operand Pad(const wgpu::Operand& input,
+                      const std::vector<uint32_t>& padding,
+                      wgpu::PaddingMode mode) {
+        wgpu::PadOptions options = {};
+        options.mode = mode;
+        return builder.Pad(input, padding.data(), padding.size(), &options);
+    }
+
+    wgpu::Operand MaxPool2d(const wgpu::Operand& input,
+                            const std::vector<int32_t>& windowDimensions,
+                            const std::vector<int32_t>& dilations,
+                            const std::vector<int32_t>& padding = {0, 0, 0, 0}) {
+        wgpu::Pool2dOptions options = {};
+        options.windowDimensions = windowDimensions.data();
+        options.windowDimensionsCount = windowDimensions.size();
+        options.dilations = dilations.data();
+        options.dilationsCount = dilations.size();
+        options.padding = padding.data();
+        options.paddingCount = padding.size();
+        return builder.MaxPool2d(input, &options);
+    }
+
+    wgpu::GraphBuilder builder;
+};
+
+// Test that the padding must have two values per dimension of the input.
+TEST_F(GraphBuilderValidationTest, PadPaddingCount) {
+    wgpu::Operand input = Input({2, 3});
+    Pad(input, {1, 1, 1, 1}, wgpu::PaddingMode::Constant);
+    ASSERT_DEVICE_ERROR(Pad(input, {1, 1}, wgpu::PaddingMode::Constant));
+    ASSERT_DEVICE_ERROR(Pad(input, {1, 1, 1, 1, 1, 1}, wgpu::PaddingMode::Constant));
+}
+
+// Test that the reflection padding must be less than the size of the dimension, as the edge
+// isn't repeated.
+TEST_F(GraphBuilderValidationTest, PadReflectionPadding) {
+    wgpu::Operand input = Input({1, 2});
+    Pad(input, {0, 0, 1, 1}, wgpu::PaddingMode::Reflection);
+    ASSERT_DEVICE_ERROR(Pad(input, {0, 0, 2, 0}, wgpu::PaddingMode::Reflection));
+    ASSERT_DEVICE_ERROR(Pad(input, {0, 0, 0, 2}, wgpu::PaddingMode::Reflection));
+    ASSERT_DEVICE_ERROR(Pad(input, {0, 0, 3, 3}, wgpu::PaddingMode::Reflection));
+    ASSERT_DEVICE_ERROR(Pad(input, {1, 0, 0, 0}, wgpu::PaddingMode::Reflection));
+}
+
+// Test that the symmetric padding must not exceed the size of the dimension.
+TEST_F(GraphBuilderValidationTest, PadSymmetricPadding) {
+    wgpu::Operand input = Input({1, 2});
+    Pad(input, {1, 1, 2, 2}, wgpu::PaddingMode::Symmetric);
+    ASSERT_DEVICE_ERROR(Pad(input, {0, 0, 3, 0}, wgpu::PaddingMode::Symmetric));
+    ASSERT_DEVICE_ERROR(Pad(input, {0, 2, 0, 0}, wgpu::PaddingMode::Symmetric));
+}
+
+// Test that the constant and edge modes accept any padding.
+TEST_F(GraphBuilderValidationTest, PadConstantAndEdgePadding) {
+    wgpu::Operand input = Input({1, 2});
+    Pad(input, {4, 4, 5, 5}, wgpu::PaddingMode::Constant);
+    Pad(input, {4, 4, 5, 5}, wgpu::PaddingMode::Edge);
+}
+
+// Test that the output of Pool2d covers the dilated window, which the input must fit once padded.
+TEST_F(GraphBuilderValidationTest, Pool2dDilatedShape) {
+    wgpu::Operand input = Input({1, 2, 7, 8});
+    // The 3x3 window dilated by 2x3 spans 5x7 values, leaving a 3x2 output.
+    wgpu::Operand output = MaxPool2d(input, {3, 3}, {2, 3});
+    builder.Add(output, Input({1, 2, 3, 2}, "other"));
+    ASSERT_DEVICE_ERROR(builder.Add(output, Input({1, 2, 5, 6}, "other")));
+    // The padding widens the input for the dilated window.
+    MaxPool2d(input, {3, 3}, {4, 4}, {1, 1, 0, 1});
+    ASSERT_DEVICE_ERROR(MaxPool2d(input, {3, 3}, {4, 4}));
+    ASSERT_DEVICE_ERROR(MaxPool2d(input, {3, 3}, {1, 5}));
+}